@@ -213,6 +213,14 @@ EGLAPI EGLint EGLAPIENTRY eglProgramCacheResizeANGLE(EGLDisplay dpy, EGLint limi
 #endif
 #endif /* EGL_ANGLE_program_cache_control */
 
+#ifndef EGL_ANGLE_program_cache_statistics
+#define EGL_ANGLE_program_cache_statistics 1
+/* From the 0x34A0 block reserved for ANGLE.  See issue 2 of the extension. */
+#define EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE 0x34A6
+#define EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE 0x34A7
+#define EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE 0x34A8
+#endif /* EGL_ANGLE_program_cache_statistics */
+
 #ifndef EGL_ANGLE_iosurface_client_buffer
 #define EGL_ANGLE_iosurface_client_buffer 1
 #define EGL_IOSURFACE_ANGLE 0x3454
@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 246
+#define ANGLE_SH_VERSION 247
 
 enum ShShaderSpec
 {
@@ -348,6 +348,11 @@ const ShCompileOptions SH_FORCE_SHADER_PRECISION_HIGHP_TO_MEDIUMP = UINT64_C(1)
 // Allow compiler to use specialization constant to do pre-rotation and y flip.
 const ShCompileOptions SH_USE_ROTATION_SPECIALIZATION_CONSTANT = UINT64_C(1) << 58;
 
+// Record the time spent in each phase of the compilation: preprocessing, parsing, each pass over
+// the AST and the translation by the output backend.  See sh::GetCompileTimings().  Timing the
+// preprocessor adds some overhead to the preprocessing and parsing phases.
+const ShCompileOptions SH_RECORD_COMPILE_TIMINGS = UINT64_C(1) << 59;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -602,6 +607,17 @@ using ShHandle = void *;
 namespace sh
 {
 
+// The time spent in a phase of the compilation, recorded with SH_RECORD_COMPILE_TIMINGS.
+struct CompileTiming
+{
+    // "Preprocess", "Parse", the name of a pass over the AST, or "Translate" for the output
+    // backend.  The passes the output backend runs over the AST are reported on their own and are
+    // not part of "Translate".  Passes done in a single traversal of the AST have their names
+    // joined with '+'.
+    std::string phase;
+    double seconds;
+};
+
 //
 // Driver must call this first, once, before doing any other compiler operations.
 // If the function succeeds, the return value is true, else false.
@@ -723,6 +739,10 @@ bool HasEarlyFragmentTestsOptimization(const ShHandle handle);
 // Returns specialization constant usage bits
 uint32_t GetShaderSpecConstUsageBits(const ShHandle handle);
 
+// Returns the time spent in each phase of the last compilation, in the order the phases ran.  The
+// list is empty unless the shader was compiled with SH_RECORD_COMPILE_TIMINGS.
+const std::vector<CompileTiming> *GetCompileTimings(const ShHandle handle);
+
 // Returns true if the passed in variables pack in maxVectors followingthe packing rules from the
 // GLSL 1.017 spec, Appendix A, section 7.
 // Returns false otherwise. Also look at the SH_ENFORCE_PACKING_RESTRICTIONS
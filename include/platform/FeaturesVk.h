@@ -84,6 +84,10 @@ struct FeaturesVk : FeatureSetBase
                                    "VkDevice supports the VK_KHR_create_renderpass2 extension",
                                    &members};
 
+    Feature supportsDescriptorUpdateTemplate = {
+        "supportsDescriptorUpdateTemplate", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_descriptor_update_template extension", &members};
+
     // Whether the VkDevice supports the VK_KHR_incremental_present extension, on which the
     // EGL_KHR_swap_buffers_with_damage extension can be layered.
     Feature supportsIncrementalPresent = {
@@ -347,6 +351,39 @@ struct FeaturesVk : FeatureSetBase
                                  "Use CommandQueue worker thread to dispatch work to GPU.",
                                  &members, "http://anglebug.com/4324"};
 
+    // Create graphics pipelines on worker threads.  A draw that needs a pipeline that is still
+    // being created is recorded right away, and the pipeline is waited on only when the render pass
+    // is flushed.
+    Feature asyncGraphicsPipelineCompilation = {
+        "asyncGraphicsPipelineCompilation", FeatureCategory::VulkanFeatures,
+        "Create graphics pipelines on worker threads.", &members};
+
+    // Split large render passes into chunks that are recorded into secondary command buffers on
+    // worker threads, instead of replaying all of their commands into the primary command buffer
+    // on one thread.  Only has an effect with ANGLE's own secondary command buffers.
+    Feature parallelRenderPassCommandRecording = {
+        "parallelRenderPassCommandRecording", FeatureCategory::VulkanFeatures,
+        "Record large render passes into secondary command buffers on worker threads.", &members};
+
+    // Record the graphics pipeline states used with each program in the blob cache, and recreate
+    // them on worker threads when the same program is linked again so the first draw call does
+    // not create them.
+    Feature warmUpGraphicsPipelines = {
+        "warmUpGraphicsPipelines", FeatureCategory::VulkanFeatures,
+        "Record used graphics pipelines per program and recreate them at link time.", &members};
+
+    // Convert the pixels of large texture uploads that need a format conversion on worker threads,
+    // directly into the staging buffer.
+    Feature parallelTextureLoad = {
+        "parallelTextureLoad", FeatureCategory::VulkanFeatures,
+        "Convert the pixels of large texture uploads on worker threads.", &members};
+
+    // Write the texture descriptor set of a program with a descriptor update template created at
+    // link time, instead of assembling a VkWriteDescriptorSet per sampler on every update.
+    Feature useDescriptorUpdateTemplates = {
+        "useDescriptorUpdateTemplates", FeatureCategory::VulkanFeatures,
+        "Update texture descriptor sets with descriptor update templates.", &members};
+
     // Whether the VkDevice supports the VK_KHR_shader_float16_int8 extension and has the
     // shaderFloat16 feature.
     Feature supportsShaderFloat16 = {"supportsShaderFloat16", FeatureCategory::VulkanFeatures,
@@ -65,6 +65,28 @@ struct FrontendFeatures : angle::FeatureSetBase
     angle::Feature allowCompressedFormats = {"allow_compressed_formats",
                                              angle::FeatureCategory::FrontendWorkarounds,
                                              "Allow compressed formats", &members};
+
+    // When the program cache is full, evict the least recently used programs that were hit the
+    // fewest times per byte instead of strictly the least recently used one.
+    angle::Feature sizeAwareBlobCacheEviction = {
+        "size_aware_blob_cache_eviction", angle::FeatureCategory::FrontendFeatures,
+        "Evict rarely used large blobs from the program cache before frequently used small ones",
+        &members};
+
+    // Let a worker thread of each context execute its GL calls that don't return anything, with
+    // copies of the client memory they take.  Ignored by back-ends that bind a native context to
+    // the thread making the calls; see DisplayImpl::supportsDeferredGLCalls.
+    angle::Feature deferGLCalls = {
+        "defer_gl_calls", angle::FeatureCategory::FrontendFeatures,
+        "Execute the GL calls that don't return data on a worker thread of the context",
+        &members};
+
+    // Look shaders up in the shader cache before translating them, and store their translation
+    // there afterwards.
+    angle::Feature cacheTranslatedShaders = {
+        "cache_translated_shaders", angle::FeatureCategory::FrontendFeatures,
+        "Reuse the translation of shaders compiled before with the same source and options",
+        &members};
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
@@ -106,6 +106,9 @@ int main(int argc, char *argv[])
                 case 'p':
                     resources.WEBGL_debug_shader_precision = 1;
                     break;
+                case 't':
+                    compileOptions |= SH_RECORD_COMPILE_TIMINGS;
+                    break;
                 case 's':
                     if (argv[0][2] == '=')
                     {
@@ -344,6 +347,16 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
                     printf("\n\n");
                 }
+                if (compiled && (compileOptions & SH_RECORD_COMPILE_TIMINGS))
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "TIMINGS");
+                    for (const sh::CompileTiming &timing : *sh::GetCompileTimings(compiler))
+                    {
+                        printf("%s: %.3f ms\n", timing.phase.c_str(), timing.seconds * 1000.0);
+                    }
+                    LogMsg("END", "COMPILER", numCompiles, "TIMINGS");
+                    printf("\n\n");
+                }
                 if (!compiled)
                     failCode = EFailCompile;
                 ++numCompiles;
@@ -382,12 +395,13 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -l -p -t -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
         "       -p       : use precision emulation\n"
+        "       -t       : print the time spent in each phase of the compilation\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec\n"
         "       -s=e31   : use GLES31 spec (in development)\n"
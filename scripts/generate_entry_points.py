@@ -8,7 +8,7 @@
 #   Generates the OpenGL bindings and entry point layers for ANGLE.
 #   NOTE: don't run this script directly. Run scripts/run_code_generation.py.
 
-import sys, os, pprint, json
+import sys, os, pprint, json, re
 from datetime import date
 import registry_xml
 
@@ -171,7 +171,7 @@ void GL_APIENTRY {name}{explicit_context_suffix}({explicit_context_param}{explic
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
     if ({valid_context_check})
-    {{{assert_explicit_context}{packed_gl_enum_conversions}
+    {{{assert_explicit_context}{defer_call}{packed_gl_enum_conversions}
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
         if (isCallValid)
@@ -1208,6 +1208,136 @@ def get_def_template(api, return_type):
             return TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN
 
 
+# Calls that don't return anything but still have to be executed on the calling thread.
+DEFERRED_CALL_SYNCHRONOUS_CMDS = [
+    "glFinish",
+]
+
+# Parameter types that refer to memory or to objects owned by the caller.
+DEFERRED_CALL_NON_VALUE_TYPES = [
+    "GLsync",
+    "GLeglImageOES",
+    "GLeglClientBufferEXT",
+    "GLDEBUGPROC",
+    "GLDEBUGPROCKHR",
+]
+
+# Calls that are only deferred when the condition holds.  The debug callback is called from the
+# calls themselves once GL_DEBUG_OUTPUT_SYNCHRONOUS is enabled, so changing it isn't deferred.
+DEFERRED_CALL_CONDITIONS = {
+    "glEnable": "cap != GL_DEBUG_OUTPUT_SYNCHRONOUS",
+    "glDisable": "cap != GL_DEBUG_OUTPUT_SYNCHRONOUS",
+}
+
+# Calls that can change whether the draw calls read client memory, when the condition holds.
+DEFERRED_CALL_VERTEX_STATE_CMDS = {
+    "glBindBuffer": "target == GL_ELEMENT_ARRAY_BUFFER",
+    "glBindVertexArray": "true",
+    "glBindVertexArrayOES": "true",
+    "glBindVertexBuffer": "true",
+    "glDisableClientState": "true",
+    "glDisableVertexArrayAttrib": "true",
+    "glDisableVertexAttribArray": "true",
+    "glEnableClientState": "true",
+    "glEnableVertexArrayAttrib": "true",
+    "glEnableVertexAttribArray": "true",
+    "glVertexArrayElementBuffer": "true",
+    "glVertexArrayVertexBuffer": "true",
+    "glVertexAttribBinding": "true",
+    "glVertexAttribIPointer": "true",
+    "glVertexAttribPointer": "true",
+}
+
+# Pointer parameters that are kept by the context as they are.  They are either an offset into a
+# buffer or client memory the draw calls read.
+DEFERRED_CALL_POINTER_VALUE_PARAMS = {
+    "glVertexAttribIPointer": ["pointer"],
+    "glVertexAttribPointer": ["pointer"],
+}
+
+# Pointer parameters copied into the queue, with their element count and size, as in the
+# capture_gles_*_params.cpp functions.
+DEFERRED_CALL_COPIED_PARAMS = {
+    "glBufferData": {
+        "data": ("size", "1")
+    },
+    "glBufferSubData": {
+        "data": ("size", "1")
+    },
+}
+
+DEFERRED_CALL_UNIFORM_TYPES = {
+    "f": "GLfloat",
+    "i": "GLint",
+    "ui": "GLuint",
+    "d": "GLdouble",
+}
+
+
+def get_deferred_copied_param(cmd_name, param_name):
+    if cmd_name in DEFERRED_CALL_COPIED_PARAMS:
+        return DEFERRED_CALL_COPIED_PARAMS[cmd_name].get(param_name)
+
+    # glUniform*v and glProgramUniform*v.
+    match = re.match(r"^gl(?:Program)?Uniform(Matrix)?([1234])(?:x([234]))?(f|i|ui|d)v(?:EXT)?$",
+                     cmd_name)
+    if match and param_name == "value":
+        is_matrix, columns, rows, uniform_type = match.groups()
+        components = int(columns) * int(rows or (columns if is_matrix else 1))
+        element_size = "sizeof(%s)" % DEFERRED_CALL_UNIFORM_TYPES[uniform_type]
+        if components > 1:
+            element_size = "%d * %s" % (components, element_size)
+        return ("count", element_size)
+
+    return None
+
+
+def is_deferred_draw_cmd(cmd_name):
+    return re.match(r"^glDraw(Arrays|Elements|RangeElements|TransformFeedback)", cmd_name) and \
+        "Indirect" not in cmd_name
+
+
+def get_defer_call(cmd_name, return_type, params, is_explicit_context):
+    if return_type.strip() != "void" or cmd_name in DEFERRED_CALL_SYNCHRONOUS_CMDS:
+        return ""
+    if is_context_lost_acceptable_cmd(cmd_name):
+        return ""
+
+    param_args = []
+    for param in params:
+        param_name = just_the_name(param)
+        if just_the_type(param).strip() in DEFERRED_CALL_NON_VALUE_TYPES or "[" in param:
+            return ""
+        if "*" not in param or param_name in DEFERRED_CALL_POINTER_VALUE_PARAMS.get(cmd_name, []):
+            param_args.append(param_name)
+            continue
+        # The indices of the draw calls are copied unless an element array buffer is bound.
+        if is_deferred_draw_cmd(cmd_name) and param_name == "indices":
+            param_args.append("context->copyDeferredIndices(indices, count, type)")
+            continue
+        copied_param = get_deferred_copied_param(cmd_name, param_name)
+        if not copied_param:
+            return ""
+        param_args.append("DeferredCallQueue::Copy(%s, %s, %s)" %
+                          ((param_name,) + copied_param))
+
+    name = strip_api_prefix(cmd_name) + ("ContextANGLE" if is_explicit_context else "")
+    args = ["context", name] + (["ctx"] if is_explicit_context else []) + param_args
+
+    if cmd_name in DEFERRED_CALL_VERTEX_STATE_CMDS:
+        macro = "ANGLE_DEFER_VERTEX_STATE_CALL"
+        args = [DEFERRED_CALL_VERTEX_STATE_CMDS[cmd_name]] + args
+    elif cmd_name in DEFERRED_CALL_CONDITIONS:
+        macro = "ANGLE_DEFER_CALL_IF"
+        args = [DEFERRED_CALL_CONDITIONS[cmd_name]] + args
+    elif is_deferred_draw_cmd(cmd_name):
+        macro = "ANGLE_DEFER_CALL_IF"
+        args = ["context->canDeferDraw()"] + args
+    else:
+        macro = "ANGLE_DEFER_CALL"
+    return "\n        %s(%s);" % (macro, ", ".join(args))
+
+
 def format_entry_point_def(api, command_node, cmd_name, proto, params, is_explicit_context,
                            cmd_packed_enums, packed_param_types, egl_ep_to_object):
     packed_enums = get_packed_enums(api, cmd_packed_enums, cmd_name, packed_param_types, params)
@@ -1267,6 +1397,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, is_explic
             ", " if is_explicit_context and len(params) > 0 else "",
         "assert_explicit_context":
             "\nASSERT(context == GetValidGlobalContext());" if is_explicit_context else "",
+        "defer_call":
+            get_defer_call(cmd_name, return_type, params, is_explicit_context),
         "labeled_object":
             get_egl_entry_point_labeled_object(egl_ep_to_object, cmd_name, params, packed_enums)
     }
@@ -0,0 +1,158 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BoundedMPSCQueue.h:
+//   A fixed capacity, lock-free queue with multiple producers and a single consumer.
+//
+
+#ifndef COMMON_BOUNDEDMPSCQUEUE_H_
+#define COMMON_BOUNDEDMPSCQUEUE_H_
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace angle
+{
+// Ring buffer where each slot carries a sequence number that tells producers and the consumer
+// whose turn it is to use the slot.  Producers claim a slot by advancing the enqueue position with
+// a compare-and-swap and then publish the element by bumping the slot's sequence number, so
+// elements are consumed in the order the slots were claimed.  tryPush fails if the queue is full
+// and tryPop fails if the next element is not yet published; callers decide how to wait.
+//
+// T must be default constructible and move assignable.  Popped slots keep a moved-from T until
+// they are reused.
+template <class T, size_t N>
+class BoundedMPSCQueue final : angle::NonCopyable
+{
+  public:
+    static_assert(N > 1 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+    BoundedMPSCQueue();
+    ~BoundedMPSCQueue();
+
+    // Can be called from any thread.
+    bool tryPush(T &&value);
+
+    // Must only be called from the consumer thread.
+    bool tryPop(T *valueOut);
+
+    // Can be called from any thread.  The result may be stale by the time it is used, unless the
+    // caller otherwise knows that no other thread is pushing or popping.
+    bool empty() const;
+    size_t size() const;
+
+    static constexpr size_t capacity() { return N; }
+
+  private:
+    static constexpr size_t kMask = N - 1;
+
+    // Pad the positions apart so producers and the consumer do not contend on the same cache line.
+    // Padding is used instead of alignas so the queue can be embedded in heap allocated objects
+    // without requiring over-aligned new.
+    static constexpr size_t kCacheLineSize = 64;
+    static constexpr size_t kPaddingSize   = kCacheLineSize - sizeof(std::atomic<size_t>);
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::atomic<size_t> mEnqueuePosition;
+    uint8_t mEnqueuePadding[kPaddingSize];
+    std::atomic<size_t> mDequeuePosition;
+    uint8_t mDequeuePadding[kPaddingSize];
+    std::array<Slot, N> mSlots;
+};
+
+template <class T, size_t N>
+BoundedMPSCQueue<T, N>::BoundedMPSCQueue() : mEnqueuePosition(0), mDequeuePosition(0)
+{
+    for (size_t index = 0; index < N; ++index)
+    {
+        mSlots[index].sequence.store(index, std::memory_order_relaxed);
+    }
+}
+
+template <class T, size_t N>
+BoundedMPSCQueue<T, N>::~BoundedMPSCQueue() = default;
+
+template <class T, size_t N>
+bool BoundedMPSCQueue<T, N>::tryPush(T &&value)
+{
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot *slot      = nullptr;
+
+    while (true)
+    {
+        slot                  = &mSlots[position & kMask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t diff   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (diff == 0)
+        {
+            // The slot is free; try to claim it.  On failure, |position| is reloaded.
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                       std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The consumer has not yet released this slot from the previous lap: full.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot first.
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->value = std::move(value);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T, size_t N>
+bool BoundedMPSCQueue<T, N>::tryPop(T *valueOut)
+{
+    const size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+    Slot *slot            = &mSlots[position & kMask];
+
+    if (slot->sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        // Either empty, or the producer that claimed this slot has not published it yet.
+        return false;
+    }
+
+    *valueOut = std::move(slot->value);
+    slot->sequence.store(position + N, std::memory_order_release);
+    mDequeuePosition.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T, size_t N>
+bool BoundedMPSCQueue<T, N>::empty() const
+{
+    return size() == 0;
+}
+
+template <class T, size_t N>
+size_t BoundedMPSCQueue<T, N>::size() const
+{
+    const size_t dequeuePosition = mDequeuePosition.load(std::memory_order_acquire);
+    const size_t enqueuePosition = mEnqueuePosition.load(std::memory_order_acquire);
+    return enqueuePosition - dequeuePosition;
+}
+}  // namespace angle
+
+#endif  // COMMON_BOUNDEDMPSCQUEUE_H_
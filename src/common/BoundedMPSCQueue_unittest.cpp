@@ -0,0 +1,132 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BoundedMPSCQueue_unittest:
+//   Tests of the BoundedMPSCQueue class
+//
+
+#include <gtest/gtest.h>
+
+#include "common/BoundedMPSCQueue.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace angle
+{
+// Make sure elements come out in the order they were pushed.
+TEST(BoundedMPSCQueue, PushPop)
+{
+    BoundedMPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(&value));
+
+    // Go around the ring a few times.
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        EXPECT_TRUE(queue.tryPush(lap * 10 + 1));
+        EXPECT_TRUE(queue.tryPush(lap * 10 + 2));
+        EXPECT_EQ(2u, queue.size());
+
+        EXPECT_TRUE(queue.tryPop(&value));
+        EXPECT_EQ(lap * 10 + 1, value);
+        EXPECT_TRUE(queue.tryPop(&value));
+        EXPECT_EQ(lap * 10 + 2, value);
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+// Make sure pushing fails when the queue is full and succeeds again once an element is popped.
+TEST(BoundedMPSCQueue, Full)
+{
+    BoundedMPSCQueue<int, 4> queue;
+    for (int index = 0; index < 4; ++index)
+    {
+        EXPECT_TRUE(queue.tryPush(std::move(index)));
+    }
+    EXPECT_EQ(4u, queue.size());
+    EXPECT_FALSE(queue.tryPush(4));
+
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(0, value);
+    EXPECT_TRUE(queue.tryPush(4));
+
+    for (int expected = 1; expected <= 4; ++expected)
+    {
+        EXPECT_TRUE(queue.tryPop(&value));
+        EXPECT_EQ(expected, value);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Make sure move-only types are moved through the queue.
+TEST(BoundedMPSCQueue, MoveOnly)
+{
+    BoundedMPSCQueue<std::unique_ptr<int>, 2> queue;
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(5)));
+
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(queue.tryPop(&value));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(5, *value);
+}
+
+// Push from several threads at once and make sure every element arrives exactly once, and that the
+// elements of each producer arrive in order.
+TEST(BoundedMPSCQueue, MultipleProducers)
+{
+    constexpr uint32_t kProducerCount     = 4;
+    constexpr uint32_t kValuesPerProducer = 10000;
+
+    BoundedMPSCQueue<uint32_t, 64> queue;
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < kProducerCount; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (uint32_t index = 0; index < kValuesPerProducer; ++index)
+            {
+                uint32_t value = producer * kValuesPerProducer + index;
+                while (!queue.tryPush(std::move(value)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> nextExpected(kProducerCount, 0);
+    for (uint32_t received = 0; received < kProducerCount * kValuesPerProducer;)
+    {
+        uint32_t value = 0;
+        if (!queue.tryPop(&value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const uint32_t producer = value / kValuesPerProducer;
+        ASSERT_LT(producer, kProducerCount);
+        EXPECT_EQ(nextExpected[producer], value % kValuesPerProducer);
+        ++nextExpected[producer];
+        ++received;
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    for (uint32_t producer = 0; producer < kProducerCount; ++producer)
+    {
+        EXPECT_EQ(kValuesPerProducer, nextExpected[producer]);
+    }
+}
+}  // namespace angle
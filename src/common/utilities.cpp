@@ -11,6 +11,8 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
@@ -20,14 +22,19 @@
 #    include <wrl/wrappers/corewrappers.h>
 #endif
 
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_INDEX_RANGE_USE_NEON
+#endif
+
 namespace
 {
 
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+gl::IndexRange ComputeTypedIndexRangeScalar(const IndexType *indices,
+                                            size_t count,
+                                            bool primitiveRestartEnabled,
+                                            GLuint primitiveRestartIndex)
 {
     ASSERT(count > 0);
 
@@ -51,7 +58,7 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
         }
 
         // Loop over the rest of the indices
-        for (; i < count; i++)
+        for (i++; i < count; i++)
         {
             if (indices[i] != primitiveRestartIndex)
             {
@@ -90,6 +97,289 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_INDEX_RANGE_USE_NEON)
+#    define ANGLE_INDEX_RANGE_VECTORIZED
+
+// Below this many indices, reducing the vector lanes costs more than the scalar loop.
+constexpr size_t kMinVectorizedIndexCount = 64;
+
+// Restart lane counters are flushed before an 8-bit lane can overflow.
+constexpr size_t kMaxRestartLaneCount = 255;
+
+// Each *Lanes struct wraps the instructions the vectorized scan needs for one index type.  Min and
+// Max compare lanes as unsigned values.
+#    if defined(ANGLE_USE_SSE)
+struct SSE2LanesBase
+{
+    using Vector = __m128i;
+
+    static Vector Load(const void *src)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    }
+    static void Store(void *dst, Vector value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), value);
+    }
+    static Vector Zero() { return _mm_setzero_si128(); }
+    static Vector AllOnes() { return _mm_set1_epi32(-1); }
+    static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    // Returns |value| with the lanes set in |mask| cleared.
+    static Vector AndNot(Vector mask, Vector value) { return _mm_andnot_si128(mask, value); }
+};
+
+template <typename IndexType>
+struct SSE2Lanes;
+
+template <>
+struct SSE2Lanes<GLubyte> : SSE2LanesBase
+{
+    static Vector Splat(GLubyte value) { return _mm_set1_epi8(static_cast<char>(value)); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epu8(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epu8(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_epi8(a, b); }
+};
+
+// SSE2 only has signed 16-bit min and max, so the sign bit is flipped around them.
+template <>
+struct SSE2Lanes<GLushort> : SSE2LanesBase
+{
+    static Vector Splat(GLushort value) { return _mm_set1_epi16(static_cast<short>(value)); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi16(a, b); }
+    static Vector Min(Vector a, Vector b)
+    {
+        const Vector signBit = _mm_set1_epi16(-0x8000);
+        return _mm_xor_si128(
+            _mm_min_epi16(_mm_xor_si128(a, signBit), _mm_xor_si128(b, signBit)), signBit);
+    }
+    static Vector Max(Vector a, Vector b)
+    {
+        const Vector signBit = _mm_set1_epi16(-0x8000);
+        return _mm_xor_si128(
+            _mm_max_epi16(_mm_xor_si128(a, signBit), _mm_xor_si128(b, signBit)), signBit);
+    }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_epi16(a, b); }
+};
+
+// SSE2 has no 32-bit min or max, so lanes are selected with a signed compare after flipping the
+// sign bit.
+template <>
+struct SSE2Lanes<GLuint> : SSE2LanesBase
+{
+    static Vector Splat(GLuint value) { return _mm_set1_epi32(static_cast<int>(value)); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi32(a, b); }
+    static Vector Greater(Vector a, Vector b)
+    {
+        const Vector signBit = _mm_set1_epi32(std::numeric_limits<int>::min());
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, signBit), _mm_xor_si128(b, signBit));
+    }
+    static Vector Min(Vector a, Vector b)
+    {
+        const Vector aGreater = Greater(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    static Vector Max(Vector a, Vector b)
+    {
+        const Vector aGreater = Greater(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_epi32(a, b); }
+};
+
+template <typename IndexType>
+using VectorLanes = SSE2Lanes<IndexType>;
+
+bool SupportsVectorLanes()
+{
+#        if defined(_M_X64) || defined(__x86_64__)
+    // SSE2 is part of the x86-64 baseline.
+    return true;
+#        else
+    return gl::supportsSSE2();
+#        endif
+}
+#    elif defined(ANGLE_INDEX_RANGE_USE_NEON)
+template <typename IndexType>
+struct NEONLanes;
+
+template <>
+struct NEONLanes<GLubyte>
+{
+    using Vector = uint8x16_t;
+
+    static Vector Load(const GLubyte *src) { return vld1q_u8(src); }
+    static void Store(GLubyte *dst, Vector value) { vst1q_u8(dst, value); }
+    static Vector Zero() { return vdupq_n_u8(0); }
+    static Vector AllOnes() { return vdupq_n_u8(0xFF); }
+    static Vector Or(Vector a, Vector b) { return vorrq_u8(a, b); }
+    static Vector AndNot(Vector mask, Vector value) { return vbicq_u8(value, mask); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_u8(a, b); }
+};
+
+template <>
+struct NEONLanes<GLushort>
+{
+    using Vector = uint16x8_t;
+
+    static Vector Load(const GLushort *src) { return vld1q_u16(src); }
+    static void Store(GLushort *dst, Vector value) { vst1q_u16(dst, value); }
+    static Vector Zero() { return vdupq_n_u16(0); }
+    static Vector AllOnes() { return vdupq_n_u16(0xFFFF); }
+    static Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+    static Vector AndNot(Vector mask, Vector value) { return vbicq_u16(value, mask); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_u16(a, b); }
+};
+
+template <>
+struct NEONLanes<GLuint>
+{
+    using Vector = uint32x4_t;
+
+    static Vector Load(const GLuint *src) { return vld1q_u32(src); }
+    static void Store(GLuint *dst, Vector value) { vst1q_u32(dst, value); }
+    static Vector Zero() { return vdupq_n_u32(0); }
+    static Vector AllOnes() { return vdupq_n_u32(0xFFFFFFFF); }
+    static Vector Or(Vector a, Vector b) { return vorrq_u32(a, b); }
+    static Vector AndNot(Vector mask, Vector value) { return vbicq_u32(value, mask); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_u32(a, b); }
+};
+
+template <typename IndexType>
+using VectorLanes = NEONLanes<IndexType>;
+
+bool SupportsVectorLanes()
+{
+    // NEON is part of the AArch64 baseline.
+    return true;
+}
+#    endif
+
+gl::IndexRange MergeIndexRanges(const gl::IndexRange &a, const gl::IndexRange &b)
+{
+    if (a.vertexIndexCount == 0)
+    {
+        return b;
+    }
+    if (b.vertexIndexCount == 0)
+    {
+        return a;
+    }
+    return gl::IndexRange(std::min(a.start, b.start), std::max(a.end, b.end),
+                          a.vertexIndexCount + b.vertexIndexCount);
+}
+
+// Keeps a running minimum and maximum per vector lane and reduces them at the end.  Primitive
+// restart lanes are replaced with values that can't change the result: all ones for the minimum
+// and zero for the maximum.  They are also counted per lane, since a lane that compares equal is
+// all ones and subtracting it adds one.  The indices that don't fill a vector are left to the
+// scalar loop.
+template <typename IndexType, bool kPrimitiveRestartEnabled>
+gl::IndexRange ComputeTypedIndexRangeVectorized(const IndexType *indices,
+                                                size_t count,
+                                                GLuint primitiveRestartIndex)
+{
+    using Lanes  = VectorLanes<IndexType>;
+    using Vector = typename Lanes::Vector;
+
+    constexpr size_t kLaneCount  = sizeof(Vector) / sizeof(IndexType);
+    const size_t vectorizedCount = count - count % kLaneCount;
+
+    const Vector restartIndex = Lanes::Splat(static_cast<IndexType>(primitiveRestartIndex));
+    Vector minLanes           = Lanes::AllOnes();
+    Vector maxLanes           = Lanes::Zero();
+    size_t restartCount       = 0;
+
+    for (size_t offset = 0; offset < vectorizedCount;)
+    {
+        const size_t chunkEnd =
+            std::min(vectorizedCount, offset + kLaneCount * kMaxRestartLaneCount);
+        Vector restartLanes = Lanes::Zero();
+
+        for (; offset < chunkEnd; offset += kLaneCount)
+        {
+            const Vector values = Lanes::Load(indices + offset);
+            if (kPrimitiveRestartEnabled)
+            {
+                const Vector isRestart = Lanes::Equal(values, restartIndex);
+                minLanes               = Lanes::Min(minLanes, Lanes::Or(values, isRestart));
+                maxLanes               = Lanes::Max(maxLanes, Lanes::AndNot(isRestart, values));
+                restartLanes           = Lanes::Sub(restartLanes, isRestart);
+            }
+            else
+            {
+                minLanes = Lanes::Min(minLanes, values);
+                maxLanes = Lanes::Max(maxLanes, values);
+            }
+        }
+
+        if (kPrimitiveRestartEnabled)
+        {
+            IndexType restartCounts[kLaneCount];
+            Lanes::Store(restartCounts, restartLanes);
+            for (IndexType laneCount : restartCounts)
+            {
+                restartCount += laneCount;
+            }
+        }
+    }
+
+    gl::IndexRange range;
+    if (restartCount < vectorizedCount)
+    {
+        IndexType minValues[kLaneCount];
+        IndexType maxValues[kLaneCount];
+        Lanes::Store(minValues, minLanes);
+        Lanes::Store(maxValues, maxLanes);
+        range = gl::IndexRange(*std::min_element(minValues, minValues + kLaneCount),
+                               *std::max_element(maxValues, maxValues + kLaneCount),
+                               vectorizedCount - restartCount);
+    }
+
+    if (vectorizedCount < count)
+    {
+        range = MergeIndexRanges(
+            range, ComputeTypedIndexRangeScalar(indices + vectorizedCount, count - vectorizedCount,
+                                                kPrimitiveRestartEnabled, primitiveRestartIndex));
+    }
+
+    return range;
+}
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_INDEX_RANGE_USE_NEON)
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+#if defined(ANGLE_INDEX_RANGE_VECTORIZED)
+    if (count >= kMinVectorizedIndexCount && SupportsVectorLanes())
+    {
+        return primitiveRestartEnabled
+                   ? ComputeTypedIndexRangeVectorized<IndexType, true>(indices, count,
+                                                                       primitiveRestartIndex)
+                   : ComputeTypedIndexRangeVectorized<IndexType, false>(indices, count,
+                                                                        primitiveRestartIndex);
+    }
+#endif  // defined(ANGLE_INDEX_RANGE_VECTORIZED)
+
+    return ComputeTypedIndexRangeScalar(indices, count, primitiveRestartEnabled,
+                                        primitiveRestartIndex);
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -10,8 +10,137 @@
 
 #include "common/utilities.h"
 
+#include <random>
+
 namespace
 {
+template <typename IndexType>
+gl::DrawElementsType GetDrawElementsType();
+
+template <>
+gl::DrawElementsType GetDrawElementsType<GLubyte>()
+{
+    return gl::DrawElementsType::UnsignedByte;
+}
+
+template <>
+gl::DrawElementsType GetDrawElementsType<GLushort>()
+{
+    return gl::DrawElementsType::UnsignedShort;
+}
+
+template <>
+gl::DrawElementsType GetDrawElementsType<GLuint>()
+{
+    return gl::DrawElementsType::UnsignedInt;
+}
+
+// Checks ComputeIndexRange against a plain loop over the indices.
+template <typename IndexType>
+void CheckIndexRange(const IndexType *indices, size_t count, bool primitiveRestartEnabled)
+{
+    const IndexType restartIndex = gl::GetPrimitiveRestartIndexFromType<IndexType>();
+
+    size_t expectedStart = std::numeric_limits<size_t>::max();
+    size_t expectedEnd   = 0;
+    size_t expectedCount = 0;
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (primitiveRestartEnabled && indices[index] == restartIndex)
+        {
+            continue;
+        }
+        expectedStart = std::min<size_t>(expectedStart, indices[index]);
+        expectedEnd   = std::max<size_t>(expectedEnd, indices[index]);
+        ++expectedCount;
+    }
+    if (expectedCount == 0)
+    {
+        expectedStart = 0;
+    }
+
+    gl::IndexRange range = gl::ComputeIndexRange(GetDrawElementsType<IndexType>(), indices, count,
+                                                 primitiveRestartEnabled);
+    EXPECT_EQ(expectedStart, range.start) << count << " indices";
+    EXPECT_EQ(expectedEnd, range.end) << count << " indices";
+    EXPECT_EQ(expectedCount, range.vertexIndexCount) << count << " indices";
+}
+
+// Checks every offset and length of |indices| up to |maxCount|, with and without primitive
+// restart.
+template <typename IndexType>
+void CheckIndexRanges(const std::vector<IndexType> &indices, size_t maxCount)
+{
+    for (size_t offset = 0; offset < 16 && offset < indices.size(); ++offset)
+    {
+        for (size_t count = 1; count <= maxCount && offset + count <= indices.size(); ++count)
+        {
+            CheckIndexRange(indices.data() + offset, count, false);
+            CheckIndexRange(indices.data() + offset, count, true);
+        }
+    }
+}
+
+template <typename IndexType>
+class ComputeIndexRangeTest : public testing::Test
+{};
+
+using IndexTypes = testing::Types<GLubyte, GLushort, GLuint>;
+TYPED_TEST_SUITE(ComputeIndexRangeTest, IndexTypes);
+
+// Test random indices with a sprinkling of primitive restart indices, at every alignment and
+// length around the vector sizes.
+TYPED_TEST(ComputeIndexRangeTest, Random)
+{
+    const TypeParam restartIndex = gl::GetPrimitiveRestartIndexFromType<TypeParam>();
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> distribution(0, restartIndex);
+
+    std::vector<TypeParam> indices(1000);
+    for (TypeParam &index : indices)
+    {
+        const bool isRestart = generator() % 8 == 0;
+        index = isRestart ? restartIndex : static_cast<TypeParam>(distribution(generator));
+    }
+
+    CheckIndexRanges(indices, 200);
+    CheckIndexRange(indices.data(), indices.size(), false);
+    CheckIndexRange(indices.data(), indices.size(), true);
+}
+
+// Test that the extreme index values are found, and that the restart index is still an index
+// when primitive restart is disabled.
+TYPED_TEST(ComputeIndexRangeTest, ExtremeValues)
+{
+    const TypeParam restartIndex = gl::GetPrimitiveRestartIndexFromType<TypeParam>();
+
+    std::vector<TypeParam> indices(300, 7);
+    indices[100] = 0;
+    indices[150] = restartIndex - 1;
+    indices[250] = restartIndex;
+
+    CheckIndexRanges(indices, 300);
+}
+
+// Test buffers made up of only primitive restart indices, and buffers where a single index is
+// hidden among many restart indices.
+TYPED_TEST(ComputeIndexRangeTest, PrimitiveRestartOnly)
+{
+    const TypeParam restartIndex = gl::GetPrimitiveRestartIndexFromType<TypeParam>();
+
+    // Enough restart indices to overflow a per-lane count of 8-bit indices.
+    std::vector<TypeParam> indices(100000, restartIndex);
+    CheckIndexRange(indices.data(), indices.size(), true);
+    CheckIndexRange(indices.data(), 65, true);
+
+    for (size_t position : {0, 63, 64, 5000, 99999})
+    {
+        indices[position] = 3;
+        CheckIndexRange(indices.data(), indices.size(), true);
+        indices[position] = restartIndex;
+    }
+}
 
 // Test parsing valid single array indices
 TEST(ParseResourceName, ArrayIndex)
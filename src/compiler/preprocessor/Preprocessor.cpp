@@ -7,6 +7,7 @@
 #include "compiler/preprocessor/Preprocessor.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "compiler/preprocessor/DiagnosticsBase.h"
 #include "compiler/preprocessor/DirectiveParser.h"
 #include "compiler/preprocessor/Macro.h"
@@ -41,6 +42,7 @@ struct PreprocessorImpl
 Preprocessor::Preprocessor(Diagnostics *diagnostics,
                            DirectiveHandler *directiveHandler,
                            const PreprocessorSettings &settings)
+    : mTimeSpent(nullptr)
 {
     mImpl = new PreprocessorImpl(diagnostics, directiveHandler, settings);
 }
@@ -69,6 +71,19 @@ void Preprocessor::predefineMacro(const char *name, int value)
 }
 
 void Preprocessor::lex(Token *token)
+{
+    if (mTimeSpent == nullptr)
+    {
+        lexImpl(token);
+        return;
+    }
+
+    double startTime = GetCurrentTime();
+    lexImpl(token);
+    *mTimeSpent += GetCurrentTime() - startTime;
+}
+
+void Preprocessor::lexImpl(Token *token)
 {
     bool validToken = false;
     while (!validToken)
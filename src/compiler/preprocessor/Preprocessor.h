@@ -61,8 +61,14 @@ class Preprocessor : angle::NonCopyable
     // Set maximum preprocessor token size
     void setMaxTokenSize(size_t maxTokenSize);
 
+    // Adds the time spent in lex() to |seconds|, unless it's null.
+    void setTimeSpent(double *seconds) { mTimeSpent = seconds; }
+
   private:
+    void lexImpl(Token *token);
+
     PreprocessorImpl *mImpl;
+    double *mTimeSpent;
 };
 
 }  // namespace pp
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "angle_gl.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
@@ -141,6 +142,16 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(PassManager *passManager)
+{
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+        return;
+
+    passManager->queueTraversal("MarkBuiltInFunctionsForEmulation",
+                                std::make_unique<BuiltInFunctionEmulationMarker>(*this),
+                                PassManager::kAllAnalyses, nullptr);
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
@@ -12,6 +12,7 @@
 namespace sh
 {
 
+class PassManager;
 class TIntermNode;
 class TFunction;
 class TSymbolUniqueId;
@@ -29,6 +30,8 @@ class BuiltInFunctionEmulator
     BuiltInFunctionEmulator();
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
+    // Queues the traversal marking the functions in the pass manager.
+    void markBuiltInFunctionsForEmulation(PassManager *passManager);
 
     void cleanup();
 
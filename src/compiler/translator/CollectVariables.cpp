@@ -10,6 +10,7 @@
 #include "angle_gl.h"
 #include "common/utilities.h"
 #include "compiler/translator/HashNames.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/util.h"
@@ -1038,7 +1039,7 @@ bool CollectVariablesTraverser::visitBinary(Visit, TIntermBinary *binaryNode)
 
 }  // anonymous namespace
 
-void CollectVariables(TIntermBlock *root,
+void CollectVariables(PassManager *passManager,
                       std::vector<ShaderVariable> *attributes,
                       std::vector<ShaderVariable> *outputVariables,
                       std::vector<ShaderVariable> *uniforms,
@@ -1053,11 +1054,12 @@ void CollectVariables(TIntermBlock *root,
                       GLenum shaderType,
                       const TExtensionBehavior &extensionBehavior)
 {
-    CollectVariablesTraverser collect(attributes, outputVariables, uniforms, inputVaryings,
-                                      outputVaryings, sharedVariables, uniformBlocks,
-                                      shaderStorageBlocks, inBlocks, hashFunction, symbolTable,
-                                      shaderType, extensionBehavior);
-    root->traverse(&collect);
+    auto collect = std::make_unique<CollectVariablesTraverser>(
+        attributes, outputVariables, uniforms, inputVaryings, outputVaryings, sharedVariables,
+        uniformBlocks, shaderStorageBlocks, inBlocks, hashFunction, symbolTable, shaderType,
+        extensionBehavior);
+    passManager->queueTraversal("CollectVariables", std::move(collect), PassManager::kAllAnalyses,
+                                nullptr);
 }
 
 }  // namespace sh
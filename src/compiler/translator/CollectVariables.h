@@ -15,10 +15,12 @@
 namespace sh
 {
 
-class TIntermBlock;
+class PassManager;
 class TSymbolTable;
 
-void CollectVariables(TIntermBlock *root,
+// Queues the traversal collecting the variables in the pass manager.  The variables are collected
+// once the pass manager is flushed.
+void CollectVariables(PassManager *passManager,
                       std::vector<ShaderVariable> *attributes,
                       std::vector<ShaderVariable> *outputVariables,
                       std::vector<ShaderVariable> *uniforms,
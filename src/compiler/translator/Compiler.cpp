@@ -9,6 +9,7 @@
 #include <sstream>
 
 #include "angle_gl.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
@@ -290,7 +291,8 @@ TShHandleBase::~TShHandleBase()
 }
 
 TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
-    : mVariablesCollected(false),
+    : mPassManager(this),
+      mVariablesCollected(false),
       mGLPositionInitialized(false),
       mShaderType(type),
       mShaderSpec(spec),
@@ -398,9 +400,29 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     TScopedSymbolTableLevel globalLevel(&mSymbolTable);
     ASSERT(mSymbolTable.atGlobalLevel());
 
+    // The preprocessor runs as the parser reads the tokens, so the time spent in it is taken out of
+    // the time spent parsing.
+    const bool recordTimings = (compileOptions & SH_RECORD_COMPILE_TIMINGS) != 0;
+    double preprocessTime    = 0.0;
+    double parseStartTime    = 0.0;
+    if (recordTimings)
+    {
+        parseContext.getPreprocessor().setTimeSpent(&preprocessTime);
+        parseStartTime = angle::GetCurrentTime();
+    }
+
     // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    int parseResult = PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
+                                     &parseContext);
+
+    if (recordTimings)
+    {
+        double parseTime = angle::GetCurrentTime() - parseStartTime;
+        mCompileTimings.push_back({"Preprocess", preprocessTime});
+        mCompileTimings.push_back({"Parse", parseTime - preprocessTime});
+    }
+
+    if (parseResult != 0)
     {
         return nullptr;
     }
@@ -523,14 +545,24 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     ShCompileOptions compileOptions)
 {
+    // The passes run through the pass manager, which can record the time spent in each of them.
+    // Passes that are a single traversal of the tree and don't depend on each other are queued,
+    // so they are done in one traversal.
+    mPassManager.begin(root, (compileOptions & SH_RECORD_COMPILE_TIMINGS) != 0 ? &mCompileTimings
+                                                                              : nullptr);
+
     // Disallow expressions deemed too complex.
-    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
+    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) &&
+        !mPassManager.run("LimitExpressionComplexity", PassManager::kAllAnalyses,
+                          [&]() { return limitExpressionComplexity(root); }))
     {
         return false;
     }
 
     if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+        !mPassManager.run("ValidateLimitations", PassManager::kAllAnalyses, [&]() {
+            return ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics);
+        }))
     {
         return false;
     }
@@ -542,7 +574,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!mPassManager.run("FoldExpressions",
+                          [&]() { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
@@ -556,7 +589,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      for float, so float literal statements would end up with no precision which is
     //      invalid ESSL.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
+    if (!mPassManager.run("PruneNoOps", [&]() { return PruneNoOps(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -569,51 +602,76 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                   mResources.FragmentPrecisionHigh == 1;
     bool enableNonConstantInitializers = IsExtensionEnabled(
         mExtensionBehavior, TExtension::EXT_shader_non_constant_global_initializers);
+    auto deferGlobalInitializers = [&]() {
+        return DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                       canUseLoopsToInitialize, highPrecisionSupported,
+                                       &mSymbolTable);
+    };
     if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, &mSymbolTable))
+        !mPassManager.run("DeferGlobalInitializers", deferGlobalInitializers))
     {
         return false;
     }
 
     // Create the function DAG and check there is no recursion
-    if (!initCallDag(root))
+    if (!mPassManager.run("InitCallDag", PassManager::kAllAnalyses,
+                          [&]() { return initCallDag(root); }))
     {
         return false;
     }
 
-    if ((compileOptions & SH_LIMIT_CALL_STACK_DEPTH) && !checkCallDepth())
+    if ((compileOptions & SH_LIMIT_CALL_STACK_DEPTH) &&
+        !mPassManager.run("CheckCallDepth", PassManager::kAllAnalyses,
+                          [&]() { return checkCallDepth(); }))
     {
         return false;
     }
 
     // Checks which functions are used and if "main" exists
-    mFunctionMetadata.clear();
-    mFunctionMetadata.resize(mCallDag.size());
-    if (!tagUsedFunctions())
+    if (!mPassManager.run("TagUsedFunctions", PassManager::kAllAnalyses,
+                          [&]() { return tagUsedFunctions(); }))
     {
         return false;
     }
 
-    if (!(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
+    if (!(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS) &&
+        !mPassManager.run("PruneUnusedFunctions", [&]() {
+            pruneUnusedFunctions(root);
+            return true;
+        }))
     {
-        pruneUnusedFunctions(root);
+        return false;
     }
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        if (!mPassManager.run("ReplaceShadowingVariables", [&]() {
+                return ReplaceShadowingVariables(this, root, &mSymbolTable);
+            }))
         {
             return false;
         }
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+    // The validations of the varyings and of the outputs and the marking of the indices to clamp
+    // are done in a single traversal.
+    if (mShaderVersion >= 310)
     {
-        return false;
+        ValidateVaryingLocations(&mPassManager, &mDiagnostics, mShaderType);
+    }
+
+    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER)
+    {
+        ValidateOutputs(&mPassManager, getExtensionBehavior(), mResources.MaxDrawBuffers,
+                        &mDiagnostics);
+    }
+
+    // Clamping uniform array bounds needs to happen after validateLimitations pass.
+    if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
+    {
+        mArrayBoundsClamper.MarkIndirectArrayBoundsForClamping(&mPassManager);
     }
 
-    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources.MaxDrawBuffers, &mDiagnostics))
+    if (!mPassManager.flush())
     {
         return false;
     }
@@ -626,19 +684,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
-    // Clamping uniform array bounds needs to happen after validateLimitations pass.
-    if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
-    {
-        mArrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
-    }
-
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) &&
         (parseContext.isExtensionEnabled(TExtension::OVR_multiview2) ||
          parseContext.isExtensionEnabled(TExtension::OVR_multiview)) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
-        if (!DeclareAndInitBuiltinsForInstancedMultiview(
-                this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable))
+        if (!mPassManager.run("DeclareAndInitBuiltinsForInstancedMultiview", [&]() {
+                return DeclareAndInitBuiltinsForInstancedMultiview(
+                    this, root, mNumViews, mShaderType, compileOptions, mOutputType,
+                    &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -647,7 +702,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
     {
-        if (!RewriteDoWhile(this, root, &mSymbolTable))
+        if (!mPassManager.run("RewriteDoWhile",
+                              [&]() { return RewriteDoWhile(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -655,7 +711,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!mPassManager.run("AddAndTrueToLoopCondition",
+                              [&]() { return AddAndTrueToLoopCondition(this, root); }))
         {
             return false;
         }
@@ -663,7 +720,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        if (!mPassManager.run("UnfoldShortCircuitAST",
+                              [&]() { return UnfoldShortCircuitAST(this, root); }))
         {
             return false;
         }
@@ -671,7 +729,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
     {
-        if (!RemovePow(this, root, &mSymbolTable))
+        if (!mPassManager.run("RemovePow", [&]() { return RemovePow(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -679,12 +737,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REGENERATE_STRUCT_NAMES)
     {
-        RegenerateStructNames gen(&mSymbolTable);
-        root->traverse(&gen);
-        if (!validateAST(root))
-        {
-            return false;
-        }
+        mPassManager.queueTraversal("RegenerateStructNames",
+                                    std::make_unique<RegenerateStructNames>(&mSymbolTable),
+                                    PassManager::kAllAnalyses,
+                                    [this, root]() { return validateAST(root); });
     }
 
     if (mShaderType == GL_VERTEX_SHADER &&
@@ -692,8 +748,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if ((compileOptions & SH_EMULATE_GL_DRAW_ID) != 0u)
         {
-            if (!EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms,
-                                 shouldCollectVariables(compileOptions)))
+            if (!mPassManager.run("EmulateGLDrawID", [&]() {
+                    return EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms,
+                                           shouldCollectVariables(compileOptions));
+                }))
             {
                 return false;
             }
@@ -705,9 +763,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if ((compileOptions & SH_EMULATE_GL_BASE_VERTEX_BASE_INSTANCE) != 0u)
         {
-            if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable, &mUniforms,
-                                                 shouldCollectVariables(compileOptions),
-                                                 compileOptions & SH_ADD_BASE_VERTEX_TO_VERTEX_ID))
+            if (!mPassManager.run("EmulateGLBaseVertexBaseInstance", [&]() {
+                    return EmulateGLBaseVertexBaseInstance(
+                        this, root, &mSymbolTable, &mUniforms,
+                        shouldCollectVariables(compileOptions),
+                        compileOptions & SH_ADD_BASE_VERTEX_TO_VERTEX_ID);
+                }))
             {
                 return false;
             }
@@ -718,8 +779,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         mResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(mExtensionBehavior, TExtension::EXT_draw_buffers))
     {
-        if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers, &mOutputVariables,
-                                         &mSymbolTable, mShaderVersion))
+        if (!mPassManager.run("EmulateGLFragColorBroadcast", [&]() {
+                return EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
+                                                   &mOutputVariables, &mSymbolTable,
+                                                   mShaderVersion);
+            }))
         {
             return false;
         }
@@ -732,36 +796,43 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
-    if (!SimplifyLoopConditions(this, root,
-                                IntermNodePatternMatcher::kMultiDeclaration |
-                                    IntermNodePatternMatcher::kArrayLengthMethod |
-                                    simplifyScalarized,
-                                &getSymbolTable()))
+    if (!mPassManager.run("SimplifyLoopConditions", [&]() {
+            return SimplifyLoopConditions(this, root,
+                                          IntermNodePatternMatcher::kMultiDeclaration |
+                                              IntermNodePatternMatcher::kArrayLengthMethod |
+                                              simplifyScalarized,
+                                          &getSymbolTable());
+        }))
     {
         return false;
     }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(this, root))
+    if (!mPassManager.run("SeparateDeclarations",
+                          [&]() { return SeparateDeclarations(this, root); }))
     {
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root,
-                               IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
-                               &getSymbolTable()))
+    if (!mPassManager.run("SplitSequenceOperator", [&]() {
+            return SplitSequenceOperator(
+                this, root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
+                &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
+    if (!mPassManager.run("RemoveArrayLengthMethod",
+                          [&]() { return RemoveArrayLengthMethod(this, root); }))
     {
         return false;
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+    if (!mPassManager.run("RemoveUnreferencedVariables",
+                          [&]() { return RemoveUnreferencedVariables(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -772,22 +843,26 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (!mPassManager.run("PruneEmptyCases", [&]() { return PruneEmptyCases(this, root); }))
     {
         return false;
     }
 
-    // Built-in function emulation needs to happen after validateLimitations pass.
+    // Built-in function emulation needs to happen after validateLimitations pass.  The functions
+    // are marked in the same traversal as the variables are collected, unless a pass in between
+    // changes the tree.
     // TODO(jmadill): Remove global pool allocator.
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
-    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(&mPassManager);
 
     if (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, mShaderType, highPrecisionSupported,
-                                               &mSymbolTable))
+        if (!mPassManager.run("ScalarizeVecAndMatConstructorArgs", [&]() {
+                return ScalarizeVecAndMatConstructorArgs(this, root, mShaderType,
+                                                         highPrecisionSupported, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -795,24 +870,41 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_FORCE_SHADER_PRECISION_HIGHP_TO_MEDIUMP)
     {
-        if (!ForceShaderPrecisionToMediump(root, &mSymbolTable, mShaderType))
+        if (!mPassManager.run("ForceShaderPrecisionToMediump", [&]() {
+                return ForceShaderPrecisionToMediump(root, &mSymbolTable, mShaderType);
+            }))
         {
             return false;
         }
     }
 
+    // Checking whether early fragment tests can be enabled is done in the same traversal as the
+    // variables are collected.  None of the passes after it add uses of gl_FragDepth or discard.
+    mEarlyFragmentTestsOptimized = false;
+    if ((compileOptions & SH_EARLY_FRAGMENT_TESTS_OPTIMIZATION) && mShaderVersion <= 300 &&
+        mShaderType == GL_FRAGMENT_SHADER && !isEarlyFragmentTestsSpecified())
+    {
+        CheckEarlyFragmentTestsFeasible(&mPassManager, &mEarlyFragmentTestsOptimized);
+    }
+
     if (shouldCollectVariables(compileOptions))
     {
         ASSERT(!mVariablesCollected);
-        CollectVariables(root, &mAttributes, &mOutputVariables, &mUniforms, &mInputVaryings,
-                         &mOutputVaryings, &mSharedVariables, &mUniformBlocks,
+        CollectVariables(&mPassManager, &mAttributes, &mOutputVariables, &mUniforms,
+                         &mInputVaryings, &mOutputVaryings, &mSharedVariables, &mUniformBlocks,
                          &mShaderStorageBlocks, &mInBlocks, mResources.HashFunction, &mSymbolTable,
                          mShaderType, mExtensionBehavior);
+        if (!mPassManager.flush())
+        {
+            return false;
+        }
         collectInterfaceBlocks();
         mVariablesCollected = true;
         if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
         {
-            if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
+            if (!mPassManager.run("UseAllMembersInUnusedStandardAndSharedBlocks", [&]() {
+                    return useAllMembersInUnusedStandardAndSharedBlocks(root);
+                }))
             {
                 return false;
             }
@@ -830,7 +922,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
         if ((compileOptions & SH_INIT_OUTPUT_VARIABLES) && (mShaderType != GL_COMPUTE_SHADER))
         {
-            if (!initializeOutputVariables(root))
+            if (!mPassManager.run("InitializeOutputVariables",
+                                  [&]() { return initializeOutputVariables(root); }))
             {
                 return false;
             }
@@ -841,7 +934,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
     {
-        if (!RemoveInvariantDeclaration(this, root))
+        if (!mPassManager.run("RemoveInvariantDeclaration",
+                              [&]() { return RemoveInvariantDeclaration(this, root); }))
         {
             return false;
         }
@@ -853,7 +947,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (mShaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         ((compileOptions & SH_INIT_GL_POSITION) || (mOutputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
     {
-        if (!initializeGLPosition(root))
+        if (!mPassManager.run("InitializeGLPosition",
+                              [&]() { return initializeGLPosition(root); }))
         {
             return false;
         }
@@ -868,8 +963,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // initializers before we generate the DAG, since initializers may call functions which must not
     // be optimized out
     if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, &mSymbolTable))
+        !mPassManager.run("DeferGlobalInitializers", deferGlobalInitializers))
     {
         return false;
     }
@@ -886,17 +980,23 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation(compileOptions))
         {
-            if (!SimplifyLoopConditions(this, root,
-                                        IntermNodePatternMatcher::kArrayDeclaration |
-                                            IntermNodePatternMatcher::kNamelessStructDeclaration,
-                                        &getSymbolTable()))
+            if (!mPassManager.run("SimplifyLoopConditions", [&]() {
+                    return SimplifyLoopConditions(
+                        this, root,
+                        IntermNodePatternMatcher::kArrayDeclaration |
+                            IntermNodePatternMatcher::kNamelessStructDeclaration,
+                        &getSymbolTable());
+                }))
             {
                 return false;
             }
         }
 
-        if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
-                                           highPrecisionSupported, &getSymbolTable()))
+        if (!mPassManager.run("InitializeUninitializedLocals", [&]() {
+                return InitializeUninitializedLocals(this, root, getShaderVersion(),
+                                                     canUseLoopsToInitialize,
+                                                     highPrecisionSupported, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -904,7 +1004,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE))
     {
-        if (!ClampPointSize(this, root, mResources.MaxPointSize, &getSymbolTable()))
+        if (!mPassManager.run("ClampPointSize", [&]() {
+                return ClampPointSize(this, root, mResources.MaxPointSize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -912,7 +1014,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH))
     {
-        if (!ClampFragDepth(this, root, &getSymbolTable()))
+        if (!mPassManager.run("ClampFragDepth",
+                              [&]() { return ClampFragDepth(this, root, &getSymbolTable()); }))
         {
             return false;
         }
@@ -920,7 +1023,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        if (!mPassManager.run("RewriteRepeatedAssignToSwizzled",
+                              [&]() { return sh::RewriteRepeatedAssignToSwizzled(this, root); }))
         {
             return false;
         }
@@ -928,7 +1032,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC)
     {
-        if (!VectorizeVectorScalarArithmetic(this, root, &getSymbolTable()))
+        if (!mPassManager.run("VectorizeVectorScalarArithmetic", [&]() {
+                return VectorizeVectorScalarArithmetic(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -936,23 +1042,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REMOVE_DYNAMIC_INDEXING_OF_SWIZZLED_VECTOR)
     {
-        if (!sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(), nullptr))
+        if (!mPassManager.run("RemoveDynamicIndexingOfSwizzledVector", [&]() {
+                return sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(),
+                                                                 nullptr);
+            }))
         {
             return false;
         }
     }
 
-    mEarlyFragmentTestsOptimized = false;
-    if (compileOptions & SH_EARLY_FRAGMENT_TESTS_OPTIMIZATION)
-    {
-        if (mShaderVersion <= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-            !isEarlyFragmentTestsSpecified())
-        {
-            mEarlyFragmentTestsOptimized = CheckEarlyFragmentTestsFeasible(this, root);
-        }
-    }
-
-    return true;
+    return mPassManager.flush();
 }
 
 bool TCompiler::compile(const char *const shaderStrings[],
@@ -988,11 +1087,27 @@ bool TCompiler::compile(const char *const shaderStrings[],
 
         if (compileOptions & SH_OBJECT_CODE)
         {
+            const bool recordTimings     = (compileOptions & SH_RECORD_COMPILE_TIMINGS) != 0;
+            double translateStartTime    = recordTimings ? angle::GetCurrentTime() : 0.0;
+            size_t firstTranslatorTiming = mCompileTimings.size();
+
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
                 return false;
             }
+
+            // The passes the backend runs through the pass manager are recorded on their own, so
+            // they are taken out of the time spent translating.
+            if (recordTimings)
+            {
+                double translateTime = angle::GetCurrentTime() - translateStartTime;
+                for (size_t index = firstTranslatorTiming; index < mCompileTimings.size(); ++index)
+                {
+                    translateTime -= mCompileTimings[index].seconds;
+                }
+                mCompileTimings.push_back({"Translate", translateTime});
+            }
         }
 
         if (mShaderType == GL_VERTEX_SHADER)
@@ -1145,7 +1260,39 @@ void TCompiler::setResourceString()
         << ":MaxGeometryShaderStorageBlocks:" << mResources.MaxGeometryShaderStorageBlocks
         << ":MaxGeometryShaderInvocations:" << mResources.MaxGeometryShaderInvocations
         << ":MaxGeometryImageUniforms:" << mResources.MaxGeometryImageUniforms
-        << ":MaxClipDistances" << mResources.MaxClipDistances;
+        << ":MaxClipDistances:" << mResources.MaxClipDistances
+        << ":NV_shader_noperspective_interpolation:" << mResources.NV_shader_noperspective_interpolation
+        << ":EXT_multisampled_render_to_texture:" << mResources.EXT_multisampled_render_to_texture
+        << ":EXT_multisampled_render_to_texture2:" << mResources.EXT_multisampled_render_to_texture2
+        << ":EXT_shader_non_constant_global_initializers:" << mResources.EXT_shader_non_constant_global_initializers
+        << ":OES_texture_storage_multisample_2d_array:" << mResources.OES_texture_storage_multisample_2d_array
+        << ":ANGLE_texture_multisample:" << mResources.ANGLE_texture_multisample
+        << ":WEBGL_video_texture:" << mResources.WEBGL_video_texture
+        << ":EXT_tessellation_shader:" << mResources.EXT_tessellation_shader
+        << ":ArrayIndexClampingStrategy:" << mResources.ArrayIndexClampingStrategy
+        << ":MaxUniformLocations:" << mResources.MaxUniformLocations
+        << ":MaxUniformBufferBindings:" << mResources.MaxUniformBufferBindings
+        << ":MaxShaderStorageBufferBindings:" << mResources.MaxShaderStorageBufferBindings
+        << ":MaxPointSize:" << mResources.MaxPointSize
+        << ":MaxTessControlInputComponents:" << mResources.MaxTessControlInputComponents
+        << ":MaxTessControlOutputComponents:" << mResources.MaxTessControlOutputComponents
+        << ":MaxTessControlTextureImageUnits:" << mResources.MaxTessControlTextureImageUnits
+        << ":MaxTessControlUniformComponents:" << mResources.MaxTessControlUniformComponents
+        << ":MaxTessControlTotalOutputComponents:" << mResources.MaxTessControlTotalOutputComponents
+        << ":MaxTessControlImageUniforms:" << mResources.MaxTessControlImageUniforms
+        << ":MaxTessControlAtomicCounters:" << mResources.MaxTessControlAtomicCounters
+        << ":MaxTessControlAtomicCounterBuffers:" << mResources.MaxTessControlAtomicCounterBuffers
+        << ":MaxTessPatchComponents:" << mResources.MaxTessPatchComponents
+        << ":MaxPatchVertices:" << mResources.MaxPatchVertices
+        << ":MaxTessGenLevel:" << mResources.MaxTessGenLevel
+        << ":MaxTessEvaluationInputComponents:" << mResources.MaxTessEvaluationInputComponents
+        << ":MaxTessEvaluationOutputComponents:" << mResources.MaxTessEvaluationOutputComponents
+        << ":MaxTessEvaluationTextureImageUnits:" << mResources.MaxTessEvaluationTextureImageUnits
+        << ":MaxTessEvaluationUniformComponents:" << mResources.MaxTessEvaluationUniformComponents
+        << ":MaxTessEvaluationImageUniforms:" << mResources.MaxTessEvaluationImageUniforms
+        << ":MaxTessEvaluationAtomicCounters:" << mResources.MaxTessEvaluationAtomicCounters
+        << ":MaxTessEvaluationAtomicCounterBuffers:" << mResources.MaxTessEvaluationAtomicCounterBuffers
+        << ":SubPixelBits:" << mResources.SubPixelBits;
     // clang-format on
 
     mBuiltInResourcesString = strstream.str();
@@ -1171,13 +1318,16 @@ bool TCompiler::emulatePrecisionIfNeeded(TIntermBlock *root,
 
     if (*isNeeded)
     {
-        EmulatePrecision emulatePrecision(&getSymbolTable());
-        root->traverse(&emulatePrecision);
-        if (!emulatePrecision.updateTree(this, root))
-        {
-            return false;
-        }
-        emulatePrecision.writeEmulationHelpers(sink, getShaderVersion(), outputLanguage);
+        return mPassManager.run("EmulatePrecision", [&]() {
+            EmulatePrecision emulatePrecision(&getSymbolTable());
+            root->traverse(&emulatePrecision);
+            if (!emulatePrecision.updateTree(this, root))
+            {
+                return false;
+            }
+            emulatePrecision.writeEmulationHelpers(sink, getShaderVersion(), outputLanguage);
+            return true;
+        });
     }
     return true;
 }
@@ -1211,6 +1361,7 @@ void TCompiler::clearResults()
     mGeometryShaderMaxVertices         = -1;
 
     mBuiltInFunctionEmulator.cleanup();
+    mCompileTimings.clear();
 
     mNameMap.clear();
 
@@ -1226,6 +1377,7 @@ bool TCompiler::initCallDag(TIntermNode *root)
     switch (mCallDag.init(root, &mDiagnostics))
     {
         case CallDAG::INITDAG_SUCCESS:
+            mPassManager.setValid(PassManager::kCallDag);
             return true;
         case CallDAG::INITDAG_RECURSION:
         case CallDAG::INITDAG_UNDEFINED:
@@ -1240,6 +1392,7 @@ bool TCompiler::initCallDag(TIntermNode *root)
 
 bool TCompiler::checkCallDepth()
 {
+    ASSERT(mPassManager.isValid(PassManager::kCallDag));
     std::vector<int> depths(mCallDag.size());
 
     for (size_t i = 0; i < mCallDag.size(); i++)
@@ -1296,12 +1449,17 @@ bool TCompiler::checkCallDepth()
 
 bool TCompiler::tagUsedFunctions()
 {
+    ASSERT(mPassManager.isValid(PassManager::kCallDag));
+    mFunctionMetadata.clear();
+    mFunctionMetadata.resize(mCallDag.size());
+
     // Search from main, starting from the end of the DAG as it usually is the root.
     for (size_t i = mCallDag.size(); i-- > 0;)
     {
         if (mCallDag.getRecordFromIndex(i).node->getFunction()->isMain())
         {
             internalTagUsedFunction(i);
+            mPassManager.setValid(PassManager::kUsedFunctions);
             return true;
         }
     }
@@ -1372,6 +1530,7 @@ class TCompiler::UnusedPredicate
 
 void TCompiler::pruneUnusedFunctions(TIntermBlock *root)
 {
+    ASSERT(mPassManager.isValid(PassManager::kUsedFunctions));
     UnusedPredicate isUnused(&mCallDag, &mFunctionMetadata);
     TIntermSequence *sequence = root->getSequence();
 
@@ -23,6 +23,7 @@
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/ValidateAST.h"
@@ -112,6 +113,9 @@ class TCompiler : public TShHandleBase
     // Clears the results from the previous compilation.
     void clearResults();
 
+    // Time spent in each phase of the compilation, if compiled with SH_RECORD_COMPILE_TIMINGS.
+    const std::vector<CompileTiming> &getCompileTimings() const { return mCompileTimings; }
+
     const std::vector<sh::ShaderVariable> &getAttributes() const { return mAttributes; }
     const std::vector<sh::ShaderVariable> &getOutputVariables() const { return mOutputVariables; }
     const std::vector<sh::ShaderVariable> &getUniforms() const { return mUniforms; }
@@ -200,6 +204,10 @@ class TCompiler : public TShHandleBase
     // Specialization constant usage bits
     SpecConstUsageBits mSpecConstUsageBits;
 
+    // Runs the passes over the AST, including those of the output backends in translate(), so the
+    // time spent in each of them is recorded.
+    PassManager mPassManager;
+
   private:
     // Initialize symbol-table with built-in symbols.
     bool initBuiltInSymbolTable(const ShBuiltInResources &resources);
@@ -266,6 +274,8 @@ class TCompiler : public TShHandleBase
     CallDAG mCallDag;
     std::vector<FunctionMetadata> mFunctionMetadata;
 
+    std::vector<CompileTiming> mCompileTimings;
+
     ShBuiltInResources mResources;
     std::string mBuiltInResourcesString;
 
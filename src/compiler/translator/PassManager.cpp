@@ -0,0 +1,109 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.cpp: Runs the passes of the compiler over the AST, fusing the queued traversals.
+
+#include "compiler/translator/PassManager.h"
+
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+namespace sh
+{
+
+PassManager::PassManager(TCompiler *compiler)
+    : mCompiler(compiler),
+      mRoot(nullptr),
+      mValidAnalyses(kNoAnalyses),
+      mQueuedPreservedAnalyses(kAllAnalyses),
+      mTimings(nullptr)
+{}
+
+PassManager::~PassManager() {}
+
+void PassManager::begin(TIntermBlock *root, std::vector<CompileTiming> *timings)
+{
+    mRoot          = root;
+    mValidAnalyses = kNoAnalyses;
+    mQueuedTraversals.clear();
+    mQueuedPreservedAnalyses = kAllAnalyses;
+    mTimings                 = timings;
+}
+
+void PassManager::queueTraversal(const char *name,
+                                 std::unique_ptr<TIntermTraverser> traverser,
+                                 unsigned int preservedAnalyses,
+                                 std::function<bool()> &&finish)
+{
+    ASSERT(mRoot != nullptr);
+    mQueuedTraversals.push_back({name, std::move(traverser), std::move(finish)});
+    mQueuedPreservedAnalyses &= preservedAnalyses;
+}
+
+bool PassManager::flush()
+{
+    if (mQueuedTraversals.empty())
+    {
+        return true;
+    }
+
+    double startTime = getStartTime();
+
+    // Changes to the tree are applied the same way whether the traversals are fused or not, so the
+    // tree is only validated after the traversals that changed it.
+    TIntermFusedTraverser fusedTraverser;
+    for (QueuedTraversal &queued : mQueuedTraversals)
+    {
+        fusedTraverser.addTraverser(queued.traverser.get());
+    }
+
+    if (mQueuedTraversals.size() == 1)
+    {
+        mRoot->traverse(mQueuedTraversals.front().traverser.get());
+    }
+    else
+    {
+        mRoot->traverse(&fusedTraverser);
+    }
+    bool success = fusedTraverser.updateTrees(mCompiler, mRoot);
+
+    // Like when the passes run one after the other, the passes queued after one that fails don't
+    // report errors.
+    for (QueuedTraversal &queued : mQueuedTraversals)
+    {
+        if (!success)
+        {
+            break;
+        }
+        if (queued.finish)
+        {
+            success = queued.finish();
+        }
+    }
+
+    if (isTiming())
+    {
+        std::string name;
+        for (const QueuedTraversal &queued : mQueuedTraversals)
+        {
+            name += name.empty() ? "" : "+";
+            name += queued.name;
+        }
+        recordTiming(std::move(name), startTime);
+    }
+
+    mQueuedTraversals.clear();
+    mValidAnalyses &= mQueuedPreservedAnalyses;
+    mQueuedPreservedAnalyses = kAllAnalyses;
+    return success;
+}
+
+void PassManager::recordTiming(std::string &&name, double startTime)
+{
+    ASSERT(isTiming());
+    mTimings->push_back({std::move(name), angle::GetCurrentTime() - startTime});
+}
+
+}  // namespace sh
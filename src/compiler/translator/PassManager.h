@@ -0,0 +1,120 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.h: Runs the passes of the compiler over the AST.  Passes that are a single traversal
+// of the tree can be queued, and the queued traversals are fused into one walk of the tree.  The
+// manager also tracks which analyses of the tree are still valid, and can record the time spent in
+// each pass.
+
+#ifndef COMPILER_TRANSLATOR_PASSMANAGER_H_
+#define COMPILER_TRANSLATOR_PASSMANAGER_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+#include "common/system_utils.h"
+
+namespace sh
+{
+
+class TCompiler;
+class TIntermBlock;
+class TIntermTraverser;
+
+class PassManager : angle::NonCopyable
+{
+  public:
+    // Analyses of the tree the compiler keeps.  A pass invalidates the analyses it doesn't
+    // preserve, and the code computing an analysis marks it valid.
+    enum Analysis : unsigned int
+    {
+        kNoAnalyses = 0x0,
+        // TCompiler::mCallDag.
+        kCallDag = 0x1,
+        // Which functions are used, in TCompiler::mFunctionMetadata.
+        kUsedFunctions = 0x2,
+        kAllAnalyses   = 0x3,
+    };
+
+    explicit PassManager(TCompiler *compiler);
+    ~PassManager();
+
+    // Starts running passes on a new tree.  All analyses are invalid, and the traversals still
+    // queued for the previous tree are dropped.  The time spent in each pass is appended to
+    // |timings| if it's not null.
+    void begin(TIntermBlock *root, std::vector<CompileTiming> *timings);
+
+    // Runs a pass after the queued traversals.  The pass returns false on error.
+    template <typename Pass>
+    ANGLE_NO_DISCARD bool run(const char *name, unsigned int preservedAnalyses, Pass &&pass);
+    // Runs a pass that changes the tree, invalidating all analyses.
+    template <typename Pass>
+    ANGLE_NO_DISCARD bool run(const char *name, Pass &&pass)
+    {
+        return run(name, kNoAnalyses, std::forward<Pass>(pass));
+    }
+
+    // Queues a pass that is a single traversal of the tree, after which |finish| is called if
+    // given.  The queued traversals are fused into one traversal before the next pass runs or
+    // flush() is called, see TIntermFusedTraverser for what the traversers can do.  |finish|
+    // returns false on error.
+    void queueTraversal(const char *name,
+                        std::unique_ptr<TIntermTraverser> traverser,
+                        unsigned int preservedAnalyses,
+                        std::function<bool()> &&finish);
+    ANGLE_NO_DISCARD bool flush();
+
+    bool isValid(Analysis analysis) const { return (mValidAnalyses & analysis) == analysis; }
+    void setValid(Analysis analysis) { mValidAnalyses |= analysis; }
+
+  private:
+    struct QueuedTraversal
+    {
+        const char *name;
+        std::unique_ptr<TIntermTraverser> traverser;
+        std::function<bool()> finish;
+    };
+
+    // The clock is only read, and the names of the passes only copied, when timings are recorded.
+    bool isTiming() const { return mTimings != nullptr; }
+    double getStartTime() const { return isTiming() ? angle::GetCurrentTime() : 0.0; }
+    void recordTiming(std::string &&name, double startTime);
+
+    TCompiler *mCompiler;
+    TIntermBlock *mRoot;
+    unsigned int mValidAnalyses;
+
+    std::vector<QueuedTraversal> mQueuedTraversals;
+    unsigned int mQueuedPreservedAnalyses;
+
+    std::vector<CompileTiming> *mTimings;
+};
+
+template <typename Pass>
+bool PassManager::run(const char *name, unsigned int preservedAnalyses, Pass &&pass)
+{
+    if (!flush())
+    {
+        return false;
+    }
+
+    double startTime = getStartTime();
+    bool result      = pass();
+    if (isTiming())
+    {
+        recordTiming(name, startTime);
+    }
+
+    mValidAnalyses &= preservedAnalyses;
+    return result;
+}
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_PASSMANAGER_H_
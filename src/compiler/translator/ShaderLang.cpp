@@ -553,6 +553,16 @@ uint32_t GetShaderSpecConstUsageBits(const ShHandle handle)
     return compiler->getSpecConstUsageBits().bits();
 }
 
+const std::vector<CompileTiming> *GetCompileTimings(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    if (compiler == nullptr)
+    {
+        return nullptr;
+    }
+    return &compiler->getCompileTimings();
+}
+
 bool CheckVariablesWithinPackingLimits(int maxVectors, const std::vector<ShaderVariable> &variables)
 {
     return CheckVariablesInPackingLimits(maxVectors, variables);
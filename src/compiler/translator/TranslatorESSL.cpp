@@ -50,7 +50,8 @@ bool TranslatorESSL::translate(TIntermBlock *root,
     if (!emulatePrecisionIfNeeded(root, sink, &precisionEmulation, SH_ESSL_OUTPUT))
         return false;
 
-    if (!RecordConstantPrecision(this, root, &getSymbolTable()))
+    if (!mPassManager.run("RecordConstantPrecision",
+                          [&]() { return RecordConstantPrecision(this, root, &getSymbolTable()); }))
     {
         return false;
     }
@@ -95,7 +95,10 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
 
     if ((compileOptions & SH_REWRITE_TEXELFETCHOFFSET_TO_TEXELFETCH) != 0)
     {
-        if (!sh::RewriteTexelFetchOffset(this, root, getSymbolTable(), getShaderVersion()))
+        if (!mPassManager.run("RewriteTexelFetchOffset", [&]() {
+                return sh::RewriteTexelFetchOffset(this, root, getSymbolTable(),
+                                                   getShaderVersion());
+            }))
         {
             return false;
         }
@@ -103,7 +106,8 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
 
     if ((compileOptions & SH_REWRITE_FLOAT_UNARY_MINUS_OPERATOR) != 0)
     {
-        if (!sh::RewriteUnaryMinusOperatorFloat(this, root))
+        if (!mPassManager.run("RewriteUnaryMinusOperatorFloat",
+                              [&]() { return sh::RewriteUnaryMinusOperatorFloat(this, root); }))
         {
             return false;
         }
@@ -111,7 +115,9 @@ bool TranslatorGLSL::translate(TIntermBlock *root,
 
     if ((compileOptions & SH_REWRITE_ROW_MAJOR_MATRICES) != 0 && getShaderVersion() >= 300)
     {
-        if (!RewriteRowMajorMatrices(this, root, &getSymbolTable()))
+        if (!mPassManager.run("RewriteRowMajorMatrices", [&]() {
+                return RewriteRowMajorMatrices(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -45,7 +45,8 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     int maxDualSourceDrawBuffers =
         resources.EXT_blend_func_extended ? resources.MaxDualSourceDrawBuffers : 0;
 
-    if (!sh::AddDefaultReturnStatements(this, root))
+    if (!mPassManager.run("AddDefaultReturnStatements",
+                          [&]() { return sh::AddDefaultReturnStatements(this, root); }))
     {
         return false;
     }
@@ -53,51 +54,62 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations that
     // may need to generate new statements from loop conditions or loop expressions.
     // Note that SeparateDeclarations has already been run in TCompiler::compileTreeImpl().
-    if (!SimplifyLoopConditions(
-            this, root,
-            IntermNodePatternMatcher::kExpressionReturningArray |
-                IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
-                IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
-            &getSymbolTable()))
+    if (!mPassManager.run("SimplifyLoopConditions", [&]() {
+            return SimplifyLoopConditions(
+                this, root,
+                IntermNodePatternMatcher::kExpressionReturningArray |
+                    IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
+                    IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
+                &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!SplitSequenceOperator(
-            this, root,
-            IntermNodePatternMatcher::kExpressionReturningArray |
-                IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
-                IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
-            &getSymbolTable()))
+    if (!mPassManager.run("SplitSequenceOperator", [&]() {
+            return SplitSequenceOperator(
+                this, root,
+                IntermNodePatternMatcher::kExpressionReturningArray |
+                    IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
+                    IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
+                &getSymbolTable());
+        }))
     {
         return false;
     }
 
     // Note that SeparateDeclarations needs to be run before UnfoldShortCircuitToIf.
-    if (!UnfoldShortCircuitToIf(this, root, &getSymbolTable()))
+    if (!mPassManager.run("UnfoldShortCircuitToIf",
+                          [&]() { return UnfoldShortCircuitToIf(this, root, &getSymbolTable()); }))
     {
         return false;
     }
 
-    if (!SeparateArrayConstructorStatements(this, root))
+    if (!mPassManager.run("SeparateArrayConstructorStatements",
+                          [&]() { return SeparateArrayConstructorStatements(this, root); }))
     {
         return false;
     }
 
-    if (!SeparateExpressionsReturningArrays(this, root, &getSymbolTable()))
+    if (!mPassManager.run("SeparateExpressionsReturningArrays", [&]() {
+            return SeparateExpressionsReturningArrays(this, root, &getSymbolTable());
+        }))
     {
         return false;
     }
 
     // Note that SeparateDeclarations needs to be run before SeparateArrayInitialization.
-    if (!SeparateArrayInitialization(this, root))
+    if (!mPassManager.run("SeparateArrayInitialization",
+                          [&]() { return SeparateArrayInitialization(this, root); }))
     {
         return false;
     }
 
     // HLSL doesn't support arrays as return values, we'll need to make functions that have an array
     // as a return value to use an out parameter to transfer the array data instead.
-    if (!ArrayReturnValueToOutParameter(this, root, &getSymbolTable()))
+    if (!mPassManager.run("ArrayReturnValueToOutParameter", [&]() {
+            return ArrayReturnValueToOutParameter(this, root, &getSymbolTable());
+        }))
     {
         return false;
     }
@@ -105,8 +117,10 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     if (!shouldRunLoopAndIndexingValidation(compileOptions))
     {
         // HLSL doesn't support dynamic indexing of vectors and matrices.
-        if (!RemoveDynamicIndexingOfNonSSBOVectorOrMatrix(this, root, &getSymbolTable(),
-                                                          perfDiagnostics))
+        if (!mPassManager.run("RemoveDynamicIndexingOfNonSSBOVectorOrMatrix", [&]() {
+                return RemoveDynamicIndexingOfNonSSBOVectorOrMatrix(this, root, &getSymbolTable(),
+                                                                    perfDiagnostics);
+            }))
         {
             return false;
         }
@@ -116,7 +130,9 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     // use a vertex attribute as a condition, and some related computation in the else block.
     if (getOutputType() == SH_HLSL_3_0_OUTPUT && getShaderType() == GL_VERTEX_SHADER)
     {
-        if (!sh::RewriteElseBlocks(this, root, &getSymbolTable()))
+        if (!mPassManager.run("RewriteElseBlocks", [&]() {
+                return sh::RewriteElseBlocks(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -126,7 +142,8 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     // TODO(cwallez) The date is 2016-08-25, Microsoft said the bug would be fixed
     // in the next release of d3dcompiler.dll, it would be nice to detect the DLL
     // version and only apply the workaround if it is too old.
-    if (!sh::BreakVariableAliasingInInnerLoops(this, root))
+    if (!mPassManager.run("BreakVariableAliasingInInnerLoops",
+                          [&]() { return sh::BreakVariableAliasingInInnerLoops(this, root); }))
     {
         return false;
     }
@@ -135,7 +152,8 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     // introduce variable declarations inside the main scope of any switch statement. It cannot
     // result in no-op cases at the end of switch statements, because unreferenced variables
     // have already been pruned.
-    if (!WrapSwitchStatementsInBlocks(this, root))
+    if (!mPassManager.run("WrapSwitchStatementsInBlocks",
+                          [&]() { return WrapSwitchStatementsInBlocks(this, root); }))
     {
         return false;
     }
@@ -146,7 +164,9 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
 
     if ((compileOptions & SH_EXPAND_SELECT_HLSL_INTEGER_POW_EXPRESSIONS) != 0)
     {
-        if (!sh::ExpandIntegerPowExpressions(this, root, &getSymbolTable()))
+        if (!mPassManager.run("ExpandIntegerPowExpressions", [&]() {
+                return sh::ExpandIntegerPowExpressions(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -154,7 +174,10 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
 
     if ((compileOptions & SH_REWRITE_TEXELFETCHOFFSET_TO_TEXELFETCH) != 0)
     {
-        if (!sh::RewriteTexelFetchOffset(this, root, getSymbolTable(), getShaderVersion()))
+        if (!mPassManager.run("RewriteTexelFetchOffset", [&]() {
+                return sh::RewriteTexelFetchOffset(this, root, getSymbolTable(),
+                                                   getShaderVersion());
+            }))
         {
             return false;
         }
@@ -163,7 +186,8 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     if (((compileOptions & SH_REWRITE_INTEGER_UNARY_MINUS_OPERATOR) != 0) &&
         getShaderType() == GL_VERTEX_SHADER)
     {
-        if (!sh::RewriteUnaryMinusOperatorInt(this, root))
+        if (!mPassManager.run("RewriteUnaryMinusOperatorInt",
+                              [&]() { return sh::RewriteUnaryMinusOperatorInt(this, root); }))
         {
             return false;
         }
@@ -173,12 +197,16 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     {
         // Due to ssbo also can be used as the argument of atomic memory functions, we should put
         // RewriteExpressionsWithShaderStorageBlock before RewriteAtomicFunctionExpressions.
-        if (!sh::RewriteExpressionsWithShaderStorageBlock(this, root, &getSymbolTable()))
+        if (!mPassManager.run("RewriteExpressionsWithShaderStorageBlock", [&]() {
+                return sh::RewriteExpressionsWithShaderStorageBlock(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
-        if (!sh::RewriteAtomicFunctionExpressions(this, root, &getSymbolTable(),
-                                                  getShaderVersion()))
+        if (!mPassManager.run("RewriteAtomicFunctionExpressions", [&]() {
+                return sh::RewriteAtomicFunctionExpressions(this, root, &getSymbolTable(),
+                                                            getShaderVersion());
+            }))
         {
             return false;
         }
@@ -191,8 +219,10 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
     if (getShaderVersion() == 300 &&
         (compileOptions & SH_ALLOW_TRANSLATE_UNIFORM_BLOCK_TO_STRUCTUREDBUFFER) != 0)
     {
-        if (!sh::RecordUniformBlocksTranslatedToStructuredBuffers(
-                root, mUniformBlocksTranslatedToStructuredBuffers))
+        if (!mPassManager.run("RecordUniformBlocksTranslatedToStructuredBuffers", [&]() {
+                return sh::RecordUniformBlocksTranslatedToStructuredBuffers(
+                    root, mUniformBlocksTranslatedToStructuredBuffers);
+            }))
         {
             return false;
         }
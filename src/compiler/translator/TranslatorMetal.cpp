@@ -151,7 +151,9 @@ bool TranslatorMetal::translate(TIntermBlock *root,
     }
 
     // Replace array of matrix varyings
-    if (!ReplaceArrayOfMatrixVaryings(this, root, &getSymbolTable()))
+    if (!mPassManager.run("ReplaceArrayOfMatrixVaryings", [&]() {
+            return ReplaceArrayOfMatrixVaryings(this, root, &getSymbolTable());
+        }))
     {
         return false;
     }
@@ -161,20 +163,26 @@ bool TranslatorMetal::translate(TIntermBlock *root,
         TIntermTyped *negFlipY = driverUniforms.getNegFlipYRef();
 
         // Append gl_Position.y correction to main
-        if (!AppendVertexShaderPositionYCorrectionToMain(this, root, &getSymbolTable(), negFlipY))
+        if (!mPassManager.run("AppendVertexShaderPositionYCorrectionToMain", [&]() {
+                return AppendVertexShaderPositionYCorrectionToMain(this, root, &getSymbolTable(),
+                                                                   negFlipY);
+            }))
         {
             return false;
         }
 
         // Insert rasterizer discard logic
-        if (!insertRasterizerDiscardLogic(root))
+        if (!mPassManager.run("InsertRasterizerDiscardLogic",
+                              [&]() { return insertRasterizerDiscardLogic(root); }))
         {
             return false;
         }
     }
     else if (getShaderType() == GL_FRAGMENT_SHADER)
     {
-        if (!insertSampleMaskWritingLogic(root, &driverUniforms))
+        if (!mPassManager.run("InsertSampleMaskWritingLogic", [&]() {
+                return insertSampleMaskWritingLogic(root, &driverUniforms);
+            }))
         {
             return false;
         }
@@ -194,7 +202,9 @@ bool TranslatorMetal::translate(TIntermBlock *root,
             }
         }
 
-        if (!InitializeUnusedOutputs(root, &getSymbolTable(), list))
+        if (!mPassManager.run("InitializeUnusedOutputs", [&]() {
+                return InitializeUnusedOutputs(root, &getSymbolTable(), list);
+            }))
         {
             return false;
         }
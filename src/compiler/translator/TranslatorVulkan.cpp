@@ -649,7 +649,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER)
     {
-        if (!ShaderBuiltinsWorkaround(this, root, &getSymbolTable(), compileOptions))
+        if (!mPassManager.run("ShaderBuiltinsWorkaround", [&]() {
+                return ShaderBuiltinsWorkaround(this, root, &getSymbolTable(), compileOptions);
+            }))
         {
             return false;
         }
@@ -684,9 +686,11 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
     // inactive samplers is not yet supported.  Note also that currently, CollectVariables marks
     // every field of an active uniform that's of struct type as active, i.e. no extracted sampler
     // is inactive.
-    if (!RemoveInactiveInterfaceVariables(this, root, getAttributes(), getInputVaryings(),
-                                          getOutputVariables(), getUniforms(),
-                                          getInterfaceBlocks()))
+    if (!mPassManager.run("RemoveInactiveInterfaceVariables", [&]() {
+            return RemoveInactiveInterfaceVariables(this, root, getAttributes(), getInputVaryings(),
+                                                    getOutputVariables(), getUniforms(),
+                                                    getInterfaceBlocks());
+        }))
     {
         return false;
     }
@@ -695,7 +699,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
     // http://anglebug.com/2461
     if (aggregateTypesUsedForUniforms > 0)
     {
-        if (!NameEmbeddedStructUniforms(this, root, &getSymbolTable()))
+        if (!mPassManager.run("NameEmbeddedStructUniforms", [&]() {
+                return NameEmbeddedStructUniforms(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -705,13 +711,16 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
 
         if (compileOptions & SH_USE_OLD_REWRITE_STRUCT_SAMPLERS)
         {
-            rewriteStructSamplersResult =
-                RewriteStructSamplersOld(this, root, &getSymbolTable(), &removedUniformsCount);
+            rewriteStructSamplersResult = mPassManager.run("RewriteStructSamplersOld", [&]() {
+                return RewriteStructSamplersOld(this, root, &getSymbolTable(),
+                                                &removedUniformsCount);
+            });
         }
         else
         {
-            rewriteStructSamplersResult =
-                RewriteStructSamplers(this, root, &getSymbolTable(), &removedUniformsCount);
+            rewriteStructSamplersResult = mPassManager.run("RewriteStructSamplers", [&]() {
+                return RewriteStructSamplers(this, root, &getSymbolTable(), &removedUniformsCount);
+            });
         }
 
         if (!rewriteStructSamplersResult)
@@ -721,9 +730,11 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
         defaultUniformCount -= removedUniformsCount;
 
         // We must declare the struct types before using them.
-        DeclareStructTypesTraverser structTypesTraverser(outputGLSL);
-        root->traverse(&structTypesTraverser);
-        if (!structTypesTraverser.updateTree(this, root))
+        if (!mPassManager.run("DeclareStructTypes", [&]() {
+                DeclareStructTypesTraverser structTypesTraverser(outputGLSL);
+                root->traverse(&structTypesTraverser);
+                return structTypesTraverser.updateTree(this, root);
+            }))
         {
             return false;
         }
@@ -733,14 +744,18 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
     // as it doesn't expect that.
     if (compileOptions & SH_EMULATE_SEAMFUL_CUBE_MAP_SAMPLING)
     {
-        if (!RewriteCubeMapSamplersAs2DArray(this, root, &getSymbolTable(),
-                                             getShaderType() == GL_FRAGMENT_SHADER))
+        if (!mPassManager.run("RewriteCubeMapSamplersAs2DArray", [&]() {
+                return RewriteCubeMapSamplersAs2DArray(this, root, &getSymbolTable(),
+                                                       getShaderType() == GL_FRAGMENT_SHADER);
+            }))
         {
             return false;
         }
     }
 
-    if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
+    if (!mPassManager.run("FlagSamplersForTexelFetch", [&]() {
+            return FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms);
+        }))
     {
         return false;
     }
@@ -751,9 +766,12 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
         sink << "\nlayout(set=0, binding=" << outputGLSL->nextUnusedBinding()
              << ", std140) uniform " << kDefaultUniformNames[shaderType] << "\n{\n";
 
-        DeclareDefaultUniformsTraverser defaultTraverser(&sink, getHashFunction(), &getNameMap());
-        root->traverse(&defaultTraverser);
-        if (!defaultTraverser.updateTree(this, root))
+        if (!mPassManager.run("DeclareDefaultUniforms", [&]() {
+                DeclareDefaultUniformsTraverser defaultTraverser(&sink, getHashFunction(),
+                                                                 &getNameMap());
+                root->traverse(&defaultTraverser);
+                return defaultTraverser.updateTree(this, root);
+            }))
         {
             return false;
         }
@@ -781,7 +799,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
     {
         // ANGLEUniforms.acbBufferOffsets
         const TIntermTyped *acbBufferOffsets = driverUniforms->getAbcBufferOffsets();
-        if (!RewriteAtomicCounters(this, root, &getSymbolTable(), acbBufferOffsets))
+        if (!mPassManager.run("RewriteAtomicCounters", [&]() {
+                return RewriteAtomicCounters(this, root, &getSymbolTable(), acbBufferOffsets);
+            }))
         {
             return false;
         }
@@ -791,7 +811,8 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
         // Vulkan doesn't support Atomic Storage as a Storage Class, but we've seen
         // cases where builtins are using it even with no active atomic counters.
         // This pass simply removes those builtins in that scenario.
-        if (!RemoveAtomicCounterBuiltins(this, root))
+        if (!mPassManager.run("RemoveAtomicCounterBuiltins",
+                              [&]() { return RemoveAtomicCounterBuiltins(this, root); }))
         {
             return false;
         }
@@ -799,7 +820,10 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
 
     if (getShaderType() != GL_COMPUTE_SHADER)
     {
-        if (!ReplaceGLDepthRangeWithDriverUniform(this, root, driverUniforms, &getSymbolTable()))
+        if (!mPassManager.run("ReplaceGLDepthRangeWithDriverUniform", [&]() {
+                return ReplaceGLDepthRangeWithDriverUniform(this, root, driverUniforms,
+                                                            &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -851,8 +875,11 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
 
         if (compileOptions & SH_ADD_BRESENHAM_LINE_RASTER_EMULATION)
         {
-            if (!AddBresenhamEmulationFS(this, compileOptions, sink, root, &getSymbolTable(),
-                                         &surfaceRotationSpecConst, driverUniforms, usesFragCoord))
+            if (!mPassManager.run("AddBresenhamEmulationFS", [&]() {
+                    return AddBresenhamEmulationFS(this, compileOptions, sink, root,
+                                                   &getSymbolTable(), &surfaceRotationSpecConst,
+                                                   driverUniforms, usesFragCoord);
+                }))
             {
                 return false;
             }
@@ -912,9 +939,12 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
                     fragRotation = driverUniforms->getFragRotationMatrixRef();
                 }
             }
-            if (!RotateAndFlipBuiltinVariable(this, root, GetMainSequence(root), flipNegXY,
-                                              &getSymbolTable(), BuiltInVariable::gl_PointCoord(),
-                                              kFlippedPointCoordName, pivot, fragRotation))
+            if (!mPassManager.run("RotateAndFlipPointCoord", [&]() {
+                    return RotateAndFlipBuiltinVariable(
+                        this, root, GetMainSequence(root), flipNegXY, &getSymbolTable(),
+                        BuiltInVariable::gl_PointCoord(), kFlippedPointCoordName, pivot,
+                        fragRotation);
+                }))
             {
                 return false;
             }
@@ -922,28 +952,36 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
 
         if (usesFragCoord)
         {
-            if (!InsertFragCoordCorrection(this, compileOptions, root, GetMainSequence(root),
-                                           &getSymbolTable(), &surfaceRotationSpecConst,
-                                           driverUniforms))
+            if (!mPassManager.run("InsertFragCoordCorrection", [&]() {
+                    return InsertFragCoordCorrection(this, compileOptions, root,
+                                                     GetMainSequence(root), &getSymbolTable(),
+                                                     &surfaceRotationSpecConst, driverUniforms);
+                }))
             {
                 return false;
             }
         }
 
-        if (!RewriteDfdy(this, compileOptions, root, getSymbolTable(), getShaderVersion(),
-                         &surfaceRotationSpecConst, driverUniforms))
+        if (!mPassManager.run("RewriteDfdy", [&]() {
+                return RewriteDfdy(this, compileOptions, root, getSymbolTable(),
+                                   getShaderVersion(), &surfaceRotationSpecConst, driverUniforms);
+            }))
         {
             return false;
         }
 
-        if (!RewriteInterpolateAtOffset(this, compileOptions, root, getSymbolTable(),
-                                        getShaderVersion(), &surfaceRotationSpecConst,
-                                        driverUniforms))
+        if (!mPassManager.run("RewriteInterpolateAtOffset", [&]() {
+                return RewriteInterpolateAtOffset(this, compileOptions, root, getSymbolTable(),
+                                                  getShaderVersion(), &surfaceRotationSpecConst,
+                                                  driverUniforms);
+            }))
         {
             return false;
         }
 
-        if (usesSampleMaskIn && !RewriteSampleMaskIn(this, root, &getSymbolTable()))
+        if (usesSampleMaskIn && !mPassManager.run("RewriteSampleMaskIn", [&]() {
+                return RewriteSampleMaskIn(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -951,7 +989,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
         if (hasGLSampleMask)
         {
             TIntermBinary *numSamples = driverUniforms->getNumSamplesRef();
-            if (!RewriteSampleMask(this, root, &getSymbolTable(), numSamples))
+            if (!mPassManager.run("RewriteSampleMask", [&]() {
+                    return RewriteSampleMask(this, root, &getSymbolTable(), numSamples);
+                }))
             {
                 return false;
             }
@@ -961,7 +1001,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
             const TVariable *numSamplesVar = static_cast<const TVariable *>(
                 getSymbolTable().findBuiltIn(ImmutableString("gl_NumSamples"), getShaderVersion()));
             TIntermBinary *numSamples = driverUniforms->getNumSamplesRef();
-            if (!ReplaceVariableWithTyped(this, root, numSamplesVar, numSamples))
+            if (!mPassManager.run("ReplaceNumSamples", [&]() {
+                    return ReplaceVariableWithTyped(this, root, numSamplesVar, numSamples);
+                }))
             {
                 return false;
             }
@@ -973,7 +1015,9 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
     {
         if (compileOptions & SH_ADD_BRESENHAM_LINE_RASTER_EMULATION)
         {
-            if (!AddBresenhamEmulationVS(this, root, &getSymbolTable(), driverUniforms))
+            if (!mPassManager.run("AddBresenhamEmulationVS", [&]() {
+                    return AddBresenhamEmulationVS(this, root, &getSymbolTable(), driverUniforms);
+                }))
             {
                 return false;
             }
@@ -984,7 +1028,10 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
         sink << "@@ XFB-DECL @@\n\n";
 
         // Append a macro for transform feedback substitution prior to modifying depth.
-        if (!AppendVertexShaderTransformFeedbackOutputToMain(this, root, &getSymbolTable()))
+        if (!mPassManager.run("AppendVertexShaderTransformFeedbackOutputToMain", [&]() {
+                return AppendVertexShaderTransformFeedbackOutputToMain(this, root,
+                                                                       &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -999,25 +1046,32 @@ bool TranslatorVulkan::translateImpl(TIntermBlock *root,
                 break;
             }
         }
-        if (useClipDistance &&
-            !ReplaceClipDistanceAssignments(this, root, &getSymbolTable(),
-                                            driverUniforms->getClipDistancesEnabled()))
+        if (useClipDistance && !mPassManager.run("ReplaceClipDistanceAssignments", [&]() {
+                return ReplaceClipDistanceAssignments(this, root, &getSymbolTable(),
+                                                      driverUniforms->getClipDistancesEnabled());
+            }))
         {
             return false;
         }
 
         // Append depth range translation to main.
-        if (!transformDepthBeforeCorrection(root, driverUniforms))
+        if (!mPassManager.run("TransformDepthBeforeCorrection", [&]() {
+                return transformDepthBeforeCorrection(root, driverUniforms);
+            }))
         {
             return false;
         }
-        if (!AppendVertexShaderDepthCorrectionToMain(this, root, &getSymbolTable()))
+        if (!mPassManager.run("AppendVertexShaderDepthCorrectionToMain", [&]() {
+                return AppendVertexShaderDepthCorrectionToMain(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
         if ((compileOptions & SH_ADD_PRE_ROTATION) != 0 &&
-            !AppendPreRotation(this, root, &getSymbolTable(), &surfaceRotationSpecConst,
-                               driverUniforms))
+            !mPassManager.run("AppendPreRotation", [&]() {
+                return AppendPreRotation(this, root, &getSymbolTable(), &surfaceRotationSpecConst,
+                                         driverUniforms);
+            }))
         {
             return false;
         }
@@ -13,6 +13,7 @@
 
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/ParseContext.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
 namespace sh
@@ -169,16 +170,19 @@ void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
 
 }  // anonymous namespace
 
-bool ValidateOutputs(TIntermBlock *root,
+void ValidateOutputs(PassManager *passManager,
                      const TExtensionBehavior &extBehavior,
                      int maxDrawBuffers,
                      TDiagnostics *diagnostics)
 {
-    ValidateOutputsTraverser validateOutputs(extBehavior, maxDrawBuffers);
-    root->traverse(&validateOutputs);
-    int numErrorsBefore = diagnostics->numErrors();
-    validateOutputs.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    auto validateOutputs = std::make_unique<ValidateOutputsTraverser>(extBehavior, maxDrawBuffers);
+    ValidateOutputsTraverser *validator = validateOutputs.get();
+    passManager->queueTraversal("ValidateOutputs", std::move(validateOutputs),
+                                PassManager::kAllAnalyses, [validator, diagnostics]() {
+                                    int numErrorsBefore = diagnostics->numErrors();
+                                    validator->validate(diagnostics);
+                                    return (diagnostics->numErrors() == numErrorsBefore);
+                                });
 }
 
 }  // namespace sh
@@ -16,11 +16,12 @@
 namespace sh
 {
 
-class TIntermBlock;
 class TDiagnostics;
+class PassManager;
 
-// Returns true if the shader has no conflicting or otherwise erroneous fragment outputs.
-bool ValidateOutputs(TIntermBlock *root,
+// Queues the validation in the pass manager, whose flush fails if the shader has conflicting or
+// otherwise erroneous fragment outputs.
+void ValidateOutputs(PassManager *passManager,
                      const TExtensionBehavior &extBehavior,
                      int maxDrawBuffers,
                      TDiagnostics *diagnostics);
@@ -10,6 +10,7 @@
 #include "ValidateVaryingLocations.h"
 
 #include "compiler/translator/Diagnostics.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/util.h"
@@ -177,13 +178,18 @@ unsigned int CalculateVaryingLocationCount(TIntermSymbol *varying, GLenum shader
     return GetLocationCount(varying, shaderType == GL_GEOMETRY_SHADER_EXT);
 }
 
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType)
+void ValidateVaryingLocations(PassManager *passManager,
+                              TDiagnostics *diagnostics,
+                              GLenum shaderType)
 {
-    ValidateVaryingLocationsTraverser varyingValidator(shaderType);
-    root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    auto varyingValidator = std::make_unique<ValidateVaryingLocationsTraverser>(shaderType);
+    ValidateVaryingLocationsTraverser *validator = varyingValidator.get();
+    passManager->queueTraversal("ValidateVaryingLocations", std::move(varyingValidator),
+                                PassManager::kAllAnalyses, [validator, diagnostics]() {
+                                    int numErrorsBefore = diagnostics->numErrors();
+                                    validator->validate(diagnostics);
+                                    return (diagnostics->numErrors() == numErrorsBefore);
+                                });
 }
 
 }  // namespace sh
@@ -15,12 +15,15 @@
 namespace sh
 {
 
-class TIntermBlock;
 class TIntermSymbol;
 class TDiagnostics;
+class PassManager;
 
 unsigned int CalculateVaryingLocationCount(TIntermSymbol *varying, GLenum shaderType);
-bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType);
+// Queues the validation in the pass manager, whose flush fails if there are location conflicts.
+void ValidateVaryingLocations(PassManager *passManager,
+                              TDiagnostics *diagnostics,
+                              GLenum shaderType);
 
 }  // namespace sh
 
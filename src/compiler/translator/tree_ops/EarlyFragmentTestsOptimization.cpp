@@ -10,6 +10,7 @@
 #include "compiler/translator/tree_ops/EarlyFragmentTestsOptimization.h"
 
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/tree_util/IntermNode_util.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
@@ -64,16 +65,16 @@ bool CheckEFTOptimizationTraverser::visitBranch(Visit visit, TIntermBranch *node
 
 }  // namespace
 
-bool CheckEarlyFragmentTestsFeasible(TCompiler *compiler, TIntermNode *root)
+void CheckEarlyFragmentTestsFeasible(PassManager *passManager, bool *feasibleOut)
 {
-    CheckEFTOptimizationTraverser traverser;
-    root->traverse(&traverser);
-
-    if (traverser.isFragDepthUsed() || traverser.isDiscardOpUsed())
-    {
-        return false;
-    }
-    return true;
+    auto checker                             = std::make_unique<CheckEFTOptimizationTraverser>();
+    CheckEFTOptimizationTraverser *traverser = checker.get();
+    passManager->queueTraversal("CheckEarlyFragmentTestsFeasible", std::move(checker),
+                                PassManager::kAllAnalyses, [traverser, feasibleOut]() {
+                                    *feasibleOut = !traverser->isFragDepthUsed() &&
+                                                   !traverser->isDiscardOpUsed();
+                                    return true;
+                                });
 }
 
 }  // namespace sh
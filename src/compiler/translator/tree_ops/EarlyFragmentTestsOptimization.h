@@ -14,10 +14,10 @@
 
 namespace sh
 {
-class TCompiler;
-class TIntermNode;
+class PassManager;
 
-ANGLE_NO_DISCARD bool CheckEarlyFragmentTestsFeasible(TCompiler *compiler, TIntermNode *root);
+// Queues the check in the pass manager.  |feasibleOut| is set when the queued traversals are done.
+void CheckEarlyFragmentTestsFeasible(PassManager *passManager, bool *feasibleOut);
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_EARLYFRAGMENTTESTSOPTIMIZATION_H_
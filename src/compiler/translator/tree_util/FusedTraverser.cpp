@@ -0,0 +1,313 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several traversers in a single traversal of the tree.
+
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+namespace sh
+{
+
+TIntermFusedTraverser::TIntermFusedTraverser() : TIntermTraverser(true, true, true) {}
+
+TIntermFusedTraverser::~TIntermFusedTraverser() {}
+
+void TIntermFusedTraverser::addTraverser(TIntermTraverser *traverser)
+{
+    ASSERT(traverser != nullptr && traverser != this);
+    mTraversers.push_back({traverser, kNotSkipping});
+}
+
+bool TIntermFusedTraverser::updateTrees(TCompiler *compiler, TIntermNode *node)
+{
+    ASSERT(getCurrentTraversalDepth() == -1);
+
+    for (FusedTraverser &fused : mTraversers)
+    {
+        TIntermTraverser *traverser = fused.traverser;
+        if (traverser->mInsertions.empty() && traverser->mReplacements.empty() &&
+            traverser->mMultiReplacements.empty())
+        {
+            continue;
+        }
+        if (!traverser->updateTree(compiler, node))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Called with the node already in the path of the fused traverser, so its depth is the current
+// traversal depth.  Traversers skipping an ancestor of the node don't enter it, and traversers
+// that reach their depth limit skip it.
+void TIntermFusedTraverser::enterNode(TIntermNode *node)
+{
+    const int depth           = getCurrentTraversalDepth();
+    TIntermBlock *parentBlock = node->getAsBlock();
+
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth != kNotSkipping)
+        {
+            continue;
+        }
+        if (!fused.traverser->incrementDepth(node))
+        {
+            fused.skippingAtDepth = depth;
+        }
+        if (parentBlock != nullptr)
+        {
+            fused.traverser->pushParentBlock(parentBlock);
+        }
+    }
+}
+
+// The traversers that entered the node are the ones that either still visit it or started
+// skipping at it.
+void TIntermFusedTraverser::leaveNode(TIntermNode *node)
+{
+    const int depth  = getCurrentTraversalDepth();
+    const bool block = node->getAsBlock() != nullptr;
+
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth == depth)
+        {
+            fused.skippingAtDepth = kNotSkipping;
+        }
+        else if (fused.skippingAtDepth != kNotSkipping)
+        {
+            continue;
+        }
+        if (block)
+        {
+            fused.traverser->popParentBlock();
+        }
+        fused.traverser->decrementDepth();
+    }
+}
+
+template <typename T>
+bool TIntermFusedTraverser::visitFused(Visit visit, T *node)
+{
+    if (visit == PreVisit)
+    {
+        enterNode(node);
+    }
+
+    const int depth  = getCurrentTraversalDepth();
+    bool anyVisiting = false;
+
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth != kNotSkipping)
+        {
+            continue;
+        }
+
+        TIntermTraverser *traverser = fused.traverser;
+        bool visitEnabled           = traverser->postVisit;
+        if (visit != PostVisit)
+        {
+            visitEnabled = visit == PreVisit ? traverser->preVisit : traverser->inVisit;
+        }
+
+        // The result of the post-visit is ignored, like in a traversal of a single traverser.
+        if (visitEnabled && !node->visit(visit, traverser) && visit != PostVisit)
+        {
+            fused.skippingAtDepth = depth;
+            continue;
+        }
+        anyVisiting = true;
+    }
+
+    if (visit == PostVisit || !anyVisiting)
+    {
+        leaveNode(node);
+        return false;
+    }
+    return true;
+}
+
+// Leaf nodes are visited regardless of the depth limit and of the visit flags, like in
+// TIntermSymbol::traverse().
+template <typename T>
+void TIntermFusedTraverser::visitLeaf(T *node)
+{
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth == kNotSkipping)
+        {
+            ScopedNodeInTraversalPath addToPath(fused.traverser, node);
+            node->visit(PreVisit, fused.traverser);
+        }
+    }
+}
+
+void TIntermFusedTraverser::visitSymbol(TIntermSymbol *node)
+{
+    visitLeaf(node);
+}
+
+void TIntermFusedTraverser::visitConstantUnion(TIntermConstantUnion *node)
+{
+    visitLeaf(node);
+}
+
+bool TIntermFusedTraverser::visitSwizzle(Visit visit, TIntermSwizzle *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitUnary(Visit visit, TIntermUnary *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitTernary(Visit visit, TIntermTernary *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitCase(Visit visit, TIntermCase *node)
+{
+    return visitFused(visit, node);
+}
+
+void TIntermFusedTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    visitLeaf(node);
+}
+
+bool TIntermFusedTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitGlobalQualifierDeclaration(
+    Visit visit,
+    TIntermGlobalQualifierDeclaration *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    return visitFused(visit, node);
+}
+
+bool TIntermFusedTraverser::visitBranch(Visit visit, TIntermBranch *node)
+{
+    return visitFused(visit, node);
+}
+
+void TIntermFusedTraverser::visitPreprocessorDirective(TIntermPreprocessorDirective *node)
+{
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth == kNotSkipping)
+        {
+            fused.traverser->visitPreprocessorDirective(node);
+        }
+    }
+}
+
+void TIntermFusedTraverser::traverseFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    ScopedNodeInTraversalPath addToPath(this, node);
+
+    if (!visitFused(PreVisit, node))
+    {
+        return;
+    }
+
+    node->getFunctionPrototype()->traverse(this);
+    if (!visitFused(InVisit, node))
+    {
+        return;
+    }
+
+    // The traversers visiting the body are the same before and after it.
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth == kNotSkipping)
+        {
+            fused.traverser->mInGlobalScope = false;
+        }
+    }
+    node->getBody()->traverse(this);
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippingAtDepth == kNotSkipping)
+        {
+            fused.traverser->mInGlobalScope = true;
+        }
+    }
+
+    visitFused(PostVisit, node);
+}
+
+void TIntermFusedTraverser::traverseBlock(TIntermBlock *node)
+{
+    ScopedNodeInTraversalPath addToPath(this, node);
+
+    if (!visitFused(PreVisit, node))
+    {
+        return;
+    }
+
+    TIntermSequence *sequence = node->getSequence();
+    for (TIntermNode *child : *sequence)
+    {
+        child->traverse(this);
+        if (child != sequence->back() && !visitFused(InVisit, node))
+        {
+            return;
+        }
+
+        for (FusedTraverser &fused : mTraversers)
+        {
+            if (fused.skippingAtDepth == kNotSkipping)
+            {
+                fused.traverser->incrementParentBlockPos();
+            }
+        }
+    }
+
+    visitFused(PostVisit, node);
+}
+
+}  // namespace sh
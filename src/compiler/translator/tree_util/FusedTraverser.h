@@ -0,0 +1,85 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several traversers in a single traversal of the tree.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+
+#include <vector>
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+// Calls the visit functions of several traversers during one traversal of the tree, in the order
+// the traversers were added, as if each of them traversed the tree on its own.  Each traverser
+// keeps its own path, parent blocks and depth limit, and returning false from a visit function
+// only skips the rest of the subtree for that traverser.
+//
+// The traversers must not override the traverse*() functions.  They don't see each other's changes
+// to the tree, which are only applied by updateTrees() after the traversal.  As insertions in
+// blocks are made by position, at most one of the traversers may insert statements.
+class TIntermFusedTraverser : public TIntermTraverser
+{
+  public:
+    TIntermFusedTraverser();
+    ~TIntermFusedTraverser() override;
+
+    void addTraverser(TIntermTraverser *traverser);
+
+    // Applies the changes each traverser queued, in the order the traversers were added.  Returns
+    // false if the tree is invalid after an update.
+    ANGLE_NO_DISCARD bool updateTrees(TCompiler *compiler, TIntermNode *node);
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitConstantUnion(TIntermConstantUnion *node) override;
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitTernary(Visit visit, TIntermTernary *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override;
+    bool visitCase(Visit visit, TIntermCase *node) override;
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override;
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBranch(Visit visit, TIntermBranch *node) override;
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override;
+
+    void traverseFunctionDefinition(TIntermFunctionDefinition *node) override;
+    void traverseBlock(TIntermBlock *node) override;
+
+  private:
+    struct FusedTraverser
+    {
+        TIntermTraverser *traverser;
+        // Depth of the node whose subtree the traverser skips, or kNotSkipping.
+        int skippingAtDepth;
+    };
+    static constexpr int kNotSkipping = -1;
+
+    // Returns false once none of the traversers visit the rest of the node's subtree, in which
+    // case the traversers have already left the node.
+    template <typename T>
+    bool visitFused(Visit visit, T *node);
+    template <typename T>
+    void visitLeaf(T *node);
+
+    void enterNode(TIntermNode *node);
+    void leaveNode(TIntermNode *node);
+
+    std::vector<FusedTraverser> mTraversers;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
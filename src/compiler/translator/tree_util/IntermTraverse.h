@@ -133,6 +133,8 @@ class TIntermTraverser : angle::NonCopyable
     friend void TIntermSymbol::traverse(TIntermTraverser *);
     friend void TIntermConstantUnion::traverse(TIntermTraverser *);
     friend void TIntermFunctionPrototype::traverse(TIntermTraverser *);
+    // The fused traverser does the bookkeeping of the traversers it runs.
+    friend class TIntermFusedTraverser;
 
     TIntermNode *getParentNode() const
     {
@@ -11,9 +11,13 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
@@ -39,6 +43,13 @@ class BinaryInputStream : angle::NonCopyable
         mLength = length;
     }
 
+    // Keeps |storage| alive for as long as anything read in place from the stream holds on to it.
+    explicit BinaryInputStream(std::shared_ptr<const angle::MemoryBuffer> storage)
+        : BinaryInputStream(storage->data(), storage->size())
+    {
+        mStorage = std::move(storage);
+    }
+
     // readInt will generate an error for bool types
     template <class IntT>
     IntT readInt()
@@ -67,6 +78,40 @@ class BinaryInputStream : angle::NonCopyable
         }
     }
 
+    // Reads a vector written by BinaryOutputStream::writeVector with a single copy.
+    template <class T>
+    void readVector(std::vector<T> *param)
+    {
+        size_t size          = 0;
+        const uint8_t *bytes = getVectorBytes<T>(&size);
+        if (bytes == nullptr)
+        {
+            return;
+        }
+
+        param->resize(size);
+        if (size > 0)
+        {
+            memcpy(param->data(), bytes, size * sizeof(T));
+        }
+    }
+
+    // Reads a vector written by BinaryOutputStream::writeVector in place.  The elements live as
+    // long as the data the stream was created with, which getStorage() can keep alive.  Returns
+    // nullptr if the stream is too short or if the elements are not aligned in memory, which
+    // writeVector ensures for streams that start at an aligned address.
+    template <class T>
+    const T *getVector(size_t *sizeOut)
+    {
+        const uint8_t *bytes = getVectorBytes<T>(sizeOut);
+        if (bytes == nullptr || reinterpret_cast<uintptr_t>(bytes) % alignof(T) != 0)
+        {
+            mError = true;
+            return nullptr;
+        }
+        return reinterpret_cast<const T *>(bytes);
+    }
+
     template <class EnumT>
     EnumT readEnum()
     {
@@ -121,6 +166,21 @@ class BinaryInputStream : angle::NonCopyable
         mOffset = checkedOffset.ValueOrDie();
     }
 
+    // Returns the next |length| bytes of the stream in place and skips past them, or nullptr if
+    // the stream is too short.  Lets large blobs such as shader binaries be used without a copy;
+    // the bytes live as long as the data the stream was created with.
+    const uint8_t *getBytes(size_t length)
+    {
+        if (mError)
+        {
+            return nullptr;
+        }
+
+        const uint8_t *bytes = mData + mOffset;
+        skip(length);
+        return mError ? nullptr : bytes;
+    }
+
     void skip(size_t length)
     {
         angle::CheckedNumeric<size_t> checkedOffset(mOffset);
@@ -148,11 +208,33 @@ class BinaryInputStream : angle::NonCopyable
 
     const uint8_t *data() { return mData; }
 
+    // The buffer the stream was created with, or nullptr if it does not own a reference to it.
+    const std::shared_ptr<const angle::MemoryBuffer> &getStorage() const { return mStorage; }
+
   private:
     bool mError;
     size_t mOffset;
     const uint8_t *mData;
     size_t mLength;
+    std::shared_ptr<const angle::MemoryBuffer> mStorage;
+
+    template <class T>
+    const uint8_t *getVectorBytes(size_t *sizeOut)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+        *sizeOut = readInt<size_t>();
+        angle::CheckedNumeric<size_t> checkedByteSize(*sizeOut);
+        checkedByteSize *= sizeof(T);
+        if (!checkedByteSize.IsValid())
+        {
+            mError = true;
+            return nullptr;
+        }
+
+        skip((alignof(T) - mOffset % alignof(T)) % alignof(T));
+        return getBytes(checkedByteSize.ValueOrDie());
+    }
 
     template <typename T>
     void read(T *v, size_t num)
@@ -228,6 +310,24 @@ class BinaryOutputStream : angle::NonCopyable
         }
     }
 
+    // Writes the elements in a single block, to be read back with BinaryInputStream::readVector or
+    // getVector.  Unlike writeIntVector, element types are not promoted.  The block is padded to
+    // the alignment of T relative to the start of the stream so that it can be used in place.
+    template <class T>
+    void writeVector(const T *data, size_t size)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        writeInt(size);
+        mData.resize(mData.size() + (alignof(T) - mData.size() % alignof(T)) % alignof(T), 0);
+        writeBytes(reinterpret_cast<const unsigned char *>(data), size * sizeof(T));
+    }
+
+    template <class T>
+    void writeVector(const std::vector<T> &param)
+    {
+        writeVector(param.data(), param.size());
+    }
+
     template <class EnumT>
     void writeEnum(EnumT param)
     {
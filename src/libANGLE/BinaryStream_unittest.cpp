@@ -85,4 +85,81 @@ TEST(BinaryStream, IntVector)
         ASSERT_EQ(writeData[i], readData[i]);
     }
 }
+
+// Test that readVector and writeVector match, including for empty vectors.
+TEST(BinaryStream, Vector)
+{
+    std::vector<uint32_t> writeData = {1, 0xFFFFFFFF, 3, 0x12345678};
+    std::vector<uint32_t> readData;
+    std::vector<uint32_t> readEmptyData;
+
+    gl::BinaryOutputStream out;
+    out.writeVector(writeData);
+    out.writeVector(std::vector<uint32_t>());
+
+    gl::BinaryInputStream in(out.data(), out.length());
+    in.readVector(&readData);
+    in.readVector(&readEmptyData);
+
+    ASSERT_FALSE(in.error());
+    ASSERT_TRUE(in.endOfStream());
+    EXPECT_EQ(writeData, readData);
+    EXPECT_TRUE(readEmptyData.empty());
+
+    // A vector that is longer than the stream is an error.
+    gl::BinaryInputStream truncated(out.data(), sizeof(uint64_t) + sizeof(uint32_t));
+    truncated.readVector(&readData);
+    EXPECT_TRUE(truncated.error());
+}
+
+// Test that getBytes returns bytes in place and fails past the end of the stream.
+TEST(BinaryInputStream, GetBytes)
+{
+    const std::vector<uint8_t> data = {1, 2, 3, 4, 5, 6};
+
+    gl::BinaryInputStream stream(data.data(), data.size());
+    EXPECT_EQ(data.data(), stream.getBytes(2));
+    EXPECT_EQ(data.data() + 2, stream.getBytes(3));
+    EXPECT_FALSE(stream.error());
+
+    EXPECT_EQ(nullptr, stream.getBytes(2));
+    EXPECT_TRUE(stream.error());
+
+    // Once the stream is in error, nothing more is returned.
+    EXPECT_EQ(nullptr, stream.getBytes(0));
+}
+
+// Test that getVector returns aligned elements in place, even after fields that leave the stream
+// unaligned, and that the stream's storage outlives the stream.
+TEST(BinaryInputStream, GetVector)
+{
+    std::vector<uint32_t> writeData = {1, 0xFFFFFFFF, 3, 0x12345678};
+
+    gl::BinaryOutputStream out;
+    out.writeBytes(reinterpret_cast<const unsigned char *>("x"), 1);
+    out.writeVector(writeData);
+
+    auto storage = std::make_shared<angle::MemoryBuffer>();
+    ASSERT_TRUE(storage->resize(out.length()));
+    memcpy(storage->data(), out.data(), out.length());
+
+    std::shared_ptr<const angle::MemoryBuffer> keptStorage;
+    const uint32_t *readData = nullptr;
+    size_t readSize          = 0;
+    {
+        gl::BinaryInputStream in(storage);
+        storage.reset();
+
+        in.skip(1);
+        readData = in.getVector<uint32_t>(&readSize);
+        ASSERT_FALSE(in.error());
+        ASSERT_TRUE(in.endOfStream());
+
+        keptStorage = in.getStorage();
+    }
+
+    ASSERT_NE(nullptr, readData);
+    EXPECT_GE(readData, reinterpret_cast<const uint32_t *>(keptStorage->data()));
+    EXPECT_EQ(writeData, std::vector<uint32_t>(readData, readData + readSize));
+}
 }  // namespace angle
@@ -8,9 +8,14 @@
 // disk.  MemoryProgramCache uses this to handle caching of compiled programs.
 
 #include "libANGLE/BlobCache.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/MappedBlobStore.h"
 #include "libANGLE/histogram_macros.h"
 #include "platform/PlatformMethods.h"
 
@@ -27,12 +32,40 @@ enum CacheResult
     kCacheResultMax,
 };
 
+size_t GetShardCount(size_t maxCacheSizeBytes, size_t maxShardCount, size_t minShardSizeBytes)
+{
+    // Keep the count a power of two so the shard can be picked with a mask.
+    size_t shardCount = 1;
+    while (shardCount * 2 <= maxShardCount &&
+           maxCacheSizeBytes / (shardCount * 2) >= minShardSizeBytes)
+    {
+        shardCount *= 2;
+    }
+    return shardCount;
+}
 }  // anonymous namespace
 
-BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
+BlobCache::Shard::Shard()
+    : store(CacheStore::NO_AUTO_EVICT),
+      maxSize(0),
+      currentSize(0),
+      hits(0),
+      misses(0),
+      evictions(0)
 {}
 
+BlobCache::Shard::~Shard() = default;
+
+BlobCache::BlobCache(size_t maxCacheSizeBytes)
+    : mShardCount(1),
+      mMaxSize(0),
+      mEvictionPolicy(BlobCacheEvictionPolicy::LeastRecentlyUsed),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr)
+{
+    resize(maxCacheSizeBytes);
+}
+
 BlobCache::~BlobCache() {}
 
 void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
@@ -44,6 +77,10 @@ void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
     }
     else
     {
+        if (mFileStore)
+        {
+            mFileStore->append(key, value.data(), value.size());
+        }
         populate(key, std::move(value), CacheSource::Memory);
     }
 }
@@ -58,12 +95,43 @@ void BlobCache::putApplication(const BlobCache::Key &key, const angle::MemoryBuf
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
 {
+    const size_t size = value.size();
+
     CacheEntry newEntry;
-    newEntry.first  = std::move(value);
-    newEntry.second = source;
+    newEntry.blob     = std::make_shared<angle::MemoryBuffer>(std::move(value));
+    newEntry.source   = source;
+    newEntry.useCount = 0;
 
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    std::unique_lock<std::mutex> lock;
+    Shard *shard = &lockShard(key, &lock);
+
+    if (size > shard->maxSize)
+    {
+        if (size > mMaxSize)
+        {
+            return;
+        }
+
+        // A blob larger than a shard's share of the cache would otherwise be dropped, so make the
+        // shards bigger instead.  Merging takes every shard's lock.
+        lock.unlock();
+        mergeShards(size);
+        shard = &lockShard(key, &lock);
+
+        if (size > shard->maxSize)
+        {
+            return;
+        }
+    }
+
+    // Check for existing key.
+    eraseLocked(shard, key);
+
+    shard->store.Put(key, std::move(newEntry));
+    shard->currentSize += size;
+
+    shrinkLocked(shard, shard->maxSize);
 }
 
 bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
@@ -74,9 +142,13 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     // Look into the application's cache, if there is such a cache
     if (areBlobCacheFuncsSet())
     {
+        // The statistics are atomic, so they don't need the shard's lock.
+        Shard &shard = getShard(key);
+
         EGLsizeiANDROID valueSize = mGetBlobFunc(key.data(), key.size(), nullptr, 0);
         if (valueSize <= 0)
         {
+            shard.misses++;
             return false;
         }
 
@@ -99,21 +171,48 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
             // currently known to be thread-safe.  If such a use ever arises, this WARN can be
             // removed.
             WARN() << "Binary blob no longer available in cache (removed by a thread?)";
+            shard.misses++;
             return false;
         }
 
         *valueOut      = BlobCache::Value(scratchMemory->data(), scratchMemory->size());
         *bufferSizeOut = valueSize;
+        shard.hits++;
         return true;
     }
 
     // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    bool result        = false;
+    CacheSource source = CacheSource::Memory;
+    Shard *shard       = nullptr;
+    {
+        std::unique_lock<std::mutex> lock;
+        shard     = &lockShard(key, &lock);
+        auto iter = shard->store.Get(key);
+        if (iter != shard->store.end())
+        {
+            CacheEntry &entry = iter->second;
+            entry.useCount++;
+
+            *valueOut      = BlobCache::Value(entry.blob);
+            *bufferSizeOut = entry.blob->size();
+            source         = entry.source;
+            result         = true;
+        }
+    }
+
+    // Blobs persisted by previous runs are served straight from the file.
+    if (!result && mFileStore && mFileStore->get(key, valueOut))
+    {
+        *bufferSizeOut = valueOut->size();
+        source         = CacheSource::Disk;
+        result         = true;
+    }
 
     if (result)
     {
-        if (entry->second == CacheSource::Memory)
+        shard->hits++;
+        if (source == CacheSource::Memory)
         {
             ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitMemory,
                                         kCacheResultMax);
@@ -123,12 +222,10 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
             ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitDisk,
                                         kCacheResultMax);
         }
-
-        *valueOut      = BlobCache::Value(entry->first.data(), entry->first.size());
-        *bufferSizeOut = entry->first.size();
     }
     else
     {
+        shard->misses++;
         ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
                                     kCacheResultMax);
     }
@@ -136,20 +233,249 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     return result;
 }
 
-bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
+bool BlobCache::getAt(size_t index, BlobCache::Key *keyOut, BlobCache::Value *valueOut)
 {
-    const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
-    if (result)
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        if (index < shard.store.size())
+        {
+            auto iter = shard.store.begin();
+            std::advance(iter, index);
+            *keyOut   = iter->first;
+            *valueOut = BlobCache::Value(iter->second.blob);
+            return true;
+        }
+        index -= shard.store.size();
     }
-    return result;
+    return false;
 }
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    mBlobCache.eraseByKey(key);
+    {
+        std::unique_lock<std::mutex> lock;
+        Shard &shard = lockShard(key, &lock);
+        eraseLocked(&shard, key);
+    }
+
+    if (mFileStore)
+    {
+        mFileStore->remove(key);
+    }
+}
+
+void BlobCache::clear()
+{
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.store.Clear();
+        shard.currentSize = 0;
+    }
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    const size_t shardCount = GetShardCount(maxCacheSizeBytes, kMaxShardCount, kMinShardSizeBytes);
+    mShardCount             = shardCount;
+    mMaxSize                = maxCacheSizeBytes;
+
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.store.Clear();
+        shard.currentSize = 0;
+        shard.maxSize     = shardIndex < shardCount ? maxCacheSizeBytes / shardCount : 0;
+    }
+}
+
+size_t BlobCache::entryCount() const
+{
+    size_t count = 0;
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        const Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        count += shard.store.size();
+    }
+    return count;
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    // Trim every shard to its share of the limit.  Shards past the current count are empty.  The
+    // count is read under each shard's lock, as mergeShards holds all of them to change it.
+    size_t bytesFreed = 0;
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        bytesFreed += shrinkLocked(&shard, limit / mShardCount);
+    }
+    return bytesFreed;
+}
+
+size_t BlobCache::size() const
+{
+    size_t currentSize = 0;
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        const Shard &shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        currentSize += shard.currentSize;
+    }
+    return currentSize;
+}
+
+void BlobCache::setFileStore(std::unique_ptr<MappedBlobStore> fileStore)
+{
+    mFileStore = std::move(fileStore);
+}
+
+BlobCacheStatistics BlobCache::getStatistics() const
+{
+    BlobCacheStatistics statistics;
+    for (const Shard &shard : mShards)
+    {
+        statistics.hits += shard.hits.load(std::memory_order_relaxed);
+        statistics.misses += shard.misses.load(std::memory_order_relaxed);
+        statistics.evictions += shard.evictions.load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+BlobCache::Shard &BlobCache::getShard(const BlobCache::Key &key)
+{
+    const size_t hash = std::hash<BlobCache::Key>()(key);
+    return mShards[hash & (mShardCount - 1)];
+}
+
+BlobCache::Shard &BlobCache::lockShard(const BlobCache::Key &key,
+                                       std::unique_lock<std::mutex> *lockOut)
+{
+    while (true)
+    {
+        const size_t shardCount = mShardCount;
+        const size_t hash       = std::hash<BlobCache::Key>()(key);
+        Shard &shard            = mShards[hash & (shardCount - 1)];
+        *lockOut                = std::unique_lock<std::mutex>(shard.mutex);
+
+        // mergeShards holds every lock while it changes the count, so it can't change again
+        // while this one is held.
+        if (mShardCount == shardCount)
+        {
+            return shard;
+        }
+        lockOut->unlock();
+    }
+}
+
+void BlobCache::mergeShards(size_t blobSize)
+{
+    // Always lock in index order so that concurrent merges can't deadlock.
+    std::array<std::unique_lock<std::mutex>, kMaxShardCount> locks;
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        locks[shardIndex] = std::unique_lock<std::mutex>(mShards[shardIndex].mutex);
+    }
+
+    const size_t shardCount = mShardCount;
+    const size_t newShardCount =
+        GetShardCount(mMaxSize, shardCount, std::max(kMinShardSizeBytes, blobSize));
+    if (newShardCount >= shardCount)
+    {
+        // Another thread already merged the shards.
+        return;
+    }
+
+    // Take the entries out, least recently used first so that re-adding them keeps their order
+    // within each of the old shards.
+    std::vector<std::pair<BlobCache::Key, CacheEntry>> entries;
+    for (size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        Shard &shard = mShards[shardIndex];
+        for (auto iter = shard.store.rbegin(); iter != shard.store.rend(); ++iter)
+        {
+            entries.emplace_back(iter->first, std::move(iter->second));
+        }
+        shard.store.Clear();
+        shard.currentSize = 0;
+    }
+
+    mShardCount = newShardCount;
+    for (size_t shardIndex = 0; shardIndex < kMaxShardCount; ++shardIndex)
+    {
+        mShards[shardIndex].maxSize = shardIndex < newShardCount ? mMaxSize / newShardCount : 0;
+    }
+
+    for (auto &entry : entries)
+    {
+        Shard &shard = getShard(entry.first);
+        shard.currentSize += entry.second.blob->size();
+        shard.store.Put(entry.first, std::move(entry.second));
+    }
+
+    // The merged shards hold the same number of bytes, but not necessarily spread evenly.
+    for (size_t shardIndex = 0; shardIndex < newShardCount; ++shardIndex)
+    {
+        shrinkLocked(&mShards[shardIndex], mShards[shardIndex].maxSize);
+    }
+}
+
+void BlobCache::eraseLocked(Shard *shard, const BlobCache::Key &key)
+{
+    auto existing = shard->store.Peek(key);
+    if (existing != shard->store.end())
+    {
+        shard->currentSize -= existing->second.blob->size();
+        shard->store.Erase(existing);
+    }
+}
+
+size_t BlobCache::shrinkLocked(Shard *shard, size_t limit)
+{
+    const size_t initialSize = shard->currentSize;
+
+    while (shard->currentSize > limit)
+    {
+        ASSERT(!shard->store.empty());
+
+        // Least recently used evicts the last entry.  The size-aware policy looks at a few entries
+        // from the end, but never at the most recently used one so that a blob that was just added
+        // isn't thrown out right away.
+        size_t candidateCount = 1;
+        if (mEvictionPolicy == BlobCacheEvictionPolicy::SizeAwareLeastFrequentlyUsed)
+        {
+            candidateCount =
+                std::max<size_t>(1, std::min(kEvictionSampleCount, shard->store.size() - 1));
+        }
+
+        auto victim = shard->store.rbegin();
+        auto iter   = std::next(victim);
+        for (size_t candidate = 1; candidate < candidateCount; ++candidate, ++iter)
+        {
+            // Prefer the entry with the fewest hits per byte.
+            const uint64_t iterScore =
+                static_cast<uint64_t>(iter->second.useCount + 1) * victim->second.blob->size();
+            const uint64_t victimScore =
+                static_cast<uint64_t>(victim->second.useCount + 1) * iter->second.blob->size();
+            if (iterScore < victimScore)
+            {
+                victim = iter;
+            }
+        }
+
+        shard->currentSize -= victim->second.blob->size();
+        shard->store.Erase(victim);
+        shard->evictions++;
+    }
+
+    return initialSize - shard->currentSize;
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
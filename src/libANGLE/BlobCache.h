@@ -11,13 +11,16 @@
 #define LIBANGLE_BLOB_CACHE_H_
 
 #include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
+#include <anglebase/containers/mru_cache.h>
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
 #include "common/hash_utils.h"
 #include "libANGLE/Error.h"
-#include "libANGLE/SizedMRUCache.h"
 
 namespace gl
 {
@@ -47,7 +50,28 @@ struct hash<egl::BlobCacheKey>
 
 namespace egl
 {
+class MappedBlobStore;
 
+// Which entry is evicted when the cache is full.  Least recently used is the default.  The
+// size-aware policy instead evicts whichever of the least recently used entries was hit the fewest
+// times per byte, so that rarely used large blobs make room before frequently used small ones.
+enum class BlobCacheEvictionPolicy
+{
+    LeastRecentlyUsed,
+    SizeAwareLeastFrequentlyUsed,
+};
+
+struct BlobCacheStatistics
+{
+    uint64_t hits      = 0;
+    uint64_t misses    = 0;
+    uint64_t evictions = 0;
+};
+
+// The cache is split into shards by key, each with its own lock and an equal share of the maximum
+// size, so that contexts on different threads can use it at the same time.  Small caches use a
+// single shard so that eviction stays in strict cache-wide order, and the shards are merged when a
+// blob too large for one of them comes in.  Except where noted, all methods are thread-safe.
 class BlobCache final : angle::NonCopyable
 {
   public:
@@ -60,9 +84,18 @@ class BlobCache final : angle::NonCopyable
       public:
         Value() : mPtr(nullptr), mSize(0) {}
         Value(const uint8_t *ptr, size_t sz) : mPtr(ptr), mSize(sz) {}
-
-        // A very basic struct to hold the pointer and size together.  The objects of this class
-        // don't own the memory.
+        // Shares ownership of a blob held by the cache, so it stays valid even if another thread
+        // evicts it while it is in use.
+        explicit Value(std::shared_ptr<const angle::MemoryBuffer> blob)
+            : mPtr(blob->data()), mSize(blob->size()), mOwner(std::move(blob))
+        {}
+        // Points into memory kept alive by |owner|, such as a file mapping.
+        Value(const uint8_t *ptr, size_t sz, std::shared_ptr<const void> owner)
+            : mPtr(ptr), mSize(sz), mOwner(std::move(owner))
+        {}
+
+        // A very basic struct to hold the pointer and size together.  Unless created with an
+        // owner, the objects of this class don't own the memory.
         const uint8_t *data() { return mPtr; }
         size_t size() { return mSize; }
 
@@ -75,6 +108,7 @@ class BlobCache final : angle::NonCopyable
       private:
         const uint8_t *mPtr;
         size_t mSize;
+        std::shared_ptr<const void> mOwner;
     };
     enum class CacheSource
     {
@@ -105,45 +139,104 @@ class BlobCache final : angle::NonCopyable
                               BlobCache::Value *valueOut,
                               size_t *bufferSizeOut);
 
-    // For querying the contents of the cache.
-    ANGLE_NO_DISCARD bool getAt(size_t index,
-                                const BlobCache::Key **keyOut,
-                                BlobCache::Value *valueOut);
+    // For querying the contents of the cache.  Entries are ordered by shard, and by recency within
+    // a shard.
+    ANGLE_NO_DISCARD bool getAt(size_t index, BlobCache::Key *keyOut, BlobCache::Value *valueOut);
 
     // Evict a blob from the binary cache.
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear();
 
-    // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    // Resize the cache. Discards current contents.  Not thread-safe.
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const;
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const { return entryCount() == 0; }
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mMaxSize; }
+
+    // Not thread-safe; meant to be called once when the display is initialized.
+    void setEvictionPolicy(BlobCacheEvictionPolicy policy) { mEvictionPolicy = policy; }
+
+    // Hits and misses of get(), including those served by the application's cache, and the number
+    // of entries evicted to make room or by trim().
+    BlobCacheStatistics getStatistics() const;
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
     bool areBlobCacheFuncsSet() const;
 
-    bool isCachingEnabled() const { return areBlobCacheFuncsSet() || maxSize() > 0; }
+    bool isCachingEnabled() const
+    {
+        return areBlobCacheFuncsSet() || maxSize() > 0 || mFileStore != nullptr;
+    }
+
+    // Persists blobs put in the cache to a file, and looks up blobs that miss the cache in it.
+    // Only used when the application doesn't provide its own cache.  Not thread-safe.
+    void setFileStore(std::unique_ptr<MappedBlobStore> fileStore);
+    bool hasFileStore() const { return mFileStore != nullptr; }
 
   private:
+    static constexpr size_t kMaxShardCount = 16;
+    // Caches smaller than this many bytes per shard use fewer shards.
+    static constexpr size_t kMinShardSizeBytes = 1024 * 1024;
+    // Number of entries from the least recently used end considered by the size-aware policy.
+    static constexpr size_t kEvictionSampleCount = 8;
+
     // This internal cache is used only if the application is not providing caching callbacks
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+    struct CacheEntry
+    {
+        std::shared_ptr<const angle::MemoryBuffer> blob;
+        CacheSource source;
+        // Number of hits since the entry was added, used by the size-aware eviction policy.
+        uint32_t useCount;
+    };
+    using CacheStore = angle::base::HashingMRUCache<BlobCache::Key, CacheEntry>;
+
+    struct Shard
+    {
+        Shard();
+        ~Shard();
+
+        // Protects everything but the statistics.
+        mutable std::mutex mutex;
+        CacheStore store;
+        size_t maxSize;
+        size_t currentSize;
+
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> misses;
+        std::atomic<uint64_t> evictions;
+    };
+
+    Shard &getShard(const BlobCache::Key &key);
+    // Locks the shard of |key|, retrying if the shards are merged in the meantime.
+    Shard &lockShard(const BlobCache::Key &key, std::unique_lock<std::mutex> *lockOut);
+    // Merges the shards until each can hold a blob of |blobSize| bytes, keeping their contents.
+    void mergeShards(size_t blobSize);
+    // Must be called with the shard's lock held.
+    void eraseLocked(Shard *shard, const BlobCache::Key &key);
+    size_t shrinkLocked(Shard *shard, size_t limit);
+
+    std::array<Shard, kMaxShardCount> mShards;
+    // Only ever decreases between resizes, with every shard locked.
+    std::atomic<size_t> mShardCount;
+    size_t mMaxSize;
+    BlobCacheEvictionPolicy mEvictionPolicy;
+
+    std::unique_ptr<MappedBlobStore> mFileStore;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
@@ -9,11 +9,14 @@
 
 #include "libANGLE/BlobCache.h"
 
+#include <thread>
+#include <vector>
+
 namespace egl
 {
 
-// Note: this is fairly similar to SizedMRUCache_unittest, and makes sure the
-// BlobCache usage of SizedMRUCache is not broken.
+// Note: the first tests are fairly similar to SizedMRUCache_unittest, and make sure small caches
+// keep strict least recently used eviction.
 
 using BlobPut = angle::MemoryBuffer;
 using Blob    = BlobCache::Value;
@@ -36,6 +39,16 @@ BlobPut MakeBlob(size_t size, uint8_t start = 0)
     return blob;
 }
 
+// MakeSequence's index wraps around past 255 bytes, so larger blobs are only marked at the start.
+BlobPut MakeLargeBlob(size_t size, uint8_t start)
+{
+    BlobPut blob;
+    EXPECT_TRUE(blob.resize(size));
+    blob.fill(0);
+    blob[0] = start;
+    return blob;
+}
+
 Key MakeKey(uint8_t start = 0)
 {
     Key key;
@@ -131,4 +144,211 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, MakeKey(5), &qvalue, &blobSize));
 }
 
+Key MakeIndexedKey(uint32_t index)
+{
+    Key key = MakeKey(0);
+    key[0]  = static_cast<uint8_t>(index);
+    key[1]  = static_cast<uint8_t>(index >> 8);
+    return key;
+}
+
+// Tests that a large, sharded cache holds entries with any key and accounts for all of them.
+TEST(BlobCacheTest, ShardedCache)
+{
+    constexpr size_t kSize      = 16 * 1024 * 1024;
+    constexpr uint32_t kEntries = 1000;
+    constexpr size_t kEntrySize = 100;
+    BlobCache blobCache(kSize);
+
+    for (uint32_t index = 0; index < kEntries; ++index)
+    {
+        blobCache.populate(MakeIndexedKey(index), MakeBlob(kEntrySize, index));
+    }
+    EXPECT_EQ(kEntries, blobCache.entryCount());
+    EXPECT_EQ(kEntries * kEntrySize, blobCache.size());
+
+    for (uint32_t index = 0; index < kEntries; ++index)
+    {
+        Blob blob;
+        size_t blobSize = 0;
+        ASSERT_TRUE(blobCache.get(nullptr, MakeIndexedKey(index), &blob, &blobSize));
+        ASSERT_EQ(kEntrySize, blobSize);
+        EXPECT_EQ(static_cast<uint8_t>(index), blob[0]);
+    }
+
+    // Every entry is reachable through getAt.
+    for (size_t index = 0; index < kEntries; ++index)
+    {
+        Key key;
+        Blob blob;
+        EXPECT_TRUE(blobCache.getAt(index, &key, &blob));
+        EXPECT_EQ(kEntrySize, blob.size());
+    }
+    Key key;
+    Blob blob;
+    EXPECT_FALSE(blobCache.getAt(kEntries, &key, &blob));
+
+    blobCache.clear();
+    EXPECT_TRUE(blobCache.empty());
+    EXPECT_EQ(0u, blobCache.size());
+}
+
+// Tests that a sharded cache keeps a blob larger than a shard's share of the cache, along with the
+// entries it already held.
+TEST(BlobCacheTest, LargerThanShardValue)
+{
+    constexpr size_t kSize      = 6 * 1024 * 1024;
+    constexpr uint32_t kEntries = 100;
+    constexpr size_t kEntrySize = 100;
+    constexpr size_t kLargeSize = 2 * 1024 * 1024;
+    BlobCache blobCache(kSize);
+
+    for (uint32_t index = 0; index < kEntries; ++index)
+    {
+        blobCache.populate(MakeIndexedKey(index), MakeBlob(kEntrySize, index));
+    }
+
+    const Key largeKey = MakeIndexedKey(kEntries);
+    blobCache.populate(largeKey, MakeLargeBlob(kLargeSize, 3));
+    EXPECT_EQ(kEntries + 1, blobCache.entryCount());
+    EXPECT_EQ(kEntries * kEntrySize + kLargeSize, blobCache.size());
+
+    Blob blob;
+    size_t blobSize = 0;
+    ASSERT_TRUE(blobCache.get(nullptr, largeKey, &blob, &blobSize));
+    ASSERT_EQ(kLargeSize, blobSize);
+    EXPECT_EQ(3u, blob[0]);
+
+    for (uint32_t index = 0; index < kEntries; ++index)
+    {
+        ASSERT_TRUE(blobCache.get(nullptr, MakeIndexedKey(index), &blob, &blobSize));
+        EXPECT_EQ(static_cast<uint8_t>(index), blob[0]);
+    }
+
+    // A blob as large as the whole cache is kept too, at the cost of everything else.
+    blobCache.populate(largeKey, MakeLargeBlob(kSize, 5));
+    EXPECT_EQ(1u, blobCache.entryCount());
+    ASSERT_TRUE(blobCache.get(nullptr, largeKey, &blob, &blobSize));
+    EXPECT_EQ(5u, blob[0]);
+}
+
+// Tests that hits, misses and evictions are counted.
+TEST(BlobCacheTest, Statistics)
+{
+    constexpr size_t kSize = 32;
+    BlobCache blobCache(kSize);
+
+    Blob blob;
+    size_t blobSize = 0;
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+
+    blobCache.populate(MakeKey(0), MakeBlob(16));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+
+    // Two more entries of the same size push the first one out.
+    blobCache.populate(MakeKey(1), MakeBlob(16));
+    blobCache.populate(MakeKey(2), MakeBlob(16));
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+
+    // Removing an entry is not an eviction, but trimming is.
+    blobCache.remove(MakeKey(1));
+    EXPECT_EQ(16u, blobCache.trim(0));
+
+    BlobCacheStatistics statistics = blobCache.getStatistics();
+    EXPECT_EQ(2u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_EQ(2u, statistics.evictions);
+}
+
+// Tests that the size-aware policy evicts a large, unused entry before smaller or more frequently
+// used ones, even if it isn't the least recently used one.
+TEST(BlobCacheTest, SizeAwareEviction)
+{
+    constexpr size_t kSize = 32;
+    BlobCache blobCache(kSize);
+    blobCache.setEvictionPolicy(BlobCacheEvictionPolicy::SizeAwareLeastFrequentlyUsed);
+
+    Blob blob;
+    size_t blobSize = 0;
+
+    blobCache.populate(MakeKey(0), MakeBlob(8));
+    for (int hit = 0; hit < 3; ++hit)
+    {
+        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+    }
+    blobCache.populate(MakeKey(1), MakeBlob(16));
+    blobCache.populate(MakeKey(2), MakeBlob(8));
+
+    // Least recently used would evict the first entry.
+    blobCache.populate(MakeKey(3), MakeBlob(8));
+
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(1), &blob, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(2), &blob, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(3), &blob, &blobSize));
+    EXPECT_EQ(24u, blobCache.size());
+}
+
+// Tests that a value returned by the cache stays valid after the entry is evicted.
+TEST(BlobCacheTest, ValueOutlivesEviction)
+{
+    constexpr size_t kSize = 32;
+    BlobCache blobCache(kSize);
+
+    blobCache.populate(MakeKey(0), MakeBlob(kSize, 7));
+
+    Blob blob;
+    size_t blobSize = 0;
+    ASSERT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+
+    blobCache.populate(MakeKey(1), MakeBlob(kSize, 100));
+    Blob evictedBlob;
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &evictedBlob, &blobSize));
+
+    ASSERT_EQ(kSize, blob.size());
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        EXPECT_EQ(index + 7, blob[index]);
+    }
+}
+
+// Tests populating and querying the cache from several threads at once.
+TEST(BlobCacheTest, MultithreadedAccess)
+{
+    constexpr size_t kSize               = 4 * 1024 * 1024;
+    constexpr uint32_t kThreadCount      = 4;
+    constexpr uint32_t kEntriesPerThread = 1000;
+    BlobCache blobCache(kSize);
+
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < kThreadCount; ++thread)
+    {
+        threads.emplace_back([&blobCache, thread]() {
+            for (uint32_t entry = 0; entry < kEntriesPerThread; ++entry)
+            {
+                const uint32_t index = thread * kEntriesPerThread + entry;
+                blobCache.populate(MakeIndexedKey(index), MakeBlob(64, index));
+
+                Blob blob;
+                size_t blobSize = 0;
+                if (blobCache.get(nullptr, MakeIndexedKey(index), &blob, &blobSize))
+                {
+                    EXPECT_EQ(64u, blobSize);
+                    EXPECT_EQ(static_cast<uint8_t>(index), blob[0]);
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(blobCache.size(), kSize);
+    BlobCacheStatistics statistics = blobCache.getStatistics();
+    EXPECT_EQ(kThreadCount * kEntriesPerThread, statistics.hits + statistics.misses);
+}
+
 }  // namespace egl
@@ -1079,6 +1079,9 @@ struct DisplayExtensions
     // EGL_ANGLE_program_cache_control
     bool programCacheControl = false;
 
+    // EGL_ANGLE_program_cache_statistics
+    bool programCacheStatistics = false;
+
     // EGL_ANGLE_robust_resource_initialization
     bool robustResourceInitialization = false;
 
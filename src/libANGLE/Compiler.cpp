@@ -260,7 +260,7 @@ ShCompilerInstance Compiler::getInstance(ShaderType type)
     {
         ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
         ASSERT(handle);
-        return ShCompilerInstance(handle, mOutputType, type);
+        return ShCompilerInstance(handle, mSpec, mOutputType, type);
     }
     else
     {
@@ -287,9 +287,10 @@ void Compiler::putInstance(ShCompilerInstance &&instance)
 ShCompilerInstance::ShCompilerInstance() : mHandle(nullptr) {}
 
 ShCompilerInstance::ShCompilerInstance(ShHandle handle,
+                                       ShShaderSpec spec,
                                        ShShaderOutput outputType,
                                        ShaderType shaderType)
-    : mHandle(handle), mOutputType(outputType), mShaderType(shaderType)
+    : mHandle(handle), mSpec(spec), mOutputType(outputType), mShaderType(shaderType)
 {}
 
 ShCompilerInstance::~ShCompilerInstance()
@@ -307,7 +308,10 @@ void ShCompilerInstance::destroy()
 }
 
 ShCompilerInstance::ShCompilerInstance(ShCompilerInstance &&other)
-    : mHandle(other.mHandle), mOutputType(other.mOutputType), mShaderType(other.mShaderType)
+    : mHandle(other.mHandle),
+      mSpec(other.mSpec),
+      mOutputType(other.mOutputType),
+      mShaderType(other.mShaderType)
 {
     other.mHandle = nullptr;
 }
@@ -315,6 +319,7 @@ ShCompilerInstance::ShCompilerInstance(ShCompilerInstance &&other)
 ShCompilerInstance &ShCompilerInstance::operator=(ShCompilerInstance &&other)
 {
     mHandle       = other.mHandle;
+    mSpec         = other.mSpec;
     mOutputType   = other.mOutputType;
     mShaderType   = other.mShaderType;
     other.mHandle = nullptr;
@@ -336,6 +341,11 @@ const std::string &ShCompilerInstance::getBuiltinResourcesString()
     return sh::GetBuiltInResourcesString(mHandle);
 }
 
+ShShaderSpec ShCompilerInstance::getShaderSpec() const
+{
+    return mSpec;
+}
+
 ShShaderOutput ShCompilerInstance::getShaderOutputType() const
 {
     return mOutputType;
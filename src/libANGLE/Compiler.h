@@ -52,7 +52,10 @@ class ShCompilerInstance final : public angle::NonCopyable
 {
   public:
     ShCompilerInstance();
-    ShCompilerInstance(ShHandle handle, ShShaderOutput outputType, ShaderType shaderType);
+    ShCompilerInstance(ShHandle handle,
+                       ShShaderSpec spec,
+                       ShShaderOutput outputType,
+                       ShaderType shaderType);
     ~ShCompilerInstance();
     void destroy();
 
@@ -62,10 +65,12 @@ class ShCompilerInstance final : public angle::NonCopyable
     ShHandle getHandle();
     ShaderType getShaderType() const;
     const std::string &getBuiltinResourcesString();
+    ShShaderSpec getShaderSpec() const;
     ShShaderOutput getShaderOutputType() const;
 
   private:
     ShHandle mHandle;
+    ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShaderType mShaderType;
 };
@@ -19,6 +19,9 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// Translated shaders are cached by default, so contexts don't re-translate the same shaders.
+const size_t kDefaultMaxShaderCacheMemoryBytes = 4 * 1024 * 1024;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
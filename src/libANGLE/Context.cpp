@@ -337,6 +337,9 @@ Context::Context(egl::Display *display,
       mDrawFramebufferObserverBinding(this, kDrawFramebufferSubjectIndex),
       mReadFramebufferObserverBinding(this, kReadFramebufferSubjectIndex),
       mThreadPool(nullptr),
+      mDeferredDrawStateKnown(false),
+      mDeferredDrawReadsClientAttribs(false),
+      mDeferredDrawHasElementArrayBuffer(false),
       mFrameCapture(new angle::FrameCapture),
       mRefCount(0),
       mOverlay(mImplementation.get())
@@ -567,6 +570,9 @@ void Context::initialize()
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // Executes the calls left in the queue.
+    mDeferredCalls.reset();
+
     // Dump frame capture if enabled.
     mFrameCapture->onDestroyContext(this);
 
@@ -709,9 +715,47 @@ egl::Error Context::makeCurrent(egl::Display *display,
         return angle::ResultToEGL(implResult);
     }
 
+    // The display texture and semaphore share groups are locked with the global mutex, which the
+    // thread making the calls may be holding while it waits for the worker.
+    if (mDisplay->getFrontendFeatures().deferGLCalls.enabled && !mDeferredCalls &&
+        mDisplay->getImplementation()->supportsDeferredGLCalls() && !mDisplayTextureShareGroup &&
+        !mDisplaySemaphoreShareGroup)
+    {
+        mDeferredCalls.reset(new DeferredCallQueue(this));
+    }
+
     return egl::NoError();
 }
 
+bool Context::canDeferDraw()
+{
+    ASSERT(isDeferringCalls());
+    if (!mDeferredDrawStateKnown)
+    {
+        // The vertex array state is only read once the calls that changed it are executed.
+        mDeferredCalls->finish();
+        mDeferredDrawReadsClientAttribs = mStateCache.hasAnyEnabledClientAttrib();
+        mDeferredDrawHasElementArrayBuffer =
+            mState.getVertexArray()->getElementArrayBuffer() != nullptr;
+        mDeferredDrawStateKnown = true;
+    }
+    return !mDeferredDrawReadsClientAttribs;
+}
+
+DeferredCallQueue::CopiedParam<const void> Context::copyDeferredIndices(const void *indices,
+                                                                       GLsizei count,
+                                                                       GLenum type) const
+{
+    ASSERT(mDeferredDrawStateKnown);
+    DrawElementsType typePacked = FromGLenum<DrawElementsType>(type);
+    // The indices are an offset into the element array buffer, or the call generates an error.
+    if (mDeferredDrawHasElementArrayBuffer || typePacked == DrawElementsType::InvalidEnum)
+    {
+        return DeferredCallQueue::Copy(indices, 0, 1);
+    }
+    return DeferredCallQueue::Copy(indices, count, GetDrawElementsTypeSize(typePacked));
+}
+
 egl::Error Context::unMakeCurrent(const egl::Display *display)
 {
     ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrent(this)));
@@ -8412,16 +8456,6 @@ bool Context::isProgramPipelineGenerated(ProgramPipelineID pipeline) const
     return mState.mProgramPipelineManager->isHandleGenerated(pipeline);
 }
 
-bool Context::usingDisplayTextureShareGroup() const
-{
-    return mDisplayTextureShareGroup;
-}
-
-bool Context::usingDisplaySemaphoreShareGroup() const
-{
-    return mDisplaySemaphoreShareGroup;
-}
-
 GLenum Context::getConvertedRenderbufferFormat(GLenum internalformat) const
 {
     if (mState.mExtensions.webglCompatibility && mState.mClientVersion.major == 2 &&
@@ -8693,6 +8727,17 @@ std::mutex &Context::getProgramCacheMutex() const
     return mDisplay->getProgramCacheMutex();
 }
 
+MemoryShaderCache *Context::getMemoryShaderCache() const
+{
+    MemoryShaderCache *shaderCache = mDisplay->getMemoryShaderCache();
+    if (!mDisplay->getFrontendFeatures().cacheTranslatedShaders.enabled ||
+        !shaderCache->isCachingEnabled())
+    {
+        return nullptr;
+    }
+    return shaderCache;
+}
+
 // ErrorSet implementation.
 ErrorSet::ErrorSet(Context *context) : mContext(context) {}
 
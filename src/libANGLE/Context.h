@@ -30,6 +30,7 @@
 #include "libANGLE/Context_gles_3_1_autogen.h"
 #include "libANGLE/Context_gles_3_2_autogen.h"
 #include "libANGLE/Context_gles_ext_autogen.h"
+#include "libANGLE/DeferredCallQueue.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/RefCountObject.h"
@@ -68,6 +69,7 @@ class FenceNV;
 class Framebuffer;
 class GLES1Renderer;
 class MemoryProgramCache;
+class MemoryShaderCache;
 class MemoryObject;
 class Program;
 class ProgramPipeline;
@@ -479,6 +481,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
     std::mutex &getProgramCacheMutex() const;
+    // Null when shader translations are not cached.
+    MemoryShaderCache *getMemoryShaderCache() const;
 
     bool hasBeenCurrent() const { return mHasBeenCurrent; }
     egl::Display *getDisplay() const { return mDisplay; }
@@ -548,8 +552,36 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool isProgramPipelineGenerated(ProgramPipelineID pipeline) const;
     bool isQueryGenerated(QueryID query) const;
 
-    bool usingDisplayTextureShareGroup() const;
-    bool usingDisplaySemaphoreShareGroup() const;
+    bool usingDisplayTextureShareGroup() const { return mDisplayTextureShareGroup; }
+    bool usingDisplaySemaphoreShareGroup() const { return mDisplaySemaphoreShareGroup; }
+
+    // Whether the entry points add the calls that can be deferred to the queue of the context.
+    // The worker thread of the queue executes them directly.  So does the calling thread while
+    // GL_DEBUG_OUTPUT_SYNCHRONOUS is enabled, since the debug callback must be called from the
+    // call generating the message.  Enabling or disabling it is never deferred.
+    bool isDeferringCalls() const
+    {
+        return mDeferredCalls && !gIsDeferredCallThread && !mState.getDebug().isOutputSynchronous();
+    }
+    DeferredCallQueue *getDeferredCalls() const { return mDeferredCalls.get(); }
+    void finishDeferredCalls() const
+    {
+        if (mDeferredCalls && !gIsDeferredCallThread)
+        {
+            mDeferredCalls->finish();
+            // The call that isn't deferred can change the vertex array state.
+            mDeferredDrawStateKnown = false;
+        }
+    }
+
+    // Used by the thread making the calls while they are deferred.  A draw call is deferred if it
+    // doesn't read client vertex arrays, which the worker thread would read after the draw call
+    // returned.  The client indices of the call are copied into the queue instead.
+    bool canDeferDraw();
+    DeferredCallQueue::CopiedParam<const void> copyDeferredIndices(const void *indices,
+                                                                   GLsizei count,
+                                                                   GLenum type) const;
+    void onDeferredVertexStateChange() { mDeferredDrawStateKnown = false; }
 
     // Hack for the special WebGL 1 "DEPTH_STENCIL" internal format.
     GLenum getConvertedRenderbufferFormat(GLenum internalformat) const;
@@ -765,6 +797,13 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     std::shared_ptr<angle::WorkerThreadPool> mThreadPool;
 
+    std::unique_ptr<DeferredCallQueue> mDeferredCalls;
+    // Whether the draw calls read client vertex arrays and indices, as of the last call made by
+    // the thread deferring the calls.  Looked at again after the calls changing it.
+    mutable bool mDeferredDrawStateKnown;
+    bool mDeferredDrawReadsClientAttribs;
+    bool mDeferredDrawHasElementArrayBuffer;
+
     // Note: we use a raw pointer here so we can exclude frame capture sources from the build.
     std::unique_ptr<angle::FrameCapture> mFrameCapture;
 
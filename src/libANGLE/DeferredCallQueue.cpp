@@ -0,0 +1,132 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCallQueue.cpp:
+//   Implements the gl::DeferredCallQueue class.
+//
+
+#include "libANGLE/DeferredCallQueue.h"
+
+#include "libANGLE/Context.h"
+
+namespace gl
+{
+thread_local bool gIsDeferredCallThread = false;
+
+DeferredCallQueue::DeferredCallQueue(Context *context)
+    : mContext(context),
+      mData(new uint8_t[kDataSize]),
+      mWriteIndex(0),
+      mReadIndex(0),
+      mDataWriteOffset(0),
+      mDataReadOffset(0),
+      mWorkerSleeping(false),
+      mExit(false),
+      mWorker(&DeferredCallQueue::workerLoop, this)
+{}
+
+DeferredCallQueue::~DeferredCallQueue()
+{
+    finish();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mWorkCondition.notify_one();
+    mWorker.join();
+}
+
+void DeferredCallQueue::finish()
+{
+    ASSERT(!gIsDeferredCallThread);
+
+    const size_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+    if (mReadIndex.load(std::memory_order_acquire) == writeIndex)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mIdleCondition.wait(
+        lock, [&] { return mReadIndex.load(std::memory_order_acquire) == writeIndex; });
+}
+
+uint8_t *DeferredCallQueue::allocateData(size_t size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    ASSERT(size <= kMaxCallDataSize);
+
+    // The memory of a call doesn't wrap around the end of the ring.
+    size_t start       = mDataWriteOffset;
+    const size_t index = start % kDataSize;
+    if (index + size > kDataSize)
+    {
+        start += kDataSize - index;
+    }
+
+    if (start + size - mDataReadOffset.load(std::memory_order_acquire) > kDataSize)
+    {
+        finish();
+    }
+
+    mDataWriteOffset = start + size;
+    return mData.get() + start % kDataSize;
+}
+
+void DeferredCallQueue::wakeWorker()
+{
+    // Taking the lock makes sure the worker is either waiting or will see the new call.
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+    }
+    mWorkCondition.notify_one();
+}
+
+void DeferredCallQueue::workerLoop()
+{
+    gIsDeferredCallThread = true;
+    gCurrentValidContext  = mContext;
+
+    size_t readIndex = 0;
+    while (true)
+    {
+        if (readIndex == mWriteIndex.load(std::memory_order_acquire))
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mIdleCondition.notify_all();
+
+            // The thread enqueueing calls only wakes the worker when this is set.
+            mWorkerSleeping.store(true, std::memory_order_seq_cst);
+            mWorkCondition.wait(lock, [&] {
+                return mExit || readIndex != mWriteIndex.load(std::memory_order_seq_cst);
+            });
+            mWorkerSleeping.store(false, std::memory_order_relaxed);
+
+            if (readIndex == mWriteIndex.load(std::memory_order_acquire))
+            {
+                ASSERT(mExit);
+                return;
+            }
+            continue;
+        }
+
+        // Once the context is lost, its entry points would look for the current EGL thread,
+        // which the worker doesn't have.  The calls would only generate errors anyway.
+        Call &call = mCalls[readIndex % kCallCount];
+        if (!mContext->isContextLost())
+        {
+            call.execute(call.storage);
+        }
+        call.destroy(call.storage);
+
+        mDataReadOffset.store(call.dataEnd, std::memory_order_release);
+        mReadIndex.store(++readIndex, std::memory_order_release);
+    }
+}
+}  // namespace gl
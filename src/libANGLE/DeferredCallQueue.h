@@ -0,0 +1,225 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCallQueue.h:
+//   Defines the gl::DeferredCallQueue class, a ring of GL calls that a context executes in order
+//   on its own worker thread.
+//
+
+#ifndef LIBANGLE_DEFERRED_CALL_QUEUE_H_
+#define LIBANGLE_DEFERRED_CALL_QUEUE_H_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+class Context;
+
+// Whether the calling thread is the worker thread of a DeferredCallQueue.
+extern thread_local bool gIsDeferredCallThread;
+
+// The entry points of the calls that don't return anything add the call to the queue of the
+// context instead of executing it.  The memory their pointer parameters refer to is copied into
+// the queue, unless the pointer is an offset into a buffer.  The worker thread executes a call by
+// calling its entry point again, with the context current.  The other calls finish the queue
+// first.
+class DeferredCallQueue final : angle::NonCopyable
+{
+  public:
+    // A pointer parameter of a call, with the size of the memory it refers to.
+    template <typename T>
+    struct CopiedParam
+    {
+        T *pointer;
+        size_t size;
+    };
+
+    explicit DeferredCallQueue(Context *context);
+    // Executes the calls left in the queue.
+    ~DeferredCallQueue();
+
+    // Passed to enqueue() instead of a pointer parameter for the call to use a copy of the
+    // |count| elements it points to.  Nothing is copied if |count| isn't positive.
+    template <typename T>
+    static CopiedParam<T> Copy(T *pointer, GLsizeiptr count, size_t elementSize);
+
+    // Returns false without adding the call if the memory to copy doesn't fit in the queue.
+    template <typename... Params, typename... Args>
+    bool enqueue(void(GL_APIENTRY *entryPoint)(Params...), Args... args);
+
+    // Waits until every call in the queue is executed.
+    void finish();
+
+  private:
+    static constexpr size_t kCallCount = 4096;
+    // Enough for the entry point and the parameters of any call.
+    static constexpr size_t kCallStorageSize = 120;
+    // The copied memory is kept in a ring of its own.  Calls copying more than a quarter of it
+    // are executed directly.
+    static constexpr size_t kDataSize        = 1024 * 1024;
+    static constexpr size_t kMaxCallDataSize = kDataSize / 4;
+    static constexpr size_t kDataAlignment   = 16;
+
+    struct Call
+    {
+        void (*execute)(const void *storage);
+        void (*destroy)(void *storage);
+        // The offset in the data ring past the memory copied for this call and the calls before.
+        size_t dataEnd;
+        alignas(8) uint8_t storage[kCallStorageSize];
+    };
+
+    template <typename... Params>
+    struct EntryPointCall
+    {
+        void(GL_APIENTRY *entryPoint)(Params...);
+        std::tuple<Params...> params;
+    };
+
+    template <typename... Params, size_t... Indices>
+    static void ExecuteImpl(const EntryPointCall<Params...> &call,
+                            std::index_sequence<Indices...>)
+    {
+        call.entryPoint(std::get<Indices>(call.params)...);
+    }
+
+    template <typename... Params>
+    static void Execute(const void *storage)
+    {
+        ExecuteImpl(*static_cast<const EntryPointCall<Params...> *>(storage),
+                    std::index_sequence_for<Params...>());
+    }
+
+    template <typename... Params>
+    static void Destroy(void *storage)
+    {
+        static_cast<EntryPointCall<Params...> *>(storage)->~EntryPointCall<Params...>();
+    }
+
+    template <typename T>
+    static size_t GetCopiedSize(const T &)
+    {
+        return 0;
+    }
+    template <typename T>
+    static size_t GetCopiedSize(const CopiedParam<T> &param)
+    {
+        return rx::roundUpPow2(param.size, kDataAlignment);
+    }
+
+    template <typename T>
+    static T PlaceParam(T param, uint8_t **)
+    {
+        return param;
+    }
+    template <typename T>
+    static T *PlaceParam(const CopiedParam<T> &param, uint8_t **data)
+    {
+        if (param.size == 0)
+        {
+            return param.pointer;
+        }
+        memcpy(*data, param.pointer, param.size);
+        T *copy = static_cast<T *>(static_cast<void *>(*data));
+        *data += rx::roundUpPow2(param.size, kDataAlignment);
+        return copy;
+    }
+
+    uint8_t *allocateData(size_t size);
+    void wakeWorker();
+    void workerLoop();
+
+    Context *mContext;
+    std::array<Call, kCallCount> mCalls;
+    std::unique_ptr<uint8_t[]> mData;
+
+    // Only written by the thread enqueueing the calls and the worker thread respectively.
+    std::atomic<size_t> mWriteIndex;
+    std::atomic<size_t> mReadIndex;
+    size_t mDataWriteOffset;
+    std::atomic<size_t> mDataReadOffset;
+
+    std::mutex mMutex;
+    std::condition_variable mWorkCondition;
+    std::condition_variable mIdleCondition;
+    std::atomic<bool> mWorkerSleeping;
+    bool mExit;
+    std::thread mWorker;
+};
+
+template <typename T>
+DeferredCallQueue::CopiedParam<T> DeferredCallQueue::Copy(T *pointer,
+                                                          GLsizeiptr count,
+                                                          size_t elementSize)
+{
+    if (pointer == nullptr || count <= 0)
+    {
+        return {pointer, 0};
+    }
+    // Too large copies make enqueue() fail.
+    if (static_cast<size_t>(count) > kMaxCallDataSize / elementSize)
+    {
+        return {pointer, kMaxCallDataSize + 1};
+    }
+    return {pointer, static_cast<size_t>(count) * elementSize};
+}
+
+template <typename... Params, typename... Args>
+bool DeferredCallQueue::enqueue(void(GL_APIENTRY *entryPoint)(Params...), Args... args)
+{
+    using CallType = EntryPointCall<Params...>;
+    static_assert(sizeof(CallType) <= kCallStorageSize, "Call parameters don't fit in the queue");
+    static_assert(alignof(CallType) <= 8, "Call parameters are overaligned");
+
+    size_t dataSize = 0;
+    for (size_t size : {size_t(0), GetCopiedSize(args)...})
+    {
+        dataSize += size;
+    }
+    if (dataSize > kMaxCallDataSize)
+    {
+        return false;
+    }
+
+    size_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+    if (writeIndex - mReadIndex.load(std::memory_order_acquire) == kCallCount)
+    {
+        finish();
+    }
+
+    uint8_t *data = allocateData(dataSize);
+
+    Call &call   = mCalls[writeIndex % kCallCount];
+    call.execute = &Execute<Params...>;
+    call.destroy = &Destroy<Params...>;
+    call.dataEnd = mDataWriteOffset;
+    // The braces make the copies happen in the order of the parameters.
+    new (call.storage) CallType{entryPoint, std::tuple<Params...>{PlaceParam(args, &data)...}};
+
+    mWriteIndex.store(writeIndex + 1, std::memory_order_seq_cst);
+    if (mWorkerSleeping.load(std::memory_order_seq_cst))
+    {
+        wakeWorker();
+    }
+    return true;
+}
+}  // namespace gl
+
+#endif  // LIBANGLE_DEFERRED_CALL_QUEUE_H_
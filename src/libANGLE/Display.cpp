@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <vector>
@@ -34,6 +35,7 @@
 #include "libANGLE/EGLSync.h"
 #include "libANGLE/FrameCapture.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/MappedBlobStore.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Stream.h"
 #include "libANGLE/Surface.h"
@@ -478,11 +480,19 @@ void ANGLESetDefaultDisplayPlatform(angle::EGLDisplayType display)
 
 static constexpr uint32_t kScratchBufferLifetime = 64u;
 
+constexpr char kProgramCacheFileVarName[] = "ANGLE_PROGRAM_CACHE_FILE";
+
+EGLint ClampCacheStatistic(uint64_t value)
+{
+    return static_cast<EGLint>(std::min<uint64_t>(value, std::numeric_limits<EGLint>::max()));
+}
+
 }  // anonymous namespace
 
 // ShareGroup
 ShareGroup::ShareGroup(rx::EGLImplFactory *factory)
     : mRefCount(1),
+      mMutex(std::make_shared<std::recursive_mutex>()),
       mImplementation(factory->createShareGroup()),
       mFrameCaptureShared(new angle::FrameCaptureShared)
 {}
@@ -689,6 +699,8 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mSemaphoreManager(nullptr),
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
+      mShaderBlobCache(gl::kDefaultMaxShaderCacheMemoryBytes),
+      mMemoryShaderCache(mShaderBlobCache),
       mGlobalTextureShareGroupUsers(0),
       mGlobalSemaphoreShareGroupUsers(0)
 {}
@@ -813,6 +825,18 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Persist the program cache across runs when there is no system cache to hand programs to,
+    // such as on servers.  Shader translations go to a file next to it.
+    if (!mBlobCache.hasFileStore())
+    {
+        std::string cacheFilePath = angle::GetEnvironmentVar(kProgramCacheFileVarName);
+        if (!cacheFilePath.empty())
+        {
+            mBlobCache.setFileStore(MappedBlobStore::Open(cacheFilePath));
+            mShaderBlobCache.setFileStore(MappedBlobStore::Open(cacheFilePath + ".shaders"));
+        }
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -860,6 +884,13 @@ Error Display::initialize()
     mFrontendFeatures.populateFeatureList(&mFeatures);
     mImplementation->populateFeatureList(&mFeatures);
 
+    const BlobCacheEvictionPolicy evictionPolicy =
+        mFrontendFeatures.sizeAwareBlobCacheEviction.enabled
+            ? BlobCacheEvictionPolicy::SizeAwareLeastFrequentlyUsed
+            : BlobCacheEvictionPolicy::LeastRecentlyUsed;
+    mBlobCache.setEvictionPolicy(evictionPolicy);
+    mShaderBlobCache.setEvictionPolicy(evictionPolicy);
+
     initDisplayExtensions();
     initVendorString();
 
@@ -903,6 +934,8 @@ Error Display::terminate(const Thread *thread)
 
     mMemoryProgramCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
+    mMemoryShaderCache.clear();
+    mShaderBlobCache.setBlobCacheFuncs(nullptr, nullptr);
 
     while (!mContextSet.empty())
     {
@@ -1367,7 +1400,11 @@ void Display::destroyImage(egl::Image *image)
 {
     auto iter = mImageSet.find(image);
     ASSERT(iter != mImageSet.end());
-    (*iter)->release(this);
+    {
+        // Targets in other share groups may be releasing their references at the same time.
+        std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
+        (*iter)->release(this);
+    }
     mImageSet.erase(iter);
 }
 
@@ -1503,6 +1540,7 @@ void Display::notifyDeviceLost()
 void Display::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
 {
     mBlobCache.setBlobCacheFuncs(set, get);
+    mShaderBlobCache.setBlobCacheFuncs(set, get);
     mImplementation->setBlobCacheFuncs(set, get);
 }
 
@@ -1711,7 +1749,8 @@ void Display::initDisplayExtensions()
     mDisplayExtensions.getAllProcAddresses = true;
 
     // Enable program cache control since it is not back-end dependent.
-    mDisplayExtensions.programCacheControl = true;
+    mDisplayExtensions.programCacheControl    = true;
+    mDisplayExtensions.programCacheStatistics = true;
 
     // Request extension is implemented in the ANGLE frontend
     mDisplayExtensions.createContextExtensionsEnabled = true;
@@ -1811,6 +1850,13 @@ void Display::initializeFrontendFeatures()
     ANGLE_FEATURE_CONDITION((&mFrontendFeatures), loseContextOnOutOfMemory, true);
     ANGLE_FEATURE_CONDITION((&mFrontendFeatures), scalarizeVecAndMatConstructorArgs, true);
     ANGLE_FEATURE_CONDITION((&mFrontendFeatures), allowCompressedFormats, true);
+    ANGLE_FEATURE_CONDITION((&mFrontendFeatures), cacheTranslatedShaders, true);
+
+    // Least recently used eviction stays the default.
+    ANGLE_FEATURE_CONDITION((&mFrontendFeatures), sizeAwareBlobCacheEviction, false);
+
+    // Opt-in; only takes effect on back-ends that support deferred calls.
+    ANGLE_FEATURE_CONDITION((&mFrontendFeatures), deferGLCalls, false);
 
     mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
 
@@ -1857,6 +1903,15 @@ EGLint Display::programCacheGetAttrib(EGLenum attrib) const
         case EGL_PROGRAM_CACHE_SIZE_ANGLE:
             return static_cast<EGLint>(mMemoryProgramCache.entryCount());
 
+        case EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE:
+            return ClampCacheStatistic(mBlobCache.getStatistics().hits);
+
+        case EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE:
+            return ClampCacheStatistic(mBlobCache.getStatistics().misses);
+
+        case EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE:
+            return ClampCacheStatistic(mBlobCache.getStatistics().evictions);
+
         default:
             UNREACHABLE();
             return 0;
@@ -1871,9 +1926,8 @@ Error Display::programCacheQuery(EGLint index,
 {
     ASSERT(index >= 0 && index < static_cast<EGLint>(mMemoryProgramCache.entryCount()));
 
-    const BlobCache::Key *programHash = nullptr;
+    BlobCache::Key programHash;
     BlobCache::Value programBinary;
-    // TODO(jmadill): Make this thread-safe.
     bool result =
         mMemoryProgramCache.getAt(static_cast<size_t>(index), &programHash, &programBinary);
     if (!result)
@@ -1886,7 +1940,7 @@ Error Display::programCacheQuery(EGLint index,
     if (key)
     {
         ASSERT(*keysize == static_cast<EGLint>(BlobCache::kKeyLength));
-        memcpy(key, programHash->data(), BlobCache::kKeyLength);
+        memcpy(key, programHash.data(), BlobCache::kKeyLength);
     }
 
     if (binary)
@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <memory>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/Version.h"
 #include "platform/Feature.h"
@@ -86,11 +88,18 @@ class ShareGroup final : angle::NonCopyable
 
     angle::FrameCaptureShared *getFrameCaptureShared() { return mFrameCaptureShared.get(); }
 
+    // Serializes the GL calls of the contexts in the share group, which only need to be serialized
+    // with the GL calls of other share groups when they share objects through the display.
+    std::recursive_mutex &getMutex() { return *mMutex; }
+    const std::shared_ptr<std::recursive_mutex> &getSharedMutex() const { return mMutex; }
+
   protected:
     ~ShareGroup();
 
   private:
     size_t mRefCount;
+    // Shared with the EGL calls holding the lock, since they can destroy the share group.
+    std::shared_ptr<std::recursive_mutex> mMutex;
     rx::ShareGroupImpl *mImplementation;
     rx::SerialFactory mFramebufferSerialFactory;
 
@@ -214,6 +223,7 @@ class Display final : public LabeledObject,
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
     bool areBlobCacheFuncsSet() const { return mBlobCache.areBlobCacheFuncsSet(); }
     BlobCache &getBlobCache() { return mBlobCache; }
+    gl::MemoryShaderCache *getMemoryShaderCache() { return &mMemoryShaderCache; }
 
     static EGLClientBuffer GetNativeClientBuffer(const struct AHardwareBuffer *buffer);
     static Error CreateNativeClientBuffer(const egl::AttributeMap &attribMap,
@@ -337,6 +347,9 @@ class Display final : public LabeledObject,
     gl::SemaphoreManager *mSemaphoreManager;
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
+    // Kept apart from the program cache, which the application can query and resize.
+    BlobCache mShaderBlobCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
     size_t mGlobalTextureShareGroupUsers;
     size_t mGlobalSemaphoreShareGroupUsers;
 
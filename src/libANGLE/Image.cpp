@@ -8,6 +8,7 @@
 
 #include "libANGLE/Image.h"
 
+#include <anglebase/no_destructor.h>
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
@@ -67,12 +68,14 @@ ImageSibling::~ImageSibling()
 void ImageSibling::setTargetImage(const gl::Context *context, egl::Image *imageTarget)
 {
     ASSERT(imageTarget != nullptr);
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     mTargetOf.set(DisplayFromContext(context), imageTarget);
     imageTarget->addTargetSibling(this);
 }
 
 angle::Result ImageSibling::orphanImages(const gl::Context *context)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (mTargetOf.get() != nullptr)
     {
         // Can't be a target and have sources.
@@ -96,11 +99,13 @@ angle::Result ImageSibling::orphanImages(const gl::Context *context)
 void ImageSibling::addImageSource(egl::Image *imageSource)
 {
     ASSERT(imageSource != nullptr);
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     mSourcesOf.insert(imageSource);
 }
 
 void ImageSibling::removeImageSource(egl::Image *imageSource)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     ASSERT(mSourcesOf.find(imageSource) != mSourcesOf.end());
     mSourcesOf.erase(imageSource);
 }
@@ -113,12 +118,14 @@ bool ImageSibling::isEGLImageTarget() const
 gl::InitState ImageSibling::sourceEGLImageInitState() const
 {
     ASSERT(isEGLImageTarget());
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     return mTargetOf->sourceInitState();
 }
 
 void ImageSibling::setSourceEGLImageInitState(gl::InitState initState) const
 {
     ASSERT(isEGLImageTarget());
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     mTargetOf->setInitState(initState);
 }
 
@@ -127,6 +134,7 @@ bool ImageSibling::isRenderable(const gl::Context *context,
                                 const gl::ImageIndex &imageIndex) const
 {
     ASSERT(isEGLImageTarget());
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     return mTargetOf->isRenderable(context);
 }
 
@@ -137,6 +145,7 @@ bool ImageSibling::isYUV() const
 
 void ImageSibling::notifySiblings(angle::SubjectMessage message)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (mTargetOf.get())
     {
         mTargetOf->notifySiblings(this, message);
@@ -254,6 +263,13 @@ ImageState::ImageState(EGLenum target, ImageSibling *buffer, const AttributeMap
 
 ImageState::~ImageState() {}
 
+// static
+std::recursive_mutex &Image::GetSiblingMutex()
+{
+    static angle::base::NoDestructor<std::recursive_mutex> mutex;
+    return *mutex;
+}
+
 Image::Image(rx::EGLImplFactory *factory,
              const gl::Context *context,
              EGLenum target,
@@ -278,7 +294,9 @@ void Image::onDestroy(const Display *display)
     // Make sure the implementation gets a chance to clean up before we delete the source.
     mImplementation->onDestroy(display);
 
-    // Tell the source that it is no longer used by this image
+    // Tell the source that it is no longer used by this image.  The last target to let go of the
+    // image can be in another share group than the source.
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (mState.source != nullptr)
     {
         mState.source->removeImageSource(this);
@@ -312,12 +330,14 @@ EGLLabelKHR Image::getLabel() const
 
 void Image::addTargetSibling(ImageSibling *sibling)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     mState.targets.insert(sibling);
 }
 
 angle::Result Image::orphanSibling(const gl::Context *context, ImageSibling *sibling)
 {
     ASSERT(sibling != nullptr);
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
 
     // notify impl
     ANGLE_TRY(mImplementation->orphan(context, sibling));
@@ -451,11 +471,13 @@ Error Image::initialize(const Display *display)
 
 bool Image::orphaned() const
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     return (mState.source == nullptr);
 }
 
 gl::InitState Image::sourceInitState() const
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (orphaned())
     {
         return mOrphanedAndNeedsInit ? gl::InitState::MayNeedInit : gl::InitState::Initialized;
@@ -466,6 +488,7 @@ gl::InitState Image::sourceInitState() const
 
 void Image::setInitState(gl::InitState initState)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (orphaned())
     {
         mOrphanedAndNeedsInit = false;
@@ -476,6 +499,7 @@ void Image::setInitState(gl::InitState initState)
 
 void Image::notifySiblings(const ImageSibling *notifier, angle::SubjectMessage message)
 {
+    std::lock_guard<std::recursive_mutex> lock(Image::GetSiblingMutex());
     if (mState.source && mState.source != notifier)
     {
         mState.source->onSubjectStateChange(rx::kTextureImageSiblingMessageIndex, message);
@@ -17,6 +17,7 @@
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/formatutils.h"
 
+#include <mutex>
 #include <set>
 
 namespace rx
@@ -38,6 +39,7 @@ class Display;
 // Only currently Renderbuffers and Textures can be bound with images. This makes the relationship
 // explicit, and also ensures that an image sibling can determine if it's been initialized or not,
 // which is important for the robust resource init extension with Textures and EGLImages.
+// The links between images and their siblings are guarded by Image::GetSiblingMutex().
 class ImageSibling : public gl::FramebufferAttachmentObject
 {
   public:
@@ -167,6 +169,11 @@ class Image final : public RefCountObject, public LabeledObject
 
     rx::ImageImpl *getImplementation() const;
 
+    // The source and targets of an image can belong to different share groups, whose GL calls
+    // don't lock each other out.  This guards the links between all images and their siblings,
+    // including the references the targets hold, and the image state that siblings read.
+    static std::recursive_mutex &GetSiblingMutex();
+
     bool orphaned() const;
     gl::InitState sourceInitState() const;
     void setInitState(gl::InitState initState);
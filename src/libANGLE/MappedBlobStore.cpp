@@ -0,0 +1,526 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MappedBlobStore: A persistent, append-only file of keyed blobs.
+
+#include "libANGLE/MappedBlobStore.h"
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+#include "common/third_party/xxhash/xxhash.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+namespace egl
+{
+namespace
+{
+constexpr char kFileMagic[8]      = {'A', 'N', 'G', 'L', 'E', 'B', 'L', 'B'};
+constexpr uint32_t kFileVersion   = 1;
+constexpr uint32_t kRecordMagic   = 0x524C4241;  // "ABLR"
+constexpr uint64_t kChecksumSeed  = 0x414E474C45424C42ull;
+constexpr size_t kRecordAlignment = 8;
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t keyLength;
+};
+
+// Followed by the key and the blob, padded to kRecordAlignment.
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t size;
+    uint64_t checksum;
+};
+
+static_assert(sizeof(FileHeader) % kRecordAlignment == 0, "Misaligned first record");
+static_assert(sizeof(RecordHeader) % kRecordAlignment == 0, "Misaligned record header");
+
+size_t GetRecordSize(size_t blobSize)
+{
+    return rx::roundUp(sizeof(RecordHeader) + kBlobCacheKeyLength + blobSize, kRecordAlignment);
+}
+
+uint64_t ComputeChecksum(const uint8_t *data, size_t size)
+{
+    return XXH64(data, size, kChecksumSeed);
+}
+
+// Reads the header and key of the record at |offset|.  Returns false past the last complete
+// record.
+bool ReadRecord(const uint8_t *data,
+                size_t fileSize,
+                size_t offset,
+                RecordHeader *recordOut,
+                BlobCache::Key *keyOut)
+{
+    if (offset + sizeof(RecordHeader) + kBlobCacheKeyLength > fileSize)
+    {
+        return false;
+    }
+
+    memcpy(recordOut, data + offset, sizeof(RecordHeader));
+    if (recordOut->magic != kRecordMagic || GetRecordSize(recordOut->size) > fileSize - offset)
+    {
+        return false;
+    }
+
+    memcpy(keyOut->data(), data + offset + sizeof(RecordHeader), kBlobCacheKeyLength);
+    return true;
+}
+
+FileHeader MakeFileHeader()
+{
+    FileHeader header = {};
+    memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+    header.version   = kFileVersion;
+    header.keyLength = static_cast<uint32_t>(kBlobCacheKeyLength);
+    return header;
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+bool WriteFully(int fd, const uint8_t *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written = write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Holds an exclusive lock on the file, which serializes processes sharing it.  The store may
+// switch |*fd| to another file while it is locked, so whichever file it refers to is unlocked.
+class ScopedFileLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedFileLock(const int *fd) : mFd(fd), mLocked(flock(*fd, LOCK_EX) == 0) {}
+    ~ScopedFileLock()
+    {
+        if (mLocked)
+        {
+            flock(*mFd, LOCK_UN);
+        }
+    }
+
+    bool locked() const { return mLocked; }
+
+  private:
+    const int *mFd;
+    bool mLocked;
+};
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}  // anonymous namespace
+
+class MappedBlobStore::Mapping final : angle::NonCopyable
+{
+  public:
+    Mapping(const uint8_t *data, size_t size) : mData(data), mSize(size) {}
+    ~Mapping()
+    {
+#if defined(ANGLE_PLATFORM_POSIX)
+        munmap(const_cast<uint8_t *>(mData), mSize);
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+    }
+
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+};
+
+MappedBlobStore::MappedBlobStore(const std::string &path, int fd, size_t maxFileSize)
+    : mPath(path), mFd(fd), mMaxFileSize(maxFileSize)
+{}
+
+MappedBlobStore::~MappedBlobStore()
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    close(mFd);
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+// static
+std::unique_ptr<MappedBlobStore> MappedBlobStore::Open(const std::string &path, size_t maxFileSize)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            WARN() << "Failed to open program cache file " << path;
+            return nullptr;
+        }
+
+        std::unique_ptr<MappedBlobStore> store(new MappedBlobStore(path, fd, maxFileSize));
+        bool isOutdated = false;
+        if (store->initialize(&isOutdated))
+        {
+            return store;
+        }
+        if (!isOutdated)
+        {
+            break;
+        }
+
+        // Replace a file written by another version instead of truncating it, since other
+        // processes may still have it mapped.
+        unlink(path.c_str());
+    }
+
+    WARN() << "Ignoring unusable program cache file " << path;
+    return nullptr;
+#else
+    return nullptr;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+bool MappedBlobStore::initialize(bool *isOutdatedOut)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    ScopedFileLock lock(&mFd);
+    if (!lock.locked() || !followReplacedFileLocked())
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(mFd, &fileStat) != 0)
+    {
+        return false;
+    }
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+
+    const FileHeader expectedHeader = MakeFileHeader();
+    if (fileSize < sizeof(FileHeader))
+    {
+        // A new file, or one whose header was never completely written.
+        return ftruncate(mFd, 0) == 0 && lseek(mFd, 0, SEEK_SET) == 0 &&
+               WriteFully(mFd, reinterpret_cast<const uint8_t *>(&expectedHeader),
+                          sizeof(expectedHeader));
+    }
+
+    FileHeader header = {};
+    if (pread(mFd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+        memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) != 0)
+    {
+        // Not written by this class; don't clobber it.
+        return false;
+    }
+
+    if (memcmp(&header, &expectedHeader, sizeof(header)) != 0)
+    {
+        *isOutdatedOut = true;
+        return false;
+    }
+
+    if (fileSize == sizeof(FileHeader))
+    {
+        return true;
+    }
+
+    void *address = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, mFd, 0);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    mMapping = std::make_shared<Mapping>(static_cast<const uint8_t *>(address), fileSize);
+
+    // Build the index from the record headers.  The blobs themselves aren't touched.
+    const uint8_t *data = mMapping->data();
+    size_t offset       = sizeof(FileHeader);
+    RecordHeader record;
+    BlobCache::Key key;
+    while (ReadRecord(data, fileSize, offset, &record, &key))
+    {
+        Entry entry;
+        entry.offset   = offset + sizeof(RecordHeader) + kBlobCacheKeyLength;
+        entry.size     = record.size;
+        entry.checksum = record.checksum;
+        entry.verified = false;
+        mEntries[key]  = entry;
+
+        offset += GetRecordSize(record.size);
+    }
+
+    // Drop whatever a crashed writer left behind, so the next record is appended at a record
+    // boundary.  The mapping still covers the old size, but nothing past |offset| is read.
+    if (offset < fileSize && ftruncate(mFd, offset) != 0)
+    {
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+bool MappedBlobStore::followReplacedFileLocked()
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    while (true)
+    {
+        struct stat fileStat;
+        struct stat pathStat;
+        if (fstat(mFd, &fileStat) != 0 || stat(mPath.c_str(), &pathStat) != 0)
+        {
+            return false;
+        }
+        if (fileStat.st_dev == pathStat.st_dev && fileStat.st_ino == pathStat.st_ino)
+        {
+            return true;
+        }
+
+        int fd = open(mPath.c_str(), O_RDWR | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+        if (flock(fd, LOCK_EX) != 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        // Closing the old file also unlocks it.  The new one may have been replaced too while
+        // waiting for its lock, so check again.
+        close(mFd);
+        mFd = fd;
+    }
+#else
+    return false;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+bool MappedBlobStore::compactLocked(size_t fileSize,
+                                    const BlobCache::Key &key,
+                                    size_t reservedSize)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    void *address = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, mFd, 0);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+    const Mapping mapping(static_cast<const uint8_t *>(address), fileSize);
+    const uint8_t *data = mapping.data();
+
+    struct RecordLocation
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    // Find the last record of every key.
+    std::vector<RecordLocation> records;
+    std::unordered_map<BlobCache::Key, size_t> lastRecords;
+    size_t offset = sizeof(FileHeader);
+    RecordHeader record;
+    BlobCache::Key recordKey;
+    while (ReadRecord(data, fileSize, offset, &record, &recordKey))
+    {
+        lastRecords[recordKey] = records.size();
+        records.push_back({offset, GetRecordSize(record.size)});
+        offset += records.back().size;
+    }
+
+    // Keep the newest of those, up to half the maximum size so the file isn't compacted again
+    // right away.  |key| is about to get a newer record.
+    std::vector<RecordLocation> keptRecords;
+    size_t keptSize = sizeof(FileHeader) + reservedSize;
+    for (size_t index = records.size(); index-- > 0;)
+    {
+        memcpy(recordKey.data(), data + records[index].offset + sizeof(RecordHeader),
+               kBlobCacheKeyLength);
+        if (recordKey == key || lastRecords[recordKey] != index)
+        {
+            continue;
+        }
+        if (keptSize + records[index].size > mMaxFileSize / 2)
+        {
+            break;
+        }
+        keptSize += records[index].size;
+        keptRecords.push_back(records[index]);
+    }
+
+    // Write the new file next to the old one, and lock it before it replaces the old one so that
+    // processes switching to it wait for this one to finish appending.
+    const std::string compactedPath = mPath + ".compact";
+    int fd = open(compactedPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const FileHeader header = MakeFileHeader();
+
+    bool written = flock(fd, LOCK_EX) == 0 &&
+                   WriteFully(fd, reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+    for (auto iter = keptRecords.rbegin(); written && iter != keptRecords.rend(); ++iter)
+    {
+        written = WriteFully(fd, data + iter->offset, iter->size);
+    }
+
+    if (!written || rename(compactedPath.c_str(), mPath.c_str()) != 0)
+    {
+        close(fd);
+        unlink(compactedPath.c_str());
+        return false;
+    }
+
+    // Blobs already served from the old file stay valid through mMapping.
+    close(mFd);
+    mFd = fd;
+    return true;
+#else
+    return false;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+bool MappedBlobStore::get(const BlobCache::Key &key, BlobCache::Value *valueOut)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iter = mEntries.find(key);
+    if (iter == mEntries.end())
+    {
+        return false;
+    }
+
+    Entry &entry        = iter->second;
+    const uint8_t *blob = mMapping->data() + entry.offset;
+    if (!entry.verified)
+    {
+        if (ComputeChecksum(blob, entry.size) != entry.checksum)
+        {
+            WARN() << "Discarding corrupt program cache file entry.";
+            mEntries.erase(iter);
+            return false;
+        }
+        entry.verified = true;
+    }
+
+    *valueOut = BlobCache::Value(blob, entry.size, mMapping);
+    return true;
+}
+
+void MappedBlobStore::append(const BlobCache::Key &key, const uint8_t *data, size_t size)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (size > std::numeric_limits<uint32_t>::max() ||
+        sizeof(FileHeader) + GetRecordSize(size) > mMaxFileSize)
+    {
+        return;
+    }
+
+    // Skip blobs the file already holds.  A different blob for the key gets a newer record.
+    const uint64_t checksum = ComputeChecksum(data, size);
+    auto appended           = mAppendedChecksums.find(key);
+    auto mapped             = mEntries.find(key);
+    if ((appended != mAppendedChecksums.end() && appended->second == checksum) ||
+        (mapped != mEntries.end() && mapped->second.size == size &&
+         mapped->second.checksum == checksum))
+    {
+        return;
+    }
+
+    // Write the whole record with a single call, so a failure leaves at most one partial record.
+    const size_t recordSize = GetRecordSize(size);
+    std::vector<uint8_t> record(recordSize, 0);
+
+    RecordHeader header;
+    header.magic    = kRecordMagic;
+    header.size     = static_cast<uint32_t>(size);
+    header.checksum = checksum;
+    memcpy(record.data(), &header, sizeof(header));
+    memcpy(record.data() + sizeof(header), key.data(), kBlobCacheKeyLength);
+    memcpy(record.data() + sizeof(header) + kBlobCacheKeyLength, data, size);
+
+    ScopedFileLock fileLock(&mFd);
+    if (!fileLock.locked() || !followReplacedFileLocked())
+    {
+        return;
+    }
+
+    off_t end = lseek(mFd, 0, SEEK_END);
+    if (end < 0)
+    {
+        return;
+    }
+
+    if (static_cast<size_t>(end) + recordSize > mMaxFileSize)
+    {
+        if (!compactLocked(static_cast<size_t>(end), key, recordSize))
+        {
+            WARN() << "Failed to compact program cache file.";
+            return;
+        }
+
+        end = lseek(mFd, 0, SEEK_END);
+        if (end < 0)
+        {
+            return;
+        }
+    }
+
+    if (!WriteFully(mFd, record.data(), record.size()))
+    {
+        // Don't leave a partial record for other processes to trip over.
+        if (ftruncate(mFd, end) != 0)
+        {
+            WARN() << "Failed to remove partial program cache file record.";
+        }
+        return;
+    }
+
+    mAppendedChecksums[key] = checksum;
+    mEntries.erase(key);
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+void MappedBlobStore::remove(const BlobCache::Key &key)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.erase(key);
+}
+
+size_t MappedBlobStore::mappedEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+}  // namespace egl
@@ -0,0 +1,97 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MappedBlobStore: A persistent, append-only file of keyed blobs.  Blobs that are in the file when
+// it is opened are served directly from a read-only memory mapping, so a program binary can be
+// deserialized from a previous run of the process without reading it into memory first.
+
+#ifndef LIBANGLE_MAPPED_BLOB_STORE_H_
+#define LIBANGLE_MAPPED_BLOB_STORE_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "libANGLE/BlobCache.h"
+
+namespace egl
+{
+// The file starts with a header, followed by records that each hold a blob along with its key,
+// size and checksum.  Records are only ever appended, with the file locked so processes sharing
+// the file don't interleave them.  A record left incomplete by a crash is truncated the next time
+// the file is opened.  When a key appears more than once, the last record wins.
+//
+// When an append would grow the file past its maximum size, the newest record of each key that
+// fits in half of that size is copied to a new file, which then replaces the old one.  Processes
+// that still have the old file mapped keep using the mapping, and switch to the new file the next
+// time they append.
+//
+// Blobs appended after the file was opened are not mapped; callers are expected to keep those in
+// memory.  The checksum of a mapped blob is verified the first time it is looked up.
+//
+// Only implemented on POSIX platforms; open() fails elsewhere.  All methods are thread-safe.
+class MappedBlobStore final : angle::NonCopyable
+{
+  public:
+    // Compact the file rather than let it grow past this size.
+    static constexpr size_t kDefaultMaxFileSize = 256 * 1024 * 1024;
+
+    ~MappedBlobStore();
+
+    // Opens or creates the file at |path|.  Returns nullptr if the file can't be used.
+    static std::unique_ptr<MappedBlobStore> Open(const std::string &path,
+                                                 size_t maxFileSize = kDefaultMaxFileSize);
+
+    // On success, |valueOut| points into the mapping and keeps it alive.
+    bool get(const BlobCache::Key &key, BlobCache::Value *valueOut);
+
+    // Appends the blob unless the file already holds the same blob for the key.  A mapped blob of
+    // the same key is no longer returned.
+    void append(const BlobCache::Key &key, const uint8_t *data, size_t size);
+
+    // Stops returning the blob, for example because it failed to load.  The record stays in the
+    // file.
+    void remove(const BlobCache::Key &key);
+
+    // Number of blobs that can be served from the mapping.
+    size_t mappedEntryCount() const;
+
+  private:
+    class Mapping;
+
+    struct Entry
+    {
+        size_t offset;
+        size_t size;
+        uint64_t checksum;
+        bool verified;
+    };
+
+    MappedBlobStore(const std::string &path, int fd, size_t maxFileSize);
+
+    // Sets |isOutdatedOut| if the file was written by a different version of this class.
+    bool initialize(bool *isOutdatedOut);
+
+    // Must be called with mFd locked.  Switches to the file at mPath if another process replaced
+    // the one that is open.
+    bool followReplacedFileLocked();
+    // Must be called with mFd locked.  Replaces the file of |fileSize| bytes with one that holds
+    // the newest records that leave room for |reservedSize| more bytes, except for |key|'s.
+    bool compactLocked(size_t fileSize, const BlobCache::Key &key, size_t reservedSize);
+
+    std::string mPath;
+    int mFd;
+    size_t mMaxFileSize;
+
+    mutable std::mutex mMutex;
+    std::shared_ptr<Mapping> mMapping;
+    std::unordered_map<BlobCache::Key, Entry> mEntries;
+    // Checksums of the blobs appended by this process, so they aren't appended again.
+    std::unordered_map<BlobCache::Key, uint64_t> mAppendedChecksums;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_MAPPED_BLOB_STORE_H_
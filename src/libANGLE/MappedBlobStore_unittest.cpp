@@ -0,0 +1,359 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MappedBlobStore_unittest:
+//   Tests of the file-backed program cache store.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/MappedBlobStore.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <unistd.h>
+
+namespace egl
+{
+namespace
+{
+BlobCache::Key MakeKey(uint8_t start)
+{
+    BlobCache::Key key;
+    for (size_t index = 0; index < key.size(); ++index)
+    {
+        key[index] = static_cast<uint8_t>(start + index);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeBlob(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> blob(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        blob[index] = static_cast<uint8_t>(start + index);
+    }
+    return blob;
+}
+
+bool BlobEquals(BlobCache::Value &value, const std::vector<uint8_t> &expected)
+{
+    return value.size() == expected.size() &&
+           memcmp(value.data(), expected.data(), expected.size()) == 0;
+}
+
+class MappedBlobStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        const ::testing::TestInfo *testInfo =
+            ::testing::UnitTest::GetInstance()->current_test_info();
+        mPath = ::testing::TempDir() + "MappedBlobStoreTest_" + testInfo->name();
+        unlink(mPath.c_str());
+    }
+
+    void TearDown() override { unlink(mPath.c_str()); }
+
+    std::string mPath;
+};
+
+// Tests that blobs are served from the file once it is reopened.
+TEST_F(MappedBlobStoreTest, PersistsAcrossOpen)
+{
+    const std::vector<uint8_t> blob0 = MakeBlob(100, 0);
+    const std::vector<uint8_t> blob1 = MakeBlob(3, 50);
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        store->append(MakeKey(0), blob0.data(), blob0.size());
+        store->append(MakeKey(1), blob1.data(), blob1.size());
+
+        // Appended blobs are not mapped until the next open.
+        BlobCache::Value value;
+        EXPECT_FALSE(store->get(MakeKey(0), &value));
+        EXPECT_EQ(0u, store->mappedEntryCount());
+    }
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+    ASSERT_NE(nullptr, store);
+    EXPECT_EQ(2u, store->mappedEntryCount());
+
+    BlobCache::Value value;
+    ASSERT_TRUE(store->get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+    ASSERT_TRUE(store->get(MakeKey(1), &value));
+    EXPECT_TRUE(BlobEquals(value, blob1));
+    EXPECT_FALSE(store->get(MakeKey(2), &value));
+
+    // A removed blob is no longer returned.
+    store->remove(MakeKey(0));
+    EXPECT_FALSE(store->get(MakeKey(0), &value));
+}
+
+// Tests that a value stays valid after the store is destroyed.
+TEST_F(MappedBlobStoreTest, ValueOutlivesStore)
+{
+    const std::vector<uint8_t> blob = MakeBlob(64, 3);
+    MappedBlobStore::Open(mPath)->append(MakeKey(0), blob.data(), blob.size());
+
+    BlobCache::Value value;
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        ASSERT_TRUE(store->get(MakeKey(0), &value));
+    }
+    EXPECT_TRUE(BlobEquals(value, blob));
+}
+
+// Tests that a record cut short by a crash is dropped, and that appending continues after the last
+// complete record.
+TEST_F(MappedBlobStoreTest, TruncatedRecord)
+{
+    const std::vector<uint8_t> blob0 = MakeBlob(40, 0);
+    const std::vector<uint8_t> blob1 = MakeBlob(40, 1);
+    const std::vector<uint8_t> blob2 = MakeBlob(40, 2);
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        store->append(MakeKey(0), blob0.data(), blob0.size());
+        store->append(MakeKey(1), blob1.data(), blob1.size());
+    }
+
+    std::ifstream file(mPath, std::ios::binary | std::ios::ate);
+    const long fileSize = static_cast<long>(file.tellg());
+    file.close();
+    ASSERT_EQ(0, truncate(mPath.c_str(), fileSize - 10));
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        EXPECT_EQ(1u, store->mappedEntryCount());
+        store->append(MakeKey(2), blob2.data(), blob2.size());
+    }
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+    ASSERT_NE(nullptr, store);
+    EXPECT_EQ(2u, store->mappedEntryCount());
+
+    BlobCache::Value value;
+    ASSERT_TRUE(store->get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+    EXPECT_FALSE(store->get(MakeKey(1), &value));
+    ASSERT_TRUE(store->get(MakeKey(2), &value));
+    EXPECT_TRUE(BlobEquals(value, blob2));
+}
+
+// Tests that a blob whose contents don't match its checksum is not returned.
+TEST_F(MappedBlobStoreTest, CorruptBlob)
+{
+    // Sized so the record needs no padding.
+    const std::vector<uint8_t> blob = MakeBlob(44, 0);
+    MappedBlobStore::Open(mPath)->append(MakeKey(0), blob.data(), blob.size());
+
+    // Flip the last byte of the blob.
+    std::fstream file(mPath, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+    const std::streamoff fileSize = file.tellg();
+    file.seekp(fileSize - 1);
+    file.put(0x7F);
+    file.close();
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+    ASSERT_NE(nullptr, store);
+
+    BlobCache::Value value;
+    EXPECT_FALSE(store->get(MakeKey(0), &value));
+    EXPECT_EQ(0u, store->mappedEntryCount());
+}
+
+// Tests that a file not written by the store is left alone.
+TEST_F(MappedBlobStoreTest, ForeignFile)
+{
+    constexpr char kContents[] = "Not a program cache, but long enough to hold its header";
+    {
+        std::ofstream file(mPath, std::ios::binary);
+        file << kContents;
+    }
+
+    EXPECT_EQ(nullptr, MappedBlobStore::Open(mPath));
+
+    std::ifstream file(mPath, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(kContents, contents);
+}
+
+// Tests that a newer blob for a key replaces the one in the file, and that the same blob isn't
+// appended twice.
+TEST_F(MappedBlobStoreTest, Overwrite)
+{
+    const std::vector<uint8_t> blob0 = MakeBlob(40, 0);
+    const std::vector<uint8_t> blob1 = MakeBlob(60, 1);
+    const std::vector<uint8_t> blob2 = MakeBlob(80, 2);
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        store->append(MakeKey(0), blob0.data(), blob0.size());
+        store->append(MakeKey(0), blob1.data(), blob1.size());
+    }
+
+    std::ifstream file(mPath, std::ios::binary | std::ios::ate);
+    const std::streamoff fileSize = file.tellg();
+    file.close();
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+        ASSERT_NE(nullptr, store);
+        EXPECT_EQ(1u, store->mappedEntryCount());
+
+        BlobCache::Value value;
+        ASSERT_TRUE(store->get(MakeKey(0), &value));
+        EXPECT_TRUE(BlobEquals(value, blob1));
+
+        // The same blob again leaves the file alone.
+        store->append(MakeKey(0), blob1.data(), blob1.size());
+        file.open(mPath, std::ios::binary | std::ios::ate);
+        EXPECT_EQ(fileSize, file.tellg());
+        file.close();
+
+        // A different one stops the mapped blob from being returned, but the value already
+        // returned stays valid.
+        store->append(MakeKey(0), blob2.data(), blob2.size());
+        BlobCache::Value newValue;
+        EXPECT_FALSE(store->get(MakeKey(0), &newValue));
+        EXPECT_TRUE(BlobEquals(value, blob1));
+    }
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+    ASSERT_NE(nullptr, store);
+
+    BlobCache::Value value;
+    ASSERT_TRUE(store->get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob2));
+}
+
+// Tests that the file is compacted when it would grow past its maximum size, keeping the newest
+// record of each key that fits, and that appending continues afterwards.
+TEST_F(MappedBlobStoreTest, MaxFileSize)
+{
+    // The file header takes 16 bytes and the record of a 100-byte blob 136, so the file holds six
+    // records, and three after compaction.
+    constexpr size_t kMaxFileSize = 900;
+    constexpr size_t kBlobSize    = 100;
+    const std::vector<uint8_t> oldBlob0 = MakeBlob(kBlobSize, 100);
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath, kMaxFileSize);
+        ASSERT_NE(nullptr, store);
+        for (uint8_t key : {1, 2, 4})
+        {
+            const std::vector<uint8_t> blob = MakeBlob(kBlobSize, key);
+            store->append(MakeKey(key), blob.data(), blob.size());
+        }
+        store->append(MakeKey(0), oldBlob0.data(), oldBlob0.size());
+        for (uint8_t key : {5, 0})
+        {
+            const std::vector<uint8_t> blob = MakeBlob(kBlobSize, key);
+            store->append(MakeKey(key), blob.data(), blob.size());
+        }
+    }
+
+    // This store keeps the old file mapped while another one compacts it.
+    std::unique_ptr<MappedBlobStore> oldStore = MappedBlobStore::Open(mPath, kMaxFileSize);
+    ASSERT_NE(nullptr, oldStore);
+    EXPECT_EQ(5u, oldStore->mappedEntryCount());
+
+    {
+        // Compacting keeps the last records of keys 0 and 5, and skips the older one of key 0.
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath, kMaxFileSize);
+        ASSERT_NE(nullptr, store);
+        const std::vector<uint8_t> blob = MakeBlob(kBlobSize, 3);
+        store->append(MakeKey(3), blob.data(), blob.size());
+    }
+
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath, kMaxFileSize);
+        ASSERT_NE(nullptr, store);
+        EXPECT_EQ(3u, store->mappedEntryCount());
+
+        BlobCache::Value value;
+        for (uint8_t key : {0, 3, 5})
+        {
+            ASSERT_TRUE(store->get(MakeKey(key), &value));
+            EXPECT_TRUE(BlobEquals(value, MakeBlob(kBlobSize, key)));
+        }
+        for (uint8_t key : {1, 2, 4})
+        {
+            EXPECT_FALSE(store->get(MakeKey(key), &value));
+        }
+    }
+
+    // The old mapping still serves its blobs, and appending switches to the compacted file.
+    BlobCache::Value value;
+    ASSERT_TRUE(oldStore->get(MakeKey(1), &value));
+    EXPECT_TRUE(BlobEquals(value, MakeBlob(kBlobSize, 1)));
+
+    const std::vector<uint8_t> blob6 = MakeBlob(kBlobSize, 6);
+    oldStore->append(MakeKey(6), blob6.data(), blob6.size());
+    oldStore.reset();
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath, kMaxFileSize);
+    ASSERT_NE(nullptr, store);
+    EXPECT_EQ(4u, store->mappedEntryCount());
+    ASSERT_TRUE(store->get(MakeKey(6), &value));
+    EXPECT_TRUE(BlobEquals(value, blob6));
+}
+
+// Tests that a blob too large for the file is not appended.
+TEST_F(MappedBlobStoreTest, OversizeBlob)
+{
+    const std::vector<uint8_t> blob = MakeBlob(300, 0);
+    {
+        std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath, 200);
+        ASSERT_NE(nullptr, store);
+        store->append(MakeKey(0), blob.data(), blob.size());
+    }
+
+    std::unique_ptr<MappedBlobStore> store = MappedBlobStore::Open(mPath);
+    ASSERT_NE(nullptr, store);
+    EXPECT_EQ(0u, store->mappedEntryCount());
+}
+
+// Tests that the blob cache hits programs persisted by a previous cache that used the same file.
+TEST_F(MappedBlobStoreTest, BlobCacheFallback)
+{
+    const std::vector<uint8_t> blob = MakeBlob(100, 0);
+    {
+        BlobCache blobCache(1024);
+        blobCache.setFileStore(MappedBlobStore::Open(mPath));
+
+        angle::MemoryBuffer buffer;
+        ASSERT_TRUE(buffer.resize(blob.size()));
+        memcpy(buffer.data(), blob.data(), blob.size());
+        blobCache.put(MakeKey(0), std::move(buffer));
+    }
+
+    BlobCache blobCache(1024);
+    blobCache.setFileStore(MappedBlobStore::Open(mPath));
+    EXPECT_EQ(0u, blobCache.entryCount());
+
+    BlobCache::Value value;
+    size_t valueSize = 0;
+    ASSERT_TRUE(blobCache.get(nullptr, MakeKey(0), &value, &valueSize));
+    EXPECT_EQ(blob.size(), valueSize);
+    EXPECT_TRUE(BlobEquals(value, blob));
+    EXPECT_EQ(1u, blobCache.getStatistics().hits);
+}
+}  // anonymous namespace
+}  // namespace egl
+
+#endif  // defined(ANGLE_PLATFORM_POSIX)
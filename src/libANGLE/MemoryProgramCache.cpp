@@ -149,9 +149,17 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
         uint32_t uncompressedSize =
             zlib_internal::GetGzipUncompressedSize(binaryProgram.data(), programSize);
 
-        std::vector<uint8_t> uncompressedData(uncompressedSize);
+        // Decompression overwrites the whole buffer, so it is not cleared first.  The buffer is
+        // shared because the program may keep referencing parts of it, such as its SPIR-V.
+        auto uncompressedData = std::make_shared<angle::MemoryBuffer>();
+        if (!uncompressedData->resize(uncompressedSize))
+        {
+            ERR() << "Failed to allocate memory for binary data\n";
+            return angle::Result::Incomplete;
+        }
+
         uLong destLen = uncompressedSize;
-        int zResult   = zlib_internal::GzipUncompressHelper(uncompressedData.data(), &destLen,
+        int zResult   = zlib_internal::GzipUncompressHelper(uncompressedData->data(), &destLen,
                                                           binaryProgram.data(),
                                                           static_cast<uLong>(programSize));
 
@@ -161,9 +169,7 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
             return angle::Result::Incomplete;
         }
 
-        angle::Result result =
-            program->loadBinary(context, GL_PROGRAM_BINARY_ANGLE, uncompressedData.data(),
-                                static_cast<int>(uncompressedData.size()));
+        angle::Result result = program->loadBinary(context, std::move(uncompressedData));
         ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ProgramCache.LoadBinarySuccess",
                                 result == angle::Result::Continue);
         ANGLE_TRY(result);
@@ -196,7 +202,7 @@ bool MemoryProgramCache::get(const Context *context,
 }
 
 bool MemoryProgramCache::getAt(size_t index,
-                               const egl::BlobCache::Key **hashOut,
+                               egl::BlobCache::Key *hashOut,
                                egl::BlobCache::Value *programOut)
 {
     return mBlobCache.getAt(index, hashOut, programOut);
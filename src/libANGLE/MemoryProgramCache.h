@@ -39,9 +39,7 @@ class MemoryProgramCache final : angle::NonCopyable
              size_t *programSizeOut);
 
     // For querying the contents of the cache.
-    bool getAt(size_t index,
-               const egl::BlobCache::Key **hashOut,
-               egl::BlobCache::Value *programOut);
+    bool getAt(size_t index, egl::BlobCache::Key *hashOut, egl::BlobCache::Value *programOut);
 
     // Evict a program from the binary cache.
     void remove(const egl::BlobCache::Key &programHash);
@@ -0,0 +1,163 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the translations of shaders in memory so identical shaders don't
+//   always have to be re-translated. Can be used in conjunction with the platform layer to warm
+//   up the cache from disk.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <sstream>
+
+#include <anglebase/sha1.h>
+
+#include "common/angle_version.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/histogram_macros.h"
+
+#define USE_SYSTEM_ZLIB
+#include "compression_utils_portable.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr unsigned int kWarningLimit = 3;
+
+// Distinguishes the keys of translations from the keys of programs, should both be stored in the
+// application's cache.
+constexpr char kShaderKeyTag[] = "ShaderTranslation";
+}  // anonymous namespace
+
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache)
+    : mBlobCache(blobCache), mIssuedWarnings(0)
+{}
+
+MemoryShaderCache::~MemoryShaderCache() {}
+
+void MemoryShaderCache::ComputeHash(ShaderType shaderType,
+                                    ShShaderSpec spec,
+                                    ShShaderOutput outputType,
+                                    const std::string &builtInResourcesString,
+                                    const std::string &source,
+                                    ShCompileOptions compileOptions,
+                                    egl::BlobCache::Key *hashOut)
+{
+    // The source goes last, with its length, so it can't be confused with the other fields.
+    std::ostringstream hashStream;
+    hashStream << kShaderKeyTag << ':' << ANGLE_COMMIT_HASH << ':' << shaderType << ':' << spec
+               << ':' << outputType << ':' << compileOptions << ':' << builtInResourcesString
+               << ':' << source.length() << ':' << source;
+
+    // Call the secure SHA hashing function.
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryShaderCache::getShader(const Context *context,
+                                  const egl::BlobCache::Key &shaderHash,
+                                  angle::MemoryBuffer *translationOut)
+{
+    egl::BlobCache::Value compressedTranslation;
+    size_t compressedSize = 0;
+    if (!mBlobCache.get(context->getScratchBuffer(), shaderHash, &compressedTranslation,
+                        &compressedSize))
+    {
+        return false;
+    }
+
+    uint32_t uncompressedSize =
+        zlib_internal::GetGzipUncompressedSize(compressedTranslation.data(), compressedSize);
+
+    // Decompression overwrites the whole buffer, so it is not cleared first.
+    if (!translationOut->resize(uncompressedSize))
+    {
+        ERR() << "Failed to allocate memory for shader translation";
+        return false;
+    }
+
+    uLong destLen = uncompressedSize;
+    int zResult   = zlib_internal::GzipUncompressHelper(translationOut->data(), &destLen,
+                                                      compressedTranslation.data(),
+                                                      static_cast<uLong>(compressedSize));
+    if (zResult != Z_OK)
+    {
+        ERR() << "Failure to decompress shader translation: " << zResult;
+        removeShader(shaderHash);
+        return false;
+    }
+
+    return true;
+}
+
+void MemoryShaderCache::putShader(const egl::BlobCache::Key &shaderHash,
+                                  const angle::MemoryBuffer &translation)
+{
+    // Compress the translation
+    uLong uncompressedSize       = static_cast<uLong>(translation.size());
+    uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
+
+    angle::MemoryBuffer compressedData;
+    if (!compressedData.resize(expectedCompressedSize))
+    {
+        ERR() << "Failed to allocate enough memory to hold compressed shader translation. ("
+              << expectedCompressedSize << " bytes )";
+        return;
+    }
+
+    int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &expectedCompressedSize,
+                                                    translation.data(), uncompressedSize,
+                                                    nullptr, nullptr);
+    if (zResult != Z_OK)
+    {
+        ERR() << "Error compressing shader translation: " << zResult;
+        return;
+    }
+
+    // Resize the buffer to the actual compressed size
+    if (!compressedData.resize(expectedCompressedSize))
+    {
+        ERR() << "Failed to resize to actual compressed shader translation size. ("
+              << expectedCompressedSize << " bytes )";
+        return;
+    }
+
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ShaderCache.TranslationSizeBytes",
+                           static_cast<int>(compressedData.size()));
+
+    mBlobCache.put(shaderHash, std::move(compressedData));
+}
+
+void MemoryShaderCache::removeShader(const egl::BlobCache::Key &shaderHash)
+{
+    unsigned int issuedWarnings = mIssuedWarnings++;
+    if (issuedWarnings < kWarningLimit)
+    {
+        WARN() << "Failed to load shader translation from cache.";
+
+        if (issuedWarnings + 1 == kWarningLimit)
+        {
+            WARN() << "Reaching warning limit for shader cache load failures, silencing "
+                      "subsequent warnings.";
+        }
+    }
+
+    mBlobCache.remove(shaderHash);
+}
+
+void MemoryShaderCache::clear()
+{
+    mBlobCache.clear();
+    mIssuedWarnings = 0;
+}
+
+size_t MemoryShaderCache::entryCount() const
+{
+    return mBlobCache.entryCount();
+}
+
+}  // namespace gl
@@ -0,0 +1,69 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the translations of shaders in memory so identical shaders don't
+//   always have to be re-translated. Can be used in conjunction with the platform layer to warm
+//   up the cache from disk.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <atomic>
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "common/MemoryBuffer.h"
+#include "common/PackedEnums.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    explicit MemoryShaderCache(egl::BlobCache &blobCache);
+    ~MemoryShaderCache();
+
+    // The translation only depends on the source, the final compile options and the inputs of
+    // sh::ConstructCompiler: the shader type, the spec, the output type and the built-in
+    // resources, given as sh::GetBuiltInResourcesString.
+    static void ComputeHash(ShaderType shaderType,
+                            ShShaderSpec spec,
+                            ShShaderOutput outputType,
+                            const std::string &builtInResourcesString,
+                            const std::string &source,
+                            ShCompileOptions compileOptions,
+                            egl::BlobCache::Key *hashOut);
+
+    bool isCachingEnabled() const { return mBlobCache.isCachingEnabled(); }
+
+    // Check the cache, and decompress the serialized translation if found.
+    bool getShader(const Context *context,
+                   const egl::BlobCache::Key &shaderHash,
+                   angle::MemoryBuffer *translationOut);
+
+    // Compress and store a serialized translation.
+    void putShader(const egl::BlobCache::Key &shaderHash, const angle::MemoryBuffer &translation);
+
+    // Evict a translation that failed to load.
+    void removeShader(const egl::BlobCache::Key &shaderHash);
+
+    // Empty the cache.
+    void clear();
+
+    // Returns the number of entries in the cache.
+    size_t entryCount() const;
+
+  private:
+    egl::BlobCache &mBlobCache;
+    std::atomic<unsigned int> mIssuedWarnings;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
@@ -1884,7 +1884,28 @@ angle::Result Program::loadBinary(const Context *context,
     }
 
     BinaryInputStream stream(binary, length);
-    ANGLE_TRY(deserialize(context, stream, infoLog));
+    return loadBinaryFromStream(context, &stream);
+#endif  // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+}
+
+angle::Result Program::loadBinary(const Context *context,
+                                  std::shared_ptr<const angle::MemoryBuffer> binary)
+{
+    ASSERT(!mLinkingState);
+    unlink();
+
+#if ANGLE_PROGRAM_BINARY_LOAD != ANGLE_ENABLED
+    return angle::Result::Continue;
+#else
+    BinaryInputStream stream(std::move(binary));
+    return loadBinaryFromStream(context, &stream);
+#endif  // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+}
+
+angle::Result Program::loadBinaryFromStream(const Context *context, BinaryInputStream *stream)
+{
+    InfoLog &infoLog = mState.mExecutable->getInfoLog();
+    ANGLE_TRY(deserialize(context, *stream, infoLog));
 
     // Currently we require the full shader text to compute the program hash.
     // We could also store the binary in the internal program cache.
@@ -1913,7 +1934,7 @@ angle::Result Program::loadBinary(const Context *context,
     // sources.
     angle::Result result;
     std::unique_ptr<LinkingState> linkingState;
-    std::unique_ptr<rx::LinkEvent> linkEvent = mProgram->load(context, &stream, infoLog);
+    std::unique_ptr<rx::LinkEvent> linkEvent = mProgram->load(context, stream, infoLog);
     if (linkEvent)
     {
         linkingState                    = std::make_unique<LinkingState>();
@@ -1928,7 +1949,6 @@ angle::Result Program::loadBinary(const Context *context,
     mLinkingState = std::move(linkingState);
 
     return result;
-#endif  // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
 }
 
 angle::Result Program::saveBinary(Context *context,
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -516,6 +517,9 @@ class Program final : public LabeledObject, public angle::Subject
                              GLenum binaryFormat,
                              const void *binary,
                              GLsizei length);
+    // Loads a GL_PROGRAM_BINARY_ANGLE binary that the backend may keep referencing in place.
+    angle::Result loadBinary(const Context *context,
+                             std::shared_ptr<const angle::MemoryBuffer> binary);
     angle::Result saveBinary(Context *context,
                              GLenum *binaryFormat,
                              void *binary,
@@ -881,6 +885,7 @@ class Program final : public LabeledObject, public angle::Subject
 
     // Loads program state according to the specified binary blob.
     angle::Result deserialize(const Context *context, BinaryInputStream &stream, InfoLog &infoLog);
+    angle::Result loadBinaryFromStream(const Context *context, BinaryInputStream *stream);
 
     void unlink();
     void deleteSelf(const Context *context);
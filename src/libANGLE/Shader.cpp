@@ -15,10 +15,12 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
@@ -52,6 +54,122 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var);
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var);
+
+void WriteShaderVariables(BinaryOutputStream *stream, const std::vector<sh::ShaderVariable> &vars)
+{
+    stream->writeInt(vars.size());
+    for (const sh::ShaderVariable &var : vars)
+    {
+        WriteShaderVariable(stream, var);
+    }
+}
+
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<sh::ShaderVariable> *vars)
+{
+    size_t varCount = stream->readInt<size_t>();
+    for (size_t varIndex = 0; varIndex < varCount && !stream->error(); ++varIndex)
+    {
+        vars->emplace_back();
+        LoadShaderVariable(stream, &vars->back());
+    }
+}
+
+// Unlike WriteShaderVar, which is used for program binaries, this keeps every property the
+// translator collects, including the fields of structs.
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var)
+{
+    stream->writeInt(var.type);
+    stream->writeInt(var.precision);
+    stream->writeString(var.name);
+    stream->writeString(var.mappedName);
+    stream->writeIntVector(var.arraySizes);
+    stream->writeInt(var.hasParentArrayIndex() ? var.parentArrayIndex() : -1);
+    stream->writeBool(var.staticUse);
+    stream->writeBool(var.active);
+    WriteShaderVariables(stream, var.fields);
+    stream->writeString(var.structName);
+    stream->writeBool(var.isRowMajorLayout);
+    stream->writeInt(var.location);
+    stream->writeInt(var.binding);
+    stream->writeInt(var.imageUnitFormat);
+    stream->writeInt(var.offset);
+    stream->writeBool(var.readonly);
+    stream->writeBool(var.writeonly);
+    stream->writeInt(var.index);
+    stream->writeBool(var.yuv);
+    stream->writeEnum(var.interpolation);
+    stream->writeBool(var.isInvariant);
+    stream->writeBool(var.texelFetchStaticUse);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var)
+{
+    var->type       = stream->readInt<GLenum>();
+    var->precision  = stream->readInt<GLenum>();
+    var->name       = stream->readString();
+    var->mappedName = stream->readString();
+    stream->readIntVector<unsigned int>(&var->arraySizes);
+    var->setParentArrayIndex(stream->readInt<int>());
+    var->staticUse = stream->readBool();
+    var->active    = stream->readBool();
+    LoadShaderVariables(stream, &var->fields);
+    var->structName          = stream->readString();
+    var->isRowMajorLayout    = stream->readBool();
+    var->location            = stream->readInt<int>();
+    var->binding             = stream->readInt<int>();
+    var->imageUnitFormat     = stream->readInt<GLenum>();
+    var->offset              = stream->readInt<int>();
+    var->readonly            = stream->readBool();
+    var->writeonly           = stream->readBool();
+    var->index               = stream->readInt<int>();
+    var->yuv                 = stream->readBool();
+    var->interpolation       = stream->readEnum<sh::InterpolationType>();
+    var->isInvariant         = stream->readBool();
+    var->texelFetchStaticUse = stream->readBool();
+}
+
+void WriteInterfaceBlocks(BinaryOutputStream *stream, const std::vector<sh::InterfaceBlock> &blocks)
+{
+    stream->writeInt(blocks.size());
+    for (const sh::InterfaceBlock &block : blocks)
+    {
+        stream->writeString(block.name);
+        stream->writeString(block.mappedName);
+        stream->writeString(block.instanceName);
+        stream->writeInt(block.arraySize);
+        stream->writeEnum(block.layout);
+        stream->writeBool(block.isRowMajorLayout);
+        stream->writeInt(block.binding);
+        stream->writeBool(block.staticUse);
+        stream->writeBool(block.active);
+        stream->writeEnum(block.blockType);
+        WriteShaderVariables(stream, block.fields);
+    }
+}
+
+void LoadInterfaceBlocks(BinaryInputStream *stream, std::vector<sh::InterfaceBlock> *blocks)
+{
+    size_t blockCount = stream->readInt<size_t>();
+    for (size_t blockIndex = 0; blockIndex < blockCount && !stream->error(); ++blockIndex)
+    {
+        blocks->emplace_back();
+        sh::InterfaceBlock &block = blocks->back();
+        block.name                = stream->readString();
+        block.mappedName          = stream->readString();
+        block.instanceName        = stream->readString();
+        block.arraySize           = stream->readInt<unsigned int>();
+        block.layout              = stream->readEnum<sh::BlockLayoutType>();
+        block.isRowMajorLayout    = stream->readBool();
+        block.binding             = stream->readInt<int>();
+        block.staticUse           = stream->readBool();
+        block.active              = stream->readBool();
+        block.blockType           = stream->readEnum<sh::BlockType>();
+        LoadShaderVariables(stream, &block.fields);
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -118,6 +236,7 @@ ShaderState::ShaderState(ShaderType shaderType)
     : mLabel(),
       mShaderType(shaderType),
       mShaderVersion(100),
+      mSharedMemorySize(0),
       mNumViews(-1),
       mGeometryShaderInvocations(1),
       mCompileStatus(CompileStatus::NOT_COMPILED)
@@ -303,23 +422,8 @@ void Shader::compile(const Context *context)
 {
     resolveCompile();
 
-    mState.mTranslatedSource.clear();
+    clearCompileResults();
     mInfoLog.clear();
-    mState.mShaderVersion = 100;
-    mState.mInputVaryings.clear();
-    mState.mOutputVaryings.clear();
-    mState.mUniforms.clear();
-    mState.mUniformBlocks.clear();
-    mState.mShaderStorageBlocks.clear();
-    mState.mActiveAttributes.clear();
-    mState.mActiveOutputVariables.clear();
-    mState.mNumViews = -1;
-    mState.mGeometryShaderInputPrimitiveType.reset();
-    mState.mGeometryShaderOutputPrimitiveType.reset();
-    mState.mGeometryShaderMaxVertices.reset();
-    mState.mGeometryShaderInvocations      = 1;
-    mState.mEarlyFragmentTestsOptimization = false;
-    mState.mSpecConstUsageBits.reset();
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -377,9 +481,10 @@ void Shader::resolveCompile()
 
     ASSERT(mCompilingState.get());
 
-    mCompilingState->compileEvent->wait();
+    rx::WaitableCompileEvent *compileEvent = mCompilingState->compileEvent.get();
+    compileEvent->wait();
 
-    mInfoLog += mCompilingState->compileEvent->getInfoLog();
+    mInfoLog += compileEvent->getInfoLog();
 
     ScopedExit exit([this]() {
         mBoundCompiler->putInstance(std::move(mCompilingState->shCompilerInstance));
@@ -387,8 +492,21 @@ void Shader::resolveCompile()
         mCompilingState.reset();
     });
 
+    // Use the translation found in the shader cache, unless it fails to load.  The translator has
+    // to run in that case.
+    MemoryShaderCache *shaderCache               = compileEvent->getShaderCache();
+    const angle::MemoryBuffer *cachedTranslation = compileEvent->getCachedTranslation();
+
+    bool loadedFromCache = cachedTranslation != nullptr && loadTranslation(*cachedTranslation);
+    if (cachedTranslation != nullptr && !loadedFromCache)
+    {
+        shaderCache->removeShader(compileEvent->getShaderCacheKey());
+        clearCompileResults();
+        compileEvent->translateAfterCacheHit();
+    }
+
     ShHandle compilerHandle = mCompilingState->shCompilerInstance.getHandle();
-    if (!mCompilingState->compileEvent->getResult())
+    if (!compileEvent->getResult())
     {
         mInfoLog += sh::GetInfoLog(compilerHandle);
         INFO() << std::endl << mInfoLog;
@@ -396,7 +514,52 @@ void Shader::resolveCompile()
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    if (!loadedFromCache)
+    {
+        gatherTranslation(compilerHandle);
+    }
+
+    // The limits are checked even for cached translations, since they depend on the context.
+    if (mState.mShaderType == ShaderType::Compute)
+    {
+        if (mState.mLocalSize.isDeclared())
+        {
+            angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
+            checked_local_size_product *= mState.mLocalSize[1];
+            checked_local_size_product *= mState.mLocalSize[2];
+
+            if (!checked_local_size_product.IsValid())
+            {
+                WARN() << std::endl
+                       << "Integer overflow when computing the product of local_size_x, "
+                       << "local_size_y and local_size_z.";
+                mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+                return;
+            }
+            if (checked_local_size_product.ValueOrDie() > mCurrentMaxComputeWorkGroupInvocations)
+            {
+                WARN() << std::endl
+                       << "The total number of invocations within a work group exceeds "
+                       << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
+                mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+                return;
+            }
+        }
+
+        if (mState.mSharedMemorySize > mMaxComputeSharedMemory)
+        {
+            WARN() << std::endl << "Exceeded maximum shared memory size";
+            mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+            return;
+        }
+    }
+
+    ASSERT(!mState.mTranslatedSource.empty());
+
+    // The translation is serialized before the debug prefix is added to the translated source.
+    angle::MemoryBuffer translation;
+    bool cacheTranslation =
+        shaderCache != nullptr && !loadedFromCache && serializeTranslation(&translation);
 
 #if !defined(NDEBUG)
     // Prefix translated shader with commented out un-translated shader.
@@ -427,8 +590,42 @@ void Shader::resolveCompile()
     mState.mTranslatedSource = shaderStream.str();
 #endif  // !defined(NDEBUG)
 
-    // Gather the shader information
-    mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
+    bool success          = compileEvent->postTranslate(&mInfoLog);
+    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && cacheTranslation)
+    {
+        shaderCache->putShader(compileEvent->getShaderCacheKey(), translation);
+    }
+}
+
+void Shader::clearCompileResults()
+{
+    mState.mTranslatedSource.clear();
+    mState.mShaderVersion = 100;
+    mState.mLocalSize.fill(-1);
+    mState.mSharedMemorySize = 0;
+    mState.mInputVaryings.clear();
+    mState.mOutputVaryings.clear();
+    mState.mUniforms.clear();
+    mState.mUniformBlocks.clear();
+    mState.mShaderStorageBlocks.clear();
+    mState.mAllAttributes.clear();
+    mState.mActiveAttributes.clear();
+    mState.mActiveOutputVariables.clear();
+    mState.mNumViews = -1;
+    mState.mGeometryShaderInputPrimitiveType.reset();
+    mState.mGeometryShaderOutputPrimitiveType.reset();
+    mState.mGeometryShaderMaxVertices.reset();
+    mState.mGeometryShaderInvocations      = 1;
+    mState.mEarlyFragmentTestsOptimization = false;
+    mState.mSpecConstUsageBits.reset();
+}
+
+void Shader::gatherTranslation(ShHandle compilerHandle)
+{
+    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    mState.mShaderVersion    = sh::GetShaderVersion(compilerHandle);
 
     mState.mUniforms            = GetShaderVariables(sh::GetUniforms(compilerHandle));
     mState.mUniformBlocks       = GetShaderVariables(sh::GetUniformBlocks(compilerHandle));
@@ -443,38 +640,7 @@ void Shader::resolveCompile()
             mState.mAllAttributes    = GetShaderVariables(sh::GetAttributes(compilerHandle));
             mState.mActiveAttributes = GetActiveShaderVariables(&mState.mAllAttributes);
             mState.mLocalSize        = sh::GetComputeShaderLocalGroupSize(compilerHandle);
-            if (mState.mLocalSize.isDeclared())
-            {
-                angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
-                checked_local_size_product *= mState.mLocalSize[1];
-                checked_local_size_product *= mState.mLocalSize[2];
-
-                if (!checked_local_size_product.IsValid())
-                {
-                    WARN() << std::endl
-                           << "Integer overflow when computing the product of local_size_x, "
-                           << "local_size_y and local_size_z.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-                if (checked_local_size_product.ValueOrDie() >
-                    mCurrentMaxComputeWorkGroupInvocations)
-                {
-                    WARN() << std::endl
-                           << "The total number of invocations within a work group exceeds "
-                           << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-            }
-
-            unsigned int sharedMemSize = sh::GetShaderSharedMemorySize(compilerHandle);
-            if (sharedMemSize > mMaxComputeSharedMemory)
-            {
-                WARN() << std::endl << "Exceeded maximum shared memory size";
-                mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                return;
-            }
+            mState.mSharedMemorySize = sh::GetShaderSharedMemorySize(compilerHandle);
             break;
         }
         case ShaderType::Vertex:
@@ -524,11 +690,100 @@ void Shader::resolveCompile()
         default:
             UNREACHABLE();
     }
+}
 
-    ASSERT(!mState.mTranslatedSource.empty());
+bool Shader::loadTranslation(const angle::MemoryBuffer &translation)
+{
+    BinaryInputStream stream(translation.data(), translation.size());
 
-    bool success          = mCompilingState->compileEvent->postTranslate(&mInfoLog);
-    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+    mState.mTranslatedSource = stream.readString();
+    mState.mShaderVersion    = stream.readInt<int>();
+    for (size_t dimension = 0; dimension < mState.mLocalSize.size(); ++dimension)
+    {
+        mState.mLocalSize[dimension] = stream.readInt<int>();
+    }
+    mState.mSharedMemorySize = stream.readInt<unsigned int>();
+
+    LoadShaderVariables(&stream, &mState.mInputVaryings);
+    LoadShaderVariables(&stream, &mState.mOutputVaryings);
+    LoadShaderVariables(&stream, &mState.mUniforms);
+    LoadInterfaceBlocks(&stream, &mState.mUniformBlocks);
+    LoadInterfaceBlocks(&stream, &mState.mShaderStorageBlocks);
+    LoadShaderVariables(&stream, &mState.mAllAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveAttributes);
+    LoadShaderVariables(&stream, &mState.mActiveOutputVariables);
+
+    mState.mEarlyFragmentTestsOptimization = stream.readBool();
+    mState.mSpecConstUsageBits             = rx::SpecConstUsageBits(stream.readInt<uint32_t>());
+    mState.mNumViews                       = stream.readInt<int>();
+
+    if (stream.readBool())
+    {
+        mState.mGeometryShaderInputPrimitiveType = stream.readEnum<PrimitiveMode>();
+    }
+    if (stream.readBool())
+    {
+        mState.mGeometryShaderOutputPrimitiveType = stream.readEnum<PrimitiveMode>();
+    }
+    if (stream.readBool())
+    {
+        mState.mGeometryShaderMaxVertices = stream.readInt<GLint>();
+    }
+    mState.mGeometryShaderInvocations = stream.readInt<int>();
+
+    return !stream.error() && stream.endOfStream() && !mState.mTranslatedSource.empty();
+}
+
+bool Shader::serializeTranslation(angle::MemoryBuffer *translationOut) const
+{
+    BinaryOutputStream stream;
+
+    stream.writeString(mState.mTranslatedSource);
+    stream.writeInt(mState.mShaderVersion);
+    for (size_t dimension = 0; dimension < mState.mLocalSize.size(); ++dimension)
+    {
+        stream.writeInt(mState.mLocalSize[dimension]);
+    }
+    stream.writeInt(mState.mSharedMemorySize);
+
+    WriteShaderVariables(&stream, mState.mInputVaryings);
+    WriteShaderVariables(&stream, mState.mOutputVaryings);
+    WriteShaderVariables(&stream, mState.mUniforms);
+    WriteInterfaceBlocks(&stream, mState.mUniformBlocks);
+    WriteInterfaceBlocks(&stream, mState.mShaderStorageBlocks);
+    WriteShaderVariables(&stream, mState.mAllAttributes);
+    WriteShaderVariables(&stream, mState.mActiveAttributes);
+    WriteShaderVariables(&stream, mState.mActiveOutputVariables);
+
+    stream.writeBool(mState.mEarlyFragmentTestsOptimization);
+    stream.writeInt(mState.mSpecConstUsageBits.bits());
+    stream.writeInt(mState.mNumViews);
+
+    stream.writeBool(mState.mGeometryShaderInputPrimitiveType.valid());
+    if (mState.mGeometryShaderInputPrimitiveType.valid())
+    {
+        stream.writeEnum(mState.mGeometryShaderInputPrimitiveType.value());
+    }
+    stream.writeBool(mState.mGeometryShaderOutputPrimitiveType.valid());
+    if (mState.mGeometryShaderOutputPrimitiveType.valid())
+    {
+        stream.writeEnum(mState.mGeometryShaderOutputPrimitiveType.value());
+    }
+    stream.writeBool(mState.mGeometryShaderMaxVertices.valid());
+    if (mState.mGeometryShaderMaxVertices.valid())
+    {
+        stream.writeInt(mState.mGeometryShaderMaxVertices.value());
+    }
+    stream.writeInt(mState.mGeometryShaderInvocations);
+
+    if (!translationOut->resize(stream.length()))
+    {
+        WARN() << "Failed to allocate enough memory to serialize a shader translation. ("
+               << stream.length() << " bytes )";
+        return false;
+    }
+    memcpy(translationOut->data(), stream.data(), stream.length());
+    return true;
 }
 
 void Shader::addRef()
@@ -37,6 +37,7 @@ class WaitableCompileEvent;
 
 namespace angle
 {
+class MemoryBuffer;
 class WaitableEvent;
 class WorkerThreadPool;
 }  // namespace angle
@@ -121,6 +122,7 @@ class ShaderState final : angle::NonCopyable
     std::string mSource;
 
     sh::WorkGroupSize mLocalSize;
+    unsigned int mSharedMemorySize;
 
     std::vector<sh::ShaderVariable> mInputVaryings;
     std::vector<sh::ShaderVariable> mOutputVaryings;
@@ -241,6 +243,12 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               char *buffer);
 
     void resolveCompile();
+    void clearCompileResults();
+
+    // Gathers the results of the translation from the compiler, or from the shader cache.
+    void gatherTranslation(ShHandle compilerHandle);
+    ANGLE_NO_DISCARD bool loadTranslation(const angle::MemoryBuffer &translation);
+    ANGLE_NO_DISCARD bool serializeTranslation(angle::MemoryBuffer *translationOut) const;
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
@@ -237,6 +237,7 @@ Error Surface::makeCurrent(const gl::Context *context)
 {
     ANGLE_TRY(mImplementation->makeCurrent(context));
 
+    std::lock_guard<std::mutex> lock(mRefCountMutex);
     mRefCount++;
     return NoError();
 }
@@ -249,9 +250,15 @@ Error Surface::unMakeCurrent(const gl::Context *context)
 
 Error Surface::releaseRef(const Display *display)
 {
-    ASSERT(mRefCount > 0);
-    mRefCount--;
-    if (mRefCount == 0 && mDestroyed)
+    bool destroy = false;
+    {
+        std::lock_guard<std::mutex> lock(mRefCountMutex);
+        ASSERT(mRefCount > 0);
+        mRefCount--;
+        destroy = mRefCount == 0 && mDestroyed;
+    }
+
+    if (destroy)
     {
         ASSERT(display);
         return destroyImpl(display);
@@ -262,8 +269,14 @@ Error Surface::releaseRef(const Display *display)
 
 Error Surface::onDestroy(const Display *display)
 {
-    mDestroyed = true;
-    if (mRefCount == 0)
+    bool destroy = false;
+    {
+        std::lock_guard<std::mutex> lock(mRefCountMutex);
+        mDestroyed = true;
+        destroy    = mRefCount == 0;
+    }
+
+    if (destroy)
     {
         return destroyImpl(display);
     }
@@ -518,7 +531,13 @@ Error Surface::bindTexImage(gl::Context *context, gl::Texture *texture, EGLint b
         return Error(EGL_BAD_SURFACE);
     }
     mTexture = texture;
+
+    std::lock_guard<std::mutex> lock(mRefCountMutex);
     mRefCount++;
+    if (context->isShared() && !context->usingDisplayTextureShareGroup())
+    {
+        mBoundTextureShareGroupMutex = context->getShareGroup()->getSharedMutex();
+    }
 
     return NoError();
 }
@@ -549,9 +568,19 @@ Error Surface::releaseTexImageFromTexture(const gl::Context *context)
 {
     ASSERT(mTexture);
     mTexture = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mRefCountMutex);
+        mBoundTextureShareGroupMutex.reset();
+    }
     return releaseRef(context->getDisplay());
 }
 
+std::shared_ptr<std::recursive_mutex> Surface::getBoundTextureShareGroupMutex() const
+{
+    std::lock_guard<std::mutex> lock(mRefCountMutex);
+    return mBoundTextureShareGroupMutex;
+}
+
 gl::Extents Surface::getAttachmentSize(const gl::ImageIndex & /*target*/) const
 {
     return gl::Extents(getWidth(), getHeight(), 1);
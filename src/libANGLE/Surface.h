@@ -13,6 +13,9 @@
 
 #include <EGL/egl.h>
 
+#include <memory>
+#include <mutex>
+
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
 #include "libANGLE/AttributeMap.h"
@@ -134,6 +137,10 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     EGLenum getMultisampleResolve() const;
 
     gl::Texture *getBoundTexture() const { return mTexture; }
+    // The share group mutex of the bound texture, if its share group doesn't lock the global
+    // mutex.  EGL calls lock it before they touch the texture, since the thread's current context
+    // may belong to another share group.
+    std::shared_ptr<std::recursive_mutex> getBoundTextureShareGroupMutex() const;
 
     EGLint isFixedSize() const;
 
@@ -202,8 +209,13 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
 
     SurfaceState mState;
     rx::SurfaceImpl *mImplementation;
+    // GL calls in the share group of the bound texture release the surface without holding the
+    // global mutex, so the reference count and the fields the EGL calls need to lock that share
+    // group are guarded separately.
+    mutable std::mutex mRefCountMutex;
     int mRefCount;
     bool mDestroyed;
+    std::shared_ptr<std::recursive_mutex> mBoundTextureShareGroupMutex;
 
     EGLint mType;
     EGLenum mBuftype;
@@ -113,6 +113,10 @@ class DisplayImpl : public EGLImplFactory, public angle::Subject
 
     virtual void initializeFrontendFeatures(angle::FrontendFeatures *features) const {}
 
+    // Whether a context's GL calls can be executed on a thread other than the one it is current
+    // on.  Back-ends that bind a native context to the calling thread can't do that.
+    virtual bool supportsDeferredGLCalls() const { return false; }
+
     virtual void populateFeatureList(angle::FeatureList *features) = 0;
 
     const egl::DisplayState &getState() const { return mState; }
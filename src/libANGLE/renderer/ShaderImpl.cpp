@@ -9,13 +9,14 @@
 #include "libANGLE/renderer/ShaderImpl.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/trace.h"
 
 namespace rx
 {
 
 WaitableCompileEvent::WaitableCompileEvent(std::shared_ptr<angle::WaitableEvent> waitableEvent)
-    : mWaitableEvent(waitableEvent)
+    : mWaitableEvent(waitableEvent), mShaderCache(nullptr)
 {}
 
 WaitableCompileEvent::~WaitableCompileEvent()
@@ -38,6 +39,13 @@ const std::string &WaitableCompileEvent::getInfoLog()
     return mInfoLog;
 }
 
+void WaitableCompileEvent::setShaderCache(gl::MemoryShaderCache *shaderCache,
+                                          const egl::BlobCache::Key &key)
+{
+    mShaderCache    = shaderCache;
+    mShaderCacheKey = key;
+}
+
 class TranslateTask : public angle::Closure
 {
   public:
@@ -79,6 +87,41 @@ class WaitableCompileEventImpl final : public WaitableCompileEvent
     std::shared_ptr<TranslateTask> mTranslateTask;
 };
 
+// Returned when the shader cache has the translation.  The translate task is only run if the
+// translation fails to load.
+class WaitableCompileEventCached final : public WaitableCompileEvent
+{
+  public:
+    WaitableCompileEventCached(angle::MemoryBuffer &&cachedTranslation,
+                               std::shared_ptr<TranslateTask> translateTask)
+        : WaitableCompileEvent(std::make_shared<angle::WaitableEventDone>()),
+          mCachedTranslation(std::move(cachedTranslation)),
+          mTranslateTask(translateTask),
+          mTranslated(false)
+    {}
+
+    bool getResult() override { return !mTranslated || mTranslateTask->getResult(); }
+
+    bool postTranslate(std::string *infoLog) override { return true; }
+
+    const angle::MemoryBuffer *getCachedTranslation() const override
+    {
+        return mTranslated ? nullptr : &mCachedTranslation;
+    }
+
+    void translateAfterCacheHit() override
+    {
+        ASSERT(!mTranslated);
+        (*mTranslateTask)();
+        mTranslated = true;
+    }
+
+  private:
+    angle::MemoryBuffer mCachedTranslation;
+    std::shared_ptr<TranslateTask> mTranslateTask;
+    bool mTranslated;
+};
+
 std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     const gl::Context *context,
     gl::ShCompilerInstance *compilerInstance,
@@ -93,8 +136,35 @@ std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     auto translateTask =
         std::make_shared<TranslateTask>(compilerInstance->getHandle(), compileOptions, source);
 
-    return std::make_shared<WaitableCompileEventImpl>(
-        angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask), translateTask);
+    gl::MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (shaderCache == nullptr)
+    {
+        return std::make_shared<WaitableCompileEventImpl>(
+            angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask),
+            translateTask);
+    }
+
+    egl::BlobCache::Key shaderHash;
+    gl::MemoryShaderCache::ComputeHash(
+        mState.getShaderType(), compilerInstance->getShaderSpec(),
+        compilerInstance->getShaderOutputType(), compilerInstance->getBuiltinResourcesString(),
+        source, compileOptions, &shaderHash);
+
+    std::shared_ptr<WaitableCompileEvent> compileEvent;
+    angle::MemoryBuffer cachedTranslation;
+    if (shaderCache->getShader(context, shaderHash, &cachedTranslation))
+    {
+        compileEvent = std::make_shared<WaitableCompileEventCached>(std::move(cachedTranslation),
+                                                                    translateTask);
+    }
+    else
+    {
+        compileEvent = std::make_shared<WaitableCompileEventImpl>(
+            angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask),
+            translateTask);
+    }
+    compileEvent->setShaderCache(shaderCache, shaderHash);
+    return compileEvent;
 }
 
 }  // namespace rx
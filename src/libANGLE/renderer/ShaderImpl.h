@@ -11,12 +11,15 @@
 
 #include <functional>
 
+#include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Shader.h"
 #include "libANGLE/WorkerThread.h"
 
 namespace gl
 {
+class MemoryShaderCache;
 class ShCompilerInstance;
 }  // namespace gl
 
@@ -40,9 +43,22 @@ class WaitableCompileEvent : public angle::WaitableEvent
 
     const std::string &getInfoLog();
 
+    // The serialized translation found in the shader cache, in which case the translator hasn't
+    // run.  If the translation can't be loaded, translateAfterCacheHit() runs the translator.
+    virtual const angle::MemoryBuffer *getCachedTranslation() const { return nullptr; }
+    virtual void translateAfterCacheHit() { UNREACHABLE(); }
+
+    // The cache the translation is stored in once the shader is resolved, or null if the
+    // translation isn't cached.
+    void setShaderCache(gl::MemoryShaderCache *shaderCache, const egl::BlobCache::Key &key);
+    gl::MemoryShaderCache *getShaderCache() const { return mShaderCache; }
+    const egl::BlobCache::Key &getShaderCacheKey() const { return mShaderCacheKey; }
+
   protected:
     std::shared_ptr<angle::WaitableEvent> mWaitableEvent;
     std::string mInfoLog;
+    gl::MemoryShaderCache *mShaderCache;
+    egl::BlobCache::Key mShaderCacheKey;
 };
 
 class ShaderImpl : angle::NonCopyable
@@ -1167,8 +1167,6 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
                                                       gl::BinaryInputStream *stream,
                                                       gl::InfoLog &infoLog)
 {
-    const unsigned char *binary = reinterpret_cast<const unsigned char *>(stream->data());
-
     bool separateAttribs = (mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS);
 
     size_t vertexShaderCount = stream->readInt<size_t>();
@@ -1183,7 +1181,12 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         }
 
         size_t vertexShaderSize                   = stream->readInt<size_t>();
-        const unsigned char *vertexShaderFunction = binary + stream->offset();
+        const unsigned char *vertexShaderFunction = stream->getBytes(vertexShaderSize);
+        if (vertexShaderFunction == nullptr)
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Incomplete;
+        }
 
         ShaderExecutableD3D *shaderExecutable = nullptr;
 
@@ -1204,8 +1207,6 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         // add new binary
         mVertexExecutables.push_back(std::unique_ptr<VertexExecutable>(
             new VertexExecutable(inputLayout, signature, shaderExecutable)));
-
-        stream->skip(vertexShaderSize);
     }
 
     size_t pixelShaderCount = stream->readInt<size_t>();
@@ -1219,8 +1220,14 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         }
 
         size_t pixelShaderSize                   = stream->readInt<size_t>();
-        const unsigned char *pixelShaderFunction = binary + stream->offset();
-        ShaderExecutableD3D *shaderExecutable    = nullptr;
+        const unsigned char *pixelShaderFunction = stream->getBytes(pixelShaderSize);
+        if (pixelShaderFunction == nullptr)
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Incomplete;
+        }
+
+        ShaderExecutableD3D *shaderExecutable = nullptr;
 
         ANGLE_TRY(mRenderer->loadExecutable(contextD3D, pixelShaderFunction, pixelShaderSize,
                                             gl::ShaderType::Fragment, mStreamOutVaryings,
@@ -1235,8 +1242,6 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         // add new binary
         mPixelExecutables.push_back(
             std::unique_ptr<PixelExecutable>(new PixelExecutable(outputs, shaderExecutable)));
-
-        stream->skip(pixelShaderSize);
     }
 
     for (std::unique_ptr<ShaderExecutableD3D> &geometryExe : mGeometryExecutables)
@@ -1247,7 +1252,12 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
             continue;
         }
 
-        const unsigned char *geometryShaderFunction = binary + stream->offset();
+        const unsigned char *geometryShaderFunction = stream->getBytes(geometryShaderSize);
+        if (geometryShaderFunction == nullptr)
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Incomplete;
+        }
 
         ShaderExecutableD3D *geometryExecutable = nullptr;
         ANGLE_TRY(mRenderer->loadExecutable(contextD3D, geometryShaderFunction, geometryShaderSize,
@@ -1261,8 +1271,6 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         }
 
         geometryExe.reset(geometryExecutable);
-
-        stream->skip(geometryShaderSize);
     }
 
     size_t computeShaderCount = stream->readInt<size_t>();
@@ -1281,7 +1289,12 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         }
 
         size_t computeShaderSize                   = stream->readInt<size_t>();
-        const unsigned char *computeShaderFunction = binary + stream->offset();
+        const unsigned char *computeShaderFunction = stream->getBytes(computeShaderSize);
+        if (computeShaderFunction == nullptr)
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Incomplete;
+        }
 
         ShaderExecutableD3D *computeExecutable = nullptr;
         ANGLE_TRY(mRenderer->loadExecutable(contextD3D, computeShaderFunction, computeShaderSize,
@@ -1297,8 +1310,6 @@ angle::Result ProgramD3D::loadBinaryShaderExecutables(d3d::Context *contextD3D,
         // add new binary
         mComputeExecutables.push_back(std::unique_ptr<ComputeExecutable>(new ComputeExecutable(
             signatures, std::unique_ptr<ShaderExecutableD3D>(computeExecutable))));
-
-        stream->skip(computeShaderSize);
     }
 
     size_t bindLayoutCount = stream->readInt<size_t>();
@@ -63,11 +63,15 @@ std::unique_ptr<LinkEvent> ProgramGL::load(const gl::Context *context,
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::load");
     preLink();
 
-    // Read the binary format, size and blob
+    // Read the binary format, size and blob.  The blob is passed to the driver in place.
     GLenum binaryFormat   = stream->readInt<GLenum>();
     GLint binaryLength    = stream->readInt<GLint>();
-    const uint8_t *binary = stream->data() + stream->offset();
-    stream->skip(binaryLength);
+    const uint8_t *binary = binaryLength >= 0 ? stream->getBytes(binaryLength) : nullptr;
+    if (binary == nullptr)
+    {
+        infoLog << "Invalid program binary.";
+        return std::make_unique<LinkEventDone>(angle::Result::Incomplete);
+    }
 
     // Load the binary
     mFunctions->programBinary(mProgramID, binaryFormat, binary, binaryLength);
@@ -1051,7 +1051,7 @@ void SetSpirvInstructionOp(uint32_t *instruction, uint32_t op)
 class SpirvTransformerBase : angle::NonCopyable
 {
   public:
-    SpirvTransformerBase(const std::vector<uint32_t> &spirvBlobIn,
+    SpirvTransformerBase(const SpirvBlobView &spirvBlobIn,
                          const ShaderInterfaceVariableInfoMap &variableInfoMap,
                          gl::ShaderType shaderType,
                          SpirvBlob *spirvBlobOut)
@@ -1105,7 +1105,7 @@ class SpirvTransformerBase : angle::NonCopyable
                             const angle::FixedVector<uint32_t, 4> &fields);
 
     // SPIR-V to transform:
-    const std::vector<uint32_t> &mSpirvBlobIn;
+    const SpirvBlobView mSpirvBlobIn;
     const gl::ShaderType mShaderType;
 
     // Input shader variable info map:
@@ -1368,7 +1368,7 @@ void SpirvTransformerBase::writeVectorShuffle(uint32_t id,
 class SpirvTransformer final : public SpirvTransformerBase
 {
   public:
-    SpirvTransformer(const std::vector<uint32_t> &spirvBlobIn,
+    SpirvTransformer(const SpirvBlobView &spirvBlobIn,
                      bool removeEarlyFragmentTestsOptimization,
                      bool removeDebugInfo,
                      const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -2466,7 +2466,7 @@ class SpirvVertexAttributeAliasingTransformer final : public SpirvTransformerBas
 {
   public:
     SpirvVertexAttributeAliasingTransformer(
-        const std::vector<uint32_t> &spirvBlobIn,
+        const SpirvBlobView &spirvBlobIn,
         const ShaderInterfaceVariableInfoMap &variableInfoMap,
         std::vector<const ShaderInterfaceVariableInfo *> &&variableInfoById,
         SpirvBlob *spirvBlobOut)
@@ -3684,7 +3684,7 @@ angle::Result GlslangTransformSpirvCode(const GlslangErrorCallback &callback,
                                         bool removeEarlyFragmentTestsOptimization,
                                         bool removeDebugInfo,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
-                                        const SpirvBlob &initialSpirvBlob,
+                                        const SpirvBlobView &initialSpirvBlob,
                                         SpirvBlob *spirvBlobOut)
 {
     if (initialSpirvBlob.empty())
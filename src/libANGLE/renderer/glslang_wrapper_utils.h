@@ -55,6 +55,33 @@ struct GlslangSourceOptions
 
 using SpirvBlob = std::vector<uint32_t>;
 
+// A read-only view of SPIR-V words that are owned elsewhere, such as by a SpirvBlob or by a
+// program binary loaded from the cache.
+class SpirvBlobView
+{
+  public:
+    SpirvBlobView() = default;
+    SpirvBlobView(const SpirvBlob &blob) : mData(blob.data()), mSize(blob.size()) {}
+    SpirvBlobView(const uint32_t *data, size_t size) : mData(data), mSize(size) {}
+
+    const uint32_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+
+    const uint32_t *begin() const { return mData; }
+    const uint32_t *end() const { return mData + mSize; }
+
+    const uint32_t &operator[](size_t index) const
+    {
+        ASSERT(index < mSize);
+        return mData[index];
+    }
+
+  private:
+    const uint32_t *mData = nullptr;
+    size_t mSize          = 0;
+};
+
 using GlslangErrorCallback = std::function<angle::Result(GlslangError)>;
 
 // Information for each shader interface variable.  Not all fields are relevant to each shader
@@ -142,7 +169,7 @@ angle::Result GlslangTransformSpirvCode(const GlslangErrorCallback &callback,
                                         bool removeEarlyFragmentTestsOptimization,
                                         bool removeDebugInfo,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
-                                        const SpirvBlob &initialSpirvBlob,
+                                        const SpirvBlobView &initialSpirvBlob,
                                         SpirvBlob *spirvBlobOut);
 
 angle::Result GlslangGetShaderSpirvCode(const GlslangErrorCallback &callback,
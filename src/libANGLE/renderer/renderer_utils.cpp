@@ -18,6 +18,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
@@ -206,6 +207,50 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
 
     memcpy(targetData, valueData, matrixSize * count);
 }
+
+class LoadImageTask final : public angle::Closure
+{
+  public:
+    LoadImageTask(LoadImageFunction loadFunction,
+                  size_t width,
+                  size_t height,
+                  size_t depth,
+                  const uint8_t *input,
+                  size_t inputRowPitch,
+                  size_t inputDepthPitch,
+                  uint8_t *output,
+                  size_t outputRowPitch,
+                  size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mWidth(width),
+          mHeight(height),
+          mDepth(depth),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        mLoadFunction(mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch, mOutput,
+                      mOutputRowPitch, mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
 }  // anonymous namespace
 
 void RotateRectangle(const SurfaceRotation rotation,
@@ -455,6 +500,77 @@ bool ShouldUseVirtualizedContexts(const egl::AttributeMap &attribs, bool default
     }
 }
 
+void LoadImageParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                       size_t taskCount,
+                       LoadImageFunction loadFunction,
+                       size_t inputBlockHeight,
+                       size_t outputBlockHeight,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    ASSERT(taskCount > 0);
+    if (width == 0 || height == 0 || depth == 0)
+    {
+        return;
+    }
+
+    std::vector<std::shared_ptr<LoadImageTask>> tasks;
+    if (depth >= taskCount)
+    {
+        const size_t layersPerTask = (depth + taskCount - 1) / taskCount;
+        for (size_t z = 0; z < depth; z += layersPerTask)
+        {
+            tasks.push_back(std::make_shared<LoadImageTask>(
+                loadFunction, width, height, std::min(layersPerTask, depth - z),
+                input + z * inputDepthPitch, inputRowPitch, inputDepthPitch,
+                output + z * outputDepthPitch, outputRowPitch, outputDepthPitch));
+        }
+    }
+    else
+    {
+        // The row pitches are the distance between rows of blocks.
+        const size_t rowAlignment = std::max(inputBlockHeight, outputBlockHeight);
+        ASSERT(rowAlignment % inputBlockHeight == 0 && rowAlignment % outputBlockHeight == 0);
+
+        const size_t bandsPerLayer = (taskCount + depth - 1) / depth;
+        const size_t rowsPerTask =
+            roundUp((height + bandsPerLayer - 1) / bandsPerLayer, rowAlignment);
+        for (size_t z = 0; z < depth; ++z)
+        {
+            for (size_t y = 0; y < height; y += rowsPerTask)
+            {
+                const uint8_t *bandInput =
+                    input + z * inputDepthPitch + (y / inputBlockHeight) * inputRowPitch;
+                uint8_t *bandOutput =
+                    output + z * outputDepthPitch + (y / outputBlockHeight) * outputRowPitch;
+                tasks.push_back(std::make_shared<LoadImageTask>(
+                    loadFunction, width, std::min(rowsPerTask, height - y), 1, bandInput,
+                    inputRowPitch, inputDepthPitch, bandOutput, outputRowPitch,
+                    outputDepthPitch));
+            }
+        }
+    }
+
+    // Load the first part on this thread while the worker threads load the others.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    for (size_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex)
+    {
+        events.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, tasks[taskIndex]));
+    }
+    (*tasks[0])();
+    for (std::shared_ptr<angle::WaitableEvent> &event : events)
+    {
+        event->wait();
+    }
+}
+
 void CopyImageCHROMIUM(const uint8_t *sourceData,
                        size_t sourceRowPitch,
                        size_t sourcePixelBytes,
@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/angleutils.h"
@@ -25,6 +26,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 enum class FormatID;
+class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
@@ -160,6 +162,26 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Calls loadFunction on up to taskCount parts of the image in parallel, one of them on the calling
+// thread and the others on workerPool.  Images with at least taskCount layers are split in groups
+// of layers, and the layers of other images are split in bands of rows.  A band starts at a
+// multiple of the block height of both the input and the output, which is 1 for formats that are
+// not block compressed.
+void LoadImageParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                       size_t taskCount,
+                       LoadImageFunction loadFunction,
+                       size_t inputBlockHeight,
+                       size_t outputBlockHeight,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 bool ShouldUseVirtualizedContexts(const egl::AttributeMap &attribs, bool defaultValue);
 
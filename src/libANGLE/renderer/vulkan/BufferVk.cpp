@@ -96,11 +96,16 @@ ANGLE_INLINE VkMemoryPropertyFlags GetStorageMemoryType(GLbitfield storageFlags,
     return kDeviceLocalHostVisibleFlags;
 }
 
+// Buffers up to this size are orphaned by any sub data update while they are in use by the GPU.
+// Copying the untouched ranges of such a buffer on the GPU is cheap, while a staged update would
+// end the render pass that is using the buffer.
+constexpr size_t kMaxOrphanOnSubDataBufferSize = 64 * 1024;
+
 ANGLE_INLINE bool SubDataSizeMeetsThreshold(size_t subDataSize, size_t bufferSize)
 {
     // A sub data update with size > 50% of buffer size meets the threshold
     // to acquire a new BufferHelper from the pool.
-    return subDataSize > (bufferSize / 2);
+    return subDataSize > (bufferSize / 2) || bufferSize <= kMaxOrphanOnSubDataBufferSize;
 }
 }  // namespace
 
@@ -140,7 +145,13 @@ BufferVk::VertexConversionBuffer::VertexConversionBuffer(VertexConversionBuffer
 BufferVk::VertexConversionBuffer::~VertexConversionBuffer() = default;
 
 // BufferVk implementation.
-BufferVk::BufferVk(const gl::BufferState &state) : BufferImpl(state), mBuffer(nullptr) {}
+BufferVk::BufferVk(const gl::BufferState &state)
+    : BufferImpl(state),
+      mBuffer(nullptr),
+      mIsSuballocated(false),
+      mUsageFlags(0),
+      mMemoryPropertyFlags(0)
+{}
 
 BufferVk::~BufferVk() {}
 
@@ -160,9 +171,19 @@ void BufferVk::release(ContextVk *contextVk)
     {
         mBuffer->release(renderer);
     }
+    for (std::unique_ptr<vk::BufferHelper> *suballocation :
+         {&mSuballocation, &mPreviousSuballocation})
+    {
+        if (*suballocation)
+        {
+            (*suballocation)->release(renderer);
+            suballocation->reset();
+        }
+    }
     mShadowBuffer.release();
     mBufferPool.release(renderer);
-    mBuffer = nullptr;
+    mBuffer         = nullptr;
+    mIsSuballocated = false;
 
     for (ConversionBuffer &buffer : mVertexConversionBuffers)
     {
@@ -324,12 +345,21 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
             usageFlags |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
         }
 
-        // mBuffer will be allocated through a DynamicBuffer
+        // Small host visible buffers are sub-allocated from VkBuffers that are shared with other
+        // buffers, and stay mapped.  Otherwise, mBuffer will be allocated through a DynamicBuffer.
         constexpr size_t kBufferHelperAlignment       = 1;
         constexpr size_t kBufferHelperPoolInitialSize = 0;
 
-        mBufferPool.initWithFlags(contextVk->getRenderer(), usageFlags, kBufferHelperAlignment,
-                                  kBufferHelperPoolInitialSize, memoryPropertyFlags);
+        mIsSuballocated = size <= vk::kMaxSuballocatedBufferSize &&
+                          (memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+        mUsageFlags          = usageFlags;
+        mMemoryPropertyFlags = memoryPropertyFlags;
+
+        if (!mIsSuballocated)
+        {
+            mBufferPool.initWithFlags(contextVk->getRenderer(), usageFlags, kBufferHelperAlignment,
+                                      kBufferHelperPoolInitialSize, memoryPropertyFlags);
+        }
 
         ANGLE_TRY(acquireBufferHelper(contextVk, size, &mBuffer));
 
@@ -413,8 +443,8 @@ angle::Result BufferVk::copySubData(const gl::Context *context,
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
     // Enqueue a copy command on the GPU.
-    const VkBufferCopy copyRegion = {static_cast<VkDeviceSize>(sourceOffset),
-                                     static_cast<VkDeviceSize>(destOffset),
+    const VkBufferCopy copyRegion = {sourceBuffer.getOffset() + sourceOffset,
+                                     mBuffer->getOffset() + destOffset,
                                      static_cast<VkDeviceSize>(size)};
 
     commandBuffer->copyBuffer(sourceBuffer.getBuffer(), mBuffer->getBuffer(), 1, &copyRegion);
@@ -661,7 +691,7 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
         src->retain(&contextVk->getResourceUseList());
     }
 
-    ANGLE_TRY(acquireBufferHelper(contextVk, size, &mBuffer));
+    ANGLE_TRY(acquireBufferHelper(contextVk, static_cast<size_t>(mState.getSize()), &mBuffer));
     ANGLE_TRY(directUpdate(contextVk, data, size, offset));
 
     constexpr int kMaxCopyRegions = 2;
@@ -695,12 +725,16 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     updateShadowBuffer(data, size, offset);
 
     // if the buffer is currently in use
-    //     if sub data size meets threshold, acquire a new BufferHelper from the pool
+    //     if sub data size meets threshold and the buffer can be orphaned, acquire a new
+    //     BufferHelper from the pool
     //     else stage an update
     // else update the buffer directly
     if (mBuffer->isCurrentlyInUse(contextVk->getLastCompletedQueueSerial()))
     {
-        if (SubDataSizeMeetsThreshold(size, static_cast<size_t>(mState.getSize())))
+        // Mapped and external buffers keep their storage, as the application may still access it
+        // directly.
+        const bool canOrphan = !mState.isMapped() && !mBuffer->isExternalBuffer();
+        if (canOrphan && SubDataSizeMeetsThreshold(size, static_cast<size_t>(mState.getSize())))
         {
             ANGLE_TRY(acquireAndUpdate(contextVk, data, size, offset));
         }
@@ -725,16 +759,7 @@ angle::Result BufferVk::copyToBufferImpl(ContextVk *contextVk,
                                          uint32_t copyCount,
                                          const VkBufferCopy *copies)
 {
-    vk::CommandBufferAccess access;
-    access.onBufferTransferWrite(destBuffer);
-    access.onBufferTransferRead(mBuffer);
-
-    vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
-
-    commandBuffer->copyBuffer(mBuffer->getBuffer(), destBuffer->getBuffer(), copyCount, copies);
-
-    return angle::Result::Continue;
+    return destBuffer->copyFromBuffer(contextVk, mBuffer, copyCount, copies);
 }
 
 ConversionBuffer *BufferVk::getVertexConversionBuffer(RendererVk *renderer,
@@ -778,6 +803,30 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk,
     bool needToReleasePreviousBuffers = false;
     size_t size                       = roundUpPow2(sizeInBytes, kBufferSizeGranularity);
 
+    if (mIsSuballocated)
+    {
+        RendererVk *renderer = contextVk->getRenderer();
+
+        // Like the buffers of mBufferPool, the previous sub-allocation is only released when the
+        // next one is acquired, as the caller may still copy from it.
+        if (mPreviousSuballocation)
+        {
+            mPreviousSuballocation->release(renderer);
+        }
+        else
+        {
+            mPreviousSuballocation = std::make_unique<vk::BufferHelper>();
+        }
+        std::swap(mSuballocation, mPreviousSuballocation);
+
+        ANGLE_TRY(renderer->getBufferSuballocator().allocate(
+            contextVk, size, mUsageFlags, mMemoryPropertyFlags, mSuballocation.get()));
+
+        ASSERT(bufferHelperOut);
+        *bufferHelperOut = mSuballocation.get();
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(mBufferPool.allocate(contextVk, size, nullptr, nullptr, nullptr,
                                    &needToReleasePreviousBuffers));
 
@@ -199,6 +199,14 @@ class BufferVk : public BufferImpl
     // Pool of BufferHelpers for mBuffer to acquire from
     vk::DynamicBuffer mBufferPool;
 
+    // Small buffers acquire mBuffer from the renderer's BufferSuballocator instead.  The previous
+    // sub-allocation is kept alive until the next one is acquired.
+    bool mIsSuballocated;
+    VkBufferUsageFlags mUsageFlags;
+    VkMemoryPropertyFlags mMemoryPropertyFlags;
+    std::unique_ptr<vk::BufferHelper> mSuballocation;
+    std::unique_ptr<vk::BufferHelper> mPreviousSuballocation;
+
     // For GPU-read only buffers glMap* latency is reduced by maintaining a copy
     // of the buffer which is writeable only by the CPU. The contents are updated on all
     // glData/glSubData/glCopy calls. With this, a glMap* call becomes a non-blocking
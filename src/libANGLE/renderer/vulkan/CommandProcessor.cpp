@@ -8,6 +8,11 @@
 //
 
 #include "libANGLE/renderer/vulkan/CommandProcessor.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/trace.h"
 
@@ -20,6 +25,78 @@ namespace
 constexpr size_t kInFlightCommandsLimit = 100u;
 constexpr bool kOutputVmaStatsString    = false;
 
+// Render passes are only split if each chunk gets at least this many bytes of commands, so that
+// recording a chunk outweighs the cost of handing it to a worker thread.
+constexpr size_t kMinBytesPerRecordingChunk = 16 * 1024;
+constexpr size_t kMaxRecordingChunks        = 8;
+
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+// Replays a chunk of render pass commands into a new secondary command buffer.
+class ChunkRecordingTask final : public angle::Closure
+{
+  public:
+    ChunkRecordingTask(VkDevice device,
+                       CommandBuffer *commands,
+                       const priv::CommandChunk *chunk,
+                       VkCommandPool commandPool,
+                       const VkCommandBufferInheritanceInfo &inheritanceInfo)
+        : mDevice(device),
+          mCommands(commands),
+          mChunk(chunk),
+          mCommandPool(commandPool),
+          mInheritanceInfo(inheritanceInfo),
+          mResult(VK_SUCCESS)
+    {}
+
+    // The command buffer is freed along with its pool, so any handle not handed out is dropped.
+    ~ChunkRecordingTask() override { mCommandBuffer.releaseHandle(); }
+
+    void operator()() override { mResult = record(); }
+
+    VkResult getResult() const { return mResult; }
+    priv::CommandBuffer &getCommandBuffer() { return mCommandBuffer; }
+
+  private:
+    VkResult record()
+    {
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool                 = mCommandPool;
+        allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount          = 1;
+
+        VkResult result = mCommandBuffer.init(mDevice, allocInfo);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        beginInfo.pInheritanceInfo = &mInheritanceInfo;
+
+        result = mCommandBuffer.begin(beginInfo);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        mCommands->executeChunk(mCommandBuffer.getHandle(), *mChunk);
+        return mCommandBuffer.end();
+    }
+
+    VkDevice mDevice;
+    CommandBuffer *mCommands;
+    const priv::CommandChunk *mChunk;
+    VkCommandPool mCommandPool;
+    VkCommandBufferInheritanceInfo mInheritanceInfo;
+    priv::CommandBuffer mCommandBuffer;
+    VkResult mResult;
+};
+#endif  // ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+
 void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
                           const vk::PrimaryCommandBuffer &commandBuffer,
                           const std::vector<VkSemaphore> &waitSemaphores,
@@ -270,6 +347,7 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
 {
     std::swap(primaryCommands, other.primaryCommands);
     std::swap(commandPool, other.commandPool);
+    std::swap(recordingCommandPools, other.recordingCommandPools);
     std::swap(fence, other.fence);
     std::swap(serial, other.serial);
     return *this;
@@ -279,9 +357,138 @@ void CommandBatch::destroy(VkDevice device)
 {
     primaryCommands.destroy(device);
     commandPool.destroy(device);
+    for (CommandPool &recordingCommandPool : recordingCommandPools)
+    {
+        recordingCommandPool.destroy(device);
+    }
+    recordingCommandPools.clear();
     fence.reset(device);
 }
 
+// ParallelCommandRecorder implementation.
+ParallelCommandRecorder::ParallelCommandRecorder() = default;
+
+ParallelCommandRecorder::~ParallelCommandRecorder()
+{
+    ASSERT(mFreeCommandPools.empty() && mPendingCommandPools.empty());
+}
+
+void ParallelCommandRecorder::destroy(VkDevice device)
+{
+    for (CommandPool &commandPool : mFreeCommandPools)
+    {
+        commandPool.destroy(device);
+    }
+    for (CommandPool &commandPool : mPendingCommandPools)
+    {
+        commandPool.destroy(device);
+    }
+    mFreeCommandPools.clear();
+    mPendingCommandPools.clear();
+}
+
+angle::Result ParallelCommandRecorder::record(
+    Context *context,
+    CommandBuffer *commandBuffer,
+    const RenderPass &renderPass,
+    VkFramebuffer framebuffer,
+    std::vector<priv::CommandBuffer> *secondaryCommandBuffersOut)
+{
+    secondaryCommandBuffersOut->clear();
+
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+    const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    const size_t maxChunkCount =
+        std::min({kMaxRecordingChunks, threadCount,
+                  commandBuffer->getCommandSize() / kMinBytesPerRecordingChunk});
+    if (maxChunkCount < 2 || !commandBuffer->splitIntoChunks(maxChunkCount, &mChunks))
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ParallelCommandRecorder::record");
+    RendererVk *renderer = context->getRenderer();
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass  = renderPass.getHandle();
+    inheritanceInfo.subpass     = 0;
+    inheritanceInfo.framebuffer = framebuffer;
+
+    std::vector<std::shared_ptr<ChunkRecordingTask>> tasks;
+    for (const priv::CommandChunk &chunk : mChunks)
+    {
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        ANGLE_TRY(allocateCommandPool(context, &commandPool));
+        tasks.push_back(std::make_shared<ChunkRecordingTask>(
+            renderer->getDevice(), commandBuffer, &chunk, commandPool, inheritanceInfo));
+    }
+
+    // Record the first chunk on this thread while the worker threads record the others.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    for (size_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex)
+    {
+        events.push_back(angle::WorkerThreadPool::PostWorkerTask(renderer->getWorkerThreadPool(),
+                                                                 tasks[taskIndex]));
+    }
+    (*tasks[0])();
+    for (std::shared_ptr<angle::WaitableEvent> &event : events)
+    {
+        event->wait();
+    }
+
+    for (const std::shared_ptr<ChunkRecordingTask> &task : tasks)
+    {
+        ANGLE_VK_TRY(context, task->getResult());
+    }
+    for (const std::shared_ptr<ChunkRecordingTask> &task : tasks)
+    {
+        secondaryCommandBuffersOut->push_back(std::move(task->getCommandBuffer()));
+    }
+#endif  // ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+
+    return angle::Result::Continue;
+}
+
+void ParallelCommandRecorder::releaseCommandPools(std::vector<CommandPool> *commandPoolsOut)
+{
+    ASSERT(commandPoolsOut->empty());
+    std::swap(mPendingCommandPools, *commandPoolsOut);
+}
+
+angle::Result ParallelCommandRecorder::recycleCommandPools(Context *context,
+                                                           std::vector<CommandPool> *commandPools)
+{
+    for (CommandPool &commandPool : *commandPools)
+    {
+        ANGLE_VK_TRY(context, commandPool.reset(context->getDevice(), 0));
+        mFreeCommandPools.push_back(std::move(commandPool));
+    }
+    commandPools->clear();
+    return angle::Result::Continue;
+}
+
+angle::Result ParallelCommandRecorder::allocateCommandPool(Context *context,
+                                                           VkCommandPool *commandPoolOut)
+{
+    if (mFreeCommandPools.empty())
+    {
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex        = context->getRenderer()->getQueueFamilyIndex();
+
+        CommandPool commandPool;
+        ANGLE_VK_TRY(context, commandPool.init(context->getDevice(), poolInfo));
+        mFreeCommandPools.push_back(std::move(commandPool));
+    }
+
+    mPendingCommandPools.push_back(std::move(mFreeCommandPools.back()));
+    mFreeCommandPools.pop_back();
+    *commandPoolOut = mPendingCommandPools.back().getHandle();
+    return angle::Result::Continue;
+}
+
 // CommandProcessor implementation.
 void CommandProcessor::handleError(VkResult errorCode,
                                    const char *file,
@@ -303,10 +510,11 @@ void CommandProcessor::handleError(VkResult errorCode,
     std::lock_guard<std::mutex> queueLock(mErrorMutex);
     Error error = {errorCode, file, function, line};
     mErrors.emplace(error);
+    mHasPendingError.store(true, std::memory_order_release);
 }
 
 CommandProcessor::CommandProcessor(RendererVk *renderer)
-    : Context(renderer), mWorkerThreadIdle(false)
+    : Context(renderer), mWorkerThreadIdle(false), mWorkerParked(false), mHasPendingError(false)
 {
     std::lock_guard<std::mutex> queueLock(mErrorMutex);
     while (!mErrors.empty())
@@ -319,6 +527,11 @@ CommandProcessor::~CommandProcessor() = default;
 
 angle::Result CommandProcessor::checkAndPopPendingError(Context *errorHandlingContext)
 {
+    if (!hasPendingError())
+    {
+        return angle::Result::Continue;
+    }
+
     std::lock_guard<std::mutex> queueLock(mErrorMutex);
     if (mErrors.empty())
     {
@@ -328,6 +541,7 @@ angle::Result CommandProcessor::checkAndPopPendingError(Context *errorHandlingCo
     {
         Error err = mErrors.front();
         mErrors.pop();
+        mHasPendingError.store(!mErrors.empty(), std::memory_order_release);
         errorHandlingContext->handleError(err.errorCode, err.file, err.function, err.line);
         return angle::Result::Stop;
     }
@@ -336,12 +550,71 @@ angle::Result CommandProcessor::checkAndPopPendingError(Context *errorHandlingCo
 void CommandProcessor::queueCommand(CommandProcessorTask &&task)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandProcessor::queueCommand");
-    // Grab the worker mutex so that we put things on the queue in the same order as we give out
-    // serials.
-    std::lock_guard<std::mutex> queueLock(mWorkerMutex);
+    // Callers hold RendererVk::mCommandQueueMutex, so there is only ever one producer at a time.
+    // That lock is what keeps the serial a thread reserves and the submission it queues in order;
+    // the queue only preserves the order in which tasks are pushed.
+    while (!mTasks.tryPush(std::move(task)))
+    {
+        // The queue is full; let the worker thread catch up.
+        std::this_thread::yield();
+    }
 
-    mTasks.emplace(std::move(task));
-    mWorkAvailableCondition.notify_one();
+    // The worker only needs waking if it has parked.  Tasks queued while it is busy or spinning
+    // don't touch the mutex at all, which batches the wakeups of a burst of tasks into one.  The
+    // fence pairs with the one in popTask so that either this thread sees mWorkerParked, or the
+    // worker sees the new task before waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mWorkerParked.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> queueLock(mWorkerMutex);
+        mWorkAvailableCondition.notify_one();
+    }
+}
+
+void CommandProcessor::popTask(CommandProcessorTask *taskOut)
+{
+    if (mTasks.tryPop(taskOut))
+    {
+        return;
+    }
+
+    if (mTasks.empty())
+    {
+        // Out of work; let waitForWorkComplete know.
+        {
+            std::lock_guard<std::mutex> lock(mWorkerMutex);
+            mWorkerThreadIdle = true;
+            mWorkerIdleCondition.notify_all();
+        }
+
+        // Tasks tend to come in bursts, so poll for a little while before parking the thread.
+        constexpr uint32_t kSpinCount = 100;
+        for (uint32_t spin = 0; spin < kSpinCount && mTasks.empty(); ++spin)
+        {
+            std::this_thread::yield();
+        }
+
+        if (mTasks.empty())
+        {
+            std::unique_lock<std::mutex> lock(mWorkerMutex);
+            mWorkerParked.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Only wake if notified and command queue is not empty
+            mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            mWorkerParked.store(false, std::memory_order_relaxed);
+        }
+
+        // Clear the idle state before popping, so waitForWorkComplete can never observe an empty
+        // queue and an idle worker while the task is still being processed.
+        mWorkerThreadIdle = false;
+    }
+
+    // The queue is known to be non-empty, but the producer that claimed the next slot may not
+    // have finished writing to it yet.
+    while (!mTasks.tryPop(taskOut))
+    {
+        std::this_thread::yield();
+    }
 }
 
 void CommandProcessor::processTasks(const DeviceQueueMap &queueMap)
@@ -370,25 +643,15 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
 {
     while (true)
     {
-        std::unique_lock<std::mutex> lock(mWorkerMutex);
-        if (mTasks.empty())
-        {
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_all();
-            // Only wake if notified and command queue is not empty
-            mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
-        }
-        mWorkerThreadIdle = false;
-        CommandProcessorTask task(std::move(mTasks.front()));
-        mTasks.pop();
-        lock.unlock();
+        CommandProcessorTask task;
+        popTask(&task);
 
         ANGLE_TRY(processTask(&task));
         if (task.getTaskCommand() == CustomTask::Exit)
         {
 
             *exitThread = true;
-            lock.lock();
+            std::lock_guard<std::mutex> lock(mWorkerMutex);
             mWorkerThreadIdle = true;
             mWorkerIdleCondition.notify_one();
             return angle::Result::Continue;
@@ -740,6 +1003,7 @@ void CommandQueue::destroy(Context *context)
 
     mPrimaryCommands.destroy(renderer->getDevice());
     mPrimaryCommandPool.destroy(renderer->getDevice());
+    mParallelCommandRecorder.destroy(renderer->getDevice());
     mFenceRecycler.destroy(context);
 
     ASSERT(mInFlightCommands.empty() && mGarbageQueue.empty());
@@ -800,6 +1064,8 @@ angle::Result CommandQueue::retireFinishedCommands(Context *context, size_t fini
         mFenceRecycler.resetSharedFence(&batch.fence);
         ANGLE_TRACE_EVENT0("gpu.angle", "command buffer recycling");
         batch.commandPool.destroy(device);
+        ANGLE_TRY(mParallelCommandRecorder.recycleCommandPools(context,
+                                                               &batch.recordingCommandPools));
         ANGLE_TRY(mPrimaryCommandPool.collect(context, std::move(batch.primaryCommands)));
     }
 
@@ -846,6 +1112,7 @@ angle::Result CommandQueue::releaseToCommandBatch(Context *context,
     VkDevice device      = renderer->getDevice();
 
     batch->primaryCommands = std::move(commandBuffer);
+    mParallelCommandRecorder.releaseCommandPools(&batch->recordingCommandPools);
 
     if (commandPool->valid())
     {
@@ -889,10 +1156,7 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
 
         // On device lost, here simply destroy the CommandBuffer, it will fully cleared later
         // by CommandPool::destroy
-        batch.primaryCommands.destroy(device);
-
-        batch.commandPool.destroy(device);
-        batch.fence.reset(device);
+        batch.destroy(device);
     }
     mInFlightCommands.clear();
 }
@@ -1074,8 +1338,7 @@ angle::Result CommandQueue::flushOutsideRPCommands(Context *context,
                                                    CommandBufferHelper **outsideRPCommands)
 {
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
-    return (*outsideRPCommands)
-        ->flushToPrimary(context->getRenderer()->getFeatures(), &mPrimaryCommands, nullptr);
+    return (*outsideRPCommands)->flushToPrimary(context, &mPrimaryCommands, nullptr, nullptr);
 }
 
 angle::Result CommandQueue::flushRenderPassCommands(Context *context,
@@ -1083,8 +1346,12 @@ angle::Result CommandQueue::flushRenderPassCommands(Context *context,
                                                     CommandBufferHelper **renderPassCommands)
 {
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context));
+    ParallelCommandRecorder *parallelRecorder =
+        context->getRenderer()->getFeatures().parallelRenderPassCommandRecording.enabled
+            ? &mParallelCommandRecorder
+            : nullptr;
     return (*renderPassCommands)
-        ->flushToPrimary(context->getRenderer()->getFeatures(), &mPrimaryCommands, &renderPass);
+        ->flushToPrimary(context, &mPrimaryCommands, &renderPass, parallelRecorder);
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
@@ -11,11 +11,13 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <thread>
 
+#include "common/BoundedMPSCQueue.h"
 #include "common/vulkan/vk_headers.h"
 #include "libANGLE/renderer/vulkan/PersistentCommandPool.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -167,10 +169,50 @@ struct CommandBatch final : angle::NonCopyable
     PrimaryCommandBuffer primaryCommands;
     // commandPool is for secondary CommandBuffer allocation
     CommandPool commandPool;
+    // Pools of the secondary command buffers recorded by ParallelCommandRecorder
+    std::vector<CommandPool> recordingCommandPools;
     Shared<Fence> fence;
     Serial serial;
 };
 
+// Replays large render passes into Vulkan secondary command buffers on worker threads when the
+// parallelRenderPassCommandRecording feature is enabled.  The render pass commands are split into
+// chunks of command blocks, each recorded into its own secondary command buffer from its own
+// command pool.  The pools are handed to the CommandBatch that executes them, and recycled once
+// the batch is finished.
+class ParallelCommandRecorder final : angle::NonCopyable
+{
+  public:
+    ParallelCommandRecorder();
+    ~ParallelCommandRecorder();
+
+    void destroy(VkDevice device);
+
+    // Records |commandBuffer| into secondary command buffers to be executed in |renderPass|.  The
+    // list is left empty if the render pass is too small to be worth splitting or if its commands
+    // cannot be split, in which case the commands should be replayed inline.
+    angle::Result record(Context *context,
+                         CommandBuffer *commandBuffer,
+                         const RenderPass &renderPass,
+                         VkFramebuffer framebuffer,
+                         std::vector<priv::CommandBuffer> *secondaryCommandBuffersOut);
+
+    // Hands over the pools used since the last call, when the primary command buffer that
+    // executes their command buffers is submitted.
+    void releaseCommandPools(std::vector<CommandPool> *commandPoolsOut);
+    // Takes back the pools of a finished CommandBatch.
+    angle::Result recycleCommandPools(Context *context, std::vector<CommandPool> *commandPools);
+
+  private:
+    angle::Result allocateCommandPool(Context *context, VkCommandPool *commandPoolOut);
+
+    std::vector<CommandPool> mFreeCommandPools;
+    std::vector<CommandPool> mPendingCommandPools;
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+    std::vector<priv::CommandChunk> mChunks;
+#endif
+};
+
 using DeviceQueueMap = angle::PackedEnumMap<egl::ContextPriority, VkQueue>;
 
 class CommandQueueInterface : angle::NonCopyable
@@ -310,12 +352,24 @@ class CommandQueue final : public CommandQueueInterface
     DeviceQueueMap mQueues;
 
     FenceRecycler mFenceRecycler;
+
+    ParallelCommandRecorder mParallelCommandRecorder;
 };
 
+// Maximum number of tasks queued to the CommandProcessor.  Producers wait for the worker thread
+// to catch up when the queue is full.
+constexpr size_t kCommandProcessorTaskQueueSize = 256;
+
 // CommandProcessor is used to dispatch work to the GPU when the asyncCommandQueue feature is
 // enabled. Issuing the |destroy| command will cause the worker thread to clean up it's resources
 // and shut down. This command is sent when the renderer instance shuts down. Tasks are defined by
 // the CommandQueue interface.
+//
+// Tasks are handed to the worker thread through a lock-free queue.  When it runs out of work, the
+// worker spins for a short while before parking on mWorkAvailableCondition, and producers only
+// take mWorkerMutex to wake it up if it is parked.  Tasks are queued with
+// RendererVk::mCommandQueueMutex held, which serializes the producers; what the queue saves is
+// the worker locking mWorkerMutex for every task and the producer signaling it for every task.
 
 class CommandProcessor : public Context, public CommandQueueInterface
 {
@@ -385,11 +439,7 @@ class CommandProcessor : public Context, public CommandQueueInterface
     Serial getCurrentQueueSerial() const override;
 
   private:
-    bool hasPendingError() const
-    {
-        std::lock_guard<std::mutex> queueLock(mErrorMutex);
-        return !mErrors.empty();
-    }
+    bool hasPendingError() const { return mHasPendingError.load(std::memory_order_acquire); }
     angle::Result checkAndPopPendingError(Context *errorHandlingContext);
 
     // Entry point for command processor thread, calls processTasksImpl to do the
@@ -404,20 +454,25 @@ class CommandProcessor : public Context, public CommandQueueInterface
     // be submitted from a separate thread.
     angle::Result processTasksImpl(bool *exitThread);
 
+    // Command processor thread, waits until a task is available and pops it.
+    void popTask(CommandProcessorTask *taskOut);
+
     // Command processor thread, process a task
     angle::Result processTask(CommandProcessorTask *task);
 
     VkResult getLastAndClearPresentResult(VkSwapchainKHR swapchain);
     VkResult present(egl::ContextPriority priority, const VkPresentInfoKHR &presentInfo);
 
-    std::queue<CommandProcessorTask> mTasks;
+    angle::BoundedMPSCQueue<CommandProcessorTask, kCommandProcessorTaskQueueSize> mTasks;
     mutable std::mutex mWorkerMutex;
     // Signal worker thread when work is available
     std::condition_variable mWorkAvailableCondition;
     // Signal main thread when all work completed
     mutable std::condition_variable mWorkerIdleCondition;
     // Track worker thread Idle state for assertion purposes
-    bool mWorkerThreadIdle;
+    std::atomic<bool> mWorkerThreadIdle;
+    // Whether the worker thread is (about to be) waiting on mWorkAvailableCondition
+    std::atomic<bool> mWorkerParked;
     // Command pool to allocate processor thread primary command buffers from
     CommandPool mCommandPool;
     CommandQueue mCommandQueue;
@@ -426,6 +481,8 @@ class CommandProcessor : public Context, public CommandQueueInterface
 
     mutable std::mutex mErrorMutex;
     std::queue<Error> mErrors;
+    // Lets hasPendingError avoid mErrorMutex in the common case.
+    std::atomic<bool> mHasPendingError;
 
     // Track present info
     std::mutex mSwapchainStatusMutex;
@@ -55,6 +55,11 @@ constexpr size_t kDescriptorImageInfosInitialSize  = 4;
 constexpr size_t kDescriptorWriteInfosInitialSize =
     kDescriptorBufferInfosInitialSize + kDescriptorImageInfosInitialSize;
 
+constexpr size_t kStreamingBufferInitialSize = 1024 * 1024;
+
+// Flush the recorded pipeline manifests of the share group's programs every this many swaps.
+constexpr uint32_t kPipelineManifestFlushPeriod = 60;
+
 // For shader uniforms such as gl_DepthRange and the viewport size.
 struct GraphicsDriverUniforms
 {
@@ -359,6 +364,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mComputeDirtyBitHandlers{},
       mRenderPassCommandBuffer(nullptr),
       mCurrentGraphicsPipeline(nullptr),
+      mGraphicsPipelineEvictionCount(0),
+      mPipelineManifestFlushTimeout(kPipelineManifestFlushPeriod),
       mCurrentComputePipeline(nullptr),
       mCurrentDrawMode(gl::PrimitiveMode::InvalidEnum),
       mCurrentWindowSurface(nullptr),
@@ -500,7 +507,7 @@ void ContextVk::onDestroy(const gl::Context *context)
         dynamicDescriptorPool.destroy(device);
     }
 
-    mDefaultUniformStorage.release(mRenderer);
+    mStreamingBuffer.release(mRenderer);
     mEmptyBuffer.release(mRenderer);
     mStagingBuffer.release(mRenderer);
 
@@ -649,10 +656,7 @@ angle::Result ContextVk::initialize()
                                 TRACE_EVENT_PHASE_BEGIN, eventName));
     }
 
-    size_t minAlignment = static_cast<size_t>(
-        mRenderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
-    mDefaultUniformStorage.init(mRenderer, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, minAlignment,
-                                mRenderer->getDefaultUniformBufferSize(), true);
+    mStreamingBuffer.init(mRenderer, kStreamingBufferInitialSize);
 
     // Initialize an "empty" buffer for use with default uniform blocks where there are no uniforms,
     // or atomic counter buffer array indices that are unused.
@@ -1085,6 +1089,14 @@ angle::Result ContextVk::handleDirtyGraphicsPipeline(const gl::Context *context,
 {
     ASSERT(mExecutable);
 
+    // If pipelines were evicted since the current pipeline was looked up, it (and the transitions
+    // out of it) may no longer exist.
+    if (mCurrentGraphicsPipeline &&
+        mGraphicsPipelineEvictionCount != mRenderer->getGraphicsPipelineEvictionCount())
+    {
+        mCurrentGraphicsPipeline = nullptr;
+    }
+
     if (!mCurrentGraphicsPipeline)
     {
         const vk::GraphicsPipelineDesc *descPtr;
@@ -1100,6 +1112,7 @@ angle::Result ContextVk::handleDirtyGraphicsPipeline(const gl::Context *context,
             context->getState().getProgramExecutable()->getNonBuiltinAttribLocationsMask(),
             &descPtr, &mCurrentGraphicsPipeline));
         mGraphicsPipelineTransition.reset();
+        mGraphicsPipelineEvictionCount = mRenderer->getGraphicsPipelineEvictionCount();
     }
     else if (mGraphicsPipelineTransition.any())
     {
@@ -1114,8 +1127,14 @@ angle::Result ContextVk::handleDirtyGraphicsPipeline(const gl::Context *context,
                 context->getState().getProgramExecutable()->getNonBuiltinAttribLocationsMask(),
                 &descPtr, &mCurrentGraphicsPipeline));
 
-            oldPipeline->addTransition(mGraphicsPipelineTransition, descPtr,
-                                       mCurrentGraphicsPipeline);
+            // The lookup may have evicted the old pipeline.
+            const uint64_t evictionCount = mRenderer->getGraphicsPipelineEvictionCount();
+            if (evictionCount == mGraphicsPipelineEvictionCount)
+            {
+                oldPipeline->addTransition(mGraphicsPipelineTransition, descPtr,
+                                           mCurrentGraphicsPipeline);
+            }
+            mGraphicsPipelineEvictionCount = evictionCount;
         }
 
         mGraphicsPipelineTransition.reset();
@@ -1123,9 +1142,33 @@ angle::Result ContextVk::handleDirtyGraphicsPipeline(const gl::Context *context,
 
     resumeTransformFeedbackIfStarted();
 
+    return bindGraphicsPipeline(commandBuffer);
+}
+
+angle::Result ContextVk::bindGraphicsPipeline(vk::CommandBuffer *commandBuffer)
+{
+    ASSERT(mCurrentGraphicsPipeline);
+
+    if (!mCurrentGraphicsPipeline->isCreationReady())
+    {
+#if ANGLE_USE_CUSTOM_VULKAN_CMD_BUFFERS
+        // The pipeline is still being created on a worker thread.  Render pass commands are only
+        // executed when the render pass is flushed, so record the bind now and patch the pipeline
+        // handle in at that point instead of waiting for it.
+        mDeferredGraphicsPipelineBinds.push_back(
+            mCurrentGraphicsPipeline->deferBind(commandBuffer->bindGraphicsPipelineDeferred()));
+        mCurrentGraphicsPipeline->updateSerial(getCurrentQueueSerial());
+        return angle::Result::Continue;
+#else
+        mPerfCounters.graphicsPipelineCreationWaits++;
+#endif
+    }
+
+    ANGLE_TRY(mCurrentGraphicsPipeline->waitForCreation(this));
+
     commandBuffer->bindGraphicsPipeline(mCurrentGraphicsPipeline->getPipeline());
     // Update the queue serial for the pipeline object.
-    ASSERT(mCurrentGraphicsPipeline && mCurrentGraphicsPipeline->valid());
+    ASSERT(mCurrentGraphicsPipeline->valid());
     // TODO: https://issuetracker.google.com/issues/169788986: Need to change this so that we get
     // the actual serial used when this work is submitted.
     mCurrentGraphicsPipeline->updateSerial(getCurrentQueueSerial());
@@ -1289,9 +1332,10 @@ angle::Result ContextVk::handleDirtyGraphicsIndexBuffer(const gl::Context *conte
     vk::BufferHelper *elementArrayBuffer = mVertexArray->getCurrentElementArrayBuffer();
     ASSERT(elementArrayBuffer != nullptr);
 
-    commandBuffer->bindIndexBuffer(elementArrayBuffer->getBuffer(),
-                                   mVertexArray->getCurrentElementArrayBufferOffset(),
-                                   getVkIndexType(mCurrentDrawElementsType));
+    commandBuffer->bindIndexBuffer(
+        elementArrayBuffer->getBuffer(),
+        elementArrayBuffer->getOffset() + mVertexArray->getCurrentElementArrayBufferOffset(),
+        getVkIndexType(mCurrentDrawElementsType));
 
     mRenderPassCommands->bufferRead(&mResourceUseList, VK_ACCESS_INDEX_READ_BIT,
                                     vk::PipelineStage::VertexInput, elementArrayBuffer);
@@ -1363,7 +1407,7 @@ angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersEmulation(
     }
 
     // TODO(http://anglebug.com/3570): Need to update to handle Program Pipelines
-    vk::BufferHelper *uniformBuffer      = mDefaultUniformStorage.getCurrentBuffer();
+    vk::BufferHelper *uniformBuffer      = mStreamingBuffer.getCurrentBuffer();
     vk::UniformsAndXfbDesc xfbBufferDesc = transformFeedbackVk->getTransformFeedbackDesc();
     xfbBufferDesc.updateDefaultUniformBuffer(uniformBuffer ? uniformBuffer->getBufferSerial()
                                                            : vk::kInvalidBufferSerial);
@@ -1535,6 +1579,18 @@ void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffe
     }
 }
 
+void ContextVk::addCommandBufferRecordingStats(vk::CommandBufferHelper *commandBuffer)
+{
+    size_t bytesRecorded = 0;
+    size_t blocksUsed    = 0;
+    size_t newBlocks     = 0;
+    commandBuffer->getCommandBuffer().getRecordingStats(&bytesRecorded, &blocksUsed, &newBlocks);
+
+    mPerfCounters.commandBufferBytesRecorded += static_cast<uint32_t>(bytesRecorded);
+    mPerfCounters.commandBufferBlocksUsed += static_cast<uint32_t>(blocksUsed);
+    mPerfCounters.commandBufferBlocksAllocated += static_cast<uint32_t>(newBlocks);
+}
+
 angle::Result ContextVk::submitFrame(const vk::Semaphore *signalSemaphore)
 {
     if (mCurrentWindowSurface)
@@ -2173,14 +2229,16 @@ angle::Result ContextVk::drawArraysIndirect(const gl::Context *context,
                                             currentIndirectBufOffset, &commandBuffer,
                                             &dstIndirectBuf, &dstIndirectBufOffset));
 
-        commandBuffer->drawIndexedIndirect(dstIndirectBuf->getBuffer(), dstIndirectBufOffset, 1, 0);
+        const VkDeviceSize indirectOffset = dstIndirectBuf->getOffset() + dstIndirectBufOffset;
+        commandBuffer->drawIndexedIndirect(dstIndirectBuf->getBuffer(), indirectOffset, 1, 0);
         return angle::Result::Continue;
     }
 
     ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, currentIndirectBuf,
                                 currentIndirectBufOffset, &commandBuffer));
 
-    commandBuffer->drawIndirect(currentIndirectBuf->getBuffer(), currentIndirectBufOffset, 1, 0);
+    commandBuffer->drawIndirect(currentIndirectBuf->getBuffer(),
+                                currentIndirectBuf->getOffset() + currentIndirectBufOffset, 1, 0);
     return angle::Result::Continue;
 }
 
@@ -2253,8 +2311,9 @@ angle::Result ContextVk::drawElementsIndirect(const gl::Context *context,
                                            currentIndirectBufOffset, &commandBuffer));
     }
 
-    commandBuffer->drawIndexedIndirect(currentIndirectBuf->getBuffer(), currentIndirectBufOffset, 1,
-                                       0);
+    commandBuffer->drawIndexedIndirect(currentIndirectBuf->getBuffer(),
+                                       currentIndirectBuf->getOffset() + currentIndirectBufOffset,
+                                       1, 0);
     return angle::Result::Continue;
 }
 
@@ -3130,6 +3189,116 @@ void ContextVk::updateFlipViewportReadFramebuffer(const gl::State &glState)
     mFlipViewportForReadFramebuffer  = readFramebuffer->isDefault();
 }
 
+void ContextVk::getShareGroupExecutables(std::vector<ProgramExecutableVk *> *executablesOut)
+{
+    // Programs that are being linked are skipped as their executable may be modified by the link
+    // job.  The current executable is added explicitly as it may belong to a program pipeline.
+    if (mExecutable)
+    {
+        executablesOut->push_back(mExecutable);
+    }
+
+    const gl::ResourceMap<gl::Program, gl::ShaderProgramID> &programs =
+        mState.getShaderProgramManagerForCapture().getProgramsForCaptureAndPerf();
+    for (const std::pair<GLuint, gl::Program *> &resource : programs)
+    {
+        gl::Program *program = resource.second;
+        if (program == nullptr || program->isLinking())
+        {
+            continue;
+        }
+
+        ProgramExecutableVk *executableVk = &vk::GetImpl(program)->getExecutable();
+        if (executableVk != mExecutable)
+        {
+            executablesOut->push_back(executableVk);
+        }
+    }
+}
+
+void ContextVk::trimGraphicsPipelines(const vk::PipelineHelper *keepPipeline)
+{
+    // Trim down to 3/4 of the budget so that eviction doesn't happen on every new pipeline.
+    const size_t budget      = mRenderer->getGraphicsPipelineBudget();
+    const size_t targetCount = budget - budget / 4;
+    const size_t count       = mRenderer->getGraphicsPipelineCount();
+    if (count <= targetCount)
+    {
+        return;
+    }
+
+    // Pipelines that may be referenced by a pending submission are never evicted.  The over-budget
+    // pipelines may also belong to other share groups or to UtilsVk, so nothing may be evictable
+    // here; in that case, don't scan the share group again until more submissions complete.
+    const Serial lastCompletedSerial = getLastCompletedQueueSerial();
+    if (lastCompletedSerial == mGraphicsPipelineTrimBackoffSerial)
+    {
+        return;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::trimGraphicsPipelines");
+
+    std::vector<ProgramExecutableVk *> executables;
+    getShareGroupExecutables(&executables);
+
+    std::vector<Serial> candidates;
+    for (ProgramExecutableVk *executableVk : executables)
+    {
+        executableVk->getGraphicsPipelineEvictionCandidates(lastCompletedSerial, keepPipeline,
+                                                            &candidates);
+    }
+
+    size_t evictCount = std::min(candidates.size(), count - targetCount);
+    if (evictCount == 0)
+    {
+        mGraphicsPipelineTrimBackoffSerial = lastCompletedSerial;
+        return;
+    }
+
+    // Find the serial of the most recently used pipeline to evict.  Pipelines that share this
+    // serial are evicted only as long as |evictCount| allows.
+    std::nth_element(candidates.begin(), candidates.begin() + (evictCount - 1), candidates.end());
+    const Serial maxSerial = candidates[evictCount - 1];
+
+    size_t evicted = 0;
+    for (ProgramExecutableVk *executableVk : executables)
+    {
+        if (evictCount == 0)
+        {
+            break;
+        }
+        evicted += executableVk->evictGraphicsPipelines(this, maxSerial, keepPipeline, &evictCount);
+    }
+
+    if (evicted > 0)
+    {
+        mRenderer->onGraphicsPipelinesEvicted();
+    }
+}
+
+void ContextVk::onSwap()
+{
+    if (!getFeatures().warmUpGraphicsPipelines.enabled)
+    {
+        return;
+    }
+
+    // Write the pipelines recorded since the last flush to the blob cache once in a while, so they
+    // are not lost if the application never deletes its programs.
+    if (--mPipelineManifestFlushTimeout > 0)
+    {
+        return;
+    }
+    mPipelineManifestFlushTimeout = kPipelineManifestFlushPeriod;
+
+    std::vector<ProgramExecutableVk *> executables;
+    getShareGroupExecutables(&executables);
+    for (ProgramExecutableVk *executableVk : executables)
+    {
+        executableVk->flushPipelineManifest(this);
+    }
+}
+
 SpecConstUsageBits ContextVk::getCurrentProgramSpecConstUsageBits() const
 {
     SpecConstUsageBits usageBits;
@@ -3546,7 +3715,7 @@ angle::Result ContextVk::dispatchComputeIndirect(const gl::Context *context, GLi
     mOutsideRenderPassCommands->bufferRead(&mResourceUseList, VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
                                            vk::PipelineStage::DrawIndirect, &buffer);
 
-    commandBuffer->dispatchIndirect(buffer.getBuffer(), indirect);
+    commandBuffer->dispatchIndirect(buffer.getBuffer(), buffer.getOffset() + indirect);
 
     return angle::Result::Continue;
 }
@@ -4221,15 +4390,24 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
     {
         driverUniform.dynamicBuffer.releaseInFlightBuffersToResourceUseList(this);
     }
-    mDefaultUniformStorage.releaseInFlightBuffersToResourceUseList(this);
     mStagingBuffer.releaseInFlightBuffersToResourceUseList(this);
+    mStreamingBuffer.onSubmit(this);
 
     ANGLE_TRY(submitFrame(signalSemaphore));
 
+    // The default uniforms of the current program were written for the submitted commands only.
+    onStreamingBufferDataLost();
+
     mPerfCounters.renderPasses                           = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
+    mPerfCounters.commandBufferBytesRecorded             = 0;
+    mPerfCounters.commandBufferBlocksUsed                = 0;
+    mPerfCounters.commandBufferBlocksAllocated           = 0;
+    mPerfCounters.streamingBufferBytesAllocated          = 0;
+    mPerfCounters.streamingBufferStalls                  = 0;
+    mPerfCounters.streamingBufferResizes                 = 0;
 
     ASSERT(mWaitSemaphores.empty());
     ASSERT(mWaitSemaphoreStageMasks.empty());
@@ -4614,7 +4792,15 @@ angle::Result ContextVk::flushCommandsAndEndRenderPass()
 
     resumeTransformFeedbackIfStarted();
 
+    // The render pass commands are about to be executed, so every pipeline they bind must exist.
+    for (vk::DeferredPipelineBind &deferredBind : mDeferredGraphicsPipelineBinds)
+    {
+        ANGLE_TRY(deferredBind.resolve(this));
+    }
+    mDeferredGraphicsPipelineBinds.clear();
+
     mRenderPassCommands->endRenderPass(this);
+    addCommandBufferRecordingStats(mRenderPassCommands);
 
     if (vk::CommandBufferHelper::kEnableCommandStreamDiagnostics)
     {
@@ -4727,6 +4913,7 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
     }
 
     addOverlayUsedBuffersCount(mOutsideRenderPassCommands);
+    addCommandBufferRecordingStats(mOutsideRenderPassCommands);
 
     if (vk::CommandBufferHelper::kEnableCommandStreamDiagnostics)
     {
@@ -4854,9 +5041,24 @@ VkWriteDescriptorSet *ContextVk::allocWriteDescriptorSets(size_t count)
     return &mWriteDescriptorSets[oldSize];
 }
 
+void ContextVk::onStreamingBufferDataLost()
+{
+    // Default uniforms are only written when they change, so the current program has to write all
+    // of them again.
+    if (mProgram)
+    {
+        mProgram->setAllDefaultUniformsDirty();
+    }
+    else if (mProgramPipeline)
+    {
+        mProgramPipeline->setAllDefaultUniformsDirty(mState);
+    }
+}
+
 void ContextVk::setDefaultUniformBlocksMinSizeForTesting(size_t minSize)
 {
-    mDefaultUniformStorage.setMinimumSizeForTesting(minSize);
+    mStreamingBuffer.setMinimumSizeForTesting(minSize);
+    onStreamingBufferDataLost();
 }
 
 void ContextVk::invalidateGraphicsPipelineAndDescriptorSets()
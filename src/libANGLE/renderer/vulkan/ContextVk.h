@@ -174,6 +174,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     {
         return mShareGroupVk->getDescriptorSetLayoutCache();
     }
+    vk::DescriptorSetCache &getDescriptorSetCache()
+    {
+        return mShareGroupVk->getDescriptorSetCache();
+    }
 
     // Device loss
     gl::GraphicsResetStatus getResetStatus() override;
@@ -365,6 +369,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     bool isSerialInUse(Serial serial) const;
 
+    // Called after a pipeline is created while the renderer is over its graphics pipeline budget.
+    // Evicts the least recently used pipelines of the programs in this share group, which are
+    // protected by the share group lock, other than |keepPipeline|.  Other share groups trim their
+    // own programs the next time they create a pipeline.
+    void trimGraphicsPipelines(const vk::PipelineHelper *keepPipeline);
+
+    // Called when a window surface is swapped.  Periodically writes the pipeline manifests of the
+    // programs in this share group to the blob cache.
+    void onSwap();
+
     template <typename T>
     void addGarbage(T *object)
     {
@@ -544,6 +558,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void updateOverlayOnPresent();
     void addOverlayUsedBuffersCount(vk::CommandBufferHelper *commandBuffer);
+    void addCommandBufferRecordingStats(vk::CommandBufferHelper *commandBuffer);
 
     // DescriptorSet writes
     VkDescriptorBufferInfo *allocDescriptorBufferInfos(size_t count);
@@ -554,7 +569,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     VkDescriptorImageInfo &allocDescriptorImageInfo() { return *allocDescriptorImageInfos(1); }
     VkWriteDescriptorSet &allocWriteDescriptorSet() { return *allocWriteDescriptorSets(1); }
 
-    vk::DynamicBuffer *getDefaultUniformStorage() { return &mDefaultUniformStorage; }
+    vk::StreamingBuffer *getStreamingBuffer() { return &mStreamingBuffer; }
+    // Called when data written to the streaming buffer so far can't be used by the next draw.
+    void onStreamingBufferDataLost();
     // For testing only.
     void setDefaultUniformBlocksMinSizeForTesting(size_t minSize);
 
@@ -757,6 +774,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void invalidateGraphicsDriverUniforms();
     void invalidateDriverUniforms();
 
+    angle::Result bindGraphicsPipeline(vk::CommandBuffer *commandBuffer);
+
     // Handlers for graphics pipeline dirty bits.
     angle::Result handleDirtyGraphicsEventLog(const gl::Context *context,
                                               vk::CommandBuffer *commandBuffer);
@@ -865,6 +884,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void updateSampleShadingWithRasterizationSamples(const uint32_t rasterizationSamples);
     void updateRasterizationSamples(const uint32_t rasterizationSamples);
 
+    // Gathers the executables whose caches this context may touch under the share group lock.
+    void getShareGroupExecutables(std::vector<ProgramExecutableVk *> *executablesOut);
     SpecConstUsageBits getCurrentProgramSpecConstUsageBits() const;
     void updateGraphicsPipelineDescWithSpecConstUsageBits(SpecConstUsageBits usageBits);
 
@@ -874,6 +895,17 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     vk::CommandBuffer *mRenderPassCommandBuffer;
 
     vk::PipelineHelper *mCurrentGraphicsPipeline;
+    // The renderer's pipeline eviction count at the time mCurrentGraphicsPipeline was looked up.
+    uint64_t mGraphicsPipelineEvictionCount;
+    // The last completed serial when trimGraphicsPipelines last found nothing to evict.  Pipelines
+    // only become evictable once the submissions using them complete, so there is no point in
+    // looking again before the serial changes.
+    Serial mGraphicsPipelineTrimBackoffSerial;
+    // Number of swaps left until the pipeline manifests are flushed.
+    uint32_t mPipelineManifestFlushTimeout;
+    // Binds recorded in the current render pass for pipelines that are still being created on a
+    // worker thread.  They are resolved when the render pass is flushed.
+    std::vector<vk::DeferredPipelineBind> mDeferredGraphicsPipelineBinds;
     vk::PipelineAndSerial *mCurrentComputePipeline;
     gl::PrimitiveMode mCurrentDrawMode;
 
@@ -1033,8 +1065,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // allow binding a null vertex buffer.
     vk::BufferHelper mEmptyBuffer;
 
-    // Storage for default uniforms of ProgramVks and ProgramPipelineVks.
-    vk::DynamicBuffer mDefaultUniformStorage;
+    // Storage for default uniforms of ProgramVks and ProgramPipelineVks, client vertex attributes
+    // and client index data.
+    vk::StreamingBuffer mStreamingBuffer;
 
     // All staging buffer support is provided by a DynamicBuffer.
     vk::DynamicBuffer mStagingBuffer;
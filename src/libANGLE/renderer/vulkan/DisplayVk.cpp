@@ -179,6 +179,12 @@ gl::Version DisplayVk::getMaxConformantESVersion() const
     return mRenderer->getMaxConformantESVersion();
 }
 
+bool DisplayVk::supportsDeferredGLCalls() const
+{
+    // Vulkan objects aren't tied to the thread that uses them.
+    return true;
+}
+
 void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 {
     outExtensions->createContextRobustness      = getRenderer()->getNativeExtensions().robustness;
@@ -288,6 +294,7 @@ void ShareGroupVk::onDestroy(const egl::Display *display)
 {
     DisplayVk *displayVk = vk::GetImpl(display);
 
+    mDescriptorSetCache.destroy(displayVk->getDevice());
     mPipelineLayoutCache.destroy(displayVk->getDevice());
     mDescriptorSetLayoutCache.destroy(displayVk->getDevice());
 }
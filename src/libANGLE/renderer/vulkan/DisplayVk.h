@@ -13,6 +13,7 @@
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -27,11 +28,12 @@ class ShareGroupVk : public ShareGroupImpl
     ShareGroupVk() {}
     void onDestroy(const egl::Display *display) override;
 
-    // PipelineLayoutCache and DescriptorSetLayoutCache can be shared between multiple threads
-    // accessing them via shared contexts. The ShareGroup locks around gl entrypoints ensuring
-    // synchronous update to the caches.
+    // PipelineLayoutCache, DescriptorSetLayoutCache and DescriptorSetCache can be shared between
+    // multiple threads accessing them via shared contexts. The ShareGroup locks around gl
+    // entrypoints ensuring synchronous update to the caches.
     PipelineLayoutCache &getPipelineLayoutCache() { return mPipelineLayoutCache; }
     DescriptorSetLayoutCache &getDescriptorSetLayoutCache() { return mDescriptorSetLayoutCache; }
+    vk::DescriptorSetCache &getDescriptorSetCache() { return mDescriptorSetCache; }
     ShareContextSet *getShareContextSet() { return &mShareContextSet; }
 
   private:
@@ -41,6 +43,9 @@ class ShareGroupVk : public ShareGroupImpl
     // DescriptorSetLayouts are also managed in a cache.
     DescriptorSetLayoutCache mDescriptorSetLayoutCache;
 
+    // Descriptor sets are shared between the programs of the share group.
+    vk::DescriptorSetCache mDescriptorSetCache;
+
     // The list of contexts within the share group
     ShareContextSet mShareContextSet;
 };
@@ -99,6 +104,8 @@ class DisplayVk : public DisplayImpl, public vk::Context
     gl::Version getMaxSupportedESVersion() const override;
     gl::Version getMaxConformantESVersion() const override;
 
+    bool supportsDeferredGLCalls() const override;
+
     virtual const char *getWSIExtension() const = 0;
     virtual const char *getWSILayer() const;
 
@@ -70,15 +70,23 @@ void GlslangWrapperVk::GetShaderSource(const angle::FeaturesVk &features,
 }
 
 // static
-angle::Result GlslangWrapperVk::GetShaderCode(vk::Context *context,
-                                              const gl::ShaderBitSet &linkedShaderStages,
-                                              const gl::Caps &glCaps,
-                                              const gl::ShaderMap<std::string> &shaderSources,
-                                              gl::ShaderMap<std::vector<uint32_t>> *shaderCodeOut)
+angle::Result GlslangWrapperVk::GetShaderCode(const gl::Caps &glCaps,
+                                              gl::ShaderType shaderType,
+                                              const std::string &shaderSource,
+                                              SpirvBlob *shaderCodeOut)
 {
-    return GlslangGetShaderSpirvCode(
-        [context](GlslangError error) { return ErrorHandler(context, error); }, linkedShaderStages,
-        glCaps, shaderSources, shaderCodeOut);
+    gl::ShaderBitSet linkedShaderStages;
+    linkedShaderStages.set(shaderType);
+
+    gl::ShaderMap<std::string> shaderSources;
+    shaderSources[shaderType] = shaderSource;
+
+    gl::ShaderMap<SpirvBlob> shaderCodes;
+    ANGLE_TRY(GlslangGetShaderSpirvCode([](GlslangError) { return angle::Result::Stop; },
+                                        linkedShaderStages, glCaps, shaderSources, &shaderCodes));
+
+    *shaderCodeOut = std::move(shaderCodes[shaderType]);
+    return angle::Result::Continue;
 }
 
 // static
@@ -87,7 +95,7 @@ angle::Result GlslangWrapperVk::TransformSpirV(
     const gl::ShaderType shaderType,
     bool removeEarlyFragmentTestsOptimization,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
-    const SpirvBlob &initialSpirvBlob,
+    const SpirvBlobView &initialSpirvBlob,
     SpirvBlob *shaderCodeOut)
 {
     const bool removeDebugInfo = !context->getRenderer()->getEnableValidationLayers();
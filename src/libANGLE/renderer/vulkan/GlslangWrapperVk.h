@@ -37,17 +37,18 @@ class GlslangWrapperVk
                                 gl::ShaderMap<std::string> *shaderSourcesOut,
                                 ShaderMapInterfaceVariableInfoMap *variableInfoMapOut);
 
-    static angle::Result GetShaderCode(vk::Context *context,
-                                       const gl::ShaderBitSet &linkedShaderStages,
-                                       const gl::Caps &glCaps,
-                                       const gl::ShaderMap<std::string> &shaderSources,
-                                       gl::ShaderMap<std::vector<uint32_t>> *shaderCodesOut);
+    // Doesn't take a context so it can be called from a worker thread.  The caller reports the
+    // errors.
+    static angle::Result GetShaderCode(const gl::Caps &glCaps,
+                                       gl::ShaderType shaderType,
+                                       const std::string &shaderSource,
+                                       SpirvBlob *shaderCodeOut);
 
     static angle::Result TransformSpirV(vk::Context *context,
                                         const gl::ShaderType shaderType,
                                         bool removeEarlyFragmentTestsOptimization,
                                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
-                                        const SpirvBlob &initialSpirvBlob,
+                                        const SpirvBlobView &initialSpirvBlob,
                                         SpirvBlob *shaderCodeOut);
 
     static angle::Result CompileShaderOneOff(vk::Context *context,
@@ -8,6 +8,10 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include <anglebase/sha1.h>
+
+#include "common/angle_version.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -18,15 +22,34 @@
 #include "libANGLE/renderer/vulkan/TransformFeedbackVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
+#include "libANGLE/trace.h"
 
 namespace rx
 {
 namespace
 {
+// Bump this whenever the layout of the pipeline manifest or of GraphicsPipelineDesc changes.
+constexpr uint32_t kPipelineManifestVersion = 1;
+// Bounds the blob size and the number of pipelines queued for creation at link time.
+constexpr size_t kMaxPipelineManifestEntries = 64;
+
+// Flags of the TextureBinding of each active sampler.
+constexpr uint32_t kTextureBindingIsBuffer    = 1;
+constexpr uint32_t kTextureBindingTexelFetch  = 2;
+constexpr uint32_t kTextureBindingSeamful     = 4;
+
+// The uniforms and transform feedback and the textures descriptor sets are allocated from the
+// share group's descriptor set cache instead of the program's own pools.
+bool IsDescriptorSetCached(DescriptorSetIndex descriptorSetIndex)
+{
+    return descriptorSetIndex == DescriptorSetIndex::UniformsAndXfb ||
+           descriptorSetIndex == DescriptorSetIndex::Texture;
+}
+
 bool ValidateTransformedSpirV(ContextVk *contextVk,
                               const gl::ShaderBitSet &linkedShaderStages,
                               ProgramExecutableVk *executableVk,
-                              const gl::ShaderMap<SpirvBlob> &spirvBlobs)
+                              const gl::ShaderMap<SpirvBlobView> &spirvBlobs)
 {
     for (gl::ShaderType shaderType : linkedShaderStages)
     {
@@ -52,21 +75,23 @@ ShaderInfo::ShaderInfo() {}
 
 ShaderInfo::~ShaderInfo() = default;
 
-angle::Result ShaderInfo::initShaders(ContextVk *contextVk,
-                                      const gl::ShaderBitSet &linkedShaderStages,
-                                      const gl::ShaderMap<std::string> &shaderSources,
-                                      ProgramExecutableVk *executableVk)
+void ShaderInfo::initShaders(ContextVk *contextVk,
+                             const gl::ShaderBitSet &linkedShaderStages,
+                             gl::ShaderMap<SpirvBlob> &&spirvBlobs,
+                             ProgramExecutableVk *executableVk)
 {
     ASSERT(!valid());
 
-    ANGLE_TRY(GlslangWrapperVk::GetShaderCode(contextVk, linkedShaderStages, contextVk->getCaps(),
-                                              shaderSources, &mSpirvBlobs));
+    mSpirvBlobs = std::move(spirvBlobs);
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        mSpirvBlobViews[shaderType] = mSpirvBlobs[shaderType];
+    }
 
     // Assert that SPIR-V transformation is correct, even if the test never issues a draw call.
-    ASSERT(ValidateTransformedSpirV(contextVk, linkedShaderStages, executableVk, mSpirvBlobs));
+    ASSERT(ValidateTransformedSpirV(contextVk, linkedShaderStages, executableVk, mSpirvBlobViews));
 
     mIsInitialized = true;
-    return angle::Result::Continue;
 }
 
 void ShaderInfo::release(ContextVk *contextVk)
@@ -75,18 +100,31 @@ void ShaderInfo::release(ContextVk *contextVk)
     {
         spirvBlob.clear();
     }
+    mSpirvBlobViews.fill(SpirvBlobView());
+    mBinaryStorage.reset();
     mIsInitialized = false;
 }
 
 void ShaderInfo::load(gl::BinaryInputStream *stream)
 {
+    // If the stream keeps its data alive, the SPIR-V is referenced in place instead of copied.
+    mBinaryStorage = stream->getStorage();
+
     // Read in shader codes for all shader types
     for (const gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        SpirvBlob *spirvBlob = &mSpirvBlobs[shaderType];
-
-        // Read the SPIR-V
-        stream->readIntVector<uint32_t>(spirvBlob);
+        if (mBinaryStorage)
+        {
+            size_t wordCount            = 0;
+            const uint32_t *spirv       = stream->getVector<uint32_t>(&wordCount);
+            mSpirvBlobViews[shaderType] = spirv ? SpirvBlobView(spirv, wordCount) : SpirvBlobView();
+        }
+        else
+        {
+            SpirvBlob *spirvBlob = &mSpirvBlobs[shaderType];
+            stream->readVector(spirvBlob);
+            mSpirvBlobViews[shaderType] = *spirvBlob;
+        }
     }
 
     mIsInitialized = true;
@@ -99,10 +137,10 @@ void ShaderInfo::save(gl::BinaryOutputStream *stream)
     // Write out shader codes for all shader types
     for (const gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        const SpirvBlob &spirvBlob = mSpirvBlobs[shaderType];
+        const SpirvBlobView &spirvBlob = mSpirvBlobViews[shaderType];
 
         // Write the SPIR-V
-        stream->writeIntVector(spirvBlob);
+        stream->writeVector(spirvBlob.data(), spirvBlob.size());
     }
 }
 
@@ -119,8 +157,8 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
 {
     const ShaderMapInterfaceVariableInfoMap &variableInfoMap =
         executableVk->getShaderInterfaceVariableInfoMap();
-    const gl::ShaderMap<SpirvBlob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
-    const SpirvBlob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
+    const gl::ShaderMap<SpirvBlobView> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
+    const SpirvBlobView &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
     bool removeEarlyFragmentTestsOptimization =
         (shaderType == gl::ShaderType::Fragment && optionBits.removeEarlyFragmentTestsOptimization);
     gl::ShaderMap<SpirvBlob> transformedSpirvBlobs;
@@ -156,7 +194,14 @@ void ProgramInfo::release(ContextVk *contextVk)
 ProgramExecutableVk::ProgramExecutableVk()
     : mEmptyDescriptorSets{},
       mNumDefaultUniformDescriptors(0),
+      mUniformsAndXfbBindingSignature(0),
+      mTexturesBindingSignature(0),
+      mTexturesBindingUnitsChangeCount(0),
+      mSamplerUniformChangeCount(0),
       mDynamicBufferOffsets{},
+      mPipelineManifestKey{},
+      mPipelineManifestKeyValid(false),
+      mPipelineManifestDirty(false),
       mProgram(nullptr),
       mProgramPipeline(nullptr),
       mObjectPerfCounters{}
@@ -190,8 +235,10 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
         descriptorPool.release(contextVk);
     }
 
-    mTextureDescriptorsCache.clear();
-    mUniformsAndXfbDescriptorSetCache.clear();
+    mTextureBindings.clear();
+    mTexturesBindingUnits.clear();
+    mTexturesUpdateTemplate.destroy(contextVk->getDevice());
+    mTexturesDescriptorInfos.clear();
 
     // Initialize with a unique BufferSerial
     vk::ResourceSerialFactory &factory = contextVk->getRenderer()->getResourceSerialFactory();
@@ -202,6 +249,10 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
         programInfo.release(contextVk);
     }
     mComputeProgramInfo.release(contextVk);
+
+    flushPipelineManifest(contextVk);
+    mPipelineManifest.clear();
+    mPipelineManifestKeyValid = false;
 }
 
 std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(gl::BinaryInputStream *stream)
@@ -356,34 +407,19 @@ angle::Result ProgramExecutableVk::allocUniformAndXfbDescriptorSet(
 {
     mCurrentDefaultUniformBufferSerial = xfbBufferDesc.getDefaultUniformBufferSerial();
 
-    // Look up in the cache first
-    auto iter = mUniformsAndXfbDescriptorSetCache.find(xfbBufferDesc);
-    if (iter != mUniformsAndXfbDescriptorSetCache.end())
-    {
-        *newDescriptorSetAllocated                                        = false;
-        mDescriptorSets[ToUnderlying(DescriptorSetIndex::UniformsAndXfb)] = iter->second;
-        // The descriptor pool that this descriptor set was allocated from needs to be retained each
-        // time the descriptor set is used in a new command.
-        mDescriptorPoolBindings[ToUnderlying(DescriptorSetIndex::UniformsAndXfb)].get().retain(
-            &contextVk->getResourceUseList());
-        return angle::Result::Continue;
-    }
-
-    bool newPoolAllocated;
-    ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::UniformsAndXfb,
-                                              &newPoolAllocated));
+    const size_t descriptorSetIndex = ToUnderlying(DescriptorSetIndex::UniformsAndXfb);
+    ANGLE_TRY(contextVk->getDescriptorSetCache().getUniformsAndXfbDescriptorSet(
+        contextVk, mDescriptorSetLayouts[descriptorSetIndex].get(),
+        mUniformsAndXfbBindingSignature, xfbBufferDesc,
+        &mDescriptorPoolBindings[descriptorSetIndex], &mDescriptorSets[descriptorSetIndex],
+        newDescriptorSetAllocated));
+    mEmptyDescriptorSets[descriptorSetIndex] = VK_NULL_HANDLE;
 
-    // Clear descriptor set cache. It may no longer be valid.
-    if (newPoolAllocated)
+    if (*newDescriptorSetAllocated)
     {
-        mUniformsAndXfbDescriptorSetCache.clear();
+        ++mObjectPerfCounters.descriptorSetsAllocated[descriptorSetIndex];
     }
 
-    // Add the descriptor set into cache
-    mUniformsAndXfbDescriptorSetCache.emplace(
-        xfbBufferDesc, mDescriptorSets[ToUnderlying(DescriptorSetIndex::UniformsAndXfb)]);
-    *newDescriptorSetAllocated = true;
-
     return angle::Result::Continue;
 }
 
@@ -594,6 +630,169 @@ void ProgramExecutableVk::addTextureDescriptorSetDesc(
     }
 }
 
+void ProgramExecutableVk::initTexturesBindingLayout(
+    ContextVk *contextVk,
+    const gl::ShaderMap<const gl::ProgramState *> &programStates)
+{
+    // Records, for each active sampler, everything except the texture units that decides which
+    // descriptors are written to the textures descriptor set and where.
+    const bool useOldRewriteStructSamplers = contextVk->useOldRewriteStructSamplers();
+    const bool forceOldRewriteStructSamplers =
+        contextVk->getRenderer()->getFeatures().forceOldRewriteStructSamplers.enabled;
+    const uint32_t seamfulFlag =
+        contextVk->emulateSeamfulCubeMapSampling() ? kTextureBindingSeamful : 0;
+
+    mTextureBindings.clear();
+    for (const gl::ShaderType shaderType : getGlExecutable().getLinkedShaderStages())
+    {
+        std::unordered_map<std::string, uint32_t> mappedSamplerNameToArrayOffset;
+        const gl::ProgramState *programState = programStates[shaderType];
+        ASSERT(programState);
+        for (uint32_t textureIndex = 0; textureIndex < programState->getSamplerBindings().size();
+             ++textureIndex)
+        {
+            const gl::SamplerBinding &samplerBinding =
+                programState->getSamplerBindings()[textureIndex];
+            uint32_t uniformIndex = programState->getUniformIndexFromSamplerIndex(textureIndex);
+            const gl::LinkedUniform &samplerUniform = programState->getUniforms()[uniformIndex];
+            std::string mappedSamplerName = GlslangGetMappedSamplerName(samplerUniform.name);
+
+            if (!samplerUniform.isActive(shaderType))
+            {
+                continue;
+            }
+
+            uint32_t arrayOffset = 0;
+            uint32_t arraySize   = static_cast<uint32_t>(samplerBinding.boundTextureUnits.size());
+
+            if (!useOldRewriteStructSamplers)
+            {
+                arrayOffset = mappedSamplerNameToArrayOffset[mappedSamplerName];
+                // Front-end generates array elements in order, so we can just increment
+                // the offset each time we process a nested array.
+                mappedSamplerNameToArrayOffset[mappedSamplerName] += arraySize;
+            }
+
+            // Texture buffers are not affected by forceOldRewriteStructSamplers.
+            const bool isBuffer = samplerBinding.textureType == gl::TextureType::Buffer;
+            const std::string samplerName = !isBuffer && forceOldRewriteStructSamplers
+                                                ? GetMappedSamplerNameOld(samplerUniform.name)
+                                                : mappedSamplerName;
+            const ShaderInterfaceVariableInfo &info = mVariableInfoMap[shaderType][samplerName];
+
+            TextureBinding textureBinding;
+            textureBinding.shaderType   = shaderType;
+            textureBinding.samplerIndex = textureIndex;
+            textureBinding.binding      = info.binding;
+            textureBinding.arrayOffset  = arrayOffset;
+            textureBinding.arraySize    = arraySize;
+            textureBinding.flags        = (isBuffer ? kTextureBindingIsBuffer : 0) |
+                                   (samplerUniform.texelFetchStaticUse ? kTextureBindingTexelFetch
+                                                                       : 0) |
+                                   seamfulFlag;
+            mTextureBindings.push_back(textureBinding);
+        }
+    }
+
+    updateTexturesBindingSignature(contextVk, programStates);
+}
+
+uint32_t ProgramExecutableVk::getSamplerUniformChangeCount(const ContextVk *contextVk) const
+{
+    if (mProgram)
+    {
+        return mSamplerUniformChangeCount;
+    }
+
+    // A program pipeline samples through the sampler uniforms of its programs.  Their counts only
+    // ever increase, so their sum changes whenever one of them does.
+    uint32_t changeCount = 0;
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        ProgramVk *programVk = getShaderProgram(contextVk->getState(), shaderType);
+        if (programVk)
+        {
+            changeCount += programVk->getExecutable().mSamplerUniformChangeCount;
+        }
+    }
+    return changeCount;
+}
+
+void ProgramExecutableVk::updateTexturesBindingSignature(
+    ContextVk *contextVk,
+    const gl::ShaderMap<const gl::ProgramState *> &programStates)
+{
+    mTexturesBindingUnits.clear();
+    std::vector<uint32_t> bindings;
+    for (const TextureBinding &textureBinding : mTextureBindings)
+    {
+        const gl::ProgramState *programState = programStates[textureBinding.shaderType];
+        ASSERT(programState);
+        const std::vector<GLuint> &boundTextureUnits =
+            programState->getSamplerBindings()[textureBinding.samplerIndex].boundTextureUnits;
+        ASSERT(boundTextureUnits.size() == textureBinding.arraySize);
+        mTexturesBindingUnits.insert(mTexturesBindingUnits.end(), boundTextureUnits.begin(),
+                                     boundTextureUnits.end());
+
+        bindings.push_back(textureBinding.binding);
+        bindings.push_back(textureBinding.arrayOffset);
+        bindings.push_back(textureBinding.arraySize);
+        bindings.push_back(textureBinding.flags);
+    }
+    bindings.insert(bindings.end(), mTexturesBindingUnits.begin(), mTexturesBindingUnits.end());
+
+    mTexturesBindingSignature = contextVk->getDescriptorSetCache().getBindingSignature(bindings);
+    mTexturesBindingUnitsChangeCount = getSamplerUniformChangeCount(contextVk);
+}
+
+angle::Result ProgramExecutableVk::initTexturesUpdateTemplate(ContextVk *contextVk)
+{
+    if (!contextVk->getFeatures().useDescriptorUpdateTemplates.enabled ||
+        !contextVk->getFeatures().supportsDescriptorUpdateTemplate.enabled ||
+        mTextureBindings.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    // One entry per active sampler, reading its array elements from consecutive descriptor infos.
+    std::vector<VkDescriptorUpdateTemplateEntry> entries;
+    size_t infoCount = 0;
+    for (const TextureBinding &textureBinding : mTextureBindings)
+    {
+        const uint32_t arraySize = textureBinding.arraySize;
+        const bool isBuffer      = (textureBinding.flags & kTextureBindingIsBuffer) != 0;
+
+        VkDescriptorUpdateTemplateEntry entry = {};
+
+        entry.dstBinding      = textureBinding.binding;
+        entry.dstArrayElement = textureBinding.arrayOffset;
+        entry.descriptorCount = arraySize;
+        entry.descriptorType  = isBuffer ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
+                                        : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        entry.offset          = infoCount * sizeof(TextureDescriptorInfo);
+        entry.stride          = sizeof(TextureDescriptorInfo);
+        entries.push_back(entry);
+
+        infoCount += arraySize;
+    }
+
+    const vk::DescriptorSetLayout &descriptorSetLayout =
+        mDescriptorSetLayouts[ToUnderlying(DescriptorSetIndex::Texture)].get();
+
+    VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+
+    createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+    createInfo.pDescriptorUpdateEntries   = entries.data();
+    createInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout        = descriptorSetLayout.getHandle();
+
+    ANGLE_VK_TRY(contextVk, mTexturesUpdateTemplate.init(contextVk->getDevice(), createInfo));
+    mTexturesDescriptorInfos.resize(infoCount);
+
+    return angle::Result::Continue;
+}
+
 void WriteBufferDescriptorSetBinding(const vk::BufferHelper &buffer,
                                      VkDeviceSize offset,
                                      VkDeviceSize size,
@@ -605,6 +804,9 @@ void WriteBufferDescriptorSetBinding(const vk::BufferHelper &buffer,
                                      VkDescriptorBufferInfo *bufferInfoOut,
                                      VkWriteDescriptorSet *writeInfoOut)
 {
+    // Sub-allocated buffers start at an offset that has every alignment a descriptor may need.
+    offset += buffer.getOffset();
+
     // If requiredOffsetAlignment is 0, the buffer offset is guaranteed to have the necessary
     // alignment through other means (the backend specifying the alignment through a GLES limit that
     // the frontend then enforces).  If it's not 0, we need to bind the buffer at an offset that's
@@ -650,6 +852,43 @@ void ProgramExecutableVk::updateEarlyFragmentTestsOptimization(ContextVk *contex
     }
 }
 
+void ProgramExecutableVk::getGraphicsPipelineEvictionCandidates(
+    Serial lastCompletedSerial,
+    const vk::PipelineHelper *keepPipeline,
+    std::vector<Serial> *serialsOut)
+{
+    for (ProgramInfo &programInfo : mGraphicsProgramInfos)
+    {
+        programInfo.getShaderProgram()->getGraphicsPipelineCache().getEvictionCandidates(
+            lastCompletedSerial, keepPipeline, serialsOut);
+    }
+}
+
+size_t ProgramExecutableVk::evictGraphicsPipelines(ContextVk *contextVk,
+                                                   Serial maxSerial,
+                                                   const vk::PipelineHelper *keepPipeline,
+                                                   size_t *evictCount)
+{
+    size_t evicted = 0;
+    for (ProgramInfo &programInfo : mGraphicsProgramInfos)
+    {
+        evicted += programInfo.getShaderProgram()->getGraphicsPipelineCache().evict(
+            contextVk, maxSerial, keepPipeline, evictCount);
+    }
+
+    // Transitions may cross between the pipeline caches of the different transform options, so
+    // drop all of them after an eviction.
+    if (evicted > 0)
+    {
+        for (ProgramInfo &programInfo : mGraphicsProgramInfos)
+        {
+            programInfo.getShaderProgram()->getGraphicsPipelineCache().clearTransitions();
+        }
+    }
+
+    return evicted;
+}
+
 angle::Result ProgramExecutableVk::getGraphicsPipeline(
     ContextVk *contextVk,
     gl::PrimitiveMode mode,
@@ -692,11 +931,186 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(
     shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
                                              dimensions.height);
 
+    GraphicsPipelineCache &graphicsPipelineCache = shaderProgram->getGraphicsPipelineCache();
+
+    const size_t cacheSizeBefore = graphicsPipelineCache.size();
+
     ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
-    return shaderProgram->getGraphicsPipeline(
+    ANGLE_TRY(shaderProgram->getGraphicsPipeline(
         contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(), desc,
         activeAttribLocations, glState.getProgramExecutable()->getAttributesTypeMask(), descPtrOut,
-        pipelineOut);
+        pipelineOut));
+
+    if (graphicsPipelineCache.size() > cacheSizeBefore)
+    {
+        if (mPipelineManifestKeyValid)
+        {
+            recordPipelineManifestEntry(mTransformOptions, **descPtrOut);
+        }
+
+        // Bound the number of pipelines kept alive by the renderer.  Only pipeline creation can
+        // push the renderer over budget, so cache hits don't pay for the trim.
+        if (renderer->isOverGraphicsPipelineBudget())
+        {
+            contextVk->trimGraphicsPipelines(*pipelineOut);
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
+void ProgramExecutableVk::initPipelineManifestKey(const gl::ShaderMap<SpirvBlobView> &spirvBlobs)
+{
+    // Separable programs are drawn through the executable of the program pipeline, which does
+    // not keep a manifest.
+    ASSERT(mProgram);
+
+    // The recorded descs are only meaningful to the ANGLE version that recorded them.
+    std::string hashString = "ANGLE Pipeline Manifest: ";
+    hashString.append(ANGLE_COMMIT_HASH);
+    for (const SpirvBlobView &spirvBlob : spirvBlobs)
+    {
+        hashString.append(reinterpret_cast<const char *>(spirvBlob.data()),
+                          spirvBlob.size() * sizeof(uint32_t));
+    }
+
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.data()),
+                               hashString.length(), mPipelineManifestKey.data());
+    mPipelineManifestKeyValid = true;
+}
+
+void ProgramExecutableVk::recordPipelineManifestEntry(ProgramTransformOptions transformOptions,
+                                                      const vk::GraphicsPipelineDesc &desc)
+{
+    if (mPipelineManifest.size() >= kMaxPipelineManifestEntries)
+    {
+        return;
+    }
+
+    // The desc may already be present if the pipeline was evicted and recreated.
+    const uint8_t transformOptionsBits = gl::bitCast<uint8_t>(transformOptions);
+    for (const PipelineManifestEntry &entry : mPipelineManifest)
+    {
+        if (gl::bitCast<uint8_t>(entry.transformOptions) == transformOptionsBits &&
+            entry.desc == desc)
+        {
+            return;
+        }
+    }
+
+    mPipelineManifest.push_back({transformOptions, desc});
+    mPipelineManifestDirty = true;
+}
+
+void ProgramExecutableVk::flushPipelineManifest(ContextVk *contextVk)
+{
+    if (!mPipelineManifestDirty)
+    {
+        return;
+    }
+    mPipelineManifestDirty = false;
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kPipelineManifestVersion);
+    stream.writeInt(static_cast<uint32_t>(sizeof(vk::GraphicsPipelineDesc)));
+    stream.writeInt(static_cast<uint32_t>(mPipelineManifest.size()));
+    for (const PipelineManifestEntry &entry : mPipelineManifest)
+    {
+        stream.writeInt(gl::bitCast<uint8_t>(entry.transformOptions));
+        stream.writeBytes(reinterpret_cast<const unsigned char *>(&entry.desc),
+                          sizeof(vk::GraphicsPipelineDesc));
+    }
+
+    angle::MemoryBuffer manifestData;
+    if (!manifestData.resize(stream.length()))
+    {
+        // Recording is best effort.
+        return;
+    }
+    memcpy(manifestData.data(), stream.data(), stream.length());
+
+    DisplayVk *displayVk = vk::GetImpl(contextVk->getRenderer()->getDisplay());
+    displayVk->getBlobCache()->put(mPipelineManifestKey, std::move(manifestData));
+}
+
+angle::Result ProgramExecutableVk::warmUpGraphicsPipelines(ContextVk *contextVk)
+{
+    ASSERT(mProgram && mPipelineManifestKeyValid);
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::warmUpGraphicsPipelines");
+
+    RendererVk *renderer = contextVk->getRenderer();
+    DisplayVk *displayVk = vk::GetImpl(renderer->getDisplay());
+
+    egl::BlobCache::Value manifestData;
+    size_t manifestSize = 0;
+    if (!displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), mPipelineManifestKey,
+                                        &manifestData, &manifestSize))
+    {
+        return angle::Result::Continue;
+    }
+
+    gl::BinaryInputStream stream(manifestData.data(), manifestSize);
+    const uint32_t version    = stream.readInt<uint32_t>();
+    const uint32_t descSize   = stream.readInt<uint32_t>();
+    const uint32_t entryCount = stream.readInt<uint32_t>();
+    if (stream.error() || version != kPipelineManifestVersion ||
+        descSize != sizeof(vk::GraphicsPipelineDesc) || entryCount > kMaxPipelineManifestEntries)
+    {
+        // Stale or corrupt manifest; it will be overwritten by the next recorded pipeline.
+        return angle::Result::Continue;
+    }
+
+    // The blob cache may be supplied by the application, so the manifest is untrusted.  Drop the
+    // whole manifest if any entry holds values that ANGLE could not have recorded.
+    std::vector<PipelineManifestEntry> manifest(entryCount);
+    for (PipelineManifestEntry &entry : manifest)
+    {
+        const uint8_t transformOptionsBits = stream.readInt<uint8_t>();
+        stream.readBytes(reinterpret_cast<unsigned char *>(&entry.desc),
+                         sizeof(vk::GraphicsPipelineDesc));
+        if (stream.error() || transformOptionsBits >= ProgramTransformOptions::kPermutationCount ||
+            !entry.desc.isValid())
+        {
+            return angle::Result::Continue;
+        }
+        entry.transformOptions = gl::bitCast<ProgramTransformOptions>(transformOptionsBits);
+    }
+
+    const gl::ProgramExecutable &glExecutable = mProgram->getState().getExecutable();
+    vk::PipelineCache *pipelineCache          = nullptr;
+    ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
+
+    for (const PipelineManifestEntry &entry : manifest)
+    {
+        ProgramInfo &programInfo = getGraphicsProgramInfo(entry.transformOptions);
+        for (const gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
+        {
+            ANGLE_TRY(mProgram->initGraphicsShaderProgram(contextVk, shaderType,
+                                                          entry.transformOptions, &programInfo,
+                                                          this));
+        }
+
+        vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
+        ASSERT(shaderProgram);
+
+        const vk::PackedExtent &dimensions = entry.desc.getDrawableSize();
+        shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableWidth,
+                                                 dimensions.width);
+        shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::DrawableHeight,
+                                                 dimensions.height);
+
+        // This only queues the pipeline creation on a worker thread.  The first draw call that
+        // uses the pipeline waits for it if needed.
+        ANGLE_TRY(shaderProgram->warmUpGraphicsPipeline(
+            contextVk, &contextVk->getRenderPassCache(), *pipelineCache, getPipelineLayout(),
+            entry.desc, glExecutable.getNonBuiltinAttribLocationsMask(),
+            glExecutable.getAttributesTypeMask()));
+    }
+
+    // Keep the loaded entries so that new pipelines are appended to the stored manifest.
+    mPipelineManifest = std::move(manifest);
+
+    return angle::Result::Continue;
 }
 
 angle::Result ProgramExecutableVk::getComputePipeline(ContextVk *contextVk,
@@ -753,14 +1167,20 @@ angle::Result ProgramExecutableVk::initDynamicDescriptorPools(
         descriptorPoolSizes.emplace_back(poolSize);
     }
 
-    if (!descriptorPoolSizes.empty())
+    if (descriptorPoolSizes.empty())
     {
-        ANGLE_TRY(mDynamicDescriptorPools[ToUnderlying(descriptorSetIndex)].init(
-            contextVk, descriptorPoolSizes.data(), descriptorPoolSizes.size(),
-            descriptorSetLayout));
+        return angle::Result::Continue;
     }
 
-    return angle::Result::Continue;
+    // These sets are allocated from the share group's descriptor set cache.
+    if (IsDescriptorSetCached(descriptorSetIndex))
+    {
+        return contextVk->getDescriptorSetCache().initPool(contextVk, descriptorSetLayout,
+                                                           descriptorPoolSizes);
+    }
+
+    return mDynamicDescriptorPools[ToUnderlying(descriptorSetIndex)].init(
+        contextVk, descriptorPoolSizes.data(), descriptorPoolSizes.size(), descriptorSetLayout);
 }
 
 angle::Result ProgramExecutableVk::createPipelineLayout(
@@ -894,6 +1314,13 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         contextVk, driverUniformsSetDesc, DescriptorSetIndex::DriverUniforms,
         mDescriptorSetLayouts[ToUnderlying(DescriptorSetIndex::DriverUniforms)].get().getHandle()));
 
+    // Identify the bindings of the cached descriptor sets.
+    mUniformsAndXfbBindingSignature =
+        contextVk->getDescriptorSetCache().getUniqueBindingSignature();
+
+    initTexturesBindingLayout(contextVk, programStates);
+    ANGLE_TRY(initTexturesUpdateTemplate(contextVk));
+
     mDynamicBufferOffsets.resize(glExecutable.getLinkedShaderStageCount());
 
     return angle::Result::Continue;
@@ -951,17 +1378,20 @@ void ProgramExecutableVk::updateDefaultUniformsDescriptorSet(
 
     if (!defaultUniformBlock.uniformData.empty())
     {
+        // The streaming buffer may be larger than maxUniformBufferRange, so only the block's data
+        // is bound.
         bufferInfo.buffer = defaultUniformBuffer->getBuffer().getHandle();
+        bufferInfo.range  = defaultUniformBlock.uniformData.size();
     }
     else
     {
         vk::BufferHelper &emptyBuffer = contextVk->getEmptyBuffer();
         emptyBuffer.retain(&contextVk->getResourceUseList());
         bufferInfo.buffer = emptyBuffer.getBuffer().getHandle();
+        bufferInfo.range  = VK_WHOLE_SIZE;
     }
 
     bufferInfo.offset = 0;
-    bufferInfo.range  = VK_WHOLE_SIZE;
 
     writeInfo.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     writeInfo.pNext            = nullptr;
@@ -1416,174 +1846,150 @@ void ProgramExecutableVk::updateTransformFeedbackDescriptorSetImpl(
         contextVk, programState, mDescriptorSets[ToUnderlying(DescriptorSetIndex::UniformsAndXfb)]);
 }
 
-angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(ContextVk *contextVk)
+template <typename WriteDescriptorCallback>
+angle::Result ProgramExecutableVk::forEachTextureDescriptor(
+    ContextVk *contextVk,
+    WriteDescriptorCallback &&writeDescriptor)
 {
-    const gl::ProgramExecutable *executable = contextVk->getState().getProgramExecutable();
-    ASSERT(executable);
-
-    if (!executable->hasTextures())
-    {
-        return angle::Result::Continue;
-    }
-
-    const vk::TextureDescriptorDesc &texturesDesc = contextVk->getActiveTexturesDesc();
-
-    auto iter = mTextureDescriptorsCache.find(texturesDesc);
-    if (iter != mTextureDescriptorsCache.end())
-    {
-        mDescriptorSets[ToUnderlying(DescriptorSetIndex::Texture)] = iter->second;
-        // The descriptor pool that this descriptor set was allocated from needs to be retained each
-        // time the descriptor set is used in a new command.
-        mDescriptorPoolBindings[ToUnderlying(DescriptorSetIndex::Texture)].get().retain(
-            &contextVk->getResourceUseList());
-        return angle::Result::Continue;
-    }
-
-    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
-
     const gl::ActiveTextureArray<vk::TextureUnit> &activeTextures = contextVk->getActiveTextures();
 
-    bool emulateSeamfulCubeMapSampling = contextVk->emulateSeamfulCubeMapSampling();
-    bool useOldRewriteStructSamplers   = contextVk->useOldRewriteStructSamplers();
-
-    gl::ShaderMap<const gl::ProgramState *> programStates;
-    fillProgramStateMap(contextVk, &programStates);
+    ASSERT(mTexturesBindingUnitsChangeCount == getSamplerUniformChangeCount(contextVk));
 
-    for (const gl::ShaderType shaderType : executable->getLinkedShaderStages())
+    size_t descriptorIndex = 0;
+    for (const TextureBinding &textureBinding : mTextureBindings)
     {
-        std::unordered_map<std::string, uint32_t> mappedSamplerNameToArrayOffset;
-        const gl::ProgramState *programState = programStates[shaderType];
-        ASSERT(programState);
-        for (uint32_t textureIndex = 0; textureIndex < programState->getSamplerBindings().size();
-             ++textureIndex)
+        const bool texelFetchStaticUse = (textureBinding.flags & kTextureBindingTexelFetch) != 0;
+
+        for (uint32_t arrayElement = 0; arrayElement < textureBinding.arraySize;
+             ++arrayElement, ++descriptorIndex)
         {
-            const gl::SamplerBinding &samplerBinding =
-                programState->getSamplerBindings()[textureIndex];
-            uint32_t uniformIndex = programState->getUniformIndexFromSamplerIndex(textureIndex);
-            const gl::LinkedUniform &samplerUniform = programState->getUniforms()[uniformIndex];
-            std::string mappedSamplerName = GlslangGetMappedSamplerName(samplerUniform.name);
+            const vk::TextureUnit &unit = activeTextures[mTexturesBindingUnits[descriptorIndex]];
+            TextureVk *textureVk        = unit.texture;
 
-            if (!samplerUniform.isActive(shaderType))
+            // Texture buffers use buffer views, so they are especially handled.
+            if ((textureBinding.flags & kTextureBindingIsBuffer) != 0)
             {
+                const vk::BufferView *view = nullptr;
+                ANGLE_TRY(textureVk->getBufferViewAndRecordUse(contextVk, nullptr, &view));
+                writeDescriptor(textureBinding, arrayElement, descriptorIndex, nullptr, view);
                 continue;
             }
 
-            // Lazily allocate the descriptor set, since we may not need one if all of the
-            // sampler uniforms are inactive.
-            if (descriptorSet == VK_NULL_HANDLE)
+            vk::ImageHelper &image = textureVk->getImage();
+
+            VkDescriptorImageInfo imageInfo = {};
+            imageInfo.sampler               = unit.sampler->get().getHandle();
+            imageInfo.imageLayout           = image.getCurrentLayout();
+            if (image.hasImmutableSampler())
             {
-                bool newPoolAllocated;
-                ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, DescriptorSetIndex::Texture,
-                                                          &newPoolAllocated));
+                imageInfo.sampler = textureVk->getSampler().get().getHandle();
+            }
 
-                // Clear descriptor set cache. It may no longer be valid.
-                if (newPoolAllocated)
-                {
-                    mTextureDescriptorsCache.clear();
-                }
+            // If emulating seamful cubemapping, use the fetch image view.  This is basically the
+            // same image view as read, except it's a 2DArray view for cube maps.
+            const vk::ImageView &imageView =
+                (textureBinding.flags & kTextureBindingSeamful) != 0
+                    ? textureVk->getFetchImageViewAndRecordUse(contextVk, unit.srgbDecode,
+                                                               texelFetchStaticUse)
+                    : textureVk->getReadImageViewAndRecordUse(contextVk, unit.srgbDecode,
+                                                              texelFetchStaticUse);
+            imageInfo.imageView = imageView.getHandle();
+
+            writeDescriptor(textureBinding, arrayElement, descriptorIndex, &imageInfo, nullptr);
+        }
+    }
 
-                descriptorSet = mDescriptorSets[ToUnderlying(DescriptorSetIndex::Texture)];
-                mTextureDescriptorsCache.emplace(texturesDesc, descriptorSet);
-            }
-            ASSERT(descriptorSet != VK_NULL_HANDLE);
+    return angle::Result::Continue;
+}
 
-            uint32_t arrayOffset = 0;
-            uint32_t arraySize   = static_cast<uint32_t>(samplerBinding.boundTextureUnits.size());
+angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(ContextVk *contextVk)
+{
+    const gl::ProgramExecutable *executable = contextVk->getState().getProgramExecutable();
+    ASSERT(executable);
 
-            if (!useOldRewriteStructSamplers)
-            {
-                arrayOffset = mappedSamplerNameToArrayOffset[mappedSamplerName];
-                // Front-end generates array elements in order, so we can just increment
-                // the offset each time we process a nested array.
-                mappedSamplerNameToArrayOffset[mappedSamplerName] += arraySize;
-            }
+    // No descriptor set is needed if all of the sampler uniforms are inactive.
+    if (!executable->hasTextures() || mTextureBindings.empty())
+    {
+        return angle::Result::Continue;
+    }
 
-            VkWriteDescriptorSet *writeInfos = contextVk->allocWriteDescriptorSets(arraySize);
+    if (mTexturesBindingUnitsChangeCount != getSamplerUniformChangeCount(contextVk))
+    {
+        gl::ShaderMap<const gl::ProgramState *> programStates;
+        fillProgramStateMap(contextVk, &programStates);
+        updateTexturesBindingSignature(contextVk, programStates);
+    }
 
-            // Texture buffers use buffer views, so they are especially handled.
-            if (samplerBinding.textureType == gl::TextureType::Buffer)
-            {
-                for (uint32_t arrayElement = 0; arrayElement < arraySize; ++arrayElement)
-                {
-                    GLuint textureUnit         = samplerBinding.boundTextureUnits[arrayElement];
-                    TextureVk *textureVk       = activeTextures[textureUnit].texture;
-                    const vk::BufferView *view = nullptr;
-                    ANGLE_TRY(textureVk->getBufferViewAndRecordUse(contextVk, nullptr, &view));
-
-                    const std::string samplerName =
-                        GlslangGetMappedSamplerName(samplerUniform.name);
-                    ShaderInterfaceVariableInfo &info = mVariableInfoMap[shaderType][samplerName];
-
-                    writeInfos[arrayElement].sType      = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-                    writeInfos[arrayElement].pNext      = nullptr;
-                    writeInfos[arrayElement].dstSet     = descriptorSet;
-                    writeInfos[arrayElement].dstBinding = info.binding;
-                    writeInfos[arrayElement].dstArrayElement = arrayOffset + arrayElement;
-                    writeInfos[arrayElement].descriptorCount = 1;
-                    writeInfos[arrayElement].descriptorType =
-                        VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
-                    writeInfos[arrayElement].pImageInfo       = nullptr;
-                    writeInfos[arrayElement].pBufferInfo      = nullptr;
-                    writeInfos[arrayElement].pTexelBufferView = view->ptr();
-                }
-                continue;
-            }
+    const vk::TextureDescriptorDesc &texturesDesc = contextVk->getActiveTexturesDesc();
+    const size_t descriptorSetIndex               = ToUnderlying(DescriptorSetIndex::Texture);
 
-            VkDescriptorImageInfo *imageInfos = contextVk->allocDescriptorImageInfos(arraySize);
-            for (uint32_t arrayElement = 0; arrayElement < arraySize; ++arrayElement)
-            {
-                GLuint textureUnit          = samplerBinding.boundTextureUnits[arrayElement];
-                const vk::TextureUnit &unit = activeTextures[textureUnit];
-                TextureVk *textureVk        = unit.texture;
-                const vk::SamplerHelper &samplerHelper = *unit.sampler;
+    bool newDescriptorSetAllocated;
+    ANGLE_TRY(contextVk->getDescriptorSetCache().getTexturesDescriptorSet(
+        contextVk, mDescriptorSetLayouts[descriptorSetIndex].get(), mTexturesBindingSignature,
+        texturesDesc, &mDescriptorPoolBindings[descriptorSetIndex],
+        &mDescriptorSets[descriptorSetIndex], &newDescriptorSetAllocated));
+    mEmptyDescriptorSets[descriptorSetIndex] = VK_NULL_HANDLE;
 
-                vk::ImageHelper &image = textureVk->getImage();
+    if (!newDescriptorSetAllocated)
+    {
+        return angle::Result::Continue;
+    }
+    ++mObjectPerfCounters.descriptorSetsAllocated[descriptorSetIndex];
 
-                imageInfos[arrayElement].sampler     = samplerHelper.get().getHandle();
-                imageInfos[arrayElement].imageLayout = image.getCurrentLayout();
+    const VkDescriptorSet descriptorSet = mDescriptorSets[descriptorSetIndex];
 
-                if (emulateSeamfulCubeMapSampling)
+    if (mTexturesUpdateTemplate.valid())
+    {
+        ANGLE_TRY(forEachTextureDescriptor(
+            contextVk, [this](const TextureBinding &, uint32_t, size_t descriptorIndex,
+                              const VkDescriptorImageInfo *imageInfo,
+                              const vk::BufferView *bufferView) {
+                TextureDescriptorInfo &info = mTexturesDescriptorInfos[descriptorIndex];
+                if (bufferView)
                 {
-                    // If emulating seamful cubemapping, use the fetch image view.  This is
-                    // basically the same image view as read, except it's a 2DArray view for
-                    // cube maps.
-                    const vk::ImageView &imageView = textureVk->getFetchImageViewAndRecordUse(
-                        contextVk, unit.srgbDecode, samplerUniform.texelFetchStaticUse);
-                    imageInfos[arrayElement].imageView = imageView.getHandle();
+                    info.bufferView = bufferView->getHandle();
                 }
                 else
                 {
-                    const vk::ImageView &imageView = textureVk->getReadImageViewAndRecordUse(
-                        contextVk, unit.srgbDecode, samplerUniform.texelFetchStaticUse);
-                    imageInfos[arrayElement].imageView = imageView.getHandle();
+                    info.image = *imageInfo;
                 }
+            }));
 
-                if (textureVk->getImage().hasImmutableSampler())
-                {
-                    imageInfos[arrayElement].sampler = textureVk->getSampler().get().getHandle();
-                }
-                ShaderInterfaceVariableInfoMap &variableInfoMap = mVariableInfoMap[shaderType];
-                const std::string samplerName =
-                    contextVk->getRenderer()->getFeatures().forceOldRewriteStructSamplers.enabled
-                        ? GetMappedSamplerNameOld(samplerUniform.name)
-                        : GlslangGetMappedSamplerName(samplerUniform.name);
-                ShaderInterfaceVariableInfo &info = variableInfoMap[samplerName];
-
-                writeInfos[arrayElement].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-                writeInfos[arrayElement].pNext           = nullptr;
-                writeInfos[arrayElement].dstSet          = descriptorSet;
-                writeInfos[arrayElement].dstBinding      = info.binding;
-                writeInfos[arrayElement].dstArrayElement = arrayOffset + arrayElement;
-                writeInfos[arrayElement].descriptorCount = 1;
-                writeInfos[arrayElement].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-                writeInfos[arrayElement].pImageInfo     = &imageInfos[arrayElement];
-                writeInfos[arrayElement].pBufferInfo    = nullptr;
-                writeInfos[arrayElement].pTexelBufferView = nullptr;
-            }
-        }
+        mTexturesUpdateTemplate.updateDescriptorSet(contextVk->getDevice(), descriptorSet,
+                                                    mTexturesDescriptorInfos.data());
+        return angle::Result::Continue;
     }
 
-    return angle::Result::Continue;
+    return forEachTextureDescriptor(
+        contextVk, [contextVk, descriptorSet](const TextureBinding &textureBinding,
+                                              uint32_t arrayElement, size_t,
+                                              const VkDescriptorImageInfo *imageInfo,
+                                              const vk::BufferView *bufferView) {
+            VkWriteDescriptorSet &writeInfo = contextVk->allocWriteDescriptorSet();
+
+            writeInfo.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeInfo.pNext            = nullptr;
+            writeInfo.dstSet           = descriptorSet;
+            writeInfo.dstBinding       = textureBinding.binding;
+            writeInfo.dstArrayElement  = textureBinding.arrayOffset + arrayElement;
+            writeInfo.descriptorCount  = 1;
+            writeInfo.pImageInfo       = nullptr;
+            writeInfo.pBufferInfo      = nullptr;
+            writeInfo.pTexelBufferView = nullptr;
+
+            if (bufferView)
+            {
+                writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+                writeInfo.pTexelBufferView = bufferView->ptr();
+            }
+            else
+            {
+                VkDescriptorImageInfo &writeImageInfo = contextVk->allocDescriptorImageInfo();
+                writeImageInfo                        = *imageInfo;
+                writeInfo.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+                writeInfo.pImageInfo     = &writeImageInfo;
+            }
+        });
 }
 
 angle::Result ProgramExecutableVk::updateDescriptorSets(ContextVk *contextVk,
@@ -1628,10 +2034,20 @@ angle::Result ProgramExecutableVk::updateDescriptorSets(ContextVk *contextVk,
                 const vk::DescriptorSetLayout &descriptorSetLayout =
                     mDescriptorSetLayouts[descriptorSetIndex].get();
 
-                ANGLE_TRY(mDynamicDescriptorPools[descriptorSetIndex].allocateSets(
-                    contextVk, descriptorSetLayout.ptr(), 1,
-                    &mDescriptorPoolBindings[descriptorSetIndex],
-                    &mEmptyDescriptorSets[descriptorSetIndex]));
+                if (IsDescriptorSetCached(static_cast<DescriptorSetIndex>(descriptorSetIndex)))
+                {
+                    ANGLE_TRY(contextVk->getDescriptorSetCache().allocateUncachedDescriptorSet(
+                        contextVk, descriptorSetLayout,
+                        &mDescriptorPoolBindings[descriptorSetIndex],
+                        &mEmptyDescriptorSets[descriptorSetIndex]));
+                }
+                else
+                {
+                    ANGLE_TRY(mDynamicDescriptorPools[descriptorSetIndex].allocateSets(
+                        contextVk, descriptorSetLayout.ptr(), 1,
+                        &mDescriptorPoolBindings[descriptorSetIndex],
+                        &mEmptyDescriptorSets[descriptorSetIndex]));
+                }
 
                 ++mObjectPerfCounters.descriptorSetsAllocated[descriptorSetIndex];
             }
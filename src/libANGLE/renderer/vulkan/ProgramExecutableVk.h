@@ -13,6 +13,7 @@
 #include "common/bitset_utils.h"
 #include "common/mathutil.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/InfoLog.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
@@ -29,22 +30,27 @@ class ShaderInfo final : angle::NonCopyable
     ShaderInfo();
     ~ShaderInfo();
 
-    angle::Result initShaders(ContextVk *contextVk,
-                              const gl::ShaderBitSet &linkedShaderStages,
-                              const gl::ShaderMap<std::string> &shaderSources,
-                              ProgramExecutableVk *executableVk);
+    // Takes the SPIR-V generated from the shader sources, which may be done on worker threads.
+    void initShaders(ContextVk *contextVk,
+                     const gl::ShaderBitSet &linkedShaderStages,
+                     gl::ShaderMap<SpirvBlob> &&spirvBlobs,
+                     ProgramExecutableVk *executableVk);
     void release(ContextVk *contextVk);
 
     ANGLE_INLINE bool valid() const { return mIsInitialized; }
 
-    const gl::ShaderMap<SpirvBlob> &getSpirvBlobs() const { return mSpirvBlobs; }
+    const gl::ShaderMap<SpirvBlobView> &getSpirvBlobs() const { return mSpirvBlobViews; }
 
     // Save and load implementation for GLES Program Binary support.
     void load(gl::BinaryInputStream *stream);
     void save(gl::BinaryOutputStream *stream);
 
   private:
+    // The SPIR-V is owned by mSpirvBlobs when linked from source.  When loaded from the program
+    // cache, it is referenced in place in the cache's buffer, which mBinaryStorage keeps alive.
     gl::ShaderMap<SpirvBlob> mSpirvBlobs;
+    std::shared_ptr<const angle::MemoryBuffer> mBinaryStorage;
+    gl::ShaderMap<SpirvBlobView> mSpirvBlobViews;
     bool mIsInitialized = false;
 };
 
@@ -142,6 +148,25 @@ class ProgramExecutableVk
 
     angle::Result getComputePipeline(ContextVk *contextVk, vk::PipelineAndSerial **pipelineOut);
 
+    // Used by ContextVk::trimGraphicsPipelines to evict the least recently used pipelines across
+    // the programs of a share group.  See GraphicsPipelineCache::evict.
+    void getGraphicsPipelineEvictionCandidates(Serial lastCompletedSerial,
+                                               const vk::PipelineHelper *keepPipeline,
+                                               std::vector<Serial> *serialsOut);
+    size_t evictGraphicsPipelines(ContextVk *contextVk,
+                                  Serial maxSerial,
+                                  const vk::PipelineHelper *keepPipeline,
+                                  size_t *evictCount);
+
+    // The pipeline manifest records the GraphicsPipelineDescs this program was drawn with in the
+    // blob cache, keyed by the program's SPIR-V, so that a later link of the same program can
+    // start creating those pipelines on worker threads before the first draw call.  New entries
+    // are written to the blob cache in batches, when the program is destroyed or relinked and
+    // periodically on swap.
+    void initPipelineManifestKey(const gl::ShaderMap<SpirvBlobView> &spirvBlobs);
+    angle::Result warmUpGraphicsPipelines(ContextVk *contextVk);
+    void flushPipelineManifest(ContextVk *contextVk);
+
     const vk::PipelineLayout &getPipelineLayout() const { return mPipelineLayout.get(); }
     angle::Result createPipelineLayout(const gl::Context *glContext,
                                        gl::ActiveTextureArray<vk::TextureUnit> *activeTextures);
@@ -172,6 +197,9 @@ class ProgramExecutableVk
         mProgramPipeline = pipeline;
     }
 
+    // Called when a sampler uniform of the program is set, which may change its texture units.
+    void onSamplerUniformChange() { ++mSamplerUniformChangeCount; }
+
     using DescriptorSetCountList = std::array<uint32_t, DescriptorSetIndex::EnumCount>;
     // Performance and resource counters.
     struct PerfCounters
@@ -209,6 +237,16 @@ class ProgramExecutableVk
                                      bool useOldRewriteStructSamplers,
                                      const gl::ActiveTextureArray<vk::TextureUnit> *activeTextures,
                                      vk::DescriptorSetLayoutDesc *descOut);
+    void initTexturesBindingLayout(ContextVk *contextVk,
+                                   const gl::ShaderMap<const gl::ProgramState *> &programStates);
+    uint32_t getSamplerUniformChangeCount(const ContextVk *contextVk) const;
+    void updateTexturesBindingSignature(
+        ContextVk *contextVk,
+        const gl::ShaderMap<const gl::ProgramState *> &programStates);
+    angle::Result initTexturesUpdateTemplate(ContextVk *contextVk);
+    template <typename WriteDescriptorCallback>
+    angle::Result forEachTextureDescriptor(ContextVk *contextVk,
+                                           WriteDescriptorCallback &&writeDescriptor);
 
     void resolvePrecisionMismatch(const gl::ProgramMergedVaryings &mergedVaryings);
     void updateDefaultUniformsDescriptorSet(const gl::ShaderType shaderType,
@@ -237,6 +275,9 @@ class ProgramExecutableVk
                                              DescriptorSetIndex descriptorSetIndex,
                                              VkDescriptorSetLayout descriptorSetLayout);
 
+    void recordPipelineManifestEntry(ProgramTransformOptions transformOptions,
+                                     const vk::GraphicsPipelineDesc &desc);
+
     void outputCumulativePerfCounters();
 
     // Descriptor sets for uniform blocks and textures for this program.
@@ -245,8 +286,42 @@ class ProgramExecutableVk
     size_t mNumDefaultUniformDescriptors;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
 
-    angle::HashMap<vk::UniformsAndXfbDesc, VkDescriptorSet> mUniformsAndXfbDescriptorSetCache;
-    angle::HashMap<vk::TextureDescriptorDesc, VkDescriptorSet> mTextureDescriptorsCache;
+    // The uniforms and transform feedback and the textures descriptor sets are cached in the share
+    // group, so programs that write the same textures to the same bindings can share them.  The
+    // default uniform buffer belongs to this program, so its sets are not shared.
+    uint32_t mUniformsAndXfbBindingSignature;
+    uint32_t mTexturesBindingSignature;
+
+    // Each active sampler, in the order its descriptors are written to the textures descriptor
+    // set.  Built at link, so the signature and both ways of writing the set agree on the order.
+    struct TextureBinding
+    {
+        gl::ShaderType shaderType;
+        uint32_t samplerIndex;
+        uint32_t binding;
+        uint32_t arrayOffset;
+        uint32_t arraySize;
+        uint32_t flags;
+    };
+    std::vector<TextureBinding> mTextureBindings;
+
+    // The texture units of every element of mTextureBindings.  Sampler uniforms can be set after
+    // link, so these and the signature are recomputed when the change count of the sampler
+    // uniforms differs from the one they were computed with.
+    std::vector<uint32_t> mTexturesBindingUnits;
+    uint32_t mTexturesBindingUnitsChangeCount;
+    uint32_t mSamplerUniformChangeCount;
+
+    // With the useDescriptorUpdateTemplates feature, the textures descriptor set is written from
+    // a packed array holding the descriptor of every element of the active samplers, in the order
+    // of mTexturesBindingUnits.
+    union TextureDescriptorInfo
+    {
+        VkDescriptorImageInfo image;
+        VkBufferView bufferView;
+    };
+    vk::DescriptorUpdateTemplate mTexturesUpdateTemplate;
+    std::vector<TextureDescriptorInfo> mTexturesDescriptorInfos;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
     // deleted while this program is in use.
@@ -259,7 +334,8 @@ class ProgramExecutableVk
 
     // Store descriptor pools here. We store the descriptors in the Program to facilitate descriptor
     // cache management. It can also allow fewer descriptors for shaders which use fewer
-    // textures/buffers.
+    // textures/buffers.  The uniforms and transform feedback and the textures sets are allocated
+    // from the share group's DescriptorSetCache instead, so their pools here are left unused.
     vk::DescriptorSetLayoutArray<vk::DynamicDescriptorPool> mDynamicDescriptorPools;
 
     gl::ShaderVector<uint32_t> mDynamicBufferOffsets;
@@ -275,6 +351,18 @@ class ProgramExecutableVk
 
     ProgramTransformOptions mTransformOptions;
 
+    // Pipelines recorded for warm-up.  The manifest is only kept for non-separable programs.
+    struct PipelineManifestEntry
+    {
+        ProgramTransformOptions transformOptions;
+        vk::GraphicsPipelineDesc desc;
+    };
+    std::vector<PipelineManifestEntry> mPipelineManifest;
+    egl::BlobCache::Key mPipelineManifestKey;
+    bool mPipelineManifestKeyValid;
+    // Whether mPipelineManifest has entries that are not in the blob cache yet.
+    bool mPipelineManifestDirty;
+
     ProgramVk *mProgram;
     ProgramPipelineVk *mProgramPipeline;
 
@@ -121,31 +121,44 @@ angle::Result ProgramPipelineVk::updateUniforms(ContextVk *contextVk)
 {
     const gl::State &glState                  = contextVk->getState();
     const gl::ProgramExecutable &glExecutable = *glState.getProgramExecutable();
-    vk::DynamicBuffer *defaultUniformStorage  = contextVk->getDefaultUniformStorage();
+    vk::StreamingBuffer *streamingBuffer      = contextVk->getStreamingBuffer();
     uint8_t *bufferData                       = nullptr;
     VkDeviceSize bufferOffset                 = 0;
     uint32_t offsetIndex                      = 0;
-    bool anyNewBufferAllocated                = false;
     gl::ShaderMap<VkDeviceSize> offsets;  // offset to the beginning of bufferData
     size_t requiredSpace;
 
+    RendererVk *renderer   = contextVk->getRenderer();
+    const size_t alignment = static_cast<size_t>(
+        renderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
+
     // We usually only update uniform data for shader stages that are actually dirty. But when the
     // buffer for uniform data have switched, because all shader stages are using the same buffer,
     // we then must update uniform data for all shader stages to keep all shader stages' unform data
-    // in the same buffer.
+    // in the same buffer.  The streaming buffer may also have been switched by vertex or index data
+    // since the last update.
+    vk::BufferHelper *currentBuffer = streamingBuffer->getCurrentBuffer();
+    if (currentBuffer == nullptr ||
+        mExecutable.getCurrentDefaultUniformBufferSerial() != currentBuffer->getBufferSerial())
+    {
+        setAllDefaultUniformsDirty(glState);
+    }
+
     requiredSpace = calcUniformUpdateRequiredSpace(contextVk, glExecutable, glState, &offsets);
     ASSERT(requiredSpace > 0);
 
-    // Allocate space from dynamicBuffer. Always try to allocate from the current buffer first.
-    // If that failed, we deal with fall out and try again.
-    if (!defaultUniformStorage->allocateFromCurrentBuffer(requiredSpace, &bufferData,
-                                                          &bufferOffset))
+    // Always try to allocate from the current buffer first.  If that failed, we deal with fall out
+    // and try again.
+    bool allocated = false;
+    ANGLE_TRY(streamingBuffer->allocateFromCurrentBuffer(contextVk, requiredSpace, alignment,
+                                                         &bufferData, &bufferOffset, &allocated));
+    if (!allocated)
     {
-        setAllDefaultUniformsDirty(contextVk->getState());
+        setAllDefaultUniformsDirty(glState);
 
         requiredSpace = calcUniformUpdateRequiredSpace(contextVk, glExecutable, glState, &offsets);
-        ANGLE_TRY(defaultUniformStorage->allocate(contextVk, requiredSpace, &bufferData, nullptr,
-                                                  &bufferOffset, &anyNewBufferAllocated));
+        ANGLE_TRY(streamingBuffer->allocate(contextVk, requiredSpace, alignment, &bufferData,
+                                            nullptr, &bufferOffset, nullptr));
     }
 
     for (const gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
@@ -163,16 +176,16 @@ angle::Result ProgramPipelineVk::updateUniforms(ContextVk *contextVk)
         }
         ++offsetIndex;
     }
-    ANGLE_TRY(defaultUniformStorage->flush(contextVk));
+    ANGLE_TRY(streamingBuffer->flush(contextVk));
 
-    // Because the uniform buffers are per context, we can't rely on dynamicBuffer's allocate
-    // function to tell us if you have got a new buffer or not. Other program's use of the buffer
-    // might already pushed dynamicBuffer to a new buffer. We record which buffer (represented by
+    // Because the uniform buffers are per context, we can't rely on the streaming buffer's
+    // allocate function to tell us if you have got a new buffer or not. Other program's use of the
+    // buffer might already pushed it to a new buffer. We record which buffer (represented by
     // the unique BufferSerial number) we were using with the current descriptor set and then we
     // use that recorded BufferSerial compare to the current uniform buffer to quickly detect if
     // there is a buffer switch or not. We need to retrieve from the descriptor set cache or
     // allocate a new descriptor set whenever there is uniform buffer switch.
-    vk::BufferHelper *defaultUniformBuffer = defaultUniformStorage->getCurrentBuffer();
+    vk::BufferHelper *defaultUniformBuffer = streamingBuffer->getCurrentBuffer();
     if (mExecutable.getCurrentDefaultUniformBufferSerial() !=
         defaultUniformBuffer->getBufferSerial())
     {
@@ -13,6 +13,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -200,6 +201,10 @@ std::unique_ptr<rx::LinkEvent> ProgramVk::load(const gl::Context *context,
     }
 
     status = mExecutable.createPipelineLayout(context, nullptr);
+    if (status == angle::Result::Continue)
+    {
+        status = warmUpGraphicsPipelines(contextVk);
+    }
     return std::make_unique<LinkEventDone>(status);
 }
 
@@ -252,6 +257,102 @@ void ProgramVk::fillProgramStateMap(gl::ShaderMap<const gl::ProgramState *> *pro
     }
 }
 
+// Generates the SPIR-V of one shader stage on a worker thread.
+class ProgramVk::CompileShaderTask final : public angle::Closure
+{
+  public:
+    CompileShaderTask(const gl::Caps &caps, gl::ShaderType shaderType, std::string &&source)
+        : mCaps(caps),
+          mShaderType(shaderType),
+          mSource(std::move(source)),
+          mResult(angle::Result::Continue)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::CompileShaderTask::run");
+
+        if (!mSource.empty())
+        {
+            mResult = GlslangWrapperVk::GetShaderCode(mCaps, mShaderType, mSource, &mSpirvBlob);
+        }
+    }
+
+    angle::Result getResult() const { return mResult; }
+    SpirvBlob &getSpirvBlob() { return mSpirvBlob; }
+
+  private:
+    gl::Caps mCaps;
+    gl::ShaderType mShaderType;
+    std::string mSource;
+    angle::Result mResult;
+    SpirvBlob mSpirvBlob;
+};
+
+// The event for the SPIR-V generation of the stages, which run in parallel on the worker thread
+// pool.  The pipeline layout is created once they are all done.
+class ProgramVk::LinkEventVk final : public LinkEvent
+{
+  public:
+    LinkEventVk(ProgramVk *program, const std::shared_ptr<angle::WorkerThreadPool> &workerPool)
+        : mProgram(program), mWorkerPool(workerPool)
+    {}
+
+    void postTask(gl::ShaderType shaderType, std::shared_ptr<CompileShaderTask> task)
+    {
+        std::shared_ptr<angle::WaitableEvent> waitableEvent =
+            angle::WorkerThreadPool::PostWorkerTask(mWorkerPool, task);
+        if (!waitableEvent)
+        {
+            (*task)();
+            waitableEvent = std::make_shared<angle::WaitableEventDone>();
+        }
+
+        mTasks[shaderType]          = std::move(task);
+        mWaitableEvents[shaderType] = std::move(waitableEvent);
+    }
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::LinkEventVk::wait");
+
+        ContextVk *contextVk = vk::GetImpl(context);
+        gl::ShaderMap<SpirvBlob> spirvBlobs;
+        for (gl::ShaderType shaderType : gl::AllShaderTypes())
+        {
+            if (!mTasks[shaderType])
+            {
+                continue;
+            }
+
+            mWaitableEvents[shaderType]->wait();
+            ANGLE_VK_CHECK(contextVk, mTasks[shaderType]->getResult() == angle::Result::Continue,
+                           VK_ERROR_INVALID_SHADER_NV);
+            spirvBlobs[shaderType] = std::move(mTasks[shaderType]->getSpirvBlob());
+        }
+
+        return mProgram->finishLink(context, std::move(spirvBlobs));
+    }
+
+    bool isLinking() override
+    {
+        for (const std::shared_ptr<angle::WaitableEvent> &waitableEvent : mWaitableEvents)
+        {
+            if (waitableEvent && !waitableEvent->isReady())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    ProgramVk *mProgram;
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerPool;
+    gl::ShaderMap<std::shared_ptr<CompileShaderTask>> mTasks;
+    gl::ShaderMap<std::shared_ptr<angle::WaitableEvent>> mWaitableEvents;
+};
+
 std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
                                            const gl::ProgramLinkedResources &resources,
                                            gl::InfoLog &infoLog,
@@ -273,29 +374,54 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
                                       &mGlslangProgramInterfaceInfo, &shaderSources,
                                       &mExecutable.mVariableInfoMap);
 
-    // Compile the shaders.
-    angle::Result status = mOriginalShaderInfo.initShaders(
-        contextVk, mState.getExecutable().getLinkedShaderStages(), shaderSources, &mExecutable);
+    angle::Result status = initDefaultUniformBlocks(context);
     if (status != angle::Result::Continue)
     {
         return std::make_unique<LinkEventDone>(status);
     }
 
-    status = initDefaultUniformBlocks(context);
-    if (status != angle::Result::Continue)
+    if (contextVk->getFeatures().enablePrecisionQualifiers.enabled)
     {
-        return std::make_unique<LinkEventDone>(status);
+        mExecutable.resolvePrecisionMismatch(mergedVaryings);
     }
 
-    if (contextVk->getFeatures().enablePrecisionQualifiers.enabled)
+    // Compile the shaders.  The stages are independent, so each is compiled by its own task.  The
+    // tasks run synchronously if the application disabled parallel linking with
+    // glMaxShaderCompilerThreadsKHR(0).
+    std::unique_ptr<LinkEventVk> linkEvent =
+        std::make_unique<LinkEventVk>(this, context->getWorkerThreadPool());
+    for (gl::ShaderType shaderType : mState.getExecutable().getLinkedShaderStages())
     {
-        mExecutable.resolvePrecisionMismatch(mergedVaryings);
+        auto task = std::make_shared<CompileShaderTask>(contextVk->getCaps(), shaderType,
+                                                        std::move(shaderSources[shaderType]));
+        linkEvent->postTask(shaderType, std::move(task));
     }
+    return std::move(linkEvent);
+}
 
-    // TODO(jie.a.chen@intel.com): Parallelize linking.
-    // http://crbug.com/849576
-    status = mExecutable.createPipelineLayout(context, nullptr);
-    return std::make_unique<LinkEventDone>(status);
+angle::Result ProgramVk::finishLink(const gl::Context *context,
+                                    gl::ShaderMap<SpirvBlob> &&spirvBlobs)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    mOriginalShaderInfo.initShaders(contextVk, mState.getExecutable().getLinkedShaderStages(),
+                                    std::move(spirvBlobs), &mExecutable);
+
+    ANGLE_TRY(mExecutable.createPipelineLayout(context, nullptr));
+    return warmUpGraphicsPipelines(contextVk);
+}
+
+angle::Result ProgramVk::warmUpGraphicsPipelines(ContextVk *contextVk)
+{
+    // Separable programs are drawn through a program pipeline, whose pipelines are not recorded.
+    if (!contextVk->getFeatures().warmUpGraphicsPipelines.enabled || mState.isSeparable() ||
+        mState.isCompute())
+    {
+        return angle::Result::Continue;
+    }
+
+    mExecutable.initPipelineManifestKey(mOriginalShaderInfo.getSpirvBlobs());
+    return mExecutable.warmUpGraphicsPipelines(contextVk);
 }
 
 void ProgramVk::linkResources(const gl::ProgramLinkedResources &resources)
@@ -537,8 +663,9 @@ void ProgramVk::setUniform1iv(GLint location, GLsizei count, const GLint *v)
     const gl::LinkedUniform &linkedUniform   = mState.getUniforms()[locationInfo.index];
     if (linkedUniform.isSampler())
     {
-        // We could potentially cache some indexing here. For now this is a no-op since the mapping
-        // is handled entirely in ContextVk.
+        // The texture units themselves are handled entirely in ContextVk, but the executable has
+        // to update the binding signature of its textures descriptor set.
+        mExecutable.onSamplerUniformChange();
         return;
     }
 
@@ -716,7 +843,6 @@ angle::Result ProgramVk::updateUniforms(ContextVk *contextVk)
 {
     ASSERT(dirtyUniforms());
 
-    bool anyNewBufferAllocated                = false;
     uint8_t *bufferData                       = nullptr;
     VkDeviceSize bufferOffset                 = 0;
     uint32_t offsetIndex                      = 0;
@@ -724,30 +850,38 @@ angle::Result ProgramVk::updateUniforms(ContextVk *contextVk)
     gl::ShaderMap<VkDeviceSize> offsets;  // offset to the beginning of bufferData
     size_t requiredSpace;
 
+    RendererVk *renderer   = contextVk->getRenderer();
+    const size_t alignment = static_cast<size_t>(
+        renderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
+
     // We usually only update uniform data for shader stages that are actually dirty. But when the
     // buffer for uniform data have switched, because all shader stages are using the same buffer,
     // we then must update uniform data for all shader stages to keep all shader stages' uniform
-    // data in the same buffer.
+    // data in the same buffer.  The streaming buffer may also have been switched by vertex or
+    // index data since the last update.
+    vk::StreamingBuffer *streamingBuffer = contextVk->getStreamingBuffer();
+    vk::BufferHelper *currentBuffer      = streamingBuffer->getCurrentBuffer();
+    if (currentBuffer == nullptr ||
+        mExecutable.getCurrentDefaultUniformBufferSerial() != currentBuffer->getBufferSerial())
+    {
+        setAllDefaultUniformsDirty();
+    }
+
     requiredSpace = calcUniformUpdateRequiredSpace(contextVk, glExecutable, offsets);
     ASSERT(requiredSpace > 0);
 
-    // Allocate space from dynamicBuffer. Always try to allocate from the current buffer first.
-    // If that failed, we deal with fall out and try again.
-    vk::DynamicBuffer *defaultUniformStorage = contextVk->getDefaultUniformStorage();
-    if (!defaultUniformStorage->allocateFromCurrentBuffer(requiredSpace, &bufferData,
-                                                          &bufferOffset))
+    // Always try to allocate from the current buffer first.  If that failed, we deal with fall out
+    // and try again.
+    bool allocated = false;
+    ANGLE_TRY(streamingBuffer->allocateFromCurrentBuffer(contextVk, requiredSpace, alignment,
+                                                         &bufferData, &bufferOffset, &allocated));
+    if (!allocated)
     {
-        for (const gl::ShaderType shaderType : glExecutable.getLinkedShaderStages())
-        {
-            if (!mDefaultUniformBlocks[shaderType].uniformData.empty())
-            {
-                mDefaultUniformBlocksDirty.set(shaderType);
-            }
-        }
+        setAllDefaultUniformsDirty();
 
         requiredSpace = calcUniformUpdateRequiredSpace(contextVk, glExecutable, offsets);
-        ANGLE_TRY(defaultUniformStorage->allocate(contextVk, requiredSpace, &bufferData, nullptr,
-                                                  &bufferOffset, &anyNewBufferAllocated));
+        ANGLE_TRY(streamingBuffer->allocate(contextVk, requiredSpace, alignment, &bufferData,
+                                            nullptr, &bufferOffset, nullptr));
     }
 
     // Update buffer memory by immediate mapping. This immediate update only works once.
@@ -763,9 +897,9 @@ angle::Result ProgramVk::updateUniforms(ContextVk *contextVk)
         }
         ++offsetIndex;
     }
-    ANGLE_TRY(defaultUniformStorage->flush(contextVk));
+    ANGLE_TRY(streamingBuffer->flush(contextVk));
 
-    vk::BufferHelper *defaultUniformBuffer = defaultUniformStorage->getCurrentBuffer();
+    vk::BufferHelper *defaultUniformBuffer = streamingBuffer->getCurrentBuffer();
     if (mExecutable.getCurrentDefaultUniformBufferSerial() !=
         defaultUniformBuffer->getBufferSerial())
     {
@@ -121,6 +121,7 @@ class ProgramVk : public ProgramImpl
     {
         mDefaultUniformBlocksDirty.reset(shaderType);
     }
+    void setAllDefaultUniformsDirty();
     void onProgramBind();
 
     // Used in testing only.
@@ -189,6 +190,12 @@ class ProgramVk : public ProgramImpl
     template <typename T>
     void setUniformImpl(GLint location, GLsizei count, const T *v, GLenum entryPointType);
     void linkResources(const gl::ProgramLinkedResources &resources);
+    angle::Result warmUpGraphicsPipelines(ContextVk *contextVk);
+
+    class CompileShaderTask;
+    class LinkEventVk;
+    // Done when the SPIR-V of every stage is generated.
+    angle::Result finishLink(const gl::Context *context, gl::ShaderMap<SpirvBlob> &&spirvBlobs);
 
     ANGLE_INLINE angle::Result initProgram(ContextVk *contextVk,
                                            const gl::ShaderType shaderType,
@@ -210,8 +217,6 @@ class ProgramVk : public ProgramImpl
         return angle::Result::Continue;
     }
 
-    void setAllDefaultUniformsDirty();
-
     gl::ShaderMap<DefaultUniformBlock> mDefaultUniformBlocks;
     gl::ShaderBitSet mDefaultUniformBlocksDirty;
 
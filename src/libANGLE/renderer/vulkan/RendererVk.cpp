@@ -57,6 +57,10 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
+// Maximum number of graphics pipelines kept alive across all contexts before the least recently
+// used ones are evicted.  Applications rarely need more than a few hundred pipelines per frame,
+// so this is well above any working set while still bounding driver memory.
+constexpr size_t kDefaultGraphicsPipelineBudget = 4096;
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -476,6 +480,9 @@ RendererVk::RendererVk()
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheDirty(false),
       mPipelineCacheInitialized(false),
+      mGraphicsPipelineEvictionCount(0),
+      mGraphicsPipelineCount(0),
+      mGraphicsPipelineBudget(kDefaultGraphicsPipelineBudget),
       mCommandProcessor(this),
       mGlslangInitialized(false)
 {
@@ -537,6 +544,7 @@ void RendererVk::onDestroy(vk::Context *context)
     mPipelineCache.destroy(mDevice);
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mBufferSuballocator.destroy(this);
 
     for (vk::CommandBufferHelper *commandBufferHelper : mCommandBufferHelperFreeList)
     {
@@ -1166,6 +1174,14 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     // Initialize features and workarounds.
     initFeatures(displayVk, deviceExtensionNames);
 
+    // Every feature that posts tasks to the worker threads needs the pool.
+    if (getFeatures().asyncGraphicsPipelineCompilation.enabled ||
+        getFeatures().parallelRenderPassCommandRecording.enabled ||
+        getFeatures().warmUpGraphicsPipelines.enabled || getFeatures().parallelTextureLoad.enabled)
+    {
+        mWorkerThreadPool = angle::WorkerThreadPool::Create(true);
+    }
+
     // Enable VK_EXT_depth_clip_enable, if supported
     if (ExtensionFound(VK_EXT_DEPTH_CLIP_ENABLE_EXTENSION_NAME, deviceExtensionNames))
     {
@@ -1200,6 +1216,11 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         enabledDeviceExtensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
     }
 
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+    }
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     if (getFeatures().supportsAndroidHardwareBuffer.enabled)
     {
@@ -1499,6 +1520,10 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     {
         InitRenderPass2KHRFunctions(mDevice);
     }
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        InitDescriptorUpdateTemplateKHRFunctions(mDevice);
+    }
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
     if (getFeatures().forceMaxUniformBufferSize16KB.enabled)
@@ -1798,6 +1823,10 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsRenderpass2,
         ExtensionFound(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, deviceExtensionNames));
 
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsDescriptorUpdateTemplate,
+        ExtensionFound(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME, deviceExtensionNames));
+
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsIncrementalPresent,
         ExtensionFound(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME, deviceExtensionNames));
@@ -1942,6 +1971,22 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // Currently disabled by default: http://anglebug.com/4324
     ANGLE_FEATURE_CONDITION(&mFeatures, asyncCommandQueue, false);
 
+    // Disabled by default.  Pipeline creation is moved off the draw path at the cost of extra
+    // memory held by pending creation tasks.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGraphicsPipelineCompilation, false);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelRenderPassCommandRecording, false);
+
+    // Disabled by default.  Warming up a program creates pipelines that it may never draw with.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpGraphicsPipelines, false);
+
+    // Disabled by default.  Only texture descriptor sets are written with templates.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useDescriptorUpdateTemplates, false);
+
+    // Disabled by default.  The thread uploading the texture waits for the conversion tasks, which
+    // share the worker thread pool with pipeline creation and program linking.
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelTextureLoad, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsYUVSamplerConversion,
                             mSamplerYcbcrConversionFeatures.samplerYcbcrConversion != VK_FALSE);
 
@@ -2331,21 +2376,7 @@ bool RendererVk::haveSameFormatFeatureBits(VkFormat fmt1, VkFormat fmt2) const
 angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
 {
     std::lock_guard<std::mutex> lock(mGarbageMutex);
-
-    for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
-    {
-        // Possibly 'counter' should be always zero when we add the object to garbage.
-        vk::SharedGarbage &garbage = *garbageIter;
-        if (garbage.destroyIfComplete(this, lastCompletedQueueSerial))
-        {
-            garbageIter = mSharedGarbage.erase(garbageIter);
-        }
-        else
-        {
-            garbageIter++;
-        }
-    }
-
+    mSharedGarbage.cleanup(this, lastCompletedQueueSerial);
     return angle::Result::Continue;
 }
 
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -209,10 +210,12 @@ class RendererVk : angle::NonCopyable
         if (!sharedGarbage.empty())
         {
             std::lock_guard<std::mutex> lock(mGarbageMutex);
-            mSharedGarbage.emplace_back(std::move(use), std::move(sharedGarbage));
+            mSharedGarbage.add(vk::SharedGarbage(std::move(use), std::move(sharedGarbage)));
         }
     }
 
+    egl::Display *getDisplay() const { return mDisplay; }
+
     angle::Result getPipelineCache(vk::PipelineCache **pipelineCache);
     void onNewGraphicsPipeline()
     {
@@ -220,6 +223,36 @@ class RendererVk : angle::NonCopyable
         mPipelineCacheDirty = true;
     }
 
+    const std::shared_ptr<angle::WorkerThreadPool> &getWorkerThreadPool() const
+    {
+        ASSERT(mWorkerThreadPool);
+        return mWorkerThreadPool;
+    }
+
+    // Pipeline eviction invalidates PipelineHelper pointers cached by every context in the share
+    // group, as well as the transitions between pipelines.  Contexts compare this count against
+    // the value they last observed to know when to drop their current pipeline.
+    void onGraphicsPipelinesEvicted() { mGraphicsPipelineEvictionCount++; }
+    uint64_t getGraphicsPipelineEvictionCount() const { return mGraphicsPipelineEvictionCount; }
+
+    // The number of graphics pipelines alive across all contexts is bounded by a renderer-wide
+    // budget.  When a context creates a pipeline while the renderer is over budget, it evicts the
+    // least recently used pipelines of its share group other than the new one (see
+    // ContextVk::trimGraphicsPipelines).
+    void onGraphicsPipelinesCreated(size_t count) { mGraphicsPipelineCount += count; }
+    void onGraphicsPipelinesDestroyed(size_t count)
+    {
+        ASSERT(mGraphicsPipelineCount >= count);
+        mGraphicsPipelineCount -= count;
+    }
+    size_t getGraphicsPipelineCount() const { return mGraphicsPipelineCount; }
+    size_t getGraphicsPipelineBudget() const { return mGraphicsPipelineBudget; }
+    bool isOverGraphicsPipelineBudget() const
+    {
+        return mGraphicsPipelineCount > mGraphicsPipelineBudget;
+    }
+    void setGraphicsPipelineBudgetForTesting(size_t budget) { mGraphicsPipelineBudget = budget; }
+
     void onNewValidationMessage(const std::string &message);
     std::string getAndClearLastValidationMessage(uint32_t *countSinceLastClear);
 
@@ -274,6 +307,7 @@ class RendererVk : angle::NonCopyable
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
     vk::ActiveHandleCounter &getActiveHandleCounts() { return mActiveHandleCounts; }
+    vk::BufferSuballocator &getBufferSuballocator() { return mBufferSuballocator; }
 
     // TODO(jmadill): Remove. b/172704839
     angle::Result waitForCommandProcessorIdle(vk::Context *context)
@@ -409,6 +443,19 @@ class RendererVk : angle::NonCopyable
     bool mPipelineCacheDirty;
     bool mPipelineCacheInitialized;
 
+    // Incremented every time a GraphicsPipelineCache evicts pipelines.
+    std::atomic<uint64_t> mGraphicsPipelineEvictionCount;
+
+    // The number of graphics pipelines in all GraphicsPipelineCaches, and the number above which
+    // pipelines are evicted.
+    std::atomic<size_t> mGraphicsPipelineCount;
+    std::atomic<size_t> mGraphicsPipelineBudget;
+
+    // Worker threads used to create graphics pipelines when asyncGraphicsPipelineCompilation is
+    // enabled, to record render pass commands when parallelRenderPassCommandRecording is enabled,
+    // and to convert texture data when parallelTextureLoad is enabled.
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
+
     // A cache of VkFormatProperties as queried from the device over time.
     mutable std::array<VkFormatProperties, vk::kNumVkFormats> mFormatProperties;
 
@@ -451,6 +498,9 @@ class RendererVk : angle::NonCopyable
     SamplerYcbcrConversionCache mYuvConversionCache;
     vk::ActiveHandleCounter mActiveHandleCounts;
 
+    // Small GL buffers are sub-allocated from blocks shared by all contexts.
+    vk::BufferSuballocator mBufferSuballocator;
+
     // Tracks resource serials.
     vk::ResourceSerialFactory mResourceSerialFactory;
 };
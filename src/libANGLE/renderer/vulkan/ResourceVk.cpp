@@ -9,12 +9,158 @@
 
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include "common/third_party/base/anglebase/no_destructor.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 
 namespace rx
 {
 namespace vk
 {
+namespace
+{
+constexpr size_t kResourceUseSlabSize = 4096;
+// Free objects move between a thread's cache and the shared pool in batches of this size.
+constexpr size_t kResourceUseBatchSize = 256;
+
+union ResourceUseSlot
+{
+    ResourceUseSlot *nextFree;
+    alignas(ResourceUse) unsigned char storage[sizeof(ResourceUse)];
+};
+
+struct ResourceUseFreeList
+{
+    void push(ResourceUseSlot *slot)
+    {
+        slot->nextFree = head;
+        head           = slot;
+        ++count;
+    }
+
+    ResourceUseSlot *pop()
+    {
+        ASSERT(count > 0);
+        ResourceUseSlot *slot = head;
+        head                  = slot->nextFree;
+        --count;
+        return slot;
+    }
+
+    ResourceUseSlot *head = nullptr;
+    size_t count          = 0;
+};
+
+class ResourceUsePool final : angle::NonCopyable
+{
+  public:
+    // Returns a batch of free slots, allocating a new slab if the pool is empty.
+    ResourceUseFreeList acquireBatch()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mBatches.empty())
+        {
+            mSlabs.emplace_back(new ResourceUseSlot[kResourceUseSlabSize]);
+            ResourceUseSlot *slab = mSlabs.back().get();
+            for (size_t start = 0; start < kResourceUseSlabSize; start += kResourceUseBatchSize)
+            {
+                ResourceUseFreeList batch;
+                for (size_t index = start; index < start + kResourceUseBatchSize; ++index)
+                {
+                    batch.push(&slab[index]);
+                }
+                mBatches.push_back(batch);
+            }
+        }
+
+        ResourceUseFreeList batch = mBatches.back();
+        mBatches.pop_back();
+        return batch;
+    }
+
+    void releaseBatch(const ResourceUseFreeList &batch)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBatches.push_back(batch);
+    }
+
+  private:
+    std::mutex mMutex;
+    std::vector<ResourceUseFreeList> mBatches;
+    // Slabs are never freed, since their slots may be cached by any thread.
+    std::vector<std::unique_ptr<ResourceUseSlot[]>> mSlabs;
+};
+
+static_assert(kResourceUseSlabSize % kResourceUseBatchSize == 0, "Slab must hold whole batches");
+
+ResourceUsePool &GetResourceUsePool()
+{
+    static angle::base::NoDestructor<ResourceUsePool> pool;
+    return *pool;
+}
+
+// A thread's free slots.  They go back to the shared pool when the thread exits.
+class ResourceUseCache final : angle::NonCopyable
+{
+  public:
+    ~ResourceUseCache()
+    {
+        if (mFreeList.count > 0)
+        {
+            GetResourceUsePool().releaseBatch(mFreeList);
+            mFreeList = ResourceUseFreeList();
+        }
+    }
+
+    ResourceUseSlot *allocate()
+    {
+        if (mFreeList.count == 0)
+        {
+            mFreeList = GetResourceUsePool().acquireBatch();
+        }
+        return mFreeList.pop();
+    }
+
+    void free(ResourceUseSlot *slot)
+    {
+        mFreeList.push(slot);
+
+        // Keep one batch for this thread and give the rest back, so objects that are allocated on
+        // one thread and freed on another don't pile up.
+        if (mFreeList.count == 2 * kResourceUseBatchSize)
+        {
+            ResourceUseFreeList batch;
+            while (batch.count < kResourceUseBatchSize)
+            {
+                batch.push(mFreeList.pop());
+            }
+            GetResourceUsePool().releaseBatch(batch);
+        }
+    }
+
+  private:
+    ResourceUseFreeList mFreeList;
+};
+
+thread_local ResourceUseCache gResourceUseCache;
+}  // anonymous namespace
+
+ResourceUse *AllocateResourceUse()
+{
+    return new (gResourceUseCache.allocate()->storage) ResourceUse;
+}
+
+void FreeResourceUse(ResourceUse *use)
+{
+    use->~ResourceUse();
+    gResourceUseCache.free(reinterpret_cast<ResourceUseSlot *>(use));
+}
+
 // Resource implementation.
 Resource::Resource()
 {
@@ -80,19 +226,83 @@ SharedGarbage &SharedGarbage::operator=(SharedGarbage &&rhs)
     return *this;
 }
 
-bool SharedGarbage::destroyIfComplete(RendererVk *renderer, Serial completedSerial)
+void SharedGarbage::destroy(RendererVk *renderer)
 {
-    if (mLifetime.isCurrentlyInUse(completedSerial))
-        return false;
-
     for (GarbageObject &object : mGarbage)
     {
         object.destroy(renderer);
     }
 
     mLifetime.release();
+}
+
+// SharedGarbageList implementation.
+SharedGarbageList::SharedGarbageList() = default;
+
+SharedGarbageList::~SharedGarbageList()
+{
+    ASSERT(empty());
+}
+
+void SharedGarbageList::add(SharedGarbage &&garbage)
+{
+    if (garbage.usedInRecordedCommands())
+    {
+        mPendingGarbage.emplace_back(std::move(garbage));
+    }
+    else
+    {
+        addToBucket(std::move(garbage));
+    }
+}
+
+void SharedGarbageList::addToBucket(SharedGarbage &&garbage)
+{
+    ASSERT(!garbage.usedInRecordedCommands());
+    const Serial serial = garbage.getSerial();
+
+    // Serials mostly grow, so the garbage usually goes in a new bucket at the end.
+    auto iter = mBuckets.end();
+    if (!mBuckets.empty() && serial <= mBuckets.back().serial)
+    {
+        iter = std::lower_bound(
+            mBuckets.begin(), mBuckets.end(), serial,
+            [](const Bucket &bucket, Serial value) { return bucket.serial < value; });
+    }
+
+    if (iter == mBuckets.end() || iter->serial.getValue() != serial.getValue())
+    {
+        iter         = mBuckets.emplace(iter);
+        iter->serial = serial;
+    }
+
+    iter->garbage.emplace_back(std::move(garbage));
+}
 
-    return true;
+void SharedGarbageList::cleanup(RendererVk *renderer, Serial completedSerial)
+{
+    // Garbage whose commands were flushed since the last cleanup now has its final serial.
+    for (size_t index = 0; index < mPendingGarbage.size();)
+    {
+        if (mPendingGarbage[index].usedInRecordedCommands())
+        {
+            ++index;
+            continue;
+        }
+
+        addToBucket(std::move(mPendingGarbage[index]));
+        mPendingGarbage[index] = std::move(mPendingGarbage.back());
+        mPendingGarbage.pop_back();
+    }
+
+    while (!mBuckets.empty() && mBuckets.front().serial <= completedSerial)
+    {
+        for (SharedGarbage &garbage : mBuckets.front().garbage)
+        {
+            garbage.destroy(renderer);
+        }
+        mBuckets.pop_front();
+    }
 }
 
 // ResourceUseList implementation.
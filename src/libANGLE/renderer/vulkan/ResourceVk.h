@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RESOURCEVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RESOURCEVK_H_
 
+#include <deque>
+
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -31,6 +33,12 @@ struct ResourceUse
     Serial serial;
 };
 
+// ResourceUse objects are allocated from slabs shared by all renderers and recycled, since a
+// ResourceUse is created and destroyed with every resource.  Each thread caches a batch of free
+// objects, so most allocations and frees don't take a lock.
+ResourceUse *AllocateResourceUse();
+void FreeResourceUse(ResourceUse *use);
+
 class SharedResourceUse final : angle::NonCopyable
 {
   public:
@@ -48,7 +56,7 @@ class SharedResourceUse final : angle::NonCopyable
     void init()
     {
         ASSERT(!mUse);
-        mUse = new ResourceUse;
+        mUse = AllocateResourceUse();
         mUse->counter++;
     }
 
@@ -61,7 +69,7 @@ class SharedResourceUse final : angle::NonCopyable
         ASSERT(mUse->counter > 0);
         if (--mUse->counter == 0)
         {
-            delete mUse;
+            FreeResourceUse(mUse);
         }
         mUse = nullptr;
     }
@@ -122,14 +130,45 @@ class SharedGarbage
     ~SharedGarbage();
     SharedGarbage &operator=(SharedGarbage &&rhs);
 
-    bool destroyIfComplete(RendererVk *renderer, Serial completedSerial);
+    void destroy(RendererVk *renderer);
+
+    // The serial of the last use is only final once no unflushed commands reference the garbage.
+    bool usedInRecordedCommands() const { return mLifetime.usedInRecordedCommands(); }
+    Serial getSerial() const { return mLifetime.getSerial(); }
 
   private:
     SharedResourceUse mLifetime;
     std::vector<GarbageObject> mGarbage;
 };
 
-using SharedGarbageList = std::vector<SharedGarbage>;
+// Garbage is kept in buckets ordered by the serial of its last use, so that retiring garbage only
+// touches the buckets whose serial has completed.  Garbage that is still referenced by unflushed
+// commands waits in a separate list until its serial is known.
+class SharedGarbageList final : angle::NonCopyable
+{
+  public:
+    SharedGarbageList();
+    ~SharedGarbageList();
+
+    bool empty() const { return mBuckets.empty() && mPendingGarbage.empty(); }
+
+    void add(SharedGarbage &&garbage);
+
+    // Destroys all garbage that is no longer in use.
+    void cleanup(RendererVk *renderer, Serial completedSerial);
+
+  private:
+    struct Bucket
+    {
+        Serial serial;
+        std::vector<SharedGarbage> garbage;
+    };
+
+    void addToBucket(SharedGarbage &&garbage);
+
+    std::deque<Bucket> mBuckets;
+    std::vector<SharedGarbage> mPendingGarbage;
+};
 
 // Mixin to abstract away the resource use tracking.
 class ResourceUseList final : angle::NonCopyable
@@ -8,6 +8,9 @@
 //
 
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 #include "libANGLE/trace.h"
@@ -20,6 +23,70 @@ namespace priv
 {
 namespace
 {
+// Whether two state-setting commands set the same piece of state, so that the later one replaces
+// the earlier one.
+bool IsSameState(const CommandHeader *first, const CommandHeader *second)
+{
+    if (first->id != second->id)
+    {
+        return false;
+    }
+
+    switch (first->id)
+    {
+        case CommandID::BindDescriptorSets:
+            return Offset<BindDescriptorSetParams>(first, sizeof(CommandHeader))->firstSet ==
+                   Offset<BindDescriptorSetParams>(second, sizeof(CommandHeader))->firstSet;
+        case CommandID::PushConstants:
+        {
+            const PushConstantsParams *firstParams =
+                Offset<PushConstantsParams>(first, sizeof(CommandHeader));
+            const PushConstantsParams *secondParams =
+                Offset<PushConstantsParams>(second, sizeof(CommandHeader));
+            return firstParams->flag == secondParams->flag &&
+                   firstParams->offset == secondParams->offset;
+        }
+        default:
+            return true;
+    }
+}
+
+void UpdateStateCommands(const CommandHeader *command,
+                         std::vector<const CommandHeader *> *stateCommands)
+{
+    for (auto iter = stateCommands->begin(); iter != stateCommands->end(); ++iter)
+    {
+        if (IsSameState(*iter, command))
+        {
+            stateCommands->erase(iter);
+            break;
+        }
+    }
+    stateCommands->push_back(command);
+}
+
+// Copy the commands into a single block terminated by CommandID::Invalid.
+void CopyStateCommands(const std::vector<const CommandHeader *> &stateCommands,
+                       std::vector<uint32_t> *blockOut)
+{
+    size_t byteSize = sizeof(CommandHeader);
+    for (const CommandHeader *command : stateCommands)
+    {
+        ASSERT((command->size % sizeof(uint32_t)) == 0);
+        byteSize += command->size;
+    }
+
+    blockOut->assign(byteSize / sizeof(uint32_t), 0);
+    uint8_t *writePointer = reinterpret_cast<uint8_t *>(blockOut->data());
+    for (const CommandHeader *command : stateCommands)
+    {
+        memcpy(writePointer, command, command->size);
+        writePointer += command->size;
+    }
+
+    static_assert(static_cast<uint16_t>(CommandID::Invalid) == 0, "Terminator must be zero");
+}
+
 const char *GetCommandString(CommandID id)
 {
     switch (id)
@@ -136,6 +203,152 @@ ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
                                                    command->size);
 }
 
+// CommandBlockAllocator implementation.
+CommandBlockAllocator::CommandBlockAllocator()
+    : mPool(nullptr), mRetainedBytes(0), mNewBlockCount(0)
+{}
+
+CommandBlockAllocator::~CommandBlockAllocator() = default;
+
+void CommandBlockAllocator::initialize(angle::PoolAllocator *pool)
+{
+    ASSERT(pool);
+    ASSERT(mUsedBlocks.empty());
+    mPool = pool;
+}
+
+void CommandBlockAllocator::release()
+{
+    // The blocks belong to the pool, which frees them when it is destroyed.
+    mPool = nullptr;
+    for (std::vector<uint8_t *> &freeBlocks : mFreeBlocks)
+    {
+        freeBlocks.clear();
+    }
+    mFreeLargeBlocks.clear();
+    mUsedBlocks.clear();
+    mRetainedBytes = 0;
+    mNewBlockCount = 0;
+}
+
+uint8_t *CommandBlockAllocator::allocate(size_t blockIndex, size_t minSize, size_t *blockSizeOut)
+{
+    ASSERT(mPool);
+
+    // Grow geometrically with the number of blocks in the recording, but skip to a larger size if
+    // the command doesn't fit.
+    size_t sizeClass = std::min(blockIndex, kBlockSizeClassCount - 1);
+    while (sizeClass < kBlockSizeClassCount && GetBlockSize(sizeClass) < minSize)
+    {
+        ++sizeClass;
+    }
+
+    Block block = {};
+    if (sizeClass < kBlockSizeClassCount)
+    {
+        block.size                         = GetBlockSize(sizeClass);
+        std::vector<uint8_t *> &freeBlocks = mFreeBlocks[sizeClass];
+        if (freeBlocks.empty())
+        {
+            block.data = allocateFromPool(block.size);
+        }
+        else
+        {
+            block.data = freeBlocks.back();
+            freeBlocks.pop_back();
+        }
+    }
+    else
+    {
+        // Use the smallest free large block that fits.
+        auto bestFit = mFreeLargeBlocks.end();
+        for (auto iter = mFreeLargeBlocks.begin(); iter != mFreeLargeBlocks.end(); ++iter)
+        {
+            if (iter->size >= minSize && (bestFit == mFreeLargeBlocks.end() ||
+                                          iter->size < bestFit->size))
+            {
+                bestFit = iter;
+            }
+        }
+
+        if (bestFit == mFreeLargeBlocks.end())
+        {
+            // Make sure allocation is 4-byte aligned
+            block.size = roundUpPow2<size_t>(minSize, 4);
+            block.data = allocateFromPool(block.size);
+        }
+        else
+        {
+            block = *bestFit;
+            mFreeLargeBlocks.erase(bestFit);
+        }
+    }
+
+    mUsedBlocks.push_back(block);
+    *blockSizeOut = block.size;
+    return block.data;
+}
+
+void CommandBlockAllocator::releaseBlocks()
+{
+    ASSERT(mPool);
+
+    size_t usedBytes = 0;
+    for (const Block &block : mUsedBlocks)
+    {
+        usedBytes += block.size;
+    }
+
+    // If the last recording needed only a fraction of what is kept around, for example after a
+    // one-off heavy render pass, start over so the pool can hand out its pages again.
+    if (mRetainedBytes > kMaxRetainedBytes && usedBytes * 4 < mRetainedBytes)
+    {
+        for (std::vector<uint8_t *> &freeBlocks : mFreeBlocks)
+        {
+            freeBlocks.clear();
+        }
+        mFreeLargeBlocks.clear();
+        mUsedBlocks.clear();
+        mRetainedBytes = 0;
+        mNewBlockCount = 0;
+
+        mPool->pop();
+        mPool->push();
+        return;
+    }
+
+    for (const Block &block : mUsedBlocks)
+    {
+        if (block.size > kMaxBlockSize)
+        {
+            mFreeLargeBlocks.push_back(block);
+            continue;
+        }
+
+        size_t sizeClass = 0;
+        while (GetBlockSize(sizeClass) != block.size)
+        {
+            ++sizeClass;
+            ASSERT(sizeClass < kBlockSizeClassCount);
+        }
+        mFreeBlocks[sizeClass].push_back(block.data);
+    }
+    mUsedBlocks.clear();
+    mNewBlockCount = 0;
+}
+
+uint8_t *CommandBlockAllocator::allocateFromPool(size_t size)
+{
+    ++mNewBlockCount;
+    mRetainedBytes += size;
+    // fastAllocate() can't make multi-page allocations, which large blocks may need.
+    if (size > kMaxBlockSize)
+    {
+        return reinterpret_cast<uint8_t *>(mPool->allocate(size));
+    }
+    return mPool->fastAllocate(size);
+}
+
 // Add any queued resetQueryPool commands to the given cmdBuffer
 void SecondaryCommandBuffer::executeQueuedResetQueryPoolCommands(VkCommandBuffer cmdBuffer)
 {
@@ -150,9 +363,90 @@ void SecondaryCommandBuffer::executeQueuedResetQueryPoolCommands(VkCommandBuffer
 void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeCommands");
-    for (const CommandHeader *command : mCommands)
+    executeCommandBlocks(cmdBuffer, mCommands.data(), mCommands.size());
+}
+
+bool SecondaryCommandBuffer::splitIntoChunks(size_t maxChunkCount,
+                                             std::vector<CommandChunk> *chunksOut)
+{
+    ASSERT(maxChunkCount > 0);
+    const size_t blockCount    = mCommands.size();
+    const size_t bytesPerChunk = (getCommandSize() + maxChunkCount - 1) / maxChunkCount;
+
+    // The latest state-setting command of each kind, in recording order.
+    std::vector<const CommandHeader *> stateCommands;
+
+    // Blocks grow in size as the recording goes on, so balance the chunks by the size of the
+    // commands in them rather than by the number of blocks.
+    size_t chunkBytes = 0;
+
+    chunksOut->clear();
+    for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
     {
-        for (const CommandHeader *currentCommand                      = command;
+        if (chunksOut->empty() ||
+            (chunkBytes >= bytesPerChunk && chunksOut->size() < maxChunkCount))
+        {
+            chunksOut->emplace_back();
+            CommandChunk &chunk = chunksOut->back();
+            chunk.firstBlock    = blockIndex;
+            chunk.blockCount    = 0;
+            CopyStateCommands(stateCommands, &chunk.stateCommands);
+            chunkBytes = 0;
+        }
+        chunksOut->back().blockCount++;
+
+        const CommandHeader *command = mCommands[blockIndex];
+        for (; command->id != CommandID::Invalid; command = NextCommand(command))
+        {
+            switch (command->id)
+            {
+                case CommandID::BeginDebugUtilsLabel:
+                case CommandID::BeginQuery:
+                case CommandID::BeginTransformFeedback:
+                case CommandID::BindTransformFeedbackBuffers:
+                case CommandID::EndDebugUtilsLabel:
+                case CommandID::EndQuery:
+                case CommandID::EndTransformFeedback:
+                case CommandID::NextSubpass:
+                    return false;
+                case CommandID::BindDescriptorSets:
+                case CommandID::BindGraphicsPipeline:
+                case CommandID::BindIndexBuffer:
+                case CommandID::BindVertexBuffers:
+                case CommandID::PushConstants:
+                case CommandID::SetScissor:
+                    UpdateStateCommands(command, &stateCommands);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        chunkBytes += reinterpret_cast<const uint8_t *>(command) -
+                      reinterpret_cast<const uint8_t *>(mCommands[blockIndex]);
+    }
+
+    return true;
+}
+
+void SecondaryCommandBuffer::executeChunk(VkCommandBuffer cmdBuffer, const CommandChunk &chunk)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeChunk");
+    ASSERT(chunk.firstBlock + chunk.blockCount <= mCommands.size());
+
+    const CommandHeader *stateCommands =
+        reinterpret_cast<const CommandHeader *>(chunk.stateCommands.data());
+    executeCommandBlocks(cmdBuffer, &stateCommands, 1);
+    executeCommandBlocks(cmdBuffer, mCommands.data() + chunk.firstBlock, chunk.blockCount);
+}
+
+void SecondaryCommandBuffer::executeCommandBlocks(VkCommandBuffer cmdBuffer,
+                                                  const CommandHeader *const *blocks,
+                                                  size_t blockCount)
+{
+    for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+    {
+        for (const CommandHeader *currentCommand                      = blocks[blockIndex];
              currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
         {
             switch (currentCommand->id)
@@ -597,7 +891,7 @@ void SecondaryCommandBuffer::executeCommands(VkCommandBuffer cmdBuffer)
 void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
                                                  size_t *allocatedMemoryOut) const
 {
-    *allocatedMemoryOut = kBlockSize * mCommands.size();
+    *allocatedMemoryOut = mAllocatedBytes;
 
     *usedMemoryOut = 0;
     for (const CommandHeader *command : mCommands)
@@ -615,6 +909,15 @@ void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     ASSERT(*usedMemoryOut <= *allocatedMemoryOut);
 }
 
+void SecondaryCommandBuffer::getRecordingStats(size_t *bytesRecordedOut,
+                                               size_t *blocksUsedOut,
+                                               size_t *newBlocksOut) const
+{
+    *bytesRecordedOut = mAllocatedBytes - mWastedBytes - mCurrentBytesRemaining;
+    *blocksUsedOut    = mCommands.size();
+    *newBlocksOut     = mBlockAllocator.getNewBlockCount();
+}
+
 std::string SecondaryCommandBuffer::dumpCommands(const char *separator) const
 {
     std::stringstream result;
@@ -462,6 +462,75 @@ ANGLE_INLINE const DestT *Offset(const T *ptr, size_t bytes)
     return reinterpret_cast<const DestT *>((reinterpret_cast<const uint8_t *>(ptr) + bytes));
 }
 
+// A range of command blocks that is replayed into its own Vulkan secondary command buffer.  Vulkan
+// secondary command buffers don't inherit state from each other, so each chunk carries a copy of
+// the state-setting commands recorded before it, terminated by CommandID::Invalid.
+struct CommandChunk
+{
+    size_t firstBlock;
+    size_t blockCount;
+    std::vector<uint32_t> stateCommands;
+};
+
+// Hands out the blocks that a SecondaryCommandBuffer records commands into.  Within a recording,
+// each new block is twice the size of the previous one up to kMaxBlockSize, so light command
+// buffers don't waste most of a large block and heavy ones don't allocate hundreds of small ones.
+// Blocks are carved out of a pool allocator, but are put on per-size free lists when the command
+// buffer is reset rather than returned to the pool, so recording similar amounts of commands
+// frame after frame doesn't allocate at all.
+class CommandBlockAllocator final : angle::NonCopyable
+{
+  public:
+    // Pool Alloc uses 16kB pages w/ 16byte header = 16368bytes. To minimize waste
+    //  using a 16368/12 = 1364. Also better perf than 1024 due to fewer block allocations
+    static constexpr size_t kMinBlockSize        = 1364;
+    static constexpr size_t kBlockSizeClassCount = 4;
+    static constexpr size_t kMaxBlockSize        = kMinBlockSize << (kBlockSizeClassCount - 1);
+    // Make sure block size is 4-byte aligned to avoid Android errors
+    static_assert((kMinBlockSize % 4) == 0, "Check kMinBlockSize alignment");
+
+    // If more than this much memory is kept around, and most of it wasn't needed by the last
+    // recording, the free lists are dropped and the pool is rewound.
+    static constexpr size_t kMaxRetainedBytes = 1024 * 1024;
+
+    CommandBlockAllocator();
+    ~CommandBlockAllocator();
+
+    // The pool must have a scope pushed that only this allocator allocates from.
+    void initialize(angle::PoolAllocator *pool);
+    void release();
+    bool valid() const { return mPool != nullptr; }
+
+    // Return a block of at least |minSize| bytes for the |blockIndex|th block of the current
+    // recording.
+    uint8_t *allocate(size_t blockIndex, size_t minSize, size_t *blockSizeOut);
+    // Put all blocks handed out since the last call on the free lists.
+    void releaseBlocks();
+
+    // Number of blocks handed out since the last releaseBlocks() that had to be allocated from the
+    // pool rather than recycled.
+    size_t getNewBlockCount() const { return mNewBlockCount; }
+
+  private:
+    struct Block
+    {
+        uint8_t *data;
+        size_t size;
+    };
+
+    static constexpr size_t GetBlockSize(size_t sizeClass) { return kMinBlockSize << sizeClass; }
+
+    uint8_t *allocateFromPool(size_t size);
+
+    angle::PoolAllocator *mPool;
+    std::array<std::vector<uint8_t *>, kBlockSizeClassCount> mFreeBlocks;
+    // Blocks larger than kMaxBlockSize, only needed by unusually large commands.
+    std::vector<Block> mFreeLargeBlocks;
+    std::vector<Block> mUsedBlocks;
+    size_t mRetainedBytes;
+    size_t mNewBlockCount;
+};
+
 class SecondaryCommandBuffer final : angle::NonCopyable
 {
   public:
@@ -492,6 +561,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                             const uint32_t *dynamicOffsets);
 
     void bindGraphicsPipeline(const Pipeline &pipeline);
+    // Records a pipeline bind whose handle is not known yet.  The returned handle must be written
+    // before the command buffer is executed.
+    VkPipeline *bindGraphicsPipelineDeferred();
 
     void bindIndexBuffer(const Buffer &buffer, VkDeviceSize offset, VkIndexType indexType);
 
@@ -670,31 +742,37 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     // Parse the cmds in this cmd buffer into given primary cmd buffer for execution
     void executeCommands(VkCommandBuffer cmdBuffer);
+
+    // Split the commands into at most |maxChunkCount| chunks that can be replayed independently,
+    // possibly on different threads.  Returns false if the commands cannot be split, for example
+    // because they contain queries or transform feedback, which cannot span command buffers.
+    bool splitIntoChunks(size_t maxChunkCount, std::vector<CommandChunk> *chunksOut);
+    // Replay a chunk into a Vulkan secondary command buffer.  Can be called from any thread, as
+    // long as no commands are being added.
+    void executeChunk(VkCommandBuffer cmdBuffer, const CommandChunk &chunk);
     // If resetQueryPoolCommands are queued, call this to execute them all
     //  This should only be called on a cmdBuffer without an active renderPass
     void executeQueuedResetQueryPoolCommands(VkCommandBuffer cmdBuffer);
 
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
+    // Cheaper statistics about the commands recorded since the last reset, for perf counters.
+    // New blocks are those that had to be allocated rather than recycled from a previous recording.
+    void getRecordingStats(size_t *bytesRecordedOut,
+                           size_t *blocksUsedOut,
+                           size_t *newBlocksOut) const;
 
     // Traverse the list of commands and build a summary for diagnostics.
     std::string dumpCommands(const char *separator) const;
 
-    // Pool Alloc uses 16kB pages w/ 16byte header = 16368bytes. To minimize waste
-    //  using a 16368/12 = 1364. Also better perf than 1024 due to fewer block allocations
-    static constexpr size_t kBlockSize = 1364;
-    // Make sure block size is 4-byte aligned to avoid Android errors
-    static_assert((kBlockSize % 4) == 0, "Check kBlockSize alignment");
-
-    // Initialize the SecondaryCommandBuffer by setting the allocator it will use
+    // Initialize the SecondaryCommandBuffer by setting the allocator it will use.  The allocator
+    // must have a scope pushed that is only used by this command buffer.
     void initialize(angle::PoolAllocator *allocator)
     {
         ASSERT(allocator);
         ASSERT(mCommands.empty());
-        mAllocator = allocator;
-        allocateNewBlock();
-        // Set first command to Invalid to start
-        reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
+        mBlockAllocator.initialize(allocator);
+        startRecording();
     }
 
     void open() { mIsOpen = true; }
@@ -703,14 +781,15 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     void reset()
     {
         mCommands.clear();
-        initialize(mAllocator);
+        mBlockAllocator.releaseBlocks();
+        startRecording();
         mResetQueryQueue.clear();
     }
 
     // This will cause the SecondaryCommandBuffer to become invalid by clearing its allocator
-    void releaseHandle() { mAllocator = nullptr; }
+    void releaseHandle() { mBlockAllocator.release(); }
     // The SecondaryCommandBuffer is valid if it's been initialized
-    bool valid() const { return mAllocator != nullptr; }
+    bool valid() const { return mBlockAllocator.valid(); }
 
     static bool CanKnowIfEmpty() { return true; }
     bool empty() const { return mCommands.size() == 0 || mCommands[0]->id == CommandID::Invalid; }
@@ -718,12 +797,16 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     uint32_t getCommandSize() const
     {
         ASSERT(mCommands.size() > 0 || mCurrentBytesRemaining == 0);
-        uint32_t rtn =
-            static_cast<uint32_t>((mCommands.size() * kBlockSize) - mCurrentBytesRemaining);
+        uint32_t rtn = static_cast<uint32_t>(mAllocatedBytes - mCurrentBytesRemaining);
         return rtn;
     }
 
   private:
+    // Replay |blockCount| blocks of commands, each terminated by CommandID::Invalid.
+    void executeCommandBlocks(VkCommandBuffer cmdBuffer,
+                              const CommandHeader *const *blocks,
+                              size_t blockCount);
+
     void commonDebugUtilsLabel(CommandID cmd, const VkDebugUtilsLabelEXT &label);
     template <class StructType>
     ANGLE_INLINE StructType *commonInit(CommandID cmdID, size_t allocationSize)
@@ -741,11 +824,24 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
         return Offset<StructType>(header, sizeof(CommandHeader));
     }
-    ANGLE_INLINE void allocateNewBlock(size_t blockSize = kBlockSize)
+    void startRecording()
     {
-        ASSERT(mAllocator);
-        mCurrentWritePointer   = mAllocator->fastAllocate(blockSize);
-        mCurrentBytesRemaining = blockSize;
+        mAllocatedBytes        = 0;
+        mWastedBytes           = 0;
+        mCurrentBytesRemaining = 0;
+        allocateNewBlock();
+        // Set first command to Invalid to start
+        reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
+    }
+    // Start a new block that can hold at least |requiredSize| bytes.  Whatever is left of the
+    // current block is wasted.
+    ANGLE_INLINE void allocateNewBlock(size_t requiredSize = 0)
+    {
+        ASSERT(mBlockAllocator.valid());
+        mWastedBytes += mCurrentBytesRemaining;
+        mCurrentWritePointer =
+            mBlockAllocator.allocate(mCommands.size(), requiredSize, &mCurrentBytesRemaining);
+        mAllocatedBytes += mCurrentBytesRemaining;
         mCommands.push_back(reinterpret_cast<CommandHeader *>(mCurrentWritePointer));
     }
 
@@ -763,16 +859,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         const size_t requiredSize = allocationSize + sizeof(CommandHeader);
         if (mCurrentBytesRemaining < requiredSize)
         {
-            // variable size command can potentially exceed default cmd allocation blockSize
-            if (requiredSize <= kBlockSize)
-                allocateNewBlock();
-            else
-            {
-                // Make sure allocation is 4-byte aligned
-                const size_t alignedSize = roundUpPow2<size_t>(requiredSize, 4);
-                ASSERT((alignedSize % 4) == 0);
-                allocateNewBlock(alignedSize);
-            }
+            // variable size command can potentially exceed the size of the next block, in which
+            // case the block allocator hands out a larger one
+            allocateNewBlock(requiredSize);
         }
         *variableDataPtr = Offset<uint8_t>(mCurrentWritePointer, fixedAllocationSize);
         return commonInit<StructType>(cmdID, allocationSize);
@@ -788,7 +877,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         // Make sure we have enough room to mark follow-on header "Invalid"
         if (mCurrentBytesRemaining < (allocationSize + sizeof(CommandHeader)))
         {
-            ASSERT((allocationSize + sizeof(CommandHeader)) < kBlockSize);
+            ASSERT((allocationSize + sizeof(CommandHeader)) < CommandBlockAllocator::kMinBlockSize);
             allocateNewBlock();
         }
         return commonInit<StructType>(cmdID, allocationSize);
@@ -816,18 +905,26 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     std::vector<CommandHeader *> mCommands;
 
-    // Allocator used by this class. If non-null then the class is valid.
-    angle::PoolAllocator *mAllocator;
+    // Allocator used by this class. If initialized then the class is valid.
+    CommandBlockAllocator mBlockAllocator;
 
     uint8_t *mCurrentWritePointer;
     size_t mCurrentBytesRemaining;
+    // Total size of the blocks in mCommands, and how much of it was left unused at the end of
+    // blocks that are full.
+    size_t mAllocatedBytes;
+    size_t mWastedBytes;
     // resetQueryPool command must be executed outside RP so we queue them up for
     //  an inside RenderPass command buffer and pre-prend them to the commands
     std::vector<ResetQueryPoolParams> mResetQueryQueue;
 };
 
 ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer()
-    : mIsOpen(true), mAllocator(nullptr), mCurrentWritePointer(nullptr), mCurrentBytesRemaining(0)
+    : mIsOpen(true),
+      mCurrentWritePointer(nullptr),
+      mCurrentBytesRemaining(0),
+      mAllocatedBytes(0),
+      mWastedBytes(0)
 {}
 
 ANGLE_INLINE SecondaryCommandBuffer::~SecondaryCommandBuffer() {}
@@ -881,6 +978,14 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindComputePipeline(const Pipeline &pi
     paramStruct->pipeline = pipeline.getHandle();
 }
 
+ANGLE_INLINE VkPipeline *SecondaryCommandBuffer::bindGraphicsPipelineDeferred()
+{
+    BindPipelineParams *paramStruct =
+        initCommand<BindPipelineParams>(CommandID::BindGraphicsPipeline);
+    paramStruct->pipeline = VK_NULL_HANDLE;
+    return &paramStruct->pipeline;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayout &layout,
                                                              VkPipelineBindPoint pipelineBindPoint,
                                                              DescriptorSetIndex firstSet,
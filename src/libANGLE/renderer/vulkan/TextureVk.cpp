@@ -1645,7 +1645,7 @@ angle::Result TextureVk::copyBufferDataToImage(ContextVk *contextVk,
     ASSERT((aspectFlags & kDepthStencilAspects) != kDepthStencilAspects);
 
     VkBufferImageCopy region           = {};
-    region.bufferOffset                = offset;
+    region.bufferOffset                = srcBuffer->getOffset() + offset;
     region.bufferRowLength             = rowLength;
     region.bufferImageHeight           = imageHeight;
     region.imageExtent.width           = sourceArea.width;
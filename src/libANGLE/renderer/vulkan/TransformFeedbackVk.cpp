@@ -58,8 +58,9 @@ void TransformFeedbackVk::initializeXFBBuffersDesc(ContextVk *contextVk, size_t
 
         if (bufferVk->isBufferValid())
         {
-            mBufferHelpers[bufferIndex] = &bufferVk->getBuffer();
-            mBufferOffsets[bufferIndex] = binding.getOffset();
+            vk::BufferHelper &buffer    = bufferVk->getBuffer();
+            mBufferHelpers[bufferIndex] = &buffer;
+            mBufferOffsets[bufferIndex] = buffer.getOffset() + binding.getOffset();
             mBufferSizes[bufferIndex]   = gl::GetBoundBufferAvailableSize(binding);
         }
         else
@@ -24,7 +24,6 @@ namespace rx
 {
 namespace
 {
-constexpr size_t kDynamicVertexDataSize   = 1024 * 1024;
 constexpr size_t kDynamicIndexDataSize    = 1024 * 8;
 constexpr size_t kDynamicIndirectDataSize = sizeof(VkDrawIndexedIndirectCommand) * 8;
 
@@ -50,7 +49,7 @@ ANGLE_INLINE bool BindingIsAligned(const gl::VertexBinding &binding,
 }
 
 angle::Result StreamVertexData(ContextVk *contextVk,
-                               vk::DynamicBuffer *dynamicBuffer,
+                               vk::StreamingBuffer *streamingBuffer,
                                const uint8_t *sourceData,
                                size_t bytesToAllocate,
                                size_t destOffset,
@@ -63,9 +62,8 @@ angle::Result StreamVertexData(ContextVk *contextVk,
                                uint32_t replicateCount)
 {
     uint8_t *dst = nullptr;
-    ANGLE_TRY(dynamicBuffer->allocate(contextVk, bytesToAllocate, &dst, nullptr, bufferOffsetOut,
-                                      nullptr));
-    *bufferOut = dynamicBuffer->getCurrentBuffer();
+    ANGLE_TRY(streamingBuffer->allocate(contextVk, bytesToAllocate, vk::kVertexBufferAlignment,
+                                        &dst, bufferOut, bufferOffsetOut, nullptr));
     dst += destOffset;
     if (replicateCount == 1)
     {
@@ -87,7 +85,7 @@ angle::Result StreamVertexData(ContextVk *contextVk,
         }
     }
 
-    ANGLE_TRY(dynamicBuffer->flush(contextVk));
+    ANGLE_TRY(streamingBuffer->flush(contextVk));
     return angle::Result::Continue;
 }
 
@@ -129,9 +127,6 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
     mCurrentArrayBufferRelativeOffsets.fill(0);
     mCurrentArrayBuffers.fill(&emptyBuffer);
 
-    mDynamicVertexData.init(renderer, vk::kVertexBufferUsageFlags, vk::kVertexBufferAlignment,
-                            kDynamicVertexDataSize, true);
-
     // We use an alignment of four for index data. This ensures that compute shaders can read index
     // elements from "uint" aligned addresses.
     mDynamicIndexData.init(renderer, vk::kIndexBufferUsageFlags, vk::kIndexBufferAlignment,
@@ -150,7 +145,6 @@ void VertexArrayVk::destroy(const gl::Context *context)
 
     RendererVk *renderer = contextVk->getRenderer();
 
-    mDynamicVertexData.release(renderer);
     mDynamicIndexData.release(renderer);
     mTranslatedByteIndexData.release(renderer);
     mTranslatedByteIndirectData.release(renderer);
@@ -287,15 +281,26 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
 {
     ASSERT(!mState.getElementArrayBuffer() || indexType == gl::DrawElementsType::UnsignedByte);
 
-    mDynamicIndexData.releaseInFlightBuffers(contextVk);
-
     size_t elementSize  = contextVk->getVkIndexTypeSize(indexType);
     const size_t amount = elementSize * indexCount;
     GLubyte *dst        = nullptr;
 
-    ANGLE_TRY(mDynamicIndexData.allocate(contextVk, amount, &dst, nullptr,
-                                         &mCurrentElementArrayBufferOffset, nullptr));
-    mCurrentElementArrayBuffer = mDynamicIndexData.getCurrentBuffer();
+    // Client indices are converted again for every draw call, so they are streamed.  Converted
+    // element array buffers are kept across draw calls.
+    const bool streamIndices = mState.getElementArrayBuffer() == nullptr;
+    if (streamIndices)
+    {
+        ANGLE_TRY(contextVk->getStreamingBuffer()->allocate(
+            contextVk, amount, vk::kIndexBufferAlignment, &dst, &mCurrentElementArrayBuffer,
+            &mCurrentElementArrayBufferOffset, nullptr));
+    }
+    else
+    {
+        mDynamicIndexData.releaseInFlightBuffers(contextVk);
+        ANGLE_TRY(mDynamicIndexData.allocate(contextVk, amount, &dst, nullptr,
+                                             &mCurrentElementArrayBufferOffset, nullptr));
+        mCurrentElementArrayBuffer = mDynamicIndexData.getCurrentBuffer();
+    }
     if (contextVk->shouldConvertUint8VkIndexType(indexType))
     {
         // Unsigned bytes don't have direct support in Vulkan so we have to expand the
@@ -335,6 +340,11 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
         // so there's no need to perform any conversion.
         memcpy(dst, sourcePointer, amount);
     }
+
+    if (streamIndices)
+    {
+        return contextVk->getStreamingBuffer()->flush(contextVk);
+    }
     return mDynamicIndexData.flush(contextVk);
 }
 
@@ -636,8 +646,10 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
 
                     // Vulkan requires the offset is within the buffer. We use robust access
                     // behaviour to reset the offset if it starts outside the buffer.
-                    mCurrentArrayBufferOffsets[attribIndex] =
+                    const VkDeviceSize bindingOffset =
                         binding.getOffset() < bufferVk->getSize() ? binding.getOffset() : 0;
+                    mCurrentArrayBufferOffsets[attribIndex] =
+                        bufferHelper.getOffset() + bindingOffset;
 
                     stride = binding.getStride();
                 }
@@ -717,8 +729,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
     ANGLE_TRY(GetVertexRangeInfo(context, firstVertex, vertexOrIndexCount, indexTypeOrInvalid,
                                  indices, 0, &startVertex, &vertexCount));
 
-    RendererVk *renderer = contextVk->getRenderer();
-    mDynamicVertexData.releaseInFlightBuffers(contextVk);
+    RendererVk *renderer                 = contextVk->getRenderer();
+    vk::StreamingBuffer *streamingBuffer = contextVk->getStreamingBuffer();
 
     const auto &attribs  = mState.getVertexAttributes();
     const auto &bindings = mState.getVertexBindings();
@@ -756,7 +768,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 // Divisor will be set to 1 & so update buffer to have 1 attrib per instance
                 size_t bytesToAllocate = instanceCount * stride;
 
-                ANGLE_TRY(StreamVertexData(contextVk, &mDynamicVertexData, src, bytesToAllocate, 0,
+                ANGLE_TRY(StreamVertexData(contextVk, streamingBuffer, src, bytesToAllocate, 0,
                                            instanceCount, binding.getStride(), stride,
                                            vertexFormat.vertexLoadFunction,
                                            &mCurrentArrayBuffers[attribIndex],
@@ -772,7 +784,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 size_t count           = UnsignedCeilDivide(instanceCount, divisor);
                 size_t bytesToAllocate = count * stride;
 
-                ANGLE_TRY(StreamVertexData(contextVk, &mDynamicVertexData, src, bytesToAllocate, 0,
+                ANGLE_TRY(StreamVertexData(contextVk, streamingBuffer, src, bytesToAllocate, 0,
                                            count, binding.getStride(), stride,
                                            vertexFormat.vertexLoadFunction,
                                            &mCurrentArrayBuffers[attribIndex],
@@ -790,7 +802,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             size_t destOffset = startVertex * stride;
 
             ANGLE_TRY(StreamVertexData(
-                contextVk, &mDynamicVertexData, src, bytesToAllocate, destOffset, vertexCount,
+                contextVk, streamingBuffer, src, bytesToAllocate, destOffset, vertexCount,
                 binding.getStride(), stride, vertexFormat.vertexLoadFunction,
                 &mCurrentArrayBuffers[attribIndex], &mCurrentArrayBufferOffsets[attribIndex], 1));
         }
@@ -151,7 +151,6 @@ class VertexArrayVk : public VertexArrayImpl
     VkDeviceSize mCurrentElementArrayBufferOffset;
     vk::BufferHelper *mCurrentElementArrayBuffer;
 
-    vk::DynamicBuffer mDynamicVertexData;
     vk::DynamicBuffer mDynamicIndexData;
     vk::DynamicBuffer mTranslatedByteIndexData;
     vk::DynamicBuffer mTranslatedByteIndirectData;
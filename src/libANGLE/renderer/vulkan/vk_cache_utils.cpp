@@ -21,7 +21,9 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
+#include "libANGLE/trace.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace rx
@@ -1452,6 +1454,38 @@ size_t RenderPassDesc::attachmentCount() const
            depthStencilResolveCount;
 }
 
+bool RenderPassDesc::isValid() const
+{
+    if (mLogSamples > PackSampleCount(32) ||
+        mColorAttachmentRange > gl::IMPLEMENTATION_MAX_DRAW_BUFFERS)
+    {
+        return false;
+    }
+
+    gl::DrawBufferMask enabledColorAttachments;
+    for (size_t colorIndexGL = 0; colorIndexGL < mColorAttachmentRange; ++colorIndexGL)
+    {
+        if (mAttachmentFormats[colorIndexGL] >= angle::kNumANGLEFormats)
+        {
+            return false;
+        }
+        enabledColorAttachments.set(colorIndexGL, isColorAttachmentEnabled(colorIndexGL));
+    }
+
+    // Resolve and unresolve attachments can only accompany enabled color attachments.
+    if ((mColorResolveAttachmentMask & ~enabledColorAttachments).any() ||
+        (mColorUnresolveAttachmentMask & ~enabledColorAttachments).any())
+    {
+        return false;
+    }
+
+    if (hasDepthStencilAttachment())
+    {
+        return operator[](depthStencilAttachmentIndex()) != angle::FormatID::NONE;
+    }
+    return !hasDepthStencilResolveAttachment() && !hasDepthStencilUnresolveAttachment();
+}
+
 bool operator==(const RenderPassDesc &lhs, const RenderPassDesc &rhs)
 {
     return (memcmp(&lhs, &rhs, sizeof(RenderPassDesc)) == 0);
@@ -1497,6 +1531,70 @@ bool GraphicsPipelineDesc::operator==(const GraphicsPipelineDesc &other) const
     return (memcmp(this, &other, sizeof(GraphicsPipelineDesc)) == 0);
 }
 
+bool GraphicsPipelineDesc::isValid() const
+{
+    for (const PackedAttribDesc &packedAttrib : mVertexInputAttribs.attribs)
+    {
+        if (packedAttrib.format >= angle::kNumANGLEFormats)
+        {
+            return false;
+        }
+    }
+
+    if (!mRenderPassDesc.isValid())
+    {
+        return false;
+    }
+
+    const RasterizationStateBits &rasterBits = mRasterizationAndMultisampleStateInfo.bits;
+    const uint32_t samples                   = rasterBits.rasterizationSamples;
+    if (rasterBits.subpass > 1 || rasterBits.polygonMode > VK_POLYGON_MODE_POINT ||
+        rasterBits.cullMode > VK_CULL_MODE_FRONT_AND_BACK ||
+        rasterBits.frontFace > VK_FRONT_FACE_CLOCKWISE || samples == 0 || samples > 32 ||
+        !gl::isPow2(samples))
+    {
+        return false;
+    }
+
+    auto isStencilStateValid = [](const PackedStencilOpState &state) {
+        return state.ops.fail <= VK_STENCIL_OP_DECREMENT_AND_WRAP &&
+               state.ops.pass <= VK_STENCIL_OP_DECREMENT_AND_WRAP &&
+               state.ops.depthFail <= VK_STENCIL_OP_DECREMENT_AND_WRAP &&
+               state.ops.compare <= VK_COMPARE_OP_ALWAYS;
+    };
+    const DepthCompareOpAndSurfaceRotation &depthCompareOpAndSurfaceRotation =
+        mDepthStencilStateInfo.depthCompareOpAndSurfaceRotation;
+    if (depthCompareOpAndSurfaceRotation.depthCompareOp > VK_COMPARE_OP_ALWAYS ||
+        depthCompareOpAndSurfaceRotation.surfaceRotation >=
+            static_cast<uint8_t>(SurfaceRotation::EnumCount) ||
+        !isStencilStateValid(mDepthStencilStateInfo.front) ||
+        !isStencilStateValid(mDepthStencilStateInfo.back))
+    {
+        return false;
+    }
+
+    const PackedInputAssemblyAndColorBlendStateInfo &inputAndBlend =
+        mInputAssemblyAndColorBlendStateInfo;
+    if (inputAndBlend.logic.op > VK_LOGIC_OP_SET ||
+        inputAndBlend.primitive.topology > VK_PRIMITIVE_TOPOLOGY_PATCH_LIST)
+    {
+        return false;
+    }
+    for (const PackedColorBlendAttachmentState &attachment : inputAndBlend.attachments)
+    {
+        if (attachment.srcColorBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.dstColorBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.srcAlphaBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.dstAlphaBlendFactor > VK_BLEND_FACTOR_ONE_MINUS_SRC1_ALPHA ||
+            attachment.colorBlendOp > VK_BLEND_OP_MAX || attachment.alphaBlendOp > VK_BLEND_OP_MAX)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // TODO(jmadill): We should prefer using Packed GLenums. http://anglebug.com/2169
 
 // Initialize PSO states, it is consistent with initial value of gl::State
@@ -1611,7 +1709,7 @@ void GraphicsPipelineDesc::initDefaults(const ContextVk *contextVk)
 }
 
 angle::Result GraphicsPipelineDesc::initializePipeline(
-    ContextVk *contextVk,
+    Context *context,
     const PipelineCache &pipelineCacheVk,
     const RenderPass &compatibleRenderPass,
     const PipelineLayout &pipelineLayout,
@@ -1707,7 +1805,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
         // Get the corresponding VkFormat for the attrib's format.
         angle::FormatID formatID         = static_cast<angle::FormatID>(packedAttrib.format);
-        const Format &format             = contextVk->getRenderer()->getFormat(formatID);
+        const Format &format             = context->getRenderer()->getFormat(formatID);
         const angle::Format &angleFormat = format.intendedFormat();
         VkFormat vkFormat =
             packedAttrib.compressed ? format.vkCompressedBufferFormat : format.vkBufferFormat;
@@ -1818,7 +1916,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     rasterLineState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT;
     // Enable Bresenham line rasterization if available and not multisampling.
     if (rasterAndMS.bits.rasterizationSamples <= 1 &&
-        contextVk->getFeatures().bresenhamLineRasterization.enabled)
+        context->getRenderer()->getFeatures().bresenhamLineRasterization.enabled)
     {
         rasterLineState.lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_BRESENHAM_EXT;
         *pNextPtr                             = &rasterLineState;
@@ -1829,7 +1927,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     provokingVertexState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
     // Always set provoking vertex mode to last if available.
-    if (contextVk->getFeatures().provokingVertex.enabled)
+    if (context->getRenderer()->getFeatures().provokingVertex.enabled)
     {
         provokingVertexState.provokingVertexMode = VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT;
         *pNextPtr                                = &provokingVertexState;
@@ -1843,7 +1941,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     VkPipelineRasterizationDepthClipStateCreateInfoEXT depthClipState = {};
     depthClipState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().depthClamping.enabled)
+    if (context->getRenderer()->getFeatures().depthClamping.enabled)
     {
         depthClipState.depthClipEnable = VK_TRUE;
         *pNextPtr                      = &depthClipState;
@@ -1852,7 +1950,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
     VkPipelineRasterizationStateStreamCreateInfoEXT rasterStreamState = {};
     rasterStreamState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().supportsTransformFeedbackExtension.enabled)
+    if (context->getRenderer()->getFeatures().supportsTransformFeedbackExtension.enabled)
     {
         rasterStreamState.rasterizationStream = 0;
         rasterState.pNext                     = &rasterLineState;
@@ -1932,7 +2030,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
             // From OpenGL ES clients, this means disabling blending for integer formats.
             if (!angle::Format::Get(mRenderPassDesc[colorIndexGL]).isInt())
             {
-                ASSERT(!contextVk->getRenderer()
+                ASSERT(!context->getRenderer()
                             ->getFormat(mRenderPassDesc[colorIndexGL])
                             .actualImageFormat()
                             .isInt());
@@ -1975,8 +2073,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
 
-    ANGLE_VK_TRY(contextVk,
-                 pipelineOut->initGraphics(contextVk->getDevice(), createInfo, pipelineCacheVk));
+    ANGLE_VK_TRY(context,
+                 pipelineOut->initGraphics(context->getDevice(), createInfo, pipelineCacheVk));
     return angle::Result::Continue;
 }
 
@@ -2772,6 +2870,81 @@ const PushConstantRangeArray<PackedPushConstantRange> &PipelineLayoutDesc::getPu
     return mPushConstantRanges;
 }
 
+// GraphicsPipelineCreationTask implementation.
+// Creates a graphics pipeline on a worker thread.  The pipeline desc and specialization constants
+// are copied, while the render pass, layout and shader modules are owned by the caches and the
+// program and are kept alive until the PipelineHelper waiting for the task is destroyed.  Errors
+// are recorded and reported to the context that waits for the pipeline.  The pipeline handle is
+// remembered after ownership of the pipeline is taken, for the benefit of DeferredPipelineBind.
+class GraphicsPipelineCreationTask final : public Context, public angle::Closure
+{
+  public:
+    GraphicsPipelineCreationTask(RendererVk *renderer,
+                                 const PipelineCache &pipelineCacheVk,
+                                 const RenderPass &compatibleRenderPass,
+                                 const PipelineLayout &pipelineLayout,
+                                 const gl::AttributesMask &activeAttribLocationsMask,
+                                 const gl::ComponentTypeMask &programAttribsTypeMask,
+                                 const ShaderModule *vertexModule,
+                                 const ShaderModule *fragmentModule,
+                                 const ShaderModule *geometryModule,
+                                 const SpecializationConstants &specConsts,
+                                 const GraphicsPipelineDesc &desc)
+        : Context(renderer),
+          mPipelineCacheVk(pipelineCacheVk),
+          mCompatibleRenderPass(compatibleRenderPass),
+          mPipelineLayout(pipelineLayout),
+          mActiveAttribLocationsMask(activeAttribLocationsMask),
+          mProgramAttribsTypeMask(programAttribsTypeMask),
+          mVertexModule(vertexModule),
+          mFragmentModule(fragmentModule),
+          mGeometryModule(geometryModule),
+          mSpecConsts(specConsts),
+          mDesc(desc),
+          mPipelineHandle(VK_NULL_HANDLE),
+          mResult(VK_SUCCESS)
+    {}
+    ~GraphicsPipelineCreationTask() override { ASSERT(!mPipeline.valid()); }
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "GraphicsPipelineCreationTask");
+        (void)mDesc.initializePipeline(this, mPipelineCacheVk, mCompatibleRenderPass,
+                                       mPipelineLayout, mActiveAttribLocationsMask,
+                                       mProgramAttribsTypeMask, mVertexModule, mFragmentModule,
+                                       mGeometryModule, mSpecConsts, &mPipeline);
+        mPipelineHandle = mPipeline.getHandle();
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mResult = result;
+    }
+
+    VkResult getResult() const { return mResult; }
+    Pipeline &getPipeline() { return mPipeline; }
+    VkPipeline getPipelineHandle() const { return mPipelineHandle; }
+
+  private:
+    const PipelineCache &mPipelineCacheVk;
+    const RenderPass &mCompatibleRenderPass;
+    const PipelineLayout &mPipelineLayout;
+    gl::AttributesMask mActiveAttribLocationsMask;
+    gl::ComponentTypeMask mProgramAttribsTypeMask;
+    const ShaderModule *mVertexModule;
+    const ShaderModule *mFragmentModule;
+    const ShaderModule *mGeometryModule;
+    SpecializationConstants mSpecConsts;
+    GraphicsPipelineDesc mDesc;
+
+    Pipeline mPipeline;
+    VkPipeline mPipelineHandle;
+    VkResult mResult;
+};
+
 // PipelineHelper implementation.
 PipelineHelper::PipelineHelper() = default;
 
@@ -2779,9 +2952,52 @@ PipelineHelper::~PipelineHelper() = default;
 
 void PipelineHelper::destroy(VkDevice device)
 {
+    (void)finishPendingCreation();
     mPipeline.destroy(device);
 }
 
+void PipelineHelper::setPendingCreation(
+    std::shared_ptr<angle::WaitableEvent> &&creationEvent,
+    std::shared_ptr<GraphicsPipelineCreationTask> &&creationTask)
+{
+    ASSERT(!valid() && !isCreationPending());
+    mCreationEvent = std::move(creationEvent);
+    mCreationTask  = std::move(creationTask);
+}
+
+angle::Result PipelineHelper::waitForCreation(Context *context)
+{
+    ANGLE_VK_TRY(context, finishPendingCreation());
+    return angle::Result::Continue;
+}
+
+VkResult PipelineHelper::finishPendingCreation()
+{
+    if (!isCreationPending())
+    {
+        return VK_SUCCESS;
+    }
+
+    mCreationEvent->wait();
+
+    // On failure, keep the task around so the error is reported again if the pipeline is used.
+    VkResult result = mCreationTask->getResult();
+    if (result == VK_SUCCESS)
+    {
+        mPipeline = std::move(mCreationTask->getPipeline());
+        mCreationEvent.reset();
+        mCreationTask.reset();
+    }
+
+    return result;
+}
+
+DeferredPipelineBind PipelineHelper::deferBind(VkPipeline *handleOut) const
+{
+    ASSERT(isCreationPending());
+    return DeferredPipelineBind(mCreationEvent, mCreationTask, handleOut);
+}
+
 void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
                                    const GraphicsPipelineDesc *desc,
                                    PipelineHelper *pipeline)
@@ -2789,6 +3005,22 @@ void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
     mTransitions.emplace_back(bits, desc, pipeline);
 }
 
+// DeferredPipelineBind implementation.
+DeferredPipelineBind::DeferredPipelineBind(
+    const std::shared_ptr<angle::WaitableEvent> &creationEvent,
+    const std::shared_ptr<GraphicsPipelineCreationTask> &creationTask,
+    VkPipeline *handleOut)
+    : mCreationEvent(creationEvent), mCreationTask(creationTask), mHandleOut(handleOut)
+{}
+
+angle::Result DeferredPipelineBind::resolve(Context *context)
+{
+    mCreationEvent->wait();
+    ANGLE_VK_TRY(context, mCreationTask->getResult());
+    *mHandleOut = mCreationTask->getPipelineHandle();
+    return angle::Result::Continue;
+}
+
 TextureDescriptorDesc::TextureDescriptorDesc() : mMaxIndex(0)
 {
     mSerials.fill({kInvalidImageOrBufferViewSubresourceSerial, kInvalidSamplerSerial});
@@ -3294,8 +3526,16 @@ GraphicsPipelineCache::~GraphicsPipelineCache()
     ASSERT(mPayload.empty());
 }
 
-void GraphicsPipelineCache::destroy(VkDevice device)
+void GraphicsPipelineCache::destroy(RendererVk *renderer)
 {
+    // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
+    VkDevice device = VK_NULL_HANDLE;
+    if (renderer != nullptr)
+    {
+        device = renderer->getDevice();
+        renderer->onGraphicsPipelinesDestroyed(mPayload.size());
+    }
+
     for (auto &item : mPayload)
     {
         vk::PipelineHelper &pipeline = item.second;
@@ -3307,9 +3547,12 @@ void GraphicsPipelineCache::destroy(VkDevice device)
 
 void GraphicsPipelineCache::release(ContextVk *context)
 {
+    context->getRenderer()->onGraphicsPipelinesDestroyed(mPayload.size());
+
     for (auto &item : mPayload)
     {
         vk::PipelineHelper &pipeline = item.second;
+        (void)pipeline.finishPendingCreation();
         context->addGarbage(&pipeline.getPipeline());
     }
 
@@ -3336,7 +3579,17 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (contextVk != nullptr)
     {
+        contextVk->getPerfCounters().graphicsPipelineCacheMisses++;
         contextVk->getRenderer()->onNewGraphicsPipeline();
+
+        if (contextVk->getFeatures().asyncGraphicsPipelineCompilation.enabled)
+        {
+            return insertPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass,
+                                       pipelineLayout, activeAttribLocationsMask,
+                                       programAttribsTypeMask, vertexModule, fragmentModule,
+                                       geometryModule, specConsts, desc, descPtrOut, pipelineOut);
+        }
+
         ANGLE_TRY(desc.initializePipeline(contextVk, pipelineCacheVk, compatibleRenderPass,
                                           pipelineLayout, activeAttribLocationsMask,
                                           programAttribsTypeMask, vertexModule, fragmentModule,
@@ -3348,9 +3601,154 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     *descPtrOut       = &insertedItem.first->first;
     *pipelineOut      = &insertedItem.first->second;
 
+    if (contextVk != nullptr)
+    {
+        contextVk->getRenderer()->onGraphicsPipelinesCreated(1);
+    }
+
     return angle::Result::Continue;
 }
 
+angle::Result GraphicsPipelineCache::insertPipelineAsync(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    ASSERT(renderer->getWorkerThreadPool());
+
+    auto creationTask = std::make_shared<vk::GraphicsPipelineCreationTask>(
+        renderer, pipelineCacheVk, compatibleRenderPass, pipelineLayout, activeAttribLocationsMask,
+        programAttribsTypeMask, vertexModule, fragmentModule, geometryModule, specConsts, desc);
+    std::shared_ptr<angle::WaitableEvent> creationEvent = angle::WorkerThreadPool::PostWorkerTask(
+        renderer->getWorkerThreadPool(), creationTask);
+    ASSERT(creationEvent);
+
+    // The entry is inserted right away so that further lookups and transitions find it while the
+    // pipeline is being created.  The pipeline is waited on when it's bound.
+    auto insertedItem = mPayload.emplace(std::piecewise_construct, std::forward_as_tuple(desc),
+                                         std::forward_as_tuple());
+    insertedItem.first->second.setPendingCreation(std::move(creationEvent),
+                                                  std::move(creationTask));
+    renderer->onGraphicsPipelinesCreated(1);
+
+    *descPtrOut  = &insertedItem.first->first;
+    *pipelineOut = &insertedItem.first->second;
+
+    return angle::Result::Continue;
+}
+
+angle::Result GraphicsPipelineCache::warmUpPipeline(
+    ContextVk *contextVk,
+    const vk::PipelineCache &pipelineCacheVk,
+    const vk::RenderPass &compatibleRenderPass,
+    const vk::PipelineLayout &pipelineLayout,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask,
+    const vk::ShaderModule *vertexModule,
+    const vk::ShaderModule *fragmentModule,
+    const vk::ShaderModule *geometryModule,
+    const vk::SpecializationConstants &specConsts,
+    const vk::GraphicsPipelineDesc &desc)
+{
+    if (mPayload.find(desc) != mPayload.end())
+    {
+        return angle::Result::Continue;
+    }
+
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    vk::PipelineHelper *pipeline            = nullptr;
+    return insertPipelineAsync(contextVk, pipelineCacheVk, compatibleRenderPass, pipelineLayout,
+                               activeAttribLocationsMask, programAttribsTypeMask, vertexModule,
+                               fragmentModule, geometryModule, specConsts, desc, &descPtr,
+                               &pipeline);
+}
+
+void GraphicsPipelineCache::onCacheHit(ContextVk *contextVk)
+{
+    // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
+    if (contextVk != nullptr)
+    {
+        contextVk->getPerfCounters().graphicsPipelineCacheHits++;
+    }
+}
+
+void GraphicsPipelineCache::getEvictionCandidates(Serial lastCompletedSerial,
+                                                  const vk::PipelineHelper *keepPipeline,
+                                                  std::vector<Serial> *serialsOut) const
+{
+    for (const auto &item : mPayload)
+    {
+        // Pipelines still being created are about to be used.
+        if (!item.second.isCreationReady() || &item.second == keepPipeline)
+        {
+            continue;
+        }
+
+        const Serial serial = item.second.getSerial();
+        if (serial <= lastCompletedSerial)
+        {
+            serialsOut->push_back(serial);
+        }
+    }
+}
+
+size_t GraphicsPipelineCache::evict(ContextVk *contextVk,
+                                    Serial maxSerial,
+                                    const vk::PipelineHelper *keepPipeline,
+                                    size_t *evictCount)
+{
+    ASSERT(maxSerial <= contextVk->getLastCompletedQueueSerial());
+
+    size_t evicted = 0;
+    for (auto item = mPayload.begin(); item != mPayload.end() && evicted < *evictCount;)
+    {
+        if (!item->second.isCreationReady() || item->second.getSerial() > maxSerial ||
+            &item->second == keepPipeline)
+        {
+            ++item;
+            continue;
+        }
+
+        // A pipeline whose bind was deferred may not have been bound again since it was created.
+        (void)item->second.finishPendingCreation();
+        contextVk->addGarbage(&item->second.getPipeline());
+        item = mPayload.erase(item);
+        ++evicted;
+    }
+
+    if (evicted == 0)
+    {
+        return 0;
+    }
+
+    // The remaining pipelines may have transitions to the evicted ones.
+    clearTransitions();
+
+    *evictCount -= evicted;
+    contextVk->getRenderer()->onGraphicsPipelinesDestroyed(evicted);
+    contextVk->getPerfCounters().graphicsPipelineCacheEvictions += static_cast<uint32_t>(evicted);
+    return evicted;
+}
+
+void GraphicsPipelineCache::clearTransitions()
+{
+    for (auto &item : mPayload)
+    {
+        item.second.clearTransitions();
+    }
+}
+
 void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline)
 {
     auto item = mPayload.find(desc);
@@ -13,6 +13,7 @@
 
 #include "common/Color.h"
 #include "common/FixedVector.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -216,6 +217,10 @@ class alignas(4) RenderPassDesc final
     // color attachments.
     size_t attachmentCount() const;
 
+    // Whether every packed field holds a value that could have been produced by the pack
+    // functions.  Used to reject descs loaded from untrusted storage.
+    bool isValid() const;
+
     void setSamples(GLint samples);
 
     uint8_t samples() const { return 1u << mLogSamples; }
@@ -582,6 +587,10 @@ class GraphicsPipelineDesc final
 
     void initDefaults(const ContextVk *contextVk);
 
+    // Whether every enum and count field is in range.  Descs loaded from the blob cache must pass
+    // this check before being used to create a pipeline.
+    bool isValid() const;
+
     // For custom comparisons.
     template <typename T>
     const T *getPtr() const
@@ -589,7 +598,7 @@ class GraphicsPipelineDesc final
         return reinterpret_cast<const T *>(this);
     }
 
-    angle::Result initializePipeline(ContextVk *contextVk,
+    angle::Result initializePipeline(Context *context,
                                      const PipelineCache &pipelineCacheVk,
                                      const RenderPass &compatibleRenderPass,
                                      const PipelineLayout &pipelineLayout,
@@ -986,6 +995,27 @@ ANGLE_INLINE bool GraphicsPipelineTransitionMatch(GraphicsPipelineTransitionBits
     return true;
 }
 
+class GraphicsPipelineCreationTask;
+
+// A pipeline bind recorded in a command buffer before the pipeline is created.  The pipeline handle
+// is written into the recorded command once creation is finished, which lets draw calls that use a
+// pipeline being created on a worker thread be recorded without waiting for it.
+class DeferredPipelineBind final
+{
+  public:
+    DeferredPipelineBind(const std::shared_ptr<angle::WaitableEvent> &creationEvent,
+                         const std::shared_ptr<GraphicsPipelineCreationTask> &creationTask,
+                         VkPipeline *handleOut);
+
+    // Waits for the pipeline to be created and patches its handle into the recorded command.
+    angle::Result resolve(Context *context);
+
+  private:
+    std::shared_ptr<angle::WaitableEvent> mCreationEvent;
+    std::shared_ptr<GraphicsPipelineCreationTask> mCreationTask;
+    VkPipeline *mHandleOut;
+};
+
 class PipelineHelper final : angle::NonCopyable
 {
   public:
@@ -1000,6 +1030,20 @@ class PipelineHelper final : angle::NonCopyable
     Serial getSerial() const { return mSerial; }
     Pipeline &getPipeline() { return mPipeline; }
 
+    // When pipelines are created asynchronously, the PipelineHelper is placed in the cache (and
+    // can be the target of transitions) before the VkPipeline exists.  The pipeline must be waited
+    // on before it's bound.
+    void setPendingCreation(std::shared_ptr<angle::WaitableEvent> &&creationEvent,
+                            std::shared_ptr<GraphicsPipelineCreationTask> &&creationTask);
+    bool isCreationPending() const { return mCreationEvent != nullptr; }
+    bool isCreationReady() const { return !isCreationPending() || mCreationEvent->isReady(); }
+    angle::Result waitForCreation(Context *context);
+    // Waits for the pending creation task, if any, and takes ownership of its result.
+    VkResult finishPendingCreation();
+    // Returns a bind of this pipeline to be resolved when its pending creation is finished.  The
+    // bind remains valid if this helper is released in the meantime.
+    DeferredPipelineBind deferBind(VkPipeline *handleOut) const;
+
     ANGLE_INLINE bool findTransition(GraphicsPipelineTransitionBits bits,
                                      const GraphicsPipelineDesc &desc,
                                      PipelineHelper **pipelineOut) const
@@ -1020,11 +1064,15 @@ class PipelineHelper final : angle::NonCopyable
     void addTransition(GraphicsPipelineTransitionBits bits,
                        const GraphicsPipelineDesc *desc,
                        PipelineHelper *pipeline);
+    void clearTransitions() { mTransitions.clear(); }
 
   private:
     std::vector<GraphicsPipelineTransition> mTransitions;
     Serial mSerial;
     Pipeline mPipeline;
+
+    std::shared_ptr<angle::WaitableEvent> mCreationEvent;
+    std::shared_ptr<GraphicsPipelineCreationTask> mCreationTask;
 };
 
 ANGLE_INLINE PipelineHelper::PipelineHelper(Pipeline &&pipeline) : mPipeline(std::move(pipeline)) {}
@@ -1356,18 +1404,45 @@ class RenderPassCache final : angle::NonCopyable
     OuterCache mPayload;
 };
 
-// TODO(jmadill): Add cache trimming/eviction.
+// The number of graphics pipelines is bounded by a renderer-wide budget (see
+// RendererVk::isOverGraphicsPipelineBudget).  Once the renderer is over budget, the least recently
+// bound pipelines that are no longer in use by the GPU are evicted from the caches of the share
+// group that creates the next pipeline.  The serial of a PipelineHelper is updated every time it
+// is bound, so it doubles as the LRU key.
 class GraphicsPipelineCache final : angle::NonCopyable
 {
   public:
     GraphicsPipelineCache();
     ~GraphicsPipelineCache();
 
-    void destroy(VkDevice device);
+    void destroy(RendererVk *renderer);
     void release(ContextVk *context);
 
     void populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline);
 
+    size_t size() const { return mPayload.size(); }
+
+    // Appends the serials of the pipelines that can be evicted, i.e. those that are neither being
+    // created nor referenced by a pending submission, other than |keepPipeline|.
+    void getEvictionCandidates(Serial lastCompletedSerial,
+                               const vk::PipelineHelper *keepPipeline,
+                               std::vector<Serial> *serialsOut) const;
+
+    // Evicts at most |*evictCount| pipelines that were last bound no later than |maxSerial|, and
+    // decrements |*evictCount| by the number of evicted pipelines.  |keepPipeline| is never
+    // evicted.  |maxSerial| must not be newer than the last completed serial.  Evicting pipelines
+    // invalidates all transitions out of the pipelines in this cache.  Returns the number of
+    // evicted pipelines.
+    size_t evict(ContextVk *contextVk,
+                 Serial maxSerial,
+                 const vk::PipelineHelper *keepPipeline,
+                 size_t *evictCount);
+
+    // Transitions may point to pipelines in other caches (for example, if the line raster
+    // emulation or surface rotation changes).  When a sibling cache evicts pipelines, the
+    // transitions in this cache must be dropped too.
+    void clearTransitions();
+
     ANGLE_INLINE angle::Result getPipeline(ContextVk *contextVk,
                                            const vk::PipelineCache &pipelineCacheVk,
                                            const vk::RenderPass &compatibleRenderPass,
@@ -1387,6 +1462,7 @@ class GraphicsPipelineCache final : angle::NonCopyable
         {
             *descPtrOut  = &item->first;
             *pipelineOut = &item->second;
+            onCacheHit(contextVk);
             return angle::Result::Continue;
         }
 
@@ -1396,6 +1472,21 @@ class GraphicsPipelineCache final : angle::NonCopyable
                               pipelineOut);
     }
 
+    // Starts creating the pipeline on a worker thread if |desc| is not in the cache, regardless of
+    // the asyncGraphicsPipelineCompilation feature.  The pipeline is waited on when it's first
+    // bound.  Used to warm up the cache without blocking.
+    angle::Result warmUpPipeline(ContextVk *contextVk,
+                                 const vk::PipelineCache &pipelineCacheVk,
+                                 const vk::RenderPass &compatibleRenderPass,
+                                 const vk::PipelineLayout &pipelineLayout,
+                                 const gl::AttributesMask &activeAttribLocationsMask,
+                                 const gl::ComponentTypeMask &programAttribsTypeMask,
+                                 const vk::ShaderModule *vertexModule,
+                                 const vk::ShaderModule *fragmentModule,
+                                 const vk::ShaderModule *geometryModule,
+                                 const vk::SpecializationConstants &specConsts,
+                                 const vk::GraphicsPipelineDesc &desc);
+
   private:
     angle::Result insertPipeline(ContextVk *contextVk,
                                  const vk::PipelineCache &pipelineCacheVk,
@@ -1410,6 +1501,20 @@ class GraphicsPipelineCache final : angle::NonCopyable
                                  const vk::GraphicsPipelineDesc &desc,
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
+    angle::Result insertPipelineAsync(ContextVk *contextVk,
+                                      const vk::PipelineCache &pipelineCacheVk,
+                                      const vk::RenderPass &compatibleRenderPass,
+                                      const vk::PipelineLayout &pipelineLayout,
+                                      const gl::AttributesMask &activeAttribLocationsMask,
+                                      const gl::ComponentTypeMask &programAttribsTypeMask,
+                                      const vk::ShaderModule *vertexModule,
+                                      const vk::ShaderModule *fragmentModule,
+                                      const vk::ShaderModule *geometryModule,
+                                      const vk::SpecializationConstants &specConsts,
+                                      const vk::GraphicsPipelineDesc &desc,
+                                      const vk::GraphicsPipelineDesc **descPtrOut,
+                                      vk::PipelineHelper **pipelineOut);
+    void onCacheHit(ContextVk *contextVk);
 
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
 };
@@ -9,6 +9,8 @@
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "libANGLE/renderer/driver_utils.h"
 
+#include <thread>
+
 #include "common/utilities.h"
 #include "image_util/loadimage.h"
 #include "libANGLE/Context.h"
@@ -49,6 +51,24 @@ constexpr VkBufferUsageFlags kLineLoopDynamicIndirectBufferUsage =
     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 constexpr int kLineLoopDynamicIndirectBufferInitialSize = sizeof(VkDrawIndirectCommand) * 16;
 
+// Once the streaming buffer reaches this size, it waits for the GPU instead of growing when full.
+constexpr size_t kMaxStreamingBufferSize = 64 * 1024 * 1024;
+
+// Sub-allocated buffers are placed in power-of-two slots of at least this size, which covers the
+// offset alignments required by most implementations.
+constexpr VkDeviceSize kMinBufferSlotSize = 256;
+// Blocks hold at least this many slots, and are at least this large.
+constexpr VkDeviceSize kMinBufferSlotsPerBlock = 16;
+constexpr VkDeviceSize kMinBufferBlockSize     = 256 * 1024;
+
+// Staged buffer updates to an image are copied in batches of up to this many regions.
+constexpr size_t kMaxBatchedBufferUpdates = 256;
+
+// With parallelTextureLoad, uploads that need a conversion are split between up to this many
+// threads once their converted data reaches this size.
+constexpr size_t kMaxParallelTextureLoadTasks = 8;
+constexpr size_t kMinParallelTextureLoadSize  = 4 * 1024 * 1024;
+
 constexpr angle::PackedEnumMap<PipelineStage, VkPipelineStageFlagBits> kPipelineStageFlagBitMap = {
     {PipelineStage::TopOfPipe, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT},
     {PipelineStage::DrawIndirect, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT},
@@ -670,6 +690,56 @@ void DestroyBufferList(RendererVk *renderer, BufferHelperPointerVector *buffers)
     }
     buffers->clear();
 }
+
+bool AreImageRegionsOverlapping(const VkBufferImageCopy &first, const VkBufferImageCopy &second)
+{
+    const VkOffset3D &firstOffset  = first.imageOffset;
+    const VkOffset3D &secondOffset = second.imageOffset;
+    const VkExtent3D &firstExtent  = first.imageExtent;
+    const VkExtent3D &secondExtent = second.imageExtent;
+
+    return firstOffset.x < secondOffset.x + static_cast<int32_t>(secondExtent.width) &&
+           secondOffset.x < firstOffset.x + static_cast<int32_t>(firstExtent.width) &&
+           firstOffset.y < secondOffset.y + static_cast<int32_t>(secondExtent.height) &&
+           secondOffset.y < firstOffset.y + static_cast<int32_t>(firstExtent.height) &&
+           firstOffset.z < secondOffset.z + static_cast<int32_t>(secondExtent.depth) &&
+           secondOffset.z < firstOffset.z + static_cast<int32_t>(firstExtent.depth);
+}
+
+// Whether a staged buffer update can join the batch of regions that are copied from batchBuffer
+// by a single command.  The regions of a copy must not overlap, and they all write to the same
+// subresources so that there is no need for a barrier between them.
+bool CanBatchBufferUpdate(const BufferHelper *batchBuffer,
+                          const std::vector<VkBufferImageCopy> &batchRegions,
+                          const BufferHelper *buffer,
+                          const VkBufferImageCopy &region)
+{
+    if (batchRegions.empty() || buffer != batchBuffer ||
+        batchRegions.size() >= kMaxBatchedBufferUpdates)
+    {
+        return false;
+    }
+
+    const VkImageSubresourceLayers &batchSubresource = batchRegions.front().imageSubresource;
+    const VkImageSubresourceLayers &subresource      = region.imageSubresource;
+    if (subresource.aspectMask != batchSubresource.aspectMask ||
+        subresource.mipLevel != batchSubresource.mipLevel ||
+        subresource.baseArrayLayer != batchSubresource.baseArrayLayer ||
+        subresource.layerCount != batchSubresource.layerCount)
+    {
+        return false;
+    }
+
+    for (const VkBufferImageCopy &batchRegion : batchRegions)
+    {
+        if (AreImageRegionsOverlapping(batchRegion, region))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 // This is an arbitrary max. We can change this later if necessary.
@@ -769,7 +839,8 @@ void CommandBufferHelper::initialize(bool isRenderPassCommandBuffer)
     mUsedBuffers.ensureCapacity(kInitialBufferCount);
 
     mAllocator.initialize(kDefaultPoolAllocatorPageSize, 1);
-    // Push a scope into the pool allocator so we can easily free and re-init on reset()
+    // Push a scope into the pool allocator that the command buffer owns.  It keeps the blocks it
+    // allocates across reset() for reuse, and rewinds the scope itself when it needs to.
     mAllocator.push();
     mCommandBuffer.initialize(&mAllocator);
     mIsRenderPassCommandBuffer = isRenderPassCommandBuffer;
@@ -1341,15 +1412,16 @@ void CommandBufferHelper::invalidateRenderPassStencilAttachment(
     ExtendRenderPassInvalidateArea(invalidateArea, &mStencilInvalidateArea);
 }
 
-angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &features,
+angle::Result CommandBufferHelper::flushToPrimary(Context *context,
                                                   PrimaryCommandBuffer *primary,
-                                                  const RenderPass *renderPass)
+                                                  const RenderPass *renderPass,
+                                                  ParallelCommandRecorder *parallelRecorder)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandBufferHelper::flushToPrimary");
     ASSERT(!empty());
 
     // Commands that are added to primary before beginRenderPass command
-    executeBarriers(features, primary);
+    executeBarriers(context->getRenderer()->getFeatures(), primary);
 
     if (mIsRenderPassCommandBuffer)
     {
@@ -1367,9 +1439,32 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
         beginInfo.clearValueCount = static_cast<uint32_t>(mRenderPassDesc.attachmentCount());
         beginInfo.pClearValues    = mClearValues.data();
 
+        std::vector<priv::CommandBuffer> secondaryCommandBuffers;
+        if (parallelRecorder)
+        {
+            ANGLE_TRY(parallelRecorder->record(context, &mCommandBuffer, *renderPass,
+                                               mFramebuffer.getHandle(),
+                                               &secondaryCommandBuffers));
+        }
+
         // Run commands inside the RenderPass.
-        primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
-        mCommandBuffer.executeCommands(primary->getHandle());
+        if (secondaryCommandBuffers.empty())
+        {
+            primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+            mCommandBuffer.executeCommands(primary->getHandle());
+        }
+        else
+        {
+            primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            primary->executeCommands(static_cast<uint32_t>(secondaryCommandBuffers.size()),
+                                     secondaryCommandBuffers.data());
+
+            // The secondary command buffers are freed when their pools are reset.
+            for (priv::CommandBuffer &secondaryCommandBuffer : secondaryCommandBuffers)
+            {
+                secondaryCommandBuffer.releaseHandle();
+            }
+        }
         primary->endRenderPass();
 
         if (mValidTransformFeedbackBufferCount != 0)
@@ -1503,8 +1598,6 @@ void CommandBufferHelper::addCommandDiagnostics(ContextVk *contextVk)
 
 void CommandBufferHelper::reset()
 {
-    mAllocator.pop();
-    mAllocator.push();
     mCommandBuffer.reset();
     mUsedBuffers.clear();
 
@@ -1967,6 +2060,288 @@ void DynamicBuffer::reset()
     mLastFlushOrInvalidateOffset = 0;
 }
 
+// StreamingBuffer implementation.
+StreamingBuffer::StreamingBuffer()
+    : mInitialSize(0),
+      mNonCoherentAtomSize(0),
+      mSize(0),
+      mHead(0),
+      mTail(0),
+      mLastFlushOffset(0),
+      mInUseSize(0),
+      mPendingSize(0)
+{}
+
+StreamingBuffer::~StreamingBuffer()
+{
+    ASSERT(mBuffer == nullptr);
+    ASSERT(mInFlightBuffers.empty());
+}
+
+void StreamingBuffer::init(RendererVk *renderer, size_t initialSize)
+{
+    // Check that we haven't overriden the initial size of the buffer in setMinimumSizeForTesting.
+    if (mInitialSize == 0)
+    {
+        mInitialSize = initialSize;
+    }
+
+    mNonCoherentAtomSize =
+        static_cast<size_t>(renderer->getPhysicalDeviceProperties().limits.nonCoherentAtomSize);
+    ASSERT(gl::isPow2(mNonCoherentAtomSize));
+}
+
+angle::Result StreamingBuffer::allocateNewBuffer(ContextVk *contextVk, size_t minSize)
+{
+    size_t newSize = std::max(mInitialSize, mSize * 2);
+    while (newSize < minSize)
+    {
+        newSize *= 2;
+    }
+
+    if (mBuffer)
+    {
+        // Commands recorded since the last submission may still use the old buffer, so it is only
+        // released once they are submitted.
+        mInFlightBuffers.push_back(std::move(mBuffer));
+        contextVk->getPerfCounters().streamingBufferResizes++;
+
+        // The current default uniforms were written to the old buffer, and the descriptor sets
+        // written from now on point at the new one.
+        contextVk->onStreamingBufferDataLost();
+    }
+    reset();
+
+    mBuffer = std::make_unique<BufferHelper>();
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = newSize;
+    createInfo.usage                 = kStreamingBufferUsageFlags;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(mBuffer->init(contextVk, createInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+
+    // The buffer stays mapped until it is released.
+    uint8_t *mappedMemory = nullptr;
+    ANGLE_TRY(mBuffer->map(contextVk, &mappedMemory));
+
+    mSize = newSize;
+    return angle::Result::Continue;
+}
+
+void StreamingBuffer::reclaim(Serial lastCompletedSerial)
+{
+    // A draw call whose setup flushes the context (for example to map a buffer that earlier draw
+    // calls used) records its commands in the submission after the one its streamed data was
+    // written for.  A segment is thus only reused once the following submission has completed too.
+    while (mSegments.size() > 1 && !mSegments[1].use.isCurrentlyInUse(lastCompletedSerial))
+    {
+        Segment &segment = mSegments.front();
+        mTail            = (mTail + segment.size) % mSize;
+        mInUseSize -= segment.size;
+        segment.use.release();
+        mSegments.pop_front();
+    }
+
+    if (mInUseSize == 0)
+    {
+        mHead            = 0;
+        mTail            = 0;
+        mLastFlushOffset = 0;
+    }
+}
+
+angle::Result StreamingBuffer::allocateFromCurrentBuffer(ContextVk *contextVk,
+                                                         size_t sizeInBytes,
+                                                         size_t alignment,
+                                                         uint8_t **ptrOut,
+                                                         VkDeviceSize *offsetOut,
+                                                         bool *allocatedOut)
+{
+    *allocatedOut = false;
+    if (!mBuffer)
+    {
+        return angle::Result::Continue;
+    }
+
+    reclaim(contextVk->getLastCompletedQueueSerial());
+
+    ASSERT(gl::isPow2(alignment));
+    alignment                   = std::max(alignment, mNonCoherentAtomSize);
+    const size_t sizeToAllocate = roundUp(sizeInBytes, mNonCoherentAtomSize);
+
+    // The free space is [head, tail) if the in-use region wraps around the end of the buffer, and
+    // [head, size) followed by [0, tail) otherwise.
+    const bool inUseRegionWraps = mHead < mTail || (mHead == mTail && mInUseSize > 0);
+    const size_t freeEnd        = inUseRegionWraps ? mTail : mSize;
+    size_t offset               = roundUp(mHead, alignment);
+
+    if (offset + sizeToAllocate > freeEnd)
+    {
+        if (inUseRegionWraps || sizeToAllocate > mTail)
+        {
+            return angle::Result::Continue;
+        }
+
+        // Skip the end of the buffer.  Since flush() only handles the data written after the last
+        // flush, anything written before the head is flushed now.
+        if (mHead > mLastFlushOffset)
+        {
+            ANGLE_TRY(mBuffer->flush(contextVk->getRenderer(), mLastFlushOffset,
+                                     mHead - mLastFlushOffset));
+        }
+
+        mInUseSize += mSize - mHead;
+        mPendingSize += mSize - mHead;
+        mHead            = 0;
+        mLastFlushOffset = 0;
+        offset           = 0;
+    }
+
+    const size_t newHead = offset + sizeToAllocate;
+    mInUseSize += newHead - mHead;
+    mPendingSize += newHead - mHead;
+    mHead = newHead;
+
+    contextVk->getPerfCounters().streamingBufferBytesAllocated +=
+        static_cast<uint32_t>(sizeToAllocate);
+
+    *ptrOut       = mBuffer->getMappedMemory() + offset;
+    *offsetOut    = static_cast<VkDeviceSize>(offset);
+    *allocatedOut = true;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBuffer::allocate(ContextVk *contextVk,
+                                        size_t sizeInBytes,
+                                        size_t alignment,
+                                        uint8_t **ptrOut,
+                                        BufferHelper **bufferOut,
+                                        VkDeviceSize *offsetOut,
+                                        bool *newBufferAllocatedOut)
+{
+    bool allocated = false;
+    ANGLE_TRY(allocateFromCurrentBuffer(contextVk, sizeInBytes, alignment, ptrOut, offsetOut,
+                                        &allocated));
+
+    // Once the ring is at its maximum size, wait for the GPU to finish with the oldest segments.
+    while (!allocated && mSize >= kMaxStreamingBufferSize && mSegments.size() > 1)
+    {
+        ANGLE_PERF_WARNING(contextVk->getDebug(), GL_DEBUG_SEVERITY_LOW,
+                           "Waiting for the GPU to free space in the streaming buffer");
+        contextVk->getPerfCounters().streamingBufferStalls++;
+
+        ANGLE_TRY(contextVk->finishToSerial(mSegments[1].use.getSerial()));
+        ANGLE_TRY(allocateFromCurrentBuffer(contextVk, sizeInBytes, alignment, ptrOut, offsetOut,
+                                            &allocated));
+    }
+
+    if (newBufferAllocatedOut != nullptr)
+    {
+        *newBufferAllocatedOut = !allocated;
+    }
+
+    if (!allocated)
+    {
+        const size_t alignedSize = roundUp(sizeInBytes, mNonCoherentAtomSize);
+        ANGLE_TRY(allocateNewBuffer(contextVk, alignedSize));
+        ANGLE_TRY(allocateFromCurrentBuffer(contextVk, sizeInBytes, alignment, ptrOut, offsetOut,
+                                            &allocated));
+        ASSERT(allocated);
+    }
+
+    if (bufferOut != nullptr)
+    {
+        *bufferOut = mBuffer.get();
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBuffer::flush(ContextVk *contextVk)
+{
+    if (mHead > mLastFlushOffset)
+    {
+        ASSERT(mBuffer != nullptr);
+        ANGLE_TRY(mBuffer->flush(contextVk->getRenderer(), mLastFlushOffset,
+                                 mHead - mLastFlushOffset));
+        mLastFlushOffset = mHead;
+    }
+    return angle::Result::Continue;
+}
+
+void StreamingBuffer::onSubmit(ContextVk *contextVk)
+{
+    ResourceUseList *resourceUseList = &contextVk->getResourceUseList();
+    for (std::unique_ptr<BufferHelper> &bufferHelper : mInFlightBuffers)
+    {
+        bufferHelper->retain(resourceUseList);
+        bufferHelper->release(contextVk->getRenderer());
+    }
+    mInFlightBuffers.clear();
+
+    if (!mBuffer)
+    {
+        return;
+    }
+
+    // The segment's serial is set to the submission's once its commands are submitted.
+    Segment segment;
+    segment.size = mPendingSize;
+    segment.use.init();
+    resourceUseList->add(segment.use);
+    mSegments.emplace_back(std::move(segment));
+
+    mBuffer->retain(resourceUseList);
+    mPendingSize = 0;
+}
+
+void StreamingBuffer::release(RendererVk *renderer)
+{
+    reset();
+    mSize = 0;
+
+    ReleaseBufferListToRenderer(renderer, &mInFlightBuffers);
+
+    if (mBuffer)
+    {
+        mBuffer->release(renderer);
+        mBuffer.reset(nullptr);
+    }
+}
+
+void StreamingBuffer::setMinimumSizeForTesting(size_t minSize)
+{
+    mInitialSize = minSize;
+
+    // Forces a new buffer of the minimum size on the next allocation.
+    if (mBuffer)
+    {
+        mInFlightBuffers.push_back(std::move(mBuffer));
+    }
+
+    reset();
+    mSize = 0;
+}
+
+void StreamingBuffer::reset()
+{
+    for (Segment &segment : mSegments)
+    {
+        segment.use.release();
+    }
+    mSegments.clear();
+
+    mHead            = 0;
+    mTail            = 0;
+    mLastFlushOffset = 0;
+    mInUseSize       = 0;
+    mPendingSize     = 0;
+}
+
 // DynamicShadowBuffer implementation.
 DynamicShadowBuffer::DynamicShadowBuffer() : mInitialSize(0), mSize(0) {}
 
@@ -2248,6 +2623,166 @@ void DynamicDescriptorPool::SetMaxSetsPerPoolMultiplierForTesting(uint32_t maxSe
     mMaxSetsPerPoolMultiplier = maxSetsPerPoolMultiplier;
 }
 
+// DescriptorSetCache implementation.
+size_t DescriptorSetCache::mMaxCachedDescriptorSets = 2048;
+
+DescriptorSetCache::DescriptorSetCache()
+    : mNextBindingSignature(0),
+      mTexturesDescriptorSets(DescriptorSetMap<TextureDescriptorDesc>::NO_AUTO_EVICT),
+      mUniformsAndXfbDescriptorSets(DescriptorSetMap<UniformsAndXfbDesc>::NO_AUTO_EVICT)
+{}
+
+DescriptorSetCache::~DescriptorSetCache()
+{
+    ASSERT(mLayoutPools.empty());
+}
+
+void DescriptorSetCache::destroy(VkDevice device)
+{
+    mTexturesDescriptorSets.Clear();
+    mUniformsAndXfbDescriptorSets.Clear();
+
+    for (auto &layoutPool : mLayoutPools)
+    {
+        layoutPool.second->currentPoolBinding.reset();
+        layoutPool.second->pool.destroy(device);
+    }
+    mLayoutPools.clear();
+    mBindingSignatures.clear();
+}
+
+angle::Result DescriptorSetCache::initPool(ContextVk *contextVk,
+                                           VkDescriptorSetLayout descriptorSetLayout,
+                                           const std::vector<VkDescriptorPoolSize> &setSizes)
+{
+    std::unique_ptr<LayoutPool> &layoutPool = mLayoutPools[descriptorSetLayout];
+    if (layoutPool)
+    {
+        return angle::Result::Continue;
+    }
+
+    layoutPool = std::make_unique<LayoutPool>();
+    return layoutPool->pool.init(contextVk, setSizes.data(), setSizes.size(), descriptorSetLayout);
+}
+
+uint32_t DescriptorSetCache::getBindingSignature(const std::vector<uint32_t> &bindings)
+{
+    auto iter = mBindingSignatures.find(bindings);
+    if (iter != mBindingSignatures.end())
+    {
+        return iter->second;
+    }
+
+    const uint32_t signature = getUniqueBindingSignature();
+    mBindingSignatures.emplace(bindings, signature);
+    return signature;
+}
+
+angle::Result DescriptorSetCache::getTexturesDescriptorSet(
+    ContextVk *contextVk,
+    const DescriptorSetLayout &descriptorSetLayout,
+    uint32_t bindingSignature,
+    const TextureDescriptorDesc &desc,
+    RefCountedDescriptorPoolBinding *bindingOut,
+    VkDescriptorSet *descriptorSetOut,
+    bool *newDescriptorSetAllocatedOut)
+{
+    return getDescriptorSet(contextVk, &mTexturesDescriptorSets, descriptorSetLayout,
+                            bindingSignature, desc, bindingOut, descriptorSetOut,
+                            newDescriptorSetAllocatedOut);
+}
+
+angle::Result DescriptorSetCache::getUniformsAndXfbDescriptorSet(
+    ContextVk *contextVk,
+    const DescriptorSetLayout &descriptorSetLayout,
+    uint32_t bindingSignature,
+    const UniformsAndXfbDesc &desc,
+    RefCountedDescriptorPoolBinding *bindingOut,
+    VkDescriptorSet *descriptorSetOut,
+    bool *newDescriptorSetAllocatedOut)
+{
+    return getDescriptorSet(contextVk, &mUniformsAndXfbDescriptorSets, descriptorSetLayout,
+                            bindingSignature, desc, bindingOut, descriptorSetOut,
+                            newDescriptorSetAllocatedOut);
+}
+
+angle::Result DescriptorSetCache::allocateUncachedDescriptorSet(
+    ContextVk *contextVk,
+    const DescriptorSetLayout &descriptorSetLayout,
+    RefCountedDescriptorPoolBinding *bindingOut,
+    VkDescriptorSet *descriptorSetOut)
+{
+    auto layoutPool = mLayoutPools.find(descriptorSetLayout.getHandle());
+    ASSERT(layoutPool != mLayoutPools.end());
+    return layoutPool->second->pool.allocateSets(contextVk, descriptorSetLayout.ptr(), 1,
+                                                 bindingOut, descriptorSetOut);
+}
+
+template <typename DescT>
+angle::Result DescriptorSetCache::getDescriptorSet(ContextVk *contextVk,
+                                                   DescriptorSetMap<DescT> *cache,
+                                                   const DescriptorSetLayout &descriptorSetLayout,
+                                                   uint32_t bindingSignature,
+                                                   const DescT &desc,
+                                                   RefCountedDescriptorPoolBinding *bindingOut,
+                                                   VkDescriptorSet *descriptorSetOut,
+                                                   bool *newDescriptorSetAllocatedOut)
+{
+    const Key<DescT> key = {descriptorSetLayout.getHandle(), bindingSignature, desc};
+
+    auto iter = cache->Get(key);
+    if (iter != cache->end())
+    {
+        CachedDescriptorSet &cached = iter->second;
+
+        // The descriptor pool that this descriptor set was allocated from needs to be retained
+        // each time the descriptor set is used in a new command.
+        cached.poolBinding.get().retain(&contextVk->getResourceUseList());
+        bindingOut->set(cached.poolBinding);
+
+        *descriptorSetOut             = cached.descriptorSet;
+        *newDescriptorSetAllocatedOut = false;
+        contextVk->getPerfCounters().descriptorSetCacheHits++;
+        return angle::Result::Continue;
+    }
+
+    auto layoutPool = mLayoutPools.find(descriptorSetLayout.getHandle());
+    ASSERT(layoutPool != mLayoutPools.end());
+    LayoutPool &pool = *layoutPool->second;
+
+    // Evict the least recently used set, so that its pool can eventually be recycled.
+    if (cache->size() >= mMaxCachedDescriptorSets)
+    {
+        cache->Erase(cache->rbegin());
+        contextVk->getPerfCounters().descriptorSetCacheEvictions++;
+    }
+
+    CachedDescriptorSet cached;
+    ANGLE_TRY(pool.pool.allocateSets(contextVk, descriptorSetLayout.ptr(), 1,
+                                     &pool.currentPoolBinding, &cached.descriptorSet));
+    cached.poolBinding.set(pool.currentPoolBinding);
+    bindingOut->set(pool.currentPoolBinding);
+
+    *descriptorSetOut             = cached.descriptorSet;
+    *newDescriptorSetAllocatedOut = true;
+    contextVk->getPerfCounters().descriptorSetCacheMisses++;
+
+    cache->Put(key, std::move(cached));
+    return angle::Result::Continue;
+}
+
+// For testing only!
+size_t DescriptorSetCache::GetMaxCachedDescriptorSetsForTesting()
+{
+    return mMaxCachedDescriptorSets;
+}
+
+// For testing only!
+void DescriptorSetCache::SetMaxCachedDescriptorSetsForTesting(size_t maxCachedDescriptorSets)
+{
+    mMaxCachedDescriptorSets = maxCachedDescriptorSets;
+}
+
 // DynamicallyGrowingPool implementation
 template <typename Pool>
 DynamicallyGrowingPool<Pool>::DynamicallyGrowingPool()
@@ -2801,10 +3336,11 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
     }
     *indexCountOut       = numOutIndices;
     size_t allocateBytes = unitSize * numOutIndices;
-    ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
-                                           reinterpret_cast<uint8_t **>(&indices), nullptr,
-                                           bufferOffsetOut, nullptr));
-    *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
+
+    // Client indices are translated again for every draw call, so they are streamed.
+    StreamingBuffer *streamingBuffer = contextVk->getStreamingBuffer();
+    ANGLE_TRY(streamingBuffer->allocate(contextVk, allocateBytes, kIndexBufferAlignment, &indices,
+                                        bufferOut, bufferOffsetOut, nullptr));
 
     if (contextVk->getState().isPrimitiveRestartEnabled())
     {
@@ -2832,7 +3368,7 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
         }
     }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk));
+    ANGLE_TRY(streamingBuffer->flush(contextVk));
     return angle::Result::Continue;
 }
 
@@ -2967,7 +3503,9 @@ void PipelineBarrier::addDiagnosticsString(std::ostringstream &out) const
 
 // BufferHelper implementation.
 BufferHelper::BufferHelper()
-    : mMemoryPropertyFlags{},
+    : mBlock(nullptr),
+      mOffset(0),
+      mMemoryPropertyFlags{},
       mSize(0),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
       mCurrentWriteAccess(0),
@@ -3195,6 +3733,21 @@ angle::Result BufferHelper::initExternal(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void BufferHelper::initSuballocation(RendererVk *renderer,
+                                     BufferBlock *block,
+                                     VkDeviceSize offset,
+                                     VkDeviceSize size)
+{
+    ASSERT(!valid());
+
+    mSerial                  = renderer->getResourceSerialFactory().generateBufferSerial();
+    mBlock                   = block;
+    mOffset                  = offset;
+    mSize                    = size;
+    mMemoryPropertyFlags     = block->getBuffer().mMemoryPropertyFlags;
+    mCurrentQueueFamilyIndex = renderer->getQueueFamilyIndex();
+}
+
 angle::Result BufferHelper::initializeNonZeroMemory(Context *context, VkDeviceSize size)
 {
     // Staging buffer memory is non-zero-initialized in 'init'.
@@ -3228,6 +3781,12 @@ angle::Result BufferHelper::initializeNonZeroMemory(Context *context, VkDeviceSi
 
 void BufferHelper::destroy(RendererVk *renderer)
 {
+    if (mBlock)
+    {
+        release(renderer);
+        return;
+    }
+
     VkDevice device = renderer->getDevice();
     unmap(renderer);
     mSize = 0;
@@ -3238,6 +3797,17 @@ void BufferHelper::destroy(RendererVk *renderer)
 
 void BufferHelper::release(RendererVk *renderer)
 {
+    if (mBlock)
+    {
+        // The slot is only reused once the GPU is done with this buffer.
+        renderer->getBufferSuballocator().free(mBlock, std::move(mUse), mOffset);
+        mUse.init();
+        mBlock  = nullptr;
+        mOffset = 0;
+        mSize   = 0;
+        return;
+    }
+
     unmap(renderer);
     mSize = 0;
 
@@ -3257,7 +3827,19 @@ angle::Result BufferHelper::copyFromBuffer(ContextVk *contextVk,
     CommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
-    commandBuffer->copyBuffer(srcBuffer->getBuffer(), mBuffer, regionCount, copyRegions);
+    if (srcBuffer->getOffset() == 0 && mOffset == 0)
+    {
+        commandBuffer->copyBuffer(srcBuffer->getBuffer(), getBuffer(), regionCount, copyRegions);
+        return angle::Result::Continue;
+    }
+
+    std::vector<VkBufferCopy> regions(copyRegions, copyRegions + regionCount);
+    for (VkBufferCopy &region : regions)
+    {
+        region.srcOffset += srcBuffer->getOffset();
+        region.dstOffset += mOffset;
+    }
+    commandBuffer->copyBuffer(srcBuffer->getBuffer(), getBuffer(), regionCount, regions.data());
 
     return angle::Result::Continue;
 }
@@ -3269,6 +3851,11 @@ void BufferHelper::unmap(RendererVk *renderer)
 
 angle::Result BufferHelper::flush(RendererVk *renderer, VkDeviceSize offset, VkDeviceSize size)
 {
+    if (mBlock)
+    {
+        return mBlock->getBuffer().flush(renderer, mOffset + offset, size);
+    }
+
     bool hostVisible  = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
@@ -3280,6 +3867,11 @@ angle::Result BufferHelper::flush(RendererVk *renderer, VkDeviceSize offset, VkD
 
 angle::Result BufferHelper::invalidate(RendererVk *renderer, VkDeviceSize offset, VkDeviceSize size)
 {
+    if (mBlock)
+    {
+        return mBlock->getBuffer().invalidate(renderer, mOffset + offset, size);
+    }
+
     bool hostVisible  = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
@@ -3297,9 +3889,9 @@ void BufferHelper::changeQueue(uint32_t newQueueFamilyIndex, CommandBuffer *comm
     bufferMemoryBarrier.dstAccessMask         = 0;
     bufferMemoryBarrier.srcQueueFamilyIndex   = mCurrentQueueFamilyIndex;
     bufferMemoryBarrier.dstQueueFamilyIndex   = newQueueFamilyIndex;
-    bufferMemoryBarrier.buffer                = mBuffer.getHandle();
-    bufferMemoryBarrier.offset                = 0;
-    bufferMemoryBarrier.size                  = VK_WHOLE_SIZE;
+    bufferMemoryBarrier.buffer                = getBuffer().getHandle();
+    bufferMemoryBarrier.offset                = mOffset;
+    bufferMemoryBarrier.size                  = mBlock ? mSize : VK_WHOLE_SIZE;
 
     commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, &bufferMemoryBarrier);
@@ -3382,6 +3974,186 @@ bool BufferHelper::recordWriteBarrier(VkAccessFlags writeAccessType,
     return barrierModified;
 }
 
+// BufferBlock implementation.
+BufferBlock::BufferBlock() : mUsage(0), mMemoryPropertyFlags(0), mSlotSize(0) {}
+
+BufferBlock::~BufferBlock()
+{
+    ASSERT(mPendingSlots.empty());
+}
+
+angle::Result BufferBlock::init(ContextVk *contextVk,
+                                VkBufferUsageFlags usage,
+                                VkMemoryPropertyFlags memoryPropertyFlags,
+                                VkDeviceSize slotSize)
+{
+    ASSERT(gl::isPow2(slotSize));
+    const VkDeviceSize blockSize =
+        std::max(kMinBufferBlockSize, slotSize * kMinBufferSlotsPerBlock);
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = blockSize;
+    createInfo.usage                 = usage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(mBuffer.init(contextVk, createInfo, memoryPropertyFlags));
+
+    // Only host visible buffers are sub-allocated, and the block stays mapped for all of them.
+    ASSERT(mBuffer.isHostVisible());
+    uint8_t *mappedMemory = nullptr;
+    ANGLE_TRY(mBuffer.map(contextVk, &mappedMemory));
+
+    mUsage               = usage;
+    mMemoryPropertyFlags = memoryPropertyFlags;
+    mSlotSize            = slotSize;
+
+    // Hand out the slots from the start of the block.
+    const uint32_t slotCount = static_cast<uint32_t>(blockSize / slotSize);
+    mFreeSlots.reserve(slotCount);
+    for (uint32_t slot = slotCount; slot > 0; --slot)
+    {
+        mFreeSlots.push_back(slot - 1);
+    }
+
+    return angle::Result::Continue;
+}
+
+void BufferBlock::destroy(RendererVk *renderer)
+{
+    for (PendingSlot &pending : mPendingSlots)
+    {
+        pending.use.release();
+    }
+    mPendingSlots.clear();
+    mFreeSlots.clear();
+
+    mBuffer.destroy(renderer);
+}
+
+bool BufferBlock::allocateSlot(Serial lastCompletedSerial, VkDeviceSize *offsetOut)
+{
+    if (mFreeSlots.empty())
+    {
+        // Reclaim the slots of released buffers the GPU is done with.
+        for (size_t index = 0; index < mPendingSlots.size();)
+        {
+            PendingSlot &pending = mPendingSlots[index];
+            if (pending.use.isCurrentlyInUse(lastCompletedSerial))
+            {
+                ++index;
+                continue;
+            }
+
+            pending.use.release();
+            mFreeSlots.push_back(pending.slot);
+            pending = std::move(mPendingSlots.back());
+            mPendingSlots.pop_back();
+        }
+
+        if (mFreeSlots.empty())
+        {
+            return false;
+        }
+    }
+
+    *offsetOut = mFreeSlots.back() * mSlotSize;
+    mFreeSlots.pop_back();
+    return true;
+}
+
+void BufferBlock::freeSlot(SharedResourceUse &&use, VkDeviceSize offset)
+{
+    ASSERT(offset % mSlotSize == 0);
+    mPendingSlots.push_back({std::move(use), static_cast<uint32_t>(offset / mSlotSize)});
+}
+
+// BufferSuballocator implementation.
+BufferSuballocator::BufferSuballocator() = default;
+
+BufferSuballocator::~BufferSuballocator()
+{
+    ASSERT(mBlocks.empty());
+}
+
+void BufferSuballocator::destroy(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (std::unique_ptr<BufferBlock> &block : mBlocks)
+    {
+        block->destroy(renderer);
+    }
+    mBlocks.clear();
+}
+
+angle::Result BufferSuballocator::allocate(ContextVk *contextVk,
+                                           VkDeviceSize size,
+                                           VkBufferUsageFlags usage,
+                                           VkMemoryPropertyFlags memoryPropertyFlags,
+                                           BufferHelper *bufferOut)
+{
+    ASSERT(size > 0 && size <= kMaxSuballocatedBufferSize);
+
+    RendererVk *renderer                 = contextVk->getRenderer();
+    const VkPhysicalDeviceLimits &limits = renderer->getPhysicalDeviceProperties().limits;
+
+    // The slot size is a multiple of every alignment a buffer offset may need, which are all
+    // powers of two.
+    VkDeviceSize slotSize =
+        std::max<VkDeviceSize>(gl::ceilPow2(static_cast<uint32_t>(size)), kMinBufferSlotSize);
+    for (VkDeviceSize alignment :
+         {limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment,
+          limits.minTexelBufferOffsetAlignment, limits.nonCoherentAtomSize})
+    {
+        slotSize = std::max(slotSize, alignment);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const Serial lastCompletedSerial = contextVk->getLastCompletedQueueSerial();
+    BufferBlock *block               = nullptr;
+    VkDeviceSize offset              = 0;
+
+    for (std::unique_ptr<BufferBlock> &candidate : mBlocks)
+    {
+        if (candidate->getUsage() == usage &&
+            candidate->getRequestedMemoryPropertyFlags() == memoryPropertyFlags &&
+            candidate->getSlotSize() == slotSize &&
+            candidate->allocateSlot(lastCompletedSerial, &offset))
+        {
+            block = candidate.get();
+            break;
+        }
+    }
+
+    if (block == nullptr)
+    {
+        std::unique_ptr<BufferBlock> newBlock = std::make_unique<BufferBlock>();
+        ANGLE_TRY(newBlock->init(contextVk, usage, memoryPropertyFlags, slotSize));
+
+        bool allocated = newBlock->allocateSlot(lastCompletedSerial, &offset);
+        ASSERT(allocated);
+        ANGLE_UNUSED_VARIABLE(allocated);
+
+        block = newBlock.get();
+        mBlocks.push_back(std::move(newBlock));
+    }
+
+    bufferOut->initSuballocation(renderer, block, offset, size);
+
+    return angle::Result::Continue;
+}
+
+void BufferSuballocator::free(BufferBlock *block, SharedResourceUse &&use, VkDeviceSize offset)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    block->freeSlot(std::move(use), offset);
+}
+
 // ImageHelper implementation.
 ImageHelper::ImageHelper()
 {
@@ -4708,10 +5480,12 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
 
     LoadImageFunctionInfo loadFunctionInfo = vkFormat.textureLoadFunctions(type);
     LoadImageFunction stencilLoadFunction  = nullptr;
+    size_t storageBlockHeight              = 1;
 
     if (storageFormat.isBlock)
     {
         const gl::InternalFormat &storageFormatInfo = vkFormat.getInternalFormatInfo(type);
+        storageBlockHeight                          = storageFormatInfo.compressedBlockHeight;
         GLuint rowPitch;
         GLuint depthPitch;
         GLuint totalSize;
@@ -4805,9 +5579,27 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
 
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
-    loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
-                                  inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
-                                  outputDepthPitch);
+    RendererVk *renderer = contextVk->getRenderer();
+    if (renderer->getFeatures().parallelTextureLoad.enabled &&
+        loadFunctionInfo.requiresConversion && allocationSize >= kMinParallelTextureLoadSize)
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::stageSubresourceUpdateImpl parallel load");
+        const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+        const size_t taskCount   = std::min(kMaxParallelTextureLoadTasks, threadCount);
+        const size_t inputBlockHeight =
+            formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        LoadImageParallel(renderer->getWorkerThreadPool(), taskCount,
+                          loadFunctionInfo.loadFunction, inputBlockHeight, storageBlockHeight,
+                          glExtents.width, glExtents.height, glExtents.depth, source,
+                          inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
+                          outputDepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
+                                      inputRowPitch, inputDepthPitch, stagingPointer,
+                                      outputRowPitch, outputDepthPitch);
+    }
 
     VkBufferImageCopy copy         = {};
     VkImageAspectFlags aspectFlags = GetFormatAspectFlags(vkFormat.actualImageFormat());
@@ -5508,6 +6300,13 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
     CommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
+    // Consecutive buffer updates are gathered in a batch and copied by a single command, which
+    // is recorded once an update that can't join the batch is found.  Texture atlases are typically
+    // filled with many small non-overlapping updates, which would otherwise each need their own
+    // copy and a barrier.
+    BufferHelper *batchBuffer = nullptr;
+    std::vector<VkBufferImageCopy> batchRegions;
+
     for (gl::LevelIndex updateMipLevelGL = levelGLStart; updateMipLevelGL < levelGLEnd;
          ++updateMipLevelGL)
     {
@@ -5570,6 +6369,21 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                 update.image.copyRegion.dstSubresource.mipLevel = updateMipLevelVk.get();
             }
 
+            // Every update since the last barrier that writes to the layers of the batch is part
+            // of the batch, so an update that joins it doesn't need a barrier either.
+            if (update.updateSource == UpdateSource::Buffer &&
+                CanBatchBufferUpdate(batchBuffer, batchRegions, update.buffer.bufferHelper,
+                                     update.buffer.copyRegion))
+            {
+                batchRegions.push_back(update.buffer.copyRegion);
+                onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
+                        update.buffer.copyRegion.imageSubresource.aspectMask);
+                update.release(contextVk->getRenderer());
+                continue;
+            }
+
+            recordBufferUpdateBatch(batchBuffer, commandBuffer, &batchRegions);
+
             if (updateLayerCount >= kMaxParallelSubresourceUpload)
             {
                 // If there are more subresources than bits we can track, always insert a barrier.
@@ -5617,8 +6431,9 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                 ANGLE_TRY(
                     contextVk->getOutsideRenderPassCommandBuffer(bufferAccess, &commandBuffer));
 
-                commandBuffer->copyBufferToImage(currentBuffer->getBuffer().getHandle(), mImage,
-                                                 getCurrentLayout(), 1, &update.buffer.copyRegion);
+                // Start a new batch with this update.
+                batchBuffer = currentBuffer;
+                batchRegions.push_back(update.buffer.copyRegion);
                 onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
                         update.buffer.copyRegion.imageSubresource.aspectMask);
             }
@@ -5639,6 +6454,8 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
             update.release(contextVk->getRenderer());
         }
 
+        recordBufferUpdateBatch(batchBuffer, commandBuffer, &batchRegions);
+
         // Only remove the updates that were actually applied to the image.
         *levelUpdates = std::move(updatesToKeep);
     }
@@ -5718,6 +6535,22 @@ bool ImageHelper::hasStagedUpdatesInLevels(gl::LevelIndex levelStart, gl::LevelI
     return false;
 }
 
+void ImageHelper::recordBufferUpdateBatch(BufferHelper *batchBuffer,
+                                          CommandBuffer *commandBuffer,
+                                          std::vector<VkBufferImageCopy> *batchRegions)
+{
+    if (batchRegions->empty())
+    {
+        return;
+    }
+
+    commandBuffer->copyBufferToImage(batchBuffer->getBuffer().getHandle(), mImage,
+                                     getCurrentLayout(),
+                                     static_cast<uint32_t>(batchRegions->size()),
+                                     batchRegions->data());
+    batchRegions->clear();
+}
+
 void ImageHelper::removeSupersededUpdates(gl::TexLevelMask skipLevelsMask)
 {
     if (mLayerCount > 64)
@@ -6883,7 +7716,7 @@ angle::Result BufferViewHelper::getView(ContextVk *contextVk,
     viewCreateInfo.sType                  = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
     viewCreateInfo.buffer                 = buffer.getBuffer().getHandle();
     viewCreateInfo.format                 = format.vkBufferFormat;
-    viewCreateInfo.offset                 = mOffset;
+    viewCreateInfo.offset                 = buffer.getOffset() + mOffset;
     viewCreateInfo.range                  = size;
 
     BufferView view;
@@ -6916,10 +7749,10 @@ bool ShaderProgramHelper::valid(const gl::ShaderType shaderType) const
     return mShaders[shaderType].valid();
 }
 
-void ShaderProgramHelper::destroy(VkDevice device)
+void ShaderProgramHelper::destroy(RendererVk *renderer)
 {
-    mGraphicsPipelines.destroy(device);
-    mComputePipeline.destroy(device);
+    mGraphicsPipelines.destroy(renderer);
+    mComputePipeline.destroy(renderer->getDevice());
     for (BindingPointer<ShaderAndSerial> &shader : mShaders)
     {
         shader.reset();
@@ -6965,6 +7798,33 @@ void ShaderProgramHelper::setSpecializationConstant(sh::vk::SpecializationConsta
     }
 }
 
+angle::Result ShaderProgramHelper::warmUpGraphicsPipeline(
+    ContextVk *contextVk,
+    RenderPassCache *renderPassCache,
+    const PipelineCache &pipelineCache,
+    const PipelineLayout &pipelineLayout,
+    const GraphicsPipelineDesc &pipelineDesc,
+    const gl::AttributesMask &activeAttribLocationsMask,
+    const gl::ComponentTypeMask &programAttribsTypeMask)
+{
+    RenderPass *compatibleRenderPass = nullptr;
+    ANGLE_TRY(renderPassCache->getCompatibleRenderPass(contextVk, pipelineDesc.getRenderPassDesc(),
+                                                       &compatibleRenderPass));
+
+    ShaderModule *vertexShader   = &mShaders[gl::ShaderType::Vertex].get().get();
+    ShaderModule *fragmentShader = mShaders[gl::ShaderType::Fragment].valid()
+                                       ? &mShaders[gl::ShaderType::Fragment].get().get()
+                                       : nullptr;
+    ShaderModule *geometryShader = mShaders[gl::ShaderType::Geometry].valid()
+                                       ? &mShaders[gl::ShaderType::Geometry].get().get()
+                                       : nullptr;
+
+    return mGraphicsPipelines.warmUpPipeline(contextVk, pipelineCache, *compatibleRenderPass,
+                                             pipelineLayout, activeAttribLocationsMask,
+                                             programAttribsTypeMask, vertexShader, fragmentShader,
+                                             geometryShader, mSpecializationConstants, pipelineDesc);
+}
+
 angle::Result ShaderProgramHelper::getComputePipeline(Context *context,
                                                       const PipelineLayout &pipelineLayout,
                                                       PipelineAndSerial **pipelineOut)
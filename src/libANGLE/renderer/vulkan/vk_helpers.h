@@ -9,6 +9,12 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 
+#include <deque>
+#include <map>
+#include <mutex>
+
+#include <anglebase/containers/mru_cache.h>
+
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
@@ -31,6 +37,8 @@ constexpr VkBufferUsageFlags kIndirectBufferUsageFlags =
 constexpr size_t kVertexBufferAlignment   = 4;
 constexpr size_t kIndexBufferAlignment    = 4;
 constexpr size_t kIndirectBufferAlignment = 4;
+constexpr VkBufferUsageFlags kStreamingBufferUsageFlags =
+    kVertexBufferUsageFlags | kIndexBufferUsageFlags | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
 
 constexpr VkBufferUsageFlags kStagingBufferFlags =
     VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
@@ -40,6 +48,8 @@ constexpr VkImageCreateFlags kVkImageCreateFlagsNone = 0;
 
 using StagingBufferOffsetArray = std::array<VkDeviceSize, 2>;
 
+class ParallelCommandRecorder;
+
 struct TextureUnit final
 {
     TextureVk *texture;
@@ -164,6 +174,87 @@ class DynamicBuffer : angle::NonCopyable
     BufferHelperPointerVector mBufferFreeList;
 };
 
+// A streaming buffer is a persistently mapped ring buffer that a context's transient vertex, index
+// and uniform data is sub-allocated from.  The data written between two submissions forms a
+// segment of the ring, which is reused once the GPU is done with it.  A new VkBuffer is only
+// created when the ring runs out of space, so none are created once the ring has grown to hold a
+// few frames' worth of data.
+//
+// Data written to the ring is only valid for the submission that follows it.  Users that cache
+// allocations across draw calls must write their data again after every submission.
+class StreamingBuffer : angle::NonCopyable
+{
+  public:
+    StreamingBuffer();
+    ~StreamingBuffer();
+
+    void init(RendererVk *renderer, size_t initialSize);
+
+    // Allocates a region of the current buffer, if it has room for it once the regions the GPU is
+    // done with are reclaimed.  Otherwise, |*allocatedOut| is false and the current buffer is
+    // kept.
+    angle::Result allocateFromCurrentBuffer(ContextVk *contextVk,
+                                            size_t sizeInBytes,
+                                            size_t alignment,
+                                            uint8_t **ptrOut,
+                                            VkDeviceSize *offsetOut,
+                                            bool *allocatedOut);
+
+    // Allocates a region of the ring.  If the ring is full, this switches to a larger buffer (which
+    // is returned in the optional parameter `newBufferAllocatedOut`), or waits for the GPU to
+    // finish with old data once the ring has reached its maximum size.
+    angle::Result allocate(ContextVk *contextVk,
+                           size_t sizeInBytes,
+                           size_t alignment,
+                           uint8_t **ptrOut,
+                           BufferHelper **bufferOut,
+                           VkDeviceSize *offsetOut,
+                           bool *newBufferAllocatedOut);
+
+    // After a sequence of writes, call flush to ensure the data is visible to the device.
+    angle::Result flush(ContextVk *contextVk);
+
+    // Closes the segment written since the last submission.  Called right before the context
+    // submits its commands.
+    void onSubmit(ContextVk *contextVk);
+
+    // This releases resources when they might currently be in use.
+    void release(RendererVk *renderer);
+
+    BufferHelper *getCurrentBuffer() const { return mBuffer.get(); }
+
+    // For testing only!
+    void setMinimumSizeForTesting(size_t minSize);
+
+  private:
+    struct Segment
+    {
+        size_t size;
+        SharedResourceUse use;
+    };
+
+    void reset();
+    void reclaim(Serial lastCompletedSerial);
+    angle::Result allocateNewBuffer(ContextVk *contextVk, size_t minSize);
+
+    size_t mInitialSize;
+    size_t mNonCoherentAtomSize;
+    std::unique_ptr<BufferHelper> mBuffer;
+    size_t mSize;
+    // Buffers that were replaced since the last submission.
+    BufferHelperPointerVector mInFlightBuffers;
+    // The next allocation is made at or after the head, and the oldest region the GPU may still
+    // read starts at the tail.
+    size_t mHead;
+    size_t mTail;
+    size_t mLastFlushOffset;
+    // Bytes between the tail and the head, including the bytes skipped when the head wraps.
+    size_t mInUseSize;
+    // Bytes allocated since the last submission.
+    size_t mPendingSize;
+    std::deque<Segment> mSegments;
+};
+
 // Based off of the DynamicBuffer class, DynamicShadowBuffer provides
 // a similar conceptually infinitely long buffer that will only be written
 // to and read by the CPU. This can be used to provide CPU cached copies of
@@ -328,6 +419,124 @@ class DynamicDescriptorPool final : angle::NonCopyable
     VkDescriptorSetLayout mCachedDescriptorSetLayout;
 };
 
+// Descriptor sets shared by all the programs of a share group.  A program can reuse a set that
+// another program wrote if both use the same descriptor set layout, write the same texture units
+// or buffers to the same bindings, and the same resources are bound to them.  The second condition
+// is identified by a binding signature, which programs get from the cache.
+//
+// Each cached set keeps the pool it was allocated from referenced.  Once the cache is full, the
+// least recently used set is evicted, and its pool can be recycled by the DynamicDescriptorPool
+// when all its sets are evicted and the GPU is done with them.  This keeps the number of pools
+// bounded regardless of how many different resources a long running application binds.
+class DescriptorSetCache final : angle::NonCopyable
+{
+  public:
+    DescriptorSetCache();
+    ~DescriptorSetCache();
+
+    void destroy(VkDevice device);
+
+    // Creates the pool for the layout's sets, if it doesn't exist yet.
+    angle::Result initPool(ContextVk *contextVk,
+                           VkDescriptorSetLayout descriptorSetLayout,
+                           const std::vector<VkDescriptorPoolSize> &setSizes);
+
+    // Returns the same signature for equal |bindings|.
+    uint32_t getBindingSignature(const std::vector<uint32_t> &bindings);
+    // Returns a signature no other program has, for sets that are not shared between programs.
+    uint32_t getUniqueBindingSignature() { return mNextBindingSignature++; }
+
+    // If the set is not in the cache, a new one is allocated which the caller needs to write.
+    // Either way, the pool of the set is retained by the context's current commands and bound to
+    // |bindingOut|.
+    angle::Result getTexturesDescriptorSet(ContextVk *contextVk,
+                                           const DescriptorSetLayout &descriptorSetLayout,
+                                           uint32_t bindingSignature,
+                                           const TextureDescriptorDesc &desc,
+                                           RefCountedDescriptorPoolBinding *bindingOut,
+                                           VkDescriptorSet *descriptorSetOut,
+                                           bool *newDescriptorSetAllocatedOut);
+    angle::Result getUniformsAndXfbDescriptorSet(ContextVk *contextVk,
+                                                 const DescriptorSetLayout &descriptorSetLayout,
+                                                 uint32_t bindingSignature,
+                                                 const UniformsAndXfbDesc &desc,
+                                                 RefCountedDescriptorPoolBinding *bindingOut,
+                                                 VkDescriptorSet *descriptorSetOut,
+                                                 bool *newDescriptorSetAllocatedOut);
+
+    // Allocates a set from the layout's pool that is not cached, such as the empty sets bound for
+    // the bindEmptyForUnusedDescriptorSets workaround.
+    angle::Result allocateUncachedDescriptorSet(ContextVk *contextVk,
+                                                const DescriptorSetLayout &descriptorSetLayout,
+                                                RefCountedDescriptorPoolBinding *bindingOut,
+                                                VkDescriptorSet *descriptorSetOut);
+
+    // For testing only!
+    static size_t GetMaxCachedDescriptorSetsForTesting();
+    static void SetMaxCachedDescriptorSetsForTesting(size_t maxCachedDescriptorSets);
+
+  private:
+    template <typename DescT>
+    struct Key
+    {
+        bool operator==(const Key &other) const
+        {
+            return descriptorSetLayout == other.descriptorSetLayout &&
+                   bindingSignature == other.bindingSignature && desc == other.desc;
+        }
+
+        VkDescriptorSetLayout descriptorSetLayout;
+        uint32_t bindingSignature;
+        DescT desc;
+    };
+
+    template <typename DescT>
+    struct KeyHash
+    {
+        size_t operator()(const Key<DescT> &key) const
+        {
+            return key.desc.hash() ^ std::hash<VkDescriptorSetLayout>()(key.descriptorSetLayout) ^
+                   (static_cast<size_t>(key.bindingSignature) << 16);
+        }
+    };
+
+    struct CachedDescriptorSet
+    {
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        RefCountedDescriptorPoolBinding poolBinding;
+    };
+
+    template <typename DescT>
+    using DescriptorSetMap =
+        angle::base::HashingMRUCache<Key<DescT>, CachedDescriptorSet, KeyHash<DescT>>;
+
+    // The pool of each layout's sets, and the pool new sets are currently allocated from.
+    struct LayoutPool
+    {
+        DynamicDescriptorPool pool;
+        RefCountedDescriptorPoolBinding currentPoolBinding;
+    };
+
+    template <typename DescT>
+    angle::Result getDescriptorSet(ContextVk *contextVk,
+                                   DescriptorSetMap<DescT> *cache,
+                                   const DescriptorSetLayout &descriptorSetLayout,
+                                   uint32_t bindingSignature,
+                                   const DescT &desc,
+                                   RefCountedDescriptorPoolBinding *bindingOut,
+                                   VkDescriptorSet *descriptorSetOut,
+                                   bool *newDescriptorSetAllocatedOut);
+
+    static size_t mMaxCachedDescriptorSets;
+
+    angle::HashMap<VkDescriptorSetLayout, std::unique_ptr<LayoutPool>> mLayoutPools;
+    std::map<std::vector<uint32_t>, uint32_t> mBindingSignatures;
+    uint32_t mNextBindingSignature;
+
+    DescriptorSetMap<TextureDescriptorDesc> mTexturesDescriptorSets;
+    DescriptorSetMap<UniformsAndXfbDesc> mUniformsAndXfbDescriptorSets;
+};
+
 template <typename Pool>
 class DynamicallyGrowingPool : angle::NonCopyable
 {
@@ -801,6 +1010,8 @@ class BufferMemory : angle::NonCopyable
     uint8_t *mMappedMemory;
 };
 
+class BufferBlock;
+
 class BufferHelper final : public Resource
 {
   public:
@@ -814,19 +1025,24 @@ class BufferHelper final : public Resource
                                VkMemoryPropertyFlags memoryProperties,
                                const VkBufferCreateInfo &requestedCreateInfo,
                                GLeglClientBufferEXT clientBuffer);
+    // Makes this buffer a range of a block that is shared with other buffers.
+    void initSuballocation(RendererVk *renderer,
+                           BufferBlock *block,
+                           VkDeviceSize offset,
+                           VkDeviceSize size);
     void destroy(RendererVk *renderer);
 
     void release(RendererVk *renderer);
 
     BufferSerial getBufferSerial() const { return mSerial; }
-    bool valid() const { return mBuffer.valid(); }
-    const Buffer &getBuffer() const { return mBuffer; }
+    bool valid() const { return mBlock != nullptr || mBuffer.valid(); }
+    const Buffer &getBuffer() const;
+    // The offset of the buffer's data in getBuffer().  Only sub-allocated buffers have a non-zero
+    // offset, which must be added to every offset given to Vulkan along with getBuffer().
+    VkDeviceSize getOffset() const { return mOffset; }
     VkDeviceSize getSize() const { return mSize; }
-    uint8_t *getMappedMemory() const
-    {
-        ASSERT(isMapped());
-        return mMemory.getMappedMemory();
-    }
+    bool isSuballocated() const { return mBlock != nullptr; }
+    uint8_t *getMappedMemory() const;
     bool isHostVisible() const
     {
         return (mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
@@ -836,10 +1052,12 @@ class BufferHelper final : public Resource
         return (mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
     }
 
-    bool isMapped() const { return mMemory.getMappedMemory() != nullptr; }
+    // Sub-allocated buffers are persistently mapped through their block.
+    bool isMapped() const { return mBlock != nullptr || mMemory.getMappedMemory() != nullptr; }
     bool isExternalBuffer() const { return mMemory.isExternalBuffer(); }
 
-    // Also implicitly sets up the correct barriers.
+    // Also implicitly sets up the correct barriers.  The offsets of the regions are relative to the
+    // source and destination buffers.
     angle::Result copyFromBuffer(ContextVk *contextVk,
                                  BufferHelper *srcBuffer,
                                  uint32_t regionCount,
@@ -847,16 +1065,10 @@ class BufferHelper final : public Resource
 
     angle::Result map(ContextVk *contextVk, uint8_t **ptrOut)
     {
-        return mMemory.map(contextVk, mSize, ptrOut);
+        return mapWithOffset(contextVk, ptrOut, 0);
     }
 
-    angle::Result mapWithOffset(ContextVk *contextVk, uint8_t **ptrOut, size_t offset)
-    {
-        uint8_t *mapBufPointer;
-        ANGLE_TRY(mMemory.map(contextVk, mSize, &mapBufPointer));
-        *ptrOut = mapBufPointer + offset;
-        return angle::Result::Continue;
-    }
+    angle::Result mapWithOffset(ContextVk *contextVk, uint8_t **ptrOut, size_t offset);
 
     void unmap(RendererVk *renderer);
 
@@ -898,6 +1110,10 @@ class BufferHelper final : public Resource
     Buffer mBuffer;
     BufferMemory mMemory;
 
+    // Set if the buffer is sub-allocated, in which case mBuffer and mMemory are not used.
+    BufferBlock *mBlock;
+    VkDeviceSize mOffset;
+
     // Cached properties.
     VkMemoryPropertyFlags mMemoryPropertyFlags;
     VkDeviceSize mSize;
@@ -912,6 +1128,102 @@ class BufferHelper final : public Resource
     BufferSerial mSerial;
 };
 
+// Buffers of up to this size are sub-allocated from blocks shared with other buffers.
+constexpr VkDeviceSize kMaxSuballocatedBufferSize = 64 * 1024;
+
+// A large VkBuffer that small buffers are sub-allocated from, so that applications with many small
+// buffers don't pay for a VkBuffer and a memory allocation per buffer.  The block is split into
+// equally sized power-of-two slots, so every slot offset satisfies the offset alignments of
+// uniform, storage and texel buffers.  The slot of a released buffer is reused once the GPU is done
+// with it.
+class BufferBlock final : angle::NonCopyable
+{
+  public:
+    BufferBlock();
+    ~BufferBlock();
+
+    angle::Result init(ContextVk *contextVk,
+                       VkBufferUsageFlags usage,
+                       VkMemoryPropertyFlags memoryPropertyFlags,
+                       VkDeviceSize slotSize);
+    void destroy(RendererVk *renderer);
+
+    // Returns false if every slot is in use.
+    bool allocateSlot(Serial lastCompletedSerial, VkDeviceSize *offsetOut);
+    void freeSlot(SharedResourceUse &&use, VkDeviceSize offset);
+
+    const BufferHelper &getBuffer() const { return mBuffer; }
+    BufferHelper &getBuffer() { return mBuffer; }
+    VkBufferUsageFlags getUsage() const { return mUsage; }
+    VkMemoryPropertyFlags getRequestedMemoryPropertyFlags() const { return mMemoryPropertyFlags; }
+    VkDeviceSize getSlotSize() const { return mSlotSize; }
+
+  private:
+    struct PendingSlot
+    {
+        SharedResourceUse use;
+        uint32_t slot;
+    };
+
+    BufferHelper mBuffer;
+    VkBufferUsageFlags mUsage;
+    VkMemoryPropertyFlags mMemoryPropertyFlags;
+    VkDeviceSize mSlotSize;
+    std::vector<uint32_t> mFreeSlots;
+    // Slots of released buffers that the GPU may still be using.
+    std::vector<PendingSlot> mPendingSlots;
+};
+
+// Owns the blocks of every usage, memory type and slot size.  Blocks are kept until the renderer is
+// destroyed, so a slot freed by one buffer is reused by the next buffer of its size class.
+class BufferSuballocator final : angle::NonCopyable
+{
+  public:
+    BufferSuballocator();
+    ~BufferSuballocator();
+
+    void destroy(RendererVk *renderer);
+
+    angle::Result allocate(ContextVk *contextVk,
+                           VkDeviceSize size,
+                           VkBufferUsageFlags usage,
+                           VkMemoryPropertyFlags memoryPropertyFlags,
+                           BufferHelper *bufferOut);
+    void free(BufferBlock *block, SharedResourceUse &&use, VkDeviceSize offset);
+
+  private:
+    // Buffers are sub-allocated by any context of the renderer.
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<BufferBlock>> mBlocks;
+};
+
+ANGLE_INLINE const Buffer &BufferHelper::getBuffer() const
+{
+    return mBlock ? mBlock->getBuffer().getBuffer() : mBuffer;
+}
+
+ANGLE_INLINE uint8_t *BufferHelper::getMappedMemory() const
+{
+    ASSERT(isMapped());
+    return mBlock ? mBlock->getBuffer().getMappedMemory() + mOffset : mMemory.getMappedMemory();
+}
+
+ANGLE_INLINE angle::Result BufferHelper::mapWithOffset(ContextVk *contextVk,
+                                                       uint8_t **ptrOut,
+                                                       size_t offset)
+{
+    if (mBlock)
+    {
+        *ptrOut = getMappedMemory() + offset;
+        return angle::Result::Continue;
+    }
+
+    uint8_t *mapBufPointer;
+    ANGLE_TRY(mMemory.map(contextVk, mSize, &mapBufPointer));
+    *ptrOut = mapBufPointer + offset;
+    return angle::Result::Continue;
+}
+
 enum class BufferAccess
 {
     Read,
@@ -1000,9 +1312,12 @@ class CommandBufferHelper : angle::NonCopyable
 
     CommandBuffer &getCommandBuffer() { return mCommandBuffer; }
 
-    angle::Result flushToPrimary(const angle::FeaturesVk &features,
+    // If |parallelRecorder| is given, large render passes are recorded into secondary command
+    // buffers on worker threads instead of being replayed inline into |primary|.
+    angle::Result flushToPrimary(Context *context,
                                  PrimaryCommandBuffer *primary,
-                                 const RenderPass *renderPass);
+                                 const RenderPass *renderPass,
+                                 ParallelCommandRecorder *parallelRecorder);
 
     void executeBarriers(const angle::FeaturesVk &features, PrimaryCommandBuffer *primary);
 
@@ -1796,6 +2111,12 @@ class ImageHelper final : public Resource, public angle::Subject
     // extents are not known).
     void removeSupersededUpdates(gl::TexLevelMask skipLevelsMask);
 
+    // Called from flushStagedUpdates, records the copy of a batch of buffer updates and empties the
+    // batch.
+    void recordBufferUpdateBatch(BufferHelper *batchBuffer,
+                                 CommandBuffer *commandBuffer,
+                                 std::vector<VkBufferImageCopy> *batchRegions);
+
     void initImageMemoryBarrierStruct(VkImageAspectFlags aspectMask,
                                       ImageLayout newLayout,
                                       uint32_t newQueueFamilyIndex,
@@ -2251,7 +2572,7 @@ class ShaderProgramHelper : angle::NonCopyable
     ~ShaderProgramHelper();
 
     bool valid(const gl::ShaderType shaderType) const;
-    void destroy(VkDevice device);
+    void destroy(RendererVk *renderer);
     void release(ContextVk *contextVk);
 
     ShaderAndSerial &getShader(gl::ShaderType shaderType) { return mShaders[shaderType].get(); }
@@ -2290,10 +2611,22 @@ class ShaderProgramHelper : angle::NonCopyable
             geometryShader, mSpecializationConstants, pipelineDesc, descPtrOut, pipelineOut);
     }
 
+    // Starts creating a pipeline on a worker thread if it's not in the cache yet, without waiting
+    // for it.
+    angle::Result warmUpGraphicsPipeline(ContextVk *contextVk,
+                                         RenderPassCache *renderPassCache,
+                                         const PipelineCache &pipelineCache,
+                                         const PipelineLayout &pipelineLayout,
+                                         const GraphicsPipelineDesc &pipelineDesc,
+                                         const gl::AttributesMask &activeAttribLocationsMask,
+                                         const gl::ComponentTypeMask &programAttribsTypeMask);
+
     angle::Result getComputePipeline(Context *context,
                                      const PipelineLayout &pipelineLayout,
                                      PipelineAndSerial **pipelineOut);
 
+    GraphicsPipelineCache &getGraphicsPipelineCache() { return mGraphicsPipelines; }
+
   private:
     gl::ShaderMap<BindingPointer<ShaderAndSerial>> mShaders;
     GraphicsPipelineCache mGraphicsPipelines;
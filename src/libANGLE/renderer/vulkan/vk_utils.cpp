@@ -687,6 +687,10 @@ void GarbageObject::destroy(RendererVk *renderer)
         case HandleType::DescriptorSetLayout:
             vkDestroyDescriptorSetLayout(device, (VkDescriptorSetLayout)mHandle, nullptr);
             break;
+        case HandleType::DescriptorUpdateTemplate:
+            vkDestroyDescriptorUpdateTemplateKHR(device, (VkDescriptorUpdateTemplate)mHandle,
+                                                 nullptr);
+            break;
         case HandleType::Sampler:
             vkDestroySampler(device, (VkSampler)mHandle, nullptr);
             break;
@@ -857,6 +861,11 @@ PFN_vkDestroySamplerYcbcrConversionKHR vkDestroySamplerYcbcrConversionKHR = null
 // VK_KHR_create_renderpass2
 PFN_vkCreateRenderPass2KHR vkCreateRenderPass2KHR = nullptr;
 
+// VK_KHR_descriptor_update_template
+PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR   = nullptr;
+PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR = nullptr;
+PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR = nullptr;
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
 PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA = nullptr;
@@ -930,6 +939,14 @@ void InitRenderPass2KHRFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCreateRenderPass2KHR);
 }
 
+// VK_KHR_descriptor_update_template
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCreateDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkDestroyDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkUpdateDescriptorSetWithTemplateKHR);
+}
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 void InitImagePipeSurfaceFUCHSIAFunctions(VkInstance instance)
 {
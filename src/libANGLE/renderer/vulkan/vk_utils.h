@@ -558,6 +558,9 @@ class BindingPointer final : angle::NonCopyable
         }
     }
 
+    // Points to the same object as |other|.
+    void set(const BindingPointer &other) { set(other.mRefCounted); }
+
     void reset() { set(nullptr); }
 
     T &get() { return mRefCounted->get(); }
@@ -843,6 +846,19 @@ struct PerfCounters
     uint32_t stencilAttachmentResolves;
     uint32_t readOnlyDepthStencilRenderPasses;
     uint32_t descriptorSetAllocations;
+    uint32_t graphicsPipelineCacheHits;
+    uint32_t graphicsPipelineCacheMisses;
+    uint32_t graphicsPipelineCacheEvictions;
+    uint32_t graphicsPipelineCreationWaits;
+    uint32_t descriptorSetCacheHits;
+    uint32_t descriptorSetCacheMisses;
+    uint32_t descriptorSetCacheEvictions;
+    uint32_t commandBufferBytesRecorded;
+    uint32_t commandBufferBlocksUsed;
+    uint32_t commandBufferBlocksAllocated;
+    uint32_t streamingBufferBytesAllocated;
+    uint32_t streamingBufferStalls;
+    uint32_t streamingBufferResizes;
 };
 
 // A Vulkan image level index.
@@ -857,6 +873,7 @@ void InitGetPhysicalDeviceProperties2KHRFunctions(VkInstance instance);
 void InitTransformFeedbackEXTFunctions(VkDevice device);
 void InitSamplerYcbcrKHRFunctions(VkDevice device);
 void InitRenderPass2KHRFunctions(VkDevice device);
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device);
 
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
@@ -36,6 +36,7 @@ namespace vk
     FUNC(CommandPool)              \
     FUNC(DescriptorPool)           \
     FUNC(DescriptorSetLayout)      \
+    FUNC(DescriptorUpdateTemplate) \
     FUNC(DeviceMemory)             \
     FUNC(Event)                    \
     FUNC(Fence)                    \
@@ -304,6 +305,9 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void executeCommands(uint32_t commandBufferCount, const CommandBuffer *commandBuffers);
 
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
+    void getRecordingStats(size_t *bytesRecordedOut,
+                           size_t *blocksUsedOut,
+                           size_t *newBlocksOut) const;
 
     void executionBarrier(VkPipelineStageFlags stageMask);
 
@@ -609,6 +613,20 @@ class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPo
                                 const VkDescriptorSet *descriptorSets);
 };
 
+class DescriptorUpdateTemplate final
+    : public WrappedObject<DescriptorUpdateTemplate, VkDescriptorUpdateTemplate>
+{
+  public:
+    DescriptorUpdateTemplate() = default;
+    void destroy(VkDevice device);
+
+    VkResult init(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo &createInfo);
+
+    void updateDescriptorSet(VkDevice device,
+                             VkDescriptorSet descriptorSet,
+                             const void *data) const;
+};
+
 class Sampler final : public WrappedObject<Sampler, VkSampler>
 {
   public:
@@ -948,6 +966,16 @@ ANGLE_INLINE void CommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     *allocatedMemoryOut = 1;
 }
 
+ANGLE_INLINE void CommandBuffer::getRecordingStats(size_t *bytesRecordedOut,
+                                                   size_t *blocksUsedOut,
+                                                   size_t *newBlocksOut) const
+{
+    // No data available.
+    *bytesRecordedOut = 0;
+    *blocksUsedOut    = 0;
+    *newBlocksOut     = 0;
+}
+
 ANGLE_INLINE void CommandBuffer::fillBuffer(const Buffer &dstBuffer,
                                             VkDeviceSize dstOffset,
                                             VkDeviceSize size,
@@ -1762,6 +1790,32 @@ ANGLE_INLINE VkResult Sampler::init(VkDevice device, const VkSamplerCreateInfo &
     return vkCreateSampler(device, &createInfo, nullptr, &mHandle);
 }
 
+// DescriptorUpdateTemplate implementation.
+ANGLE_INLINE void DescriptorUpdateTemplate::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyDescriptorUpdateTemplateKHR(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+ANGLE_INLINE VkResult
+DescriptorUpdateTemplate::init(VkDevice device,
+                               const VkDescriptorUpdateTemplateCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    return vkCreateDescriptorUpdateTemplateKHR(device, &createInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE void DescriptorUpdateTemplate::updateDescriptorSet(VkDevice device,
+                                                                VkDescriptorSet descriptorSet,
+                                                                const void *data) const
+{
+    ASSERT(valid());
+    vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, mHandle, data);
+}
+
 // SamplerYuvConversion implementation.
 ANGLE_INLINE void SamplerYcbcrConversion::destroy(VkDevice device)
 {
@@ -4567,6 +4567,17 @@ bool ValidateProgramCacheGetAttribANGLE(const ValidationContext *val,
         case EGL_PROGRAM_CACHE_SIZE_ANGLE:
             break;
 
+        case EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE:
+        case EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE:
+        case EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE:
+            if (!display->getExtensions().programCacheStatistics)
+            {
+                val->setError(EGL_BAD_PARAMETER,
+                              "Attribute requires EGL_ANGLE_program_cache_statistics.");
+                return false;
+            }
+            break;
+
         default:
             val->setError(EGL_BAD_PARAMETER, "Invalid program cache attribute.");
             return false;
@@ -37,6 +37,7 @@ void GL_APIENTRY Accum(GLenum op, GLfloat value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Accum, op, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateAccum(context, op, value));
         if (isCallValid)
@@ -59,6 +60,7 @@ void GL_APIENTRY AlphaFunc(GLenum func, GLfloat ref)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, AlphaFunc, func, ref);
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -83,6 +85,7 @@ void GL_APIENTRY Begin(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Begin, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBegin(context, mode));
         if (isCallValid)
@@ -139,6 +142,7 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunc, sfactor, dfactor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
@@ -161,6 +165,7 @@ void GL_APIENTRY CallList(GLuint list)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CallList, list);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCallList(context, list));
         if (isCallValid)
@@ -206,6 +211,7 @@ void GL_APIENTRY Clear(GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Clear, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
         if (isCallValid)
@@ -228,6 +234,7 @@ void GL_APIENTRY ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearAccum, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearAccum(context, red, green, blue, alpha));
@@ -251,6 +258,7 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearColor, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
@@ -273,6 +281,7 @@ void GL_APIENTRY ClearDepth(GLdouble depth)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearDepth, depth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepth(context, depth));
         if (isCallValid)
@@ -294,6 +303,7 @@ void GL_APIENTRY ClearIndex(GLfloat c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearIndex, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearIndex(context, c));
         if (isCallValid)
@@ -315,6 +325,7 @@ void GL_APIENTRY ClearStencil(GLint s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearStencil, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
         if (isCallValid)
@@ -360,6 +371,7 @@ void GL_APIENTRY Color3b(GLbyte red, GLbyte green, GLbyte blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3b, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3b(context, red, green, blue));
@@ -404,6 +416,7 @@ void GL_APIENTRY Color3d(GLdouble red, GLdouble green, GLdouble blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3d, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3d(context, red, green, blue));
@@ -448,6 +461,7 @@ void GL_APIENTRY Color3f(GLfloat red, GLfloat green, GLfloat blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3f, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3f(context, red, green, blue));
@@ -492,6 +506,7 @@ void GL_APIENTRY Color3i(GLint red, GLint green, GLint blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3i, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3i(context, red, green, blue));
@@ -536,6 +551,7 @@ void GL_APIENTRY Color3s(GLshort red, GLshort green, GLshort blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3s, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3s(context, red, green, blue));
@@ -580,6 +596,7 @@ void GL_APIENTRY Color3ub(GLubyte red, GLubyte green, GLubyte blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3ub, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3ub(context, red, green, blue));
@@ -624,6 +641,7 @@ void GL_APIENTRY Color3ui(GLuint red, GLuint green, GLuint blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3ui, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3ui(context, red, green, blue));
@@ -668,6 +686,7 @@ void GL_APIENTRY Color3us(GLushort red, GLushort green, GLushort blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color3us, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor3us(context, red, green, blue));
@@ -712,6 +731,7 @@ void GL_APIENTRY Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4b, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4b(context, red, green, blue, alpha));
@@ -756,6 +776,7 @@ void GL_APIENTRY Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble a
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4d, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4d(context, red, green, blue, alpha));
@@ -800,6 +821,7 @@ void GL_APIENTRY Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4f, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
@@ -844,6 +866,7 @@ void GL_APIENTRY Color4i(GLint red, GLint green, GLint blue, GLint alpha)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4i, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4i(context, red, green, blue, alpha));
@@ -888,6 +911,7 @@ void GL_APIENTRY Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4s, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4s(context, red, green, blue, alpha));
@@ -932,6 +956,7 @@ void GL_APIENTRY Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alph
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4ub, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
@@ -976,6 +1001,7 @@ void GL_APIENTRY Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4ui, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ui(context, red, green, blue, alpha));
@@ -1020,6 +1046,7 @@ void GL_APIENTRY Color4us(GLushort red, GLushort green, GLushort blue, GLushort
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4us, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4us(context, red, green, blue, alpha));
@@ -1065,6 +1092,7 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMask, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
@@ -1089,6 +1117,7 @@ void GL_APIENTRY ColorMaterial(GLenum face, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMaterial, face, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaterial(context, face, mode));
@@ -1112,6 +1141,7 @@ void GL_APIENTRY CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyPixels, x, y, width, height, type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCopyPixels(context, x, y, width, height, type));
@@ -1135,6 +1165,7 @@ void GL_APIENTRY CullFace(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CullFace, mode);
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
@@ -1157,6 +1188,7 @@ void GL_APIENTRY DeleteLists(GLuint list, GLsizei range)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DeleteLists, list, range);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDeleteLists(context, list, range));
         if (isCallValid)
@@ -1179,6 +1211,7 @@ void GL_APIENTRY DepthFunc(GLenum func)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthFunc, func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
         if (isCallValid)
@@ -1200,6 +1233,7 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthMask, flag);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
         if (isCallValid)
@@ -1221,6 +1255,7 @@ void GL_APIENTRY DepthRange(GLdouble n, GLdouble f)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthRange, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRange(context, n, f));
         if (isCallValid)
@@ -1243,6 +1278,7 @@ void GL_APIENTRY Disable(GLenum cap)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, Disable, cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
         if (isCallValid)
@@ -1265,6 +1301,7 @@ void GL_APIENTRY DrawBuffer(GLenum buf)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DrawBuffer, buf);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDrawBuffer(context, buf));
         if (isCallValid)
@@ -1313,6 +1350,7 @@ void GL_APIENTRY EdgeFlag(GLboolean flag)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EdgeFlag, flag);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEdgeFlag(context, flag));
         if (isCallValid)
@@ -1357,6 +1395,7 @@ void GL_APIENTRY Enable(GLenum cap)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, Enable, cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
         if (isCallValid)
@@ -1378,6 +1417,7 @@ void GL_APIENTRY End()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, End);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnd(context));
         if (isCallValid)
@@ -1399,6 +1439,7 @@ void GL_APIENTRY EndList()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndList);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndList(context));
         if (isCallValid)
@@ -1420,6 +1461,7 @@ void GL_APIENTRY EvalCoord1d(GLdouble u)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalCoord1d, u);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1d(context, u));
         if (isCallValid)
@@ -1463,6 +1505,7 @@ void GL_APIENTRY EvalCoord1f(GLfloat u)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalCoord1f, u);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord1f(context, u));
         if (isCallValid)
@@ -1506,6 +1549,7 @@ void GL_APIENTRY EvalCoord2d(GLdouble u, GLdouble v)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalCoord2d, u, v);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2d(context, u, v));
         if (isCallValid)
@@ -1549,6 +1593,7 @@ void GL_APIENTRY EvalCoord2f(GLfloat u, GLfloat v)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalCoord2f, u, v);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalCoord2f(context, u, v));
         if (isCallValid)
@@ -1593,6 +1638,7 @@ void GL_APIENTRY EvalMesh1(GLenum mode, GLint i1, GLint i2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalMesh1, mode, i1, i2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalMesh1(context, mode, i1, i2));
         if (isCallValid)
@@ -1615,6 +1661,7 @@ void GL_APIENTRY EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalMesh2, mode, i1, i2, j1, j2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEvalMesh2(context, mode, i1, i2, j1, j2));
@@ -1637,6 +1684,7 @@ void GL_APIENTRY EvalPoint1(GLint i)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalPoint1, i);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalPoint1(context, i));
         if (isCallValid)
@@ -1658,6 +1706,7 @@ void GL_APIENTRY EvalPoint2(GLint i, GLint j)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EvalPoint2, i, j);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEvalPoint2(context, i, j));
         if (isCallValid)
@@ -1724,6 +1773,7 @@ void GL_APIENTRY Flush()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Flush);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
         if (isCallValid)
@@ -1746,6 +1796,7 @@ void GL_APIENTRY Fogf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Fogf, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
         if (isCallValid)
@@ -1790,6 +1841,7 @@ void GL_APIENTRY Fogi(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Fogi, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogi(context, pname, param));
         if (isCallValid)
@@ -1834,6 +1886,7 @@ void GL_APIENTRY FrontFace(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FrontFace, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
         if (isCallValid)
@@ -1858,6 +1911,7 @@ Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble z
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Frustum, left, right, bottom, top, zNear, zFar);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFrustum(context, left, right, bottom, top, zNear, zFar));
@@ -2607,6 +2661,7 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Hint, target, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
         if (isCallValid)
@@ -2628,6 +2683,7 @@ void GL_APIENTRY IndexMask(GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, IndexMask, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexMask(context, mask));
         if (isCallValid)
@@ -2649,6 +2705,7 @@ void GL_APIENTRY Indexd(GLdouble c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Indexd, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexd(context, c));
         if (isCallValid)
@@ -2691,6 +2748,7 @@ void GL_APIENTRY Indexf(GLfloat c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Indexf, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexf(context, c));
         if (isCallValid)
@@ -2733,6 +2791,7 @@ void GL_APIENTRY Indexi(GLint c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Indexi, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexi(context, c));
         if (isCallValid)
@@ -2775,6 +2834,7 @@ void GL_APIENTRY Indexs(GLshort c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Indexs, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexs(context, c));
         if (isCallValid)
@@ -2817,6 +2877,7 @@ void GL_APIENTRY InitNames()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InitNames);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateInitNames(context));
         if (isCallValid)
@@ -2896,6 +2957,7 @@ void GL_APIENTRY LightModelf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LightModelf, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
@@ -2942,6 +3004,7 @@ void GL_APIENTRY LightModeli(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LightModeli, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModeli(context, pname, param));
@@ -2989,6 +3052,7 @@ void GL_APIENTRY Lightf(GLenum light, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Lightf, light, pname, param);
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3039,6 +3103,7 @@ void GL_APIENTRY Lighti(GLenum light, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Lighti, light, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLighti(context, light, pname, param));
@@ -3086,6 +3151,7 @@ void GL_APIENTRY LineStipple(GLint factor, GLushort pattern)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LineStipple, factor, pattern);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLineStipple(context, factor, pattern));
@@ -3108,6 +3174,7 @@ void GL_APIENTRY LineWidth(GLfloat width)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LineWidth, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
         if (isCallValid)
@@ -3129,6 +3196,7 @@ void GL_APIENTRY ListBase(GLuint base)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ListBase, base);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateListBase(context, base));
         if (isCallValid)
@@ -3150,6 +3218,7 @@ void GL_APIENTRY LoadIdentity()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LoadIdentity);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
         if (isCallValid)
@@ -3215,6 +3284,7 @@ void GL_APIENTRY LoadName(GLuint name)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LoadName, name);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadName(context, name));
         if (isCallValid)
@@ -3237,6 +3307,7 @@ void GL_APIENTRY LogicOp(GLenum opcode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LogicOp, opcode);
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
@@ -3388,6 +3459,7 @@ void GL_APIENTRY MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MapGrid1d, un, u1, u2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMapGrid1d(context, un, u1, u2));
         if (isCallValid)
@@ -3410,6 +3482,7 @@ void GL_APIENTRY MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MapGrid1f, un, u1, u2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMapGrid1f(context, un, u1, u2));
         if (isCallValid)
@@ -3433,6 +3506,7 @@ void GL_APIENTRY MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdoubl
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MapGrid2d, un, u1, u2, vn, v1, v2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapGrid2d(context, un, u1, u2, vn, v1, v2));
@@ -3457,6 +3531,7 @@ void GL_APIENTRY MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MapGrid2f, un, u1, u2, vn, v1, v2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMapGrid2f(context, un, u1, u2, vn, v1, v2));
@@ -3481,6 +3556,7 @@ void GL_APIENTRY Materialf(GLenum face, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Materialf, face, pname, param);
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3531,6 +3607,7 @@ void GL_APIENTRY Materiali(GLenum face, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Materiali, face, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMateriali(context, face, pname, param));
@@ -3578,6 +3655,7 @@ void GL_APIENTRY MatrixMode(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MatrixMode, mode);
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
@@ -3645,6 +3723,7 @@ void GL_APIENTRY NewList(GLuint list, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NewList, list, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNewList(context, list, mode));
         if (isCallValid)
@@ -3666,6 +3745,7 @@ void GL_APIENTRY Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3b, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3b(context, nx, ny, nz));
         if (isCallValid)
@@ -3708,6 +3788,7 @@ void GL_APIENTRY Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3d, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3d(context, nx, ny, nz));
         if (isCallValid)
@@ -3750,6 +3831,7 @@ void GL_APIENTRY Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3f, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
         if (isCallValid)
@@ -3792,6 +3874,7 @@ void GL_APIENTRY Normal3i(GLint nx, GLint ny, GLint nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3i, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3i(context, nx, ny, nz));
         if (isCallValid)
@@ -3834,6 +3917,7 @@ void GL_APIENTRY Normal3s(GLshort nx, GLshort ny, GLshort nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3s, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3s(context, nx, ny, nz));
         if (isCallValid)
@@ -3879,6 +3963,7 @@ Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Ortho, left, right, bottom, top, zNear, zFar);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateOrtho(context, left, right, bottom, top, zNear, zFar));
@@ -3901,6 +3986,7 @@ void GL_APIENTRY PassThrough(GLfloat token)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PassThrough, token);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePassThrough(context, token));
         if (isCallValid)
@@ -3994,6 +4080,7 @@ void GL_APIENTRY PixelStoref(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelStoref, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStoref(context, pname, param));
@@ -4017,6 +4104,7 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelStorei, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
@@ -4040,6 +4128,7 @@ void GL_APIENTRY PixelTransferf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelTransferf, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelTransferf(context, pname, param));
@@ -4063,6 +4152,7 @@ void GL_APIENTRY PixelTransferi(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelTransferi, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelTransferi(context, pname, param));
@@ -4086,6 +4176,7 @@ void GL_APIENTRY PixelZoom(GLfloat xfactor, GLfloat yfactor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelZoom, xfactor, yfactor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelZoom(context, xfactor, yfactor));
@@ -4108,6 +4199,7 @@ void GL_APIENTRY PointSize(GLfloat size)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointSize, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
         if (isCallValid)
@@ -4131,6 +4223,7 @@ void GL_APIENTRY PolygonMode(GLenum face, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PolygonMode, face, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePolygonMode(context, face, mode));
         if (isCallValid)
@@ -4174,6 +4267,7 @@ void GL_APIENTRY PopAttrib()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopAttrib);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopAttrib(context));
         if (isCallValid)
@@ -4195,6 +4289,7 @@ void GL_APIENTRY PopMatrix()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopMatrix);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
         if (isCallValid)
@@ -4216,6 +4311,7 @@ void GL_APIENTRY PopName()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopName);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopName(context));
         if (isCallValid)
@@ -4238,6 +4334,7 @@ void GL_APIENTRY PushAttrib(GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PushAttrib, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushAttrib(context, mask));
         if (isCallValid)
@@ -4259,6 +4356,7 @@ void GL_APIENTRY PushMatrix()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PushMatrix);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
         if (isCallValid)
@@ -4280,6 +4378,7 @@ void GL_APIENTRY PushName(GLuint name)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PushName, name);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushName(context, name));
         if (isCallValid)
@@ -4301,6 +4400,7 @@ void GL_APIENTRY RasterPos2d(GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos2d, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2d(context, x, y));
         if (isCallValid)
@@ -4344,6 +4444,7 @@ void GL_APIENTRY RasterPos2f(GLfloat x, GLfloat y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos2f, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2f(context, x, y));
         if (isCallValid)
@@ -4387,6 +4488,7 @@ void GL_APIENTRY RasterPos2i(GLint x, GLint y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos2i, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2i(context, x, y));
         if (isCallValid)
@@ -4430,6 +4532,7 @@ void GL_APIENTRY RasterPos2s(GLshort x, GLshort y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos2s, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos2s(context, x, y));
         if (isCallValid)
@@ -4473,6 +4576,7 @@ void GL_APIENTRY RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos3d, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3d(context, x, y, z));
         if (isCallValid)
@@ -4516,6 +4620,7 @@ void GL_APIENTRY RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos3f, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3f(context, x, y, z));
         if (isCallValid)
@@ -4559,6 +4664,7 @@ void GL_APIENTRY RasterPos3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos3i, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3i(context, x, y, z));
         if (isCallValid)
@@ -4602,6 +4708,7 @@ void GL_APIENTRY RasterPos3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos3s, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos3s(context, x, y, z));
         if (isCallValid)
@@ -4646,6 +4753,7 @@ void GL_APIENTRY RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos4d, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4d(context, x, y, z, w));
         if (isCallValid)
@@ -4690,6 +4798,7 @@ void GL_APIENTRY RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos4f, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4f(context, x, y, z, w));
         if (isCallValid)
@@ -4734,6 +4843,7 @@ void GL_APIENTRY RasterPos4i(GLint x, GLint y, GLint z, GLint w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos4i, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4i(context, x, y, z, w));
         if (isCallValid)
@@ -4778,6 +4888,7 @@ void GL_APIENTRY RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RasterPos4s, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRasterPos4s(context, x, y, z, w));
         if (isCallValid)
@@ -4822,6 +4933,7 @@ void GL_APIENTRY ReadBuffer(GLenum src)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ReadBuffer, src);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReadBuffer(context, src));
         if (isCallValid)
@@ -4876,6 +4988,7 @@ void GL_APIENTRY Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rectd, x1, y1, x2, y2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectd(context, x1, y1, x2, y2));
         if (isCallValid)
@@ -4920,6 +5033,7 @@ void GL_APIENTRY Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rectf, x1, y1, x2, y2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRectf(context, x1, y1, x2, y2));
         if (isCallValid)
@@ -4964,6 +5078,7 @@ void GL_APIENTRY Recti(GLint x1, GLint y1, GLint x2, GLint y2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Recti, x1, y1, x2, y2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRecti(context, x1, y1, x2, y2));
         if (isCallValid)
@@ -5008,6 +5123,7 @@ void GL_APIENTRY Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rects, x1, y1, x2, y2);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRects(context, x1, y1, x2, y2));
         if (isCallValid)
@@ -5081,6 +5197,7 @@ void GL_APIENTRY Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rotated, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotated(context, angle, x, y, z));
         if (isCallValid)
@@ -5103,6 +5220,7 @@ void GL_APIENTRY Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rotatef, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
         if (isCallValid)
@@ -5124,6 +5242,7 @@ void GL_APIENTRY Scaled(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scaled, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScaled(context, x, y, z));
         if (isCallValid)
@@ -5145,6 +5264,7 @@ void GL_APIENTRY Scalef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scalef, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
         if (isCallValid)
@@ -5167,6 +5287,7 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scissor, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
@@ -5213,6 +5334,7 @@ void GL_APIENTRY ShadeModel(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ShadeModel, mode);
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
@@ -5236,6 +5358,7 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilFunc, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
@@ -5258,6 +5381,7 @@ void GL_APIENTRY StencilMask(GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilMask, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
         if (isCallValid)
@@ -5282,6 +5406,7 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilOp, fail, zfail, zpass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
@@ -5304,6 +5429,7 @@ void GL_APIENTRY TexCoord1d(GLdouble s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord1d, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1d(context, s));
         if (isCallValid)
@@ -5347,6 +5473,7 @@ void GL_APIENTRY TexCoord1f(GLfloat s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord1f, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1f(context, s));
         if (isCallValid)
@@ -5390,6 +5517,7 @@ void GL_APIENTRY TexCoord1i(GLint s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord1i, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1i(context, s));
         if (isCallValid)
@@ -5433,6 +5561,7 @@ void GL_APIENTRY TexCoord1s(GLshort s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord1s, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord1s(context, s));
         if (isCallValid)
@@ -5476,6 +5605,7 @@ void GL_APIENTRY TexCoord2d(GLdouble s, GLdouble t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord2d, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2d(context, s, t));
         if (isCallValid)
@@ -5519,6 +5649,7 @@ void GL_APIENTRY TexCoord2f(GLfloat s, GLfloat t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord2f, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2f(context, s, t));
         if (isCallValid)
@@ -5562,6 +5693,7 @@ void GL_APIENTRY TexCoord2i(GLint s, GLint t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord2i, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2i(context, s, t));
         if (isCallValid)
@@ -5605,6 +5737,7 @@ void GL_APIENTRY TexCoord2s(GLshort s, GLshort t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord2s, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord2s(context, s, t));
         if (isCallValid)
@@ -5648,6 +5781,7 @@ void GL_APIENTRY TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord3d, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3d(context, s, t, r));
         if (isCallValid)
@@ -5691,6 +5825,7 @@ void GL_APIENTRY TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord3f, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3f(context, s, t, r));
         if (isCallValid)
@@ -5734,6 +5869,7 @@ void GL_APIENTRY TexCoord3i(GLint s, GLint t, GLint r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord3i, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3i(context, s, t, r));
         if (isCallValid)
@@ -5777,6 +5913,7 @@ void GL_APIENTRY TexCoord3s(GLshort s, GLshort t, GLshort r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord3s, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord3s(context, s, t, r));
         if (isCallValid)
@@ -5821,6 +5958,7 @@ void GL_APIENTRY TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord4d, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4d(context, s, t, r, q));
         if (isCallValid)
@@ -5865,6 +6003,7 @@ void GL_APIENTRY TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord4f, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4f(context, s, t, r, q));
         if (isCallValid)
@@ -5909,6 +6048,7 @@ void GL_APIENTRY TexCoord4i(GLint s, GLint t, GLint r, GLint q)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord4i, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4i(context, s, t, r, q));
         if (isCallValid)
@@ -5953,6 +6093,7 @@ void GL_APIENTRY TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoord4s, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTexCoord4s(context, s, t, r, q));
         if (isCallValid)
@@ -5998,6 +6139,7 @@ void GL_APIENTRY TexEnvf(GLenum target, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexEnvf, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6050,6 +6192,7 @@ void GL_APIENTRY TexEnvi(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexEnvi, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6102,6 +6245,7 @@ void GL_APIENTRY TexGend(GLenum coord, GLenum pname, GLdouble param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGend, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGend(context, coord, pname, param));
@@ -6150,6 +6294,7 @@ void GL_APIENTRY TexGenf(GLenum coord, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGenf, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenf(context, coord, pname, param));
@@ -6198,6 +6343,7 @@ void GL_APIENTRY TexGeni(GLenum coord, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGeni, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeni(context, coord, pname, param));
@@ -6321,6 +6467,7 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexParameterf, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6372,6 +6519,7 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexParameteri, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6421,6 +6569,7 @@ void GL_APIENTRY Translated(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Translated, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslated(context, x, y, z));
         if (isCallValid)
@@ -6442,6 +6591,7 @@ void GL_APIENTRY Translatef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Translatef, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
         if (isCallValid)
@@ -6463,6 +6613,7 @@ void GL_APIENTRY Vertex2d(GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex2d, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2d(context, x, y));
         if (isCallValid)
@@ -6505,6 +6656,7 @@ void GL_APIENTRY Vertex2f(GLfloat x, GLfloat y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex2f, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2f(context, x, y));
         if (isCallValid)
@@ -6547,6 +6699,7 @@ void GL_APIENTRY Vertex2i(GLint x, GLint y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex2i, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2i(context, x, y));
         if (isCallValid)
@@ -6589,6 +6742,7 @@ void GL_APIENTRY Vertex2s(GLshort x, GLshort y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex2s, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex2s(context, x, y));
         if (isCallValid)
@@ -6631,6 +6785,7 @@ void GL_APIENTRY Vertex3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex3d, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3d(context, x, y, z));
         if (isCallValid)
@@ -6673,6 +6828,7 @@ void GL_APIENTRY Vertex3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex3f, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3f(context, x, y, z));
         if (isCallValid)
@@ -6715,6 +6871,7 @@ void GL_APIENTRY Vertex3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex3i, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3i(context, x, y, z));
         if (isCallValid)
@@ -6757,6 +6914,7 @@ void GL_APIENTRY Vertex3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex3s, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex3s(context, x, y, z));
         if (isCallValid)
@@ -6800,6 +6958,7 @@ void GL_APIENTRY Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex4d, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4d(context, x, y, z, w));
         if (isCallValid)
@@ -6843,6 +7002,7 @@ void GL_APIENTRY Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex4f, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4f(context, x, y, z, w));
         if (isCallValid)
@@ -6886,6 +7046,7 @@ void GL_APIENTRY Vertex4i(GLint x, GLint y, GLint z, GLint w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex4i, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4i(context, x, y, z, w));
         if (isCallValid)
@@ -6929,6 +7090,7 @@ void GL_APIENTRY Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Vertex4s, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertex4s(context, x, y, z, w));
         if (isCallValid)
@@ -6972,6 +7134,7 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Viewport, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
@@ -7028,6 +7191,7 @@ void GL_APIENTRY ArrayElement(GLint i)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ArrayElement, i);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateArrayElement(context, i));
         if (isCallValid)
@@ -7050,6 +7214,7 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindTexture, target, texture);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7110,6 +7275,8 @@ void GL_APIENTRY CopyTexImage1D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexImage1D, target, level, internalformat, x, y, width,
+                         border);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -7145,6 +7312,8 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexImage2D, target, level, internalformat, x, y, width,
+                         height, border);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -7175,6 +7344,7 @@ CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage1D, target, level, xoffset, x, y, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -7209,6 +7379,8 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage2D, target, level, xoffset, yoffset, x, y, width,
+                         height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -7259,6 +7431,7 @@ void GL_APIENTRY DisableClientState(GLenum array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableClientState, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7283,6 +7456,7 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArrays, mode, first, count);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7309,6 +7483,8 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElements, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7357,6 +7533,7 @@ void GL_APIENTRY EnableClientState(GLenum array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableClientState, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7451,6 +7628,7 @@ void GL_APIENTRY Indexub(GLubyte c)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Indexub, c);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateIndexub(context, c));
         if (isCallValid)
@@ -7572,6 +7750,7 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PolygonOffset, factor, units);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
@@ -7594,6 +7773,7 @@ void GL_APIENTRY PopClientAttrib()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopClientAttrib);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopClientAttrib(context));
         if (isCallValid)
@@ -7640,6 +7820,7 @@ void GL_APIENTRY PushClientAttrib(GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PushClientAttrib, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushClientAttrib(context, mask));
         if (isCallValid)
@@ -7800,6 +7981,8 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage3D, target, level, xoffset, yoffset, zoffset, x, y,
+                         width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -7835,6 +8018,8 @@ void GL_APIENTRY DrawRangeElements(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElements, mode, start, end,
+                            count, type, context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7945,6 +8130,7 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ActiveTexture, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
         if (isCallValid)
@@ -7967,6 +8153,7 @@ void GL_APIENTRY ClientActiveTexture(GLenum texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClientActiveTexture, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
@@ -8334,6 +8521,7 @@ void GL_APIENTRY MultiTexCoord1d(GLenum target, GLdouble s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord1d, target, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1d(context, target, s));
@@ -8380,6 +8568,7 @@ void GL_APIENTRY MultiTexCoord1f(GLenum target, GLfloat s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord1f, target, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1f(context, target, s));
@@ -8426,6 +8615,7 @@ void GL_APIENTRY MultiTexCoord1i(GLenum target, GLint s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord1i, target, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1i(context, target, s));
@@ -8472,6 +8662,7 @@ void GL_APIENTRY MultiTexCoord1s(GLenum target, GLshort s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord1s, target, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord1s(context, target, s));
@@ -8518,6 +8709,7 @@ void GL_APIENTRY MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord2d, target, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2d(context, target, s, t));
@@ -8564,6 +8756,7 @@ void GL_APIENTRY MultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord2f, target, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2f(context, target, s, t));
@@ -8610,6 +8803,7 @@ void GL_APIENTRY MultiTexCoord2i(GLenum target, GLint s, GLint t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord2i, target, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2i(context, target, s, t));
@@ -8656,6 +8850,7 @@ void GL_APIENTRY MultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord2s, target, s, t);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord2s(context, target, s, t));
@@ -8702,6 +8897,7 @@ void GL_APIENTRY MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord3d, target, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3d(context, target, s, t, r));
@@ -8748,6 +8944,7 @@ void GL_APIENTRY MultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord3f, target, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3f(context, target, s, t, r));
@@ -8794,6 +8991,7 @@ void GL_APIENTRY MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord3i, target, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3i(context, target, s, t, r));
@@ -8840,6 +9038,7 @@ void GL_APIENTRY MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord3s, target, s, t, r);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord3s(context, target, s, t, r));
@@ -8886,6 +9085,7 @@ void GL_APIENTRY MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4d, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4d(context, target, s, t, r, q));
@@ -8932,6 +9132,7 @@ void GL_APIENTRY MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4f, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
@@ -8978,6 +9179,7 @@ void GL_APIENTRY MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4i, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4i(context, target, s, t, r, q));
@@ -9024,6 +9226,7 @@ void GL_APIENTRY MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4s, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4s(context, target, s, t, r, q));
@@ -9070,6 +9273,7 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleCoverage, value, invert);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
@@ -9094,6 +9298,7 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendColor, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
@@ -9117,6 +9322,7 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquation, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
         if (isCallValid)
@@ -9146,6 +9352,8 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparate, sfactorRGB, dfactorRGB, sfactorAlpha,
+                         dfactorAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
@@ -9194,6 +9402,7 @@ void GL_APIENTRY FogCoordd(GLdouble coord)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FogCoordd, coord);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoordd(context, coord));
         if (isCallValid)
@@ -9237,6 +9446,7 @@ void GL_APIENTRY FogCoordf(GLfloat coord)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FogCoordf, coord);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogCoordf(context, coord));
         if (isCallValid)
@@ -9345,6 +9555,7 @@ void GL_APIENTRY PointParameterf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointParameterf, pname, param);
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9393,6 +9604,7 @@ void GL_APIENTRY PointParameteri(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointParameteri, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePointParameteri(context, pname, param));
@@ -9439,6 +9651,7 @@ void GL_APIENTRY SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3b, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3b(context, red, green, blue));
@@ -9484,6 +9697,7 @@ void GL_APIENTRY SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3d, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3d(context, red, green, blue));
@@ -9529,6 +9743,7 @@ void GL_APIENTRY SecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3f, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3f(context, red, green, blue));
@@ -9574,6 +9789,7 @@ void GL_APIENTRY SecondaryColor3i(GLint red, GLint green, GLint blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3i, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3i(context, red, green, blue));
@@ -9619,6 +9835,7 @@ void GL_APIENTRY SecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3s, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3s(context, red, green, blue));
@@ -9664,6 +9881,7 @@ void GL_APIENTRY SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3ub, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3ub(context, red, green, blue));
@@ -9709,6 +9927,7 @@ void GL_APIENTRY SecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3ui, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3ui(context, red, green, blue));
@@ -9754,6 +9973,7 @@ void GL_APIENTRY SecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColor3us, red, green, blue);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColor3us(context, red, green, blue));
@@ -9823,6 +10043,7 @@ void GL_APIENTRY WindowPos2d(GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos2d, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2d(context, x, y));
         if (isCallValid)
@@ -9866,6 +10087,7 @@ void GL_APIENTRY WindowPos2f(GLfloat x, GLfloat y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos2f, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2f(context, x, y));
         if (isCallValid)
@@ -9909,6 +10131,7 @@ void GL_APIENTRY WindowPos2i(GLint x, GLint y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos2i, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2i(context, x, y));
         if (isCallValid)
@@ -9952,6 +10175,7 @@ void GL_APIENTRY WindowPos2s(GLshort x, GLshort y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos2s, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos2s(context, x, y));
         if (isCallValid)
@@ -9995,6 +10219,7 @@ void GL_APIENTRY WindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos3d, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3d(context, x, y, z));
         if (isCallValid)
@@ -10038,6 +10263,7 @@ void GL_APIENTRY WindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos3f, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3f(context, x, y, z));
         if (isCallValid)
@@ -10081,6 +10307,7 @@ void GL_APIENTRY WindowPos3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos3i, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3i(context, x, y, z));
         if (isCallValid)
@@ -10124,6 +10351,7 @@ void GL_APIENTRY WindowPos3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, WindowPos3s, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateWindowPos3s(context, x, y, z));
         if (isCallValid)
@@ -10169,6 +10397,7 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginQuery, target, id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10194,6 +10423,8 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(target == GL_ELEMENT_ARRAY_BUFFER, context, BindBuffer,
+                                      target, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10222,6 +10453,8 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BufferData, target, size, DeferredCallQueue::Copy(data, size, 1),
+                         usage);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferUsage usagePacked                               = PackParam<BufferUsage>(usage);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10250,6 +10483,8 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BufferSubData, target, offset, size,
+                         DeferredCallQueue::Copy(data, size, 1));
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10322,6 +10557,7 @@ void GL_APIENTRY EndQuery(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndQuery, target);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndQuery(context, targetPacked));
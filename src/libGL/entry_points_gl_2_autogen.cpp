@@ -37,6 +37,7 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, AttachShader, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -88,6 +89,7 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparate, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
@@ -110,6 +112,7 @@ void GL_APIENTRY CompileShader(GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CompileShader, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -191,6 +194,7 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DeleteProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -214,6 +218,7 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DeleteShader, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -238,6 +243,7 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DetachShader, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -262,6 +268,7 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableVertexAttribArray, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
@@ -306,6 +313,7 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableVertexAttribArray, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
@@ -830,6 +838,7 @@ void GL_APIENTRY LinkProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LinkProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -884,6 +893,7 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilFuncSeparate, face, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
@@ -907,6 +917,7 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilMaskSeparate, face, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
@@ -934,6 +945,7 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilOpSeparate, face, sfail, dpfail, dppass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
@@ -956,6 +968,7 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1f, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -981,6 +994,8 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1fv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1004,6 +1019,7 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1i, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1029,6 +1045,8 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1iv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1053,6 +1071,7 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2f, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1078,6 +1097,8 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1102,6 +1123,7 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2i, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1127,6 +1149,8 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1151,6 +1175,7 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3f, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1176,6 +1201,8 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1200,6 +1227,7 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3i, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1225,6 +1253,8 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1249,6 +1279,7 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4f, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1274,6 +1305,8 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1298,6 +1331,7 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4i, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1323,6 +1357,8 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1351,6 +1387,8 @@ void GL_APIENTRY UniformMatrix2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1381,6 +1419,8 @@ void GL_APIENTRY UniformMatrix3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1411,6 +1451,8 @@ void GL_APIENTRY UniformMatrix4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1436,6 +1478,7 @@ void GL_APIENTRY UseProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UseProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1459,6 +1502,7 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ValidateProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1482,6 +1526,7 @@ void GL_APIENTRY VertexAttrib1d(GLuint index, GLdouble x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib1d, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1d(context, index, x));
         if (isCallValid)
@@ -1526,6 +1571,7 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib1f, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
         if (isCallValid)
@@ -1570,6 +1616,7 @@ void GL_APIENTRY VertexAttrib1s(GLuint index, GLshort x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib1s, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1s(context, index, x));
         if (isCallValid)
@@ -1615,6 +1662,7 @@ void GL_APIENTRY VertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib2d, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2d(context, index, x, y));
@@ -1661,6 +1709,7 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib2f, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
@@ -1707,6 +1756,7 @@ void GL_APIENTRY VertexAttrib2s(GLuint index, GLshort x, GLshort y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib2s, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2s(context, index, x, y));
@@ -1753,6 +1803,7 @@ void GL_APIENTRY VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib3d, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3d(context, index, x, y, z));
@@ -1799,6 +1850,7 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib3f, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
@@ -1845,6 +1897,7 @@ void GL_APIENTRY VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib3s, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3s(context, index, x, y, z));
@@ -1960,6 +2013,7 @@ void GL_APIENTRY VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib4Nub, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4Nub(context, index, x, y, z, w));
@@ -2075,6 +2129,7 @@ void GL_APIENTRY VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib4d, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4d(context, index, x, y, z, w));
@@ -2121,6 +2176,7 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib4f, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
@@ -2190,6 +2246,7 @@ void GL_APIENTRY VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib4s, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4s(context, index, x, y, z, w));
@@ -2313,6 +2370,8 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribPointer, index, size, type,
+                                      normalized, stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2344,6 +2403,8 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2374,6 +2435,8 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2404,6 +2467,8 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2434,6 +2499,8 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2464,6 +2531,8 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2494,6 +2563,8 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -37,6 +37,7 @@ void GL_APIENTRY BeginConditionalRender(GLuint id, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginConditionalRender, id, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBeginConditionalRender(context, id, mode));
@@ -60,6 +61,7 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginTransformFeedback, primitiveMode);
         PrimitiveMode primitiveModePacked = PackParam<PrimitiveMode>(primitiveMode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -84,6 +86,7 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindBufferBase, target, index, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -112,6 +115,7 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindBufferRange, target, index, buffer, offset, size);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -164,6 +168,7 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindFramebuffer, target, framebuffer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -188,6 +193,7 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindRenderbuffer, target, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -211,6 +217,7 @@ void GL_APIENTRY BindVertexArray(GLuint array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexArray, array);
         VertexArrayID arrayPacked                             = PackParam<VertexArrayID>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -248,6 +255,8 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlitFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
+                         dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
@@ -306,6 +315,7 @@ void GL_APIENTRY ClampColor(GLenum target, GLenum clamp)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClampColor, target, clamp);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClampColor(context, target, clamp));
@@ -330,6 +340,7 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearBufferfi, buffer, drawbuffer, depth, stencil);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil));
@@ -426,6 +437,7 @@ void GL_APIENTRY ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMaski, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaski(context, index, r, g, b, a));
@@ -522,6 +534,7 @@ void GL_APIENTRY Disablei(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Disablei, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisablei(context, target, index));
         if (isCallValid)
@@ -544,6 +557,7 @@ void GL_APIENTRY Enablei(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Enablei, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnablei(context, target, index));
         if (isCallValid)
@@ -565,6 +579,7 @@ void GL_APIENTRY EndConditionalRender()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndConditionalRender);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndConditionalRender(context));
         if (isCallValid)
@@ -586,6 +601,7 @@ void GL_APIENTRY EndTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndTransformFeedback(context));
         if (isCallValid)
@@ -610,6 +626,7 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FlushMappedBufferRange, target, offset, length);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -640,6 +657,8 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferRenderbuffer, target, attachment, renderbuffertarget,
+                         renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -675,6 +694,8 @@ void GL_APIENTRY FramebufferTexture1D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture1D, target, attachment, textarget, texture,
+                         level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -710,6 +731,8 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture2D, target, attachment, textarget, texture,
+                         level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -747,6 +770,8 @@ void GL_APIENTRY FramebufferTexture3D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture3D, target, attachment, textarget, texture,
+                         level, zoffset);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -779,6 +804,8 @@ FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTextureLayer, target, attachment, texture, level,
+                         layer);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -877,6 +904,7 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GenerateMipmap, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1391,6 +1419,7 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorage, target, internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -1422,6 +1451,8 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisample, target, samples, internalformat,
+                         width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisample(context, target, samples,
@@ -1530,6 +1561,7 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1ui, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1555,6 +1587,8 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1579,6 +1613,7 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2ui, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1604,6 +1639,8 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1628,6 +1665,7 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3ui, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1653,6 +1691,8 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1677,6 +1717,7 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4ui, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1702,6 +1743,8 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1725,6 +1768,7 @@ void GL_APIENTRY VertexAttribI1i(GLuint index, GLint x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI1i, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1i(context, index, x));
@@ -1770,6 +1814,7 @@ void GL_APIENTRY VertexAttribI1ui(GLuint index, GLuint x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI1ui, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI1ui(context, index, x));
@@ -1816,6 +1861,7 @@ void GL_APIENTRY VertexAttribI2i(GLuint index, GLint x, GLint y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI2i, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2i(context, index, x, y));
@@ -1862,6 +1908,7 @@ void GL_APIENTRY VertexAttribI2ui(GLuint index, GLuint x, GLuint y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI2ui, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI2ui(context, index, x, y));
@@ -1908,6 +1955,7 @@ void GL_APIENTRY VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI3i, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3i(context, index, x, y, z));
@@ -1954,6 +2002,7 @@ void GL_APIENTRY VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI3ui, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI3ui(context, index, x, y, z));
@@ -2023,6 +2072,7 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI4i, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w));
@@ -2115,6 +2165,7 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI4ui, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w));
@@ -2188,6 +2239,8 @@ VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, cons
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribIPointer, index, size, type,
+                                      stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2224,6 +2277,8 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyBufferSubData, readTarget, writeTarget, readOffset,
+                         writeOffset, size);
         BufferBinding readTargetPacked  = PackParam<BufferBinding>(readTarget);
         BufferBinding writeTargetPacked = PackParam<BufferBinding>(writeTarget);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2253,6 +2308,8 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstanced, mode, first,
+                            count, instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2286,6 +2343,9 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstanced, mode, count,
+                            type, context->copyDeferredIndices(indices, count, type),
+                            instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2512,6 +2572,7 @@ void GL_APIENTRY PrimitiveRestartIndex(GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PrimitiveRestartIndex, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePrimitiveRestartIndex(context, index));
@@ -2536,6 +2597,7 @@ void GL_APIENTRY TexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBuffer, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2564,6 +2626,8 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformBlockBinding, program, uniformBlockIndex,
+                         uniformBlockBinding);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2652,6 +2716,8 @@ void GL_APIENTRY DrawElementsBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertex, mode, count,
+                            type, context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2688,6 +2754,9 @@ void GL_APIENTRY DrawElementsInstancedBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedBaseVertex, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            instancecount, basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2725,6 +2794,9 @@ void GL_APIENTRY DrawRangeElementsBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElementsBaseVertex, mode,
+                            start, end, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2786,6 +2858,7 @@ void GL_APIENTRY FramebufferTexture(GLenum target, GLenum attachment, GLuint tex
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture, target, attachment, texture, level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3000,6 +3073,7 @@ void GL_APIENTRY ProvokingVertex(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProvokingVertex, mode);
         ProvokingVertexConvention modePacked = PackParam<ProvokingVertexConvention>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3024,6 +3098,7 @@ void GL_APIENTRY SampleMaski(GLuint maskNumber, GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleMaski, maskNumber, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask));
@@ -3056,6 +3131,8 @@ void GL_APIENTRY TexImage2DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexImage2DMultisample, target, samples, internalformat, width,
+                         height, fixedsamplelocations);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage2DMultisample(context, target, samples, internalformat,
@@ -3092,6 +3169,8 @@ void GL_APIENTRY TexImage3DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexImage3DMultisample, target, samples, internalformat, width,
+                         height, depth, fixedsamplelocations);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -3175,6 +3254,7 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindSampler, unit, sampler);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3199,6 +3279,7 @@ void GL_APIENTRY ColorP3ui(GLenum type, GLuint color)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorP3ui, type, color);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP3ui(context, type, color));
         if (isCallValid)
@@ -3243,6 +3324,7 @@ void GL_APIENTRY ColorP4ui(GLenum type, GLuint color)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorP4ui, type, color);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateColorP4ui(context, type, color));
         if (isCallValid)
@@ -3544,6 +3626,7 @@ void GL_APIENTRY MultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoordP1ui, texture, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP1ui(context, texture, type, coords));
@@ -3593,6 +3676,7 @@ void GL_APIENTRY MultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoordP2ui, texture, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP2ui(context, texture, type, coords));
@@ -3642,6 +3726,7 @@ void GL_APIENTRY MultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoordP3ui, texture, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP3ui(context, texture, type, coords));
@@ -3691,6 +3776,7 @@ void GL_APIENTRY MultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoordP4ui, texture, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoordP4ui(context, texture, type, coords));
@@ -3739,6 +3825,7 @@ void GL_APIENTRY NormalP3ui(GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NormalP3ui, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormalP3ui(context, type, coords));
         if (isCallValid)
@@ -3784,6 +3871,7 @@ void GL_APIENTRY QueryCounter(GLuint id, GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, QueryCounter, id, target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3859,6 +3947,7 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SamplerParameterf, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3908,6 +3997,7 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SamplerParameteri, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3957,6 +4047,7 @@ void GL_APIENTRY SecondaryColorP3ui(GLenum type, GLuint color)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SecondaryColorP3ui, type, color);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSecondaryColorP3ui(context, type, color));
@@ -4003,6 +4094,7 @@ void GL_APIENTRY TexCoordP1ui(GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoordP1ui, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP1ui(context, type, coords));
@@ -4049,6 +4141,7 @@ void GL_APIENTRY TexCoordP2ui(GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoordP2ui, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP2ui(context, type, coords));
@@ -4095,6 +4188,7 @@ void GL_APIENTRY TexCoordP3ui(GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoordP3ui, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP3ui(context, type, coords));
@@ -4141,6 +4235,7 @@ void GL_APIENTRY TexCoordP4ui(GLenum type, GLuint coords)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexCoordP4ui, type, coords);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexCoordP4ui(context, type, coords));
@@ -4187,6 +4282,7 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribDivisor, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor));
@@ -4212,6 +4308,7 @@ void GL_APIENTRY VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalize
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribP1ui, index, type, normalized, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP1ui(context, index, type, normalized, value));
@@ -4265,6 +4362,7 @@ void GL_APIENTRY VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalize
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribP2ui, index, type, normalized, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP2ui(context, index, type, normalized, value));
@@ -4318,6 +4416,7 @@ void GL_APIENTRY VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalize
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribP3ui, index, type, normalized, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP3ui(context, index, type, normalized, value));
@@ -4371,6 +4470,7 @@ void GL_APIENTRY VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalize
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribP4ui, index, type, normalized, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribP4ui(context, index, type, normalized, value));
@@ -4422,6 +4522,7 @@ void GL_APIENTRY VertexP2ui(GLenum type, GLuint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexP2ui, type, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP2ui(context, type, value));
         if (isCallValid)
@@ -4466,6 +4567,7 @@ void GL_APIENTRY VertexP3ui(GLenum type, GLuint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexP3ui, type, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP3ui(context, type, value));
         if (isCallValid)
@@ -4510,6 +4612,7 @@ void GL_APIENTRY VertexP4ui(GLenum type, GLuint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexP4ui, type, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexP4ui(context, type, value));
         if (isCallValid)
@@ -37,6 +37,7 @@ void GL_APIENTRY BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginQueryIndexed, target, index, id);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -61,6 +62,7 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindTransformFeedback, target, id);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -86,6 +88,7 @@ void GL_APIENTRY BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeA
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparatei, buf, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparatei(context, buf, modeRGB, modeAlpha));
@@ -109,6 +112,7 @@ void GL_APIENTRY BlendEquationi(GLuint buf, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationi, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationi(context, buf, mode));
@@ -137,6 +141,7 @@ BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparatei, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -163,6 +168,7 @@ void GL_APIENTRY BlendFunci(GLuint buf, GLenum src, GLenum dst)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunci, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunci(context, buf, src, dst));
@@ -262,6 +268,7 @@ void GL_APIENTRY DrawTransformFeedback(GLenum mode, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawTransformFeedback, mode, id);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -286,6 +293,8 @@ void GL_APIENTRY DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stre
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawTransformFeedbackStream, mode, id,
+                            stream);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -310,6 +319,7 @@ void GL_APIENTRY EndQueryIndexed(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndQueryIndexed, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEndQueryIndexed(context, target, index));
@@ -664,6 +674,7 @@ void GL_APIENTRY MinSampleShading(GLfloat value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MinSampleShading, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMinSampleShading(context, value));
         if (isCallValid)
@@ -709,6 +720,7 @@ void GL_APIENTRY PatchParameteri(GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PatchParameteri, pname, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteri(context, pname, value));
@@ -731,6 +743,7 @@ void GL_APIENTRY PauseTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PauseTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePauseTransformFeedback(context));
         if (isCallValid)
@@ -752,6 +765,7 @@ void GL_APIENTRY ResumeTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ResumeTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateResumeTransformFeedback(context));
         if (isCallValid)
@@ -773,6 +787,7 @@ void GL_APIENTRY Uniform1d(GLint location, GLdouble x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1d, location, x);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -798,6 +813,8 @@ void GL_APIENTRY Uniform1dv(GLint location, GLsizei count, const GLdouble *value
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1dv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -822,6 +839,7 @@ void GL_APIENTRY Uniform2d(GLint location, GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2d, location, x, y);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -847,6 +865,8 @@ void GL_APIENTRY Uniform2dv(GLint location, GLsizei count, const GLdouble *value
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2dv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -871,6 +891,7 @@ void GL_APIENTRY Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3d, location, x, y, z);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -896,6 +917,8 @@ void GL_APIENTRY Uniform3dv(GLint location, GLsizei count, const GLdouble *value
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3dv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -920,6 +943,7 @@ void GL_APIENTRY Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4d, location, x, y, z, w);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -945,6 +969,8 @@ void GL_APIENTRY Uniform4dv(GLint location, GLsizei count, const GLdouble *value
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4dv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -973,6 +999,8 @@ void GL_APIENTRY UniformMatrix2dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1003,6 +1031,8 @@ void GL_APIENTRY UniformMatrix2x3dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x3dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1033,6 +1063,8 @@ void GL_APIENTRY UniformMatrix2x4dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x4dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1063,6 +1095,8 @@ void GL_APIENTRY UniformMatrix3dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1093,6 +1127,8 @@ void GL_APIENTRY UniformMatrix3x2dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x2dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1123,6 +1159,8 @@ void GL_APIENTRY UniformMatrix3x4dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x4dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1153,6 +1191,8 @@ void GL_APIENTRY UniformMatrix4dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1183,6 +1223,8 @@ void GL_APIENTRY UniformMatrix4x2dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x2dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1213,6 +1255,8 @@ void GL_APIENTRY UniformMatrix4x3dv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x3dv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLdouble)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1264,6 +1308,7 @@ void GL_APIENTRY ActiveShaderProgram(GLuint pipeline, GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ActiveShaderProgram, pipeline, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1288,6 +1333,7 @@ void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindProgramPipeline, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1311,6 +1357,7 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearDepthf, d);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
         if (isCallValid)
@@ -1415,6 +1462,7 @@ void GL_APIENTRY DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthRangeIndexed, index, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDepthRangeIndexed(context, index, n, f));
@@ -1437,6 +1485,7 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthRangef, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
         if (isCallValid)
@@ -1737,6 +1786,7 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramParameteri, program, pname, value);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1761,6 +1811,7 @@ void GL_APIENTRY ProgramUniform1d(GLuint program, GLint location, GLdouble v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1d, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1790,6 +1841,8 @@ void GL_APIENTRY ProgramUniform1dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1dv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1817,6 +1870,7 @@ void GL_APIENTRY ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1f, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1846,6 +1900,8 @@ void GL_APIENTRY ProgramUniform1fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1873,6 +1929,7 @@ void GL_APIENTRY ProgramUniform1i(GLuint program, GLint location, GLint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1i, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1902,6 +1959,8 @@ void GL_APIENTRY ProgramUniform1iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1929,6 +1988,7 @@ void GL_APIENTRY ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1ui, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1958,6 +2018,8 @@ void GL_APIENTRY ProgramUniform1uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1986,6 +2048,7 @@ void GL_APIENTRY ProgramUniform2d(GLuint program, GLint location, GLdouble v0, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2d, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2017,6 +2080,8 @@ void GL_APIENTRY ProgramUniform2dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2dv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2045,6 +2110,7 @@ void GL_APIENTRY ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2f, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2076,6 +2142,8 @@ void GL_APIENTRY ProgramUniform2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2104,6 +2172,7 @@ void GL_APIENTRY ProgramUniform2i(GLuint program, GLint location, GLint v0, GLin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2i, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2135,6 +2204,8 @@ void GL_APIENTRY ProgramUniform2iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2163,6 +2234,7 @@ void GL_APIENTRY ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2ui, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2194,6 +2266,8 @@ void GL_APIENTRY ProgramUniform2uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2223,6 +2297,7 @@ ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdou
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3d, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2254,6 +2329,8 @@ void GL_APIENTRY ProgramUniform3dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3dv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2283,6 +2360,7 @@ ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3f, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2314,6 +2392,8 @@ void GL_APIENTRY ProgramUniform3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2342,6 +2422,7 @@ void GL_APIENTRY ProgramUniform3i(GLuint program, GLint location, GLint v0, GLin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3i, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2373,6 +2454,8 @@ void GL_APIENTRY ProgramUniform3iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2401,6 +2484,7 @@ void GL_APIENTRY ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3ui, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2432,6 +2516,8 @@ void GL_APIENTRY ProgramUniform3uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2461,6 +2547,7 @@ ProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdou
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4d, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2492,6 +2579,8 @@ void GL_APIENTRY ProgramUniform4dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4dv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2521,6 +2610,7 @@ ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4f, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2552,6 +2642,8 @@ void GL_APIENTRY ProgramUniform4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2581,6 +2673,7 @@ ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4i, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2612,6 +2705,8 @@ void GL_APIENTRY ProgramUniform4iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2641,6 +2736,7 @@ ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4ui, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2672,6 +2768,8 @@ void GL_APIENTRY ProgramUniform4uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2705,6 +2803,8 @@ void GL_APIENTRY ProgramUniformMatrix2dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2739,6 +2839,8 @@ void GL_APIENTRY ProgramUniformMatrix2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2773,6 +2875,8 @@ void GL_APIENTRY ProgramUniformMatrix2x3dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2807,6 +2911,8 @@ void GL_APIENTRY ProgramUniformMatrix2x3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2841,6 +2947,8 @@ void GL_APIENTRY ProgramUniformMatrix2x4dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2875,6 +2983,8 @@ void GL_APIENTRY ProgramUniformMatrix2x4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2909,6 +3019,8 @@ void GL_APIENTRY ProgramUniformMatrix3dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2943,6 +3055,8 @@ void GL_APIENTRY ProgramUniformMatrix3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -2977,6 +3091,8 @@ void GL_APIENTRY ProgramUniformMatrix3x2dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3011,6 +3127,8 @@ void GL_APIENTRY ProgramUniformMatrix3x2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3045,6 +3163,8 @@ void GL_APIENTRY ProgramUniformMatrix3x4dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3079,6 +3199,8 @@ void GL_APIENTRY ProgramUniformMatrix3x4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3113,6 +3235,8 @@ void GL_APIENTRY ProgramUniformMatrix4dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3147,6 +3271,8 @@ void GL_APIENTRY ProgramUniformMatrix4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3181,6 +3307,8 @@ void GL_APIENTRY ProgramUniformMatrix4x2dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3215,6 +3343,8 @@ void GL_APIENTRY ProgramUniformMatrix4x2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3249,6 +3379,8 @@ void GL_APIENTRY ProgramUniformMatrix4x3dv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3dv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLdouble)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3283,6 +3415,8 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3310,6 +3444,7 @@ void GL_APIENTRY ReleaseShaderCompiler()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ReleaseShaderCompiler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
         if (isCallValid)
@@ -3357,6 +3492,7 @@ ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei he
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ScissorIndexed, index, left, bottom, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateScissorIndexed(context, index, left, bottom, width, height));
@@ -3437,6 +3573,7 @@ void GL_APIENTRY UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint pro
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UseProgramStages, pipeline, stages, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3464,6 +3601,7 @@ void GL_APIENTRY ValidateProgramPipeline(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ValidateProgramPipeline, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3487,6 +3625,7 @@ void GL_APIENTRY VertexAttribL1d(GLuint index, GLdouble x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribL1d, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL1d(context, index, x));
@@ -3533,6 +3672,7 @@ void GL_APIENTRY VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribL2d, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL2d(context, index, x, y));
@@ -3579,6 +3719,7 @@ void GL_APIENTRY VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribL3d, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL3d(context, index, x, y, z));
@@ -3625,6 +3766,7 @@ void GL_APIENTRY VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribL4d, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribL4d(context, index, x, y, z, w));
@@ -3723,6 +3865,7 @@ void GL_APIENTRY ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ViewportIndexedf, index, x, y, w, h);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewportIndexedf(context, index, x, y, w, h));
@@ -3780,6 +3923,8 @@ void GL_APIENTRY BindImageTexture(GLuint unit,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindImageTexture, unit, texture, level, layered, layer, access,
+                         format);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3812,6 +3957,8 @@ void GL_APIENTRY DrawArraysInstancedBaseInstance(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedBaseInstance, mode,
+                            first, count, instancecount, baseinstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3848,6 +3995,9 @@ void GL_APIENTRY DrawElementsInstancedBaseInstance(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedBaseInstance,
+                            mode, count, type, context->copyDeferredIndices(indices, count, type),
+                            instancecount, baseinstance);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedBaseInstance(
@@ -3884,6 +4034,10 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexBaseInstance, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instancecount,
+                            basevertex, baseinstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3914,6 +4068,8 @@ void GL_APIENTRY DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawTransformFeedbackInstanced, mode,
+                            id, instancecount);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3944,6 +4100,8 @@ void GL_APIENTRY DrawTransformFeedbackStreamInstanced(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawTransformFeedbackStreamInstanced,
+                            mode, id, stream, instancecount);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4034,6 +4192,7 @@ void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MemoryBarrier, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMemoryBarrier(context, barriers));
         if (isCallValid)
@@ -4058,6 +4217,7 @@ void GL_APIENTRY TexStorage1D(GLenum target, GLsizei levels, GLenum internalform
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage1D, target, levels, internalformat, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage1D(context, target, levels, internalformat, width));
@@ -4084,6 +4244,7 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2D, target, levels, internalformat, width, height);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4118,6 +4279,8 @@ void GL_APIENTRY TexStorage3D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3D, target, levels, internalformat, width, height,
+                         depth);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -4149,6 +4312,8 @@ void GL_APIENTRY BindVertexBuffer(GLuint bindingindex,
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexBuffer, bindingindex, buffer, offset,
+                                      stride);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4263,6 +4428,9 @@ void GL_APIENTRY CopyImageSubData(GLuint srcName,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyImageSubData, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
+                         dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight,
+                         srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyImageSubData(context, srcName, srcTarget, srcLevel, srcX,
@@ -4386,6 +4554,7 @@ void GL_APIENTRY DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DispatchCompute, num_groups_x, num_groups_y, num_groups_z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -4411,6 +4580,7 @@ void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DispatchComputeIndirect, indirect);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect));
@@ -4435,6 +4605,7 @@ void GL_APIENTRY FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferParameteri, target, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferParameteri(context, target, pname, param));
@@ -4838,6 +5009,7 @@ void GL_APIENTRY InvalidateBufferData(GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InvalidateBufferData, buffer);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4863,6 +5035,7 @@ void GL_APIENTRY InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizei
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InvalidateBufferSubData, buffer, offset, length);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -4951,6 +5124,7 @@ void GL_APIENTRY InvalidateTexImage(GLuint texture, GLint level)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InvalidateTexImage, texture, level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -4984,6 +5158,8 @@ void GL_APIENTRY InvalidateTexSubImage(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InvalidateTexSubImage, texture, level, xoffset, yoffset, zoffset,
+                         width, height, depth);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -5122,6 +5298,7 @@ void GL_APIENTRY PopDebugGroup()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopDebugGroup);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroup(context));
         if (isCallValid)
@@ -5172,6 +5349,8 @@ void GL_APIENTRY ShaderStorageBlockBinding(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ShaderStorageBlockBinding, program, storageBlockIndex,
+                         storageBlockBinding);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -5206,6 +5385,7 @@ void GL_APIENTRY TexBufferRange(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferRange, target, internalformat, buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5242,6 +5422,8 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2DMultisample, target, samples, internalformat, width,
+                         height, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5280,6 +5462,8 @@ void GL_APIENTRY TexStorage3DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3DMultisample, target, samples, internalformat, width,
+                         height, depth, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5319,6 +5503,8 @@ void GL_APIENTRY TextureView(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureView, texture, target, origtexture, internalformat,
+                         minlevel, numlevels, minlayer, numlayers);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5347,6 +5533,8 @@ void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribBinding, attribindex,
+                                      bindingindex);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribBinding(context, attribindex, bindingindex));
@@ -5377,6 +5565,8 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribFormat, attribindex, size, type, normalized,
+                         relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -5407,6 +5597,7 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribIFormat, attribindex, size, type, relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5437,6 +5628,7 @@ void GL_APIENTRY VertexAttribLFormat(GLuint attribindex,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribLFormat, attribindex, size, type, relativeoffset);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -5462,6 +5654,7 @@ void GL_APIENTRY VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexBindingDivisor, bindingindex, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexBindingDivisor(context, bindingindex, divisor));
@@ -5750,6 +5943,7 @@ void GL_APIENTRY BindTextureUnit(GLuint unit, GLuint texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindTextureUnit, unit, texture);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5790,6 +5984,8 @@ void GL_APIENTRY BlitNamedFramebuffer(GLuint readFramebuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlitNamedFramebuffer, readFramebuffer, drawFramebuffer, srcX0,
+                         srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -5929,6 +6125,8 @@ void GL_APIENTRY ClearNamedFramebufferfi(GLuint framebuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearNamedFramebufferfi, framebuffer, buffer, drawbuffer, depth,
+                         stencil);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6049,6 +6247,7 @@ void GL_APIENTRY ClipControl(GLenum origin, GLenum depth)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClipControl, origin, depth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClipControl(context, origin, depth));
@@ -6195,6 +6394,8 @@ void GL_APIENTRY CopyNamedBufferSubData(GLuint readBuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyNamedBufferSubData, readBuffer, writeBuffer, readOffset,
+                         writeOffset, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyNamedBufferSubData(context, readBuffer, writeBuffer,
@@ -6222,6 +6423,7 @@ CopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTextureSubImage1D, texture, level, xoffset, x, y, width);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -6257,6 +6459,8 @@ void GL_APIENTRY CopyTextureSubImage2D(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTextureSubImage2D, texture, level, xoffset, yoffset, x, y,
+                         width, height);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6294,6 +6498,8 @@ void GL_APIENTRY CopyTextureSubImage3D(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTextureSubImage3D, texture, level, xoffset, yoffset, zoffset,
+                         x, y, width, height);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6532,6 +6738,7 @@ void GL_APIENTRY DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableVertexArrayAttrib, vaobj, index);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6556,6 +6763,7 @@ void GL_APIENTRY EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableVertexArrayAttrib, vaobj, index);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -6581,6 +6789,7 @@ void GL_APIENTRY FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLs
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FlushMappedNamedBufferRange, buffer, offset, length);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -6606,6 +6815,7 @@ void GL_APIENTRY GenerateTextureMipmap(GLuint texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GenerateTextureMipmap, texture);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -6924,6 +7134,7 @@ void GL_APIENTRY GetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GetQueryBufferObjecti64v, id, buffer, pname, offset);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -6952,6 +7163,7 @@ void GL_APIENTRY GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GetQueryBufferObjectiv, id, buffer, pname, offset);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -6980,6 +7192,7 @@ void GL_APIENTRY GetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pnam
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GetQueryBufferObjectui64v, id, buffer, pname, offset);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7008,6 +7221,7 @@ void GL_APIENTRY GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GetQueryBufferObjectuiv, id, buffer, pname, offset);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8063,6 +8277,7 @@ void GL_APIENTRY MemoryBarrierByRegion(GLbitfield barriers)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MemoryBarrierByRegion, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers));
@@ -8170,6 +8385,7 @@ void GL_APIENTRY NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferDrawBuffer, framebuffer, buf);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8221,6 +8437,7 @@ void GL_APIENTRY NamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferParameteri, framebuffer, pname, param);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8247,6 +8464,7 @@ void GL_APIENTRY NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferReadBuffer, framebuffer, src);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8277,6 +8495,8 @@ void GL_APIENTRY NamedFramebufferRenderbuffer(GLuint framebuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferRenderbuffer, framebuffer, attachment,
+                         renderbuffertarget, renderbuffer);
         FramebufferID framebufferPacked   = PackParam<FramebufferID>(framebuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8311,6 +8531,7 @@ void GL_APIENTRY NamedFramebufferTexture(GLuint framebuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferTexture, framebuffer, attachment, texture, level);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8344,6 +8565,8 @@ void GL_APIENTRY NamedFramebufferTextureLayer(GLuint framebuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedFramebufferTextureLayer, framebuffer, attachment, texture,
+                         level, layer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8377,6 +8600,8 @@ void GL_APIENTRY NamedRenderbufferStorage(GLuint renderbuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedRenderbufferStorage, renderbuffer, internalformat, width,
+                         height);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8410,6 +8635,8 @@ void GL_APIENTRY NamedRenderbufferStorageMultisample(GLuint renderbuffer,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, NamedRenderbufferStorageMultisample, renderbuffer, samples,
+                         internalformat, width, height);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8472,6 +8699,7 @@ void GL_APIENTRY TextureBarrier()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureBarrier);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTextureBarrier(context));
         if (isCallValid)
@@ -8495,6 +8723,7 @@ void GL_APIENTRY TextureBuffer(GLuint texture, GLenum internalformat, GLuint buf
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureBuffer, texture, internalformat, buffer);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8529,6 +8758,8 @@ void GL_APIENTRY TextureBufferRange(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureBufferRange, texture, internalformat, buffer, offset,
+                         size);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8606,6 +8837,7 @@ void GL_APIENTRY TextureParameterf(GLuint texture, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureParameterf, texture, pname, param);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8655,6 +8887,7 @@ void GL_APIENTRY TextureParameteri(GLuint texture, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureParameteri, texture, pname, param);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8708,6 +8941,7 @@ void GL_APIENTRY TextureStorage1D(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureStorage1D, texture, levels, internalformat, width);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8740,6 +8974,7 @@ void GL_APIENTRY TextureStorage2D(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureStorage2D, texture, levels, internalformat, width, height);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8775,6 +9010,8 @@ void GL_APIENTRY TextureStorage2DMultisample(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureStorage2DMultisample, texture, samples, internalformat,
+                         width, height, fixedsamplelocations);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8811,6 +9048,8 @@ void GL_APIENTRY TextureStorage3D(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureStorage3D, texture, levels, internalformat, width, height,
+                         depth);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8847,6 +9086,8 @@ void GL_APIENTRY TextureStorage3DMultisample(GLuint texture,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TextureStorage3DMultisample, texture, samples, internalformat,
+                         width, height, depth, fixedsamplelocations);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8993,6 +9234,7 @@ void GL_APIENTRY TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint bu
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TransformFeedbackBufferBase, xfb, index, buffer);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -9023,6 +9265,7 @@ void GL_APIENTRY TransformFeedbackBufferRange(GLuint xfb,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TransformFeedbackBufferRange, xfb, index, buffer, offset, size);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9080,6 +9323,7 @@ void GL_APIENTRY VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLui
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexArrayAttribBinding, vaobj, attribindex, bindingindex);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9115,6 +9359,8 @@ void GL_APIENTRY VertexArrayAttribFormat(GLuint vaobj,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexArrayAttribFormat, vaobj, attribindex, size, type,
+                         normalized, relativeoffset);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -9148,6 +9394,8 @@ void GL_APIENTRY VertexArrayAttribIFormat(GLuint vaobj,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexArrayAttribIFormat, vaobj, attribindex, size, type,
+                         relativeoffset);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -9180,6 +9428,8 @@ void GL_APIENTRY VertexArrayAttribLFormat(GLuint vaobj,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexArrayAttribLFormat, vaobj, attribindex, size, type,
+                         relativeoffset);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -9207,6 +9457,7 @@ void GL_APIENTRY VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexArrayBindingDivisor, vaobj, bindingindex, divisor);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9233,6 +9484,7 @@ void GL_APIENTRY VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexArrayElementBuffer, vaobj, buffer);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -9264,6 +9516,8 @@ void GL_APIENTRY VertexArrayVertexBuffer(GLuint vaobj,
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexArrayVertexBuffer, vaobj, bindingindex,
+                                      buffer, offset, stride);
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -9396,6 +9650,7 @@ void GL_APIENTRY PolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PolygonOffsetClamp, factor, units, clamp);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePolygonOffsetClamp(context, factor, units, clamp));
@@ -125,6 +125,8 @@ EGLContext CreateContext(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglCreateContext",
                          GetDisplayIfValid(display), EGL_NO_CONTEXT);
+    // The new context takes references to the objects of the shared context.
+    ScopedShareGroupLock shareGroupLock(sharedGLContext);
     gl::Context *context = nullptr;
     ANGLE_EGL_TRY_RETURN(thread,
                          display->createContext(configuration, sharedGLContext, thread->getAPI(),
@@ -144,6 +146,7 @@ EGLImage CreateImage(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglCreateImage",
                          GetDisplayIfValid(display), EGL_FALSE);
+    ScopedShareGroupLock shareGroupLock(context);
 
     Image *image = nullptr;
     Error error  = display->createImage(context, target, buffer, attributes, &image);
@@ -277,6 +280,7 @@ EGLBoolean DestroyContext(Thread *thread, Display *display, gl::Context *context
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglDestroyContext",
                          GetDisplayIfValid(display), EGL_FALSE);
+    ScopedShareGroupLock shareGroupLock(context);
     bool contextWasCurrent = context == thread->getContext();
 
     ANGLE_EGL_TRY_RETURN(thread, display->destroyContext(thread, context), "eglDestroyContext",
@@ -471,6 +475,8 @@ EGLBoolean MakeCurrent(Thread *thread,
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglMakeCurrent",
                          GetDisplayIfValid(display), EGL_FALSE);
+    // The share group of the previous context is locked by the entry point.
+    ScopedShareGroupLock shareGroupLock(context);
     Surface *previousDraw        = thread->getCurrentDrawSurface();
     Surface *previousRead        = thread->getCurrentReadSurface();
     gl::Context *previousContext = thread->getContext();
@@ -569,6 +575,9 @@ EGLBoolean ReleaseTexImage(Thread *thread, Display *display, Surface *eglSurface
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglReleaseTexImage",
                          GetDisplayIfValid(display), EGL_FALSE);
+    // The texture may belong to another share group than the current context.  Its GL calls can
+    // also release it, so check whether it is still bound once they are locked out.
+    ScopedShareGroupLock textureShareGroupLock(eglSurface->getBoundTextureShareGroupMutex());
     gl::Texture *texture = eglSurface->getBoundTexture();
 
     if (texture)
@@ -656,6 +665,15 @@ EGLBoolean Terminate(Thread *thread, Display *display)
 {
     ANGLE_EGL_TRY_RETURN(thread, display->prepareForCall(), "eglTerminate",
                          GetDisplayIfValid(display), EGL_FALSE);
+
+    // All the contexts of the display are destroyed.  Holding the global mutex makes it safe to
+    // lock several share groups, since GL calls never lock more than one.
+    std::vector<std::unique_ptr<ScopedShareGroupLock>> shareGroupLocks;
+    for (gl::Context *context : display->getContextSet())
+    {
+        shareGroupLocks.emplace_back(new ScopedShareGroupLock(context));
+    }
+
     ANGLE_EGL_TRY_RETURN(thread,
                          display->makeCurrent(thread->getContext(), nullptr, nullptr, nullptr),
                          "eglTerminate", GetDisplayIfValid(display), EGL_FALSE);
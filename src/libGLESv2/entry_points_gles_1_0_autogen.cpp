@@ -29,6 +29,7 @@ void GL_APIENTRY AlphaFunc(GLenum func, GLfloat ref)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, AlphaFunc, func, ref);
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -53,6 +54,7 @@ void GL_APIENTRY AlphaFuncx(GLenum func, GLfixed ref)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, AlphaFuncx, func, ref);
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -78,6 +80,7 @@ void GL_APIENTRY ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixed a
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearColorx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha));
@@ -100,6 +103,7 @@ void GL_APIENTRY ClearDepthx(GLfixed depth)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearDepthx, depth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthx(context, depth));
         if (isCallValid)
@@ -122,6 +126,7 @@ void GL_APIENTRY ClientActiveTexture(GLenum texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClientActiveTexture, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
@@ -190,6 +195,7 @@ void GL_APIENTRY Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4f, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
@@ -213,6 +219,7 @@ void GL_APIENTRY Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alph
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4ub, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
@@ -236,6 +243,7 @@ void GL_APIENTRY Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Color4x, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha));
@@ -284,6 +292,7 @@ void GL_APIENTRY DepthRangex(GLfixed n, GLfixed f)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthRangex, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangex(context, n, f));
         if (isCallValid)
@@ -306,6 +315,7 @@ void GL_APIENTRY DisableClientState(GLenum array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableClientState, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -330,6 +340,7 @@ void GL_APIENTRY EnableClientState(GLenum array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableClientState, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -354,6 +365,7 @@ void GL_APIENTRY Fogf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Fogf, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
         if (isCallValid)
@@ -398,6 +410,7 @@ void GL_APIENTRY Fogx(GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Fogx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogx(context, pname, param));
         if (isCallValid)
@@ -442,6 +455,7 @@ void GL_APIENTRY Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Frustumf, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f));
@@ -466,6 +480,7 @@ void GL_APIENTRY Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Frustumx, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f));
@@ -766,6 +781,7 @@ void GL_APIENTRY LightModelf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LightModelf, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
@@ -812,6 +828,7 @@ void GL_APIENTRY LightModelx(GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LightModelx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelx(context, pname, param));
@@ -859,6 +876,7 @@ void GL_APIENTRY Lightf(GLenum light, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Lightf, light, pname, param);
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -909,6 +927,7 @@ void GL_APIENTRY Lightx(GLenum light, GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Lightx, light, pname, param);
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -957,6 +976,7 @@ void GL_APIENTRY LineWidthx(GLfixed width)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LineWidthx, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidthx(context, width));
         if (isCallValid)
@@ -978,6 +998,7 @@ void GL_APIENTRY LoadIdentity()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LoadIdentity);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
         if (isCallValid)
@@ -1044,6 +1065,7 @@ void GL_APIENTRY LogicOp(GLenum opcode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LogicOp, opcode);
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
@@ -1068,6 +1090,7 @@ void GL_APIENTRY Materialf(GLenum face, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Materialf, face, pname, param);
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1118,6 +1141,7 @@ void GL_APIENTRY Materialx(GLenum face, GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Materialx, face, pname, param);
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1167,6 +1191,7 @@ void GL_APIENTRY MatrixMode(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MatrixMode, mode);
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
@@ -1234,6 +1259,7 @@ void GL_APIENTRY MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4f, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
@@ -1258,6 +1284,7 @@ void GL_APIENTRY MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixed r
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MultiTexCoord4x, texture, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q));
@@ -1280,6 +1307,7 @@ void GL_APIENTRY Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3f, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
         if (isCallValid)
@@ -1302,6 +1330,7 @@ void GL_APIENTRY Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Normal3x, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz));
         if (isCallValid)
@@ -1349,6 +1378,7 @@ void GL_APIENTRY Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Orthof, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f));
         if (isCallValid)
@@ -1372,6 +1402,7 @@ void GL_APIENTRY Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Orthox, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f));
         if (isCallValid)
@@ -1394,6 +1425,7 @@ void GL_APIENTRY PointParameterf(GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointParameterf, pname, param);
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1442,6 +1474,7 @@ void GL_APIENTRY PointParameterx(GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointParameterx, pname, param);
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1489,6 +1522,7 @@ void GL_APIENTRY PointSize(GLfloat size)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointSize, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
         if (isCallValid)
@@ -1510,6 +1544,7 @@ void GL_APIENTRY PointSizex(GLfixed size)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PointSizex, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSizex(context, size));
         if (isCallValid)
@@ -1532,6 +1567,7 @@ void GL_APIENTRY PolygonOffsetx(GLfixed factor, GLfixed units)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PolygonOffsetx, factor, units);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units));
@@ -1554,6 +1590,7 @@ void GL_APIENTRY PopMatrix()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopMatrix);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
         if (isCallValid)
@@ -1575,6 +1612,7 @@ void GL_APIENTRY PushMatrix()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PushMatrix);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
         if (isCallValid)
@@ -1597,6 +1635,7 @@ void GL_APIENTRY Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rotatef, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
         if (isCallValid)
@@ -1619,6 +1658,7 @@ void GL_APIENTRY Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Rotatex, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatex(context, angle, x, y, z));
         if (isCallValid)
@@ -1641,6 +1681,7 @@ void GL_APIENTRY SampleCoveragex(GLclampx value, GLboolean invert)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleCoveragex, value, invert);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoveragex(context, value, invert));
@@ -1663,6 +1704,7 @@ void GL_APIENTRY Scalef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scalef, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
         if (isCallValid)
@@ -1684,6 +1726,7 @@ void GL_APIENTRY Scalex(GLfixed x, GLfixed y, GLfixed z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scalex, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalex(context, x, y, z));
         if (isCallValid)
@@ -1706,6 +1749,7 @@ void GL_APIENTRY ShadeModel(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ShadeModel, mode);
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
@@ -1756,6 +1800,7 @@ void GL_APIENTRY TexEnvf(GLenum target, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexEnvf, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1808,6 +1853,7 @@ void GL_APIENTRY TexEnvi(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexEnvi, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1860,6 +1906,7 @@ void GL_APIENTRY TexEnvx(GLenum target, GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexEnvx, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1912,6 +1959,7 @@ void GL_APIENTRY TexParameterx(GLenum target, GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexParameterx, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1961,6 +2009,7 @@ void GL_APIENTRY Translatef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Translatef, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
         if (isCallValid)
@@ -1983,6 +2032,7 @@ void GL_APIENTRY Translatex(GLfixed x, GLfixed y, GLfixed z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Translatex, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatex(context, x, y, z));
         if (isCallValid)
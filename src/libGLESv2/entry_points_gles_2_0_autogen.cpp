@@ -29,6 +29,7 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ActiveTexture, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
         if (isCallValid)
@@ -51,6 +52,7 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, AttachShader, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -101,6 +103,8 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(target == GL_ELEMENT_ARRAY_BUFFER, context, BindBuffer,
+                                      target, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -126,6 +130,7 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindFramebuffer, target, framebuffer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -150,6 +155,7 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindRenderbuffer, target, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -174,6 +180,7 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindTexture, target, texture);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -199,6 +206,7 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendColor, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
@@ -222,6 +230,7 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquation, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
         if (isCallValid)
@@ -245,6 +254,7 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparate, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
@@ -269,6 +279,7 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunc, sfactor, dfactor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
@@ -299,6 +310,8 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparate, sfactorRGB, dfactorRGB, sfactorAlpha,
+                         dfactorAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
@@ -327,6 +340,8 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BufferData, target, size, DeferredCallQueue::Copy(data, size, 1),
+                         usage);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferUsage usagePacked                               = PackParam<BufferUsage>(usage);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -355,6 +370,8 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BufferSubData, target, offset, size,
+                         DeferredCallQueue::Copy(data, size, 1));
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -410,6 +427,7 @@ void GL_APIENTRY Clear(GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Clear, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
         if (isCallValid)
@@ -432,6 +450,7 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearColor, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
@@ -454,6 +473,7 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearDepthf, d);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
         if (isCallValid)
@@ -475,6 +495,7 @@ void GL_APIENTRY ClearStencil(GLint s)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearStencil, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
         if (isCallValid)
@@ -498,6 +519,7 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMask, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
@@ -520,6 +542,7 @@ void GL_APIENTRY CompileShader(GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CompileShader, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -633,6 +656,8 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexImage2D, target, level, internalformat, x, y, width,
+                         height, border);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -670,6 +695,8 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage2D, target, level, xoffset, yoffset, x, y, width,
+                         height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -754,6 +781,7 @@ void GL_APIENTRY CullFace(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CullFace, mode);
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
@@ -824,6 +852,7 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DeleteProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -872,6 +901,7 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DeleteShader, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -920,6 +950,7 @@ void GL_APIENTRY DepthFunc(GLenum func)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthFunc, func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
         if (isCallValid)
@@ -941,6 +972,7 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthMask, flag);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
         if (isCallValid)
@@ -962,6 +994,7 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DepthRangef, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
         if (isCallValid)
@@ -984,6 +1017,7 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DetachShader, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1009,6 +1043,7 @@ void GL_APIENTRY Disable(GLenum cap)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, Disable, cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
         if (isCallValid)
@@ -1030,6 +1065,7 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableVertexAttribArray, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
@@ -1053,6 +1089,7 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArrays, mode, first, count);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1079,6 +1116,8 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElements, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1104,6 +1143,7 @@ void GL_APIENTRY Enable(GLenum cap)
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, Enable, cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
         if (isCallValid)
@@ -1125,6 +1165,7 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableVertexAttribArray, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
@@ -1168,6 +1209,7 @@ void GL_APIENTRY Flush()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Flush);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
         if (isCallValid)
@@ -1196,6 +1238,8 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferRenderbuffer, target, attachment, renderbuffertarget,
+                         renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1231,6 +1275,8 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture2D, target, attachment, textarget, texture,
+                         level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1259,6 +1305,7 @@ void GL_APIENTRY FrontFace(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FrontFace, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
         if (isCallValid)
@@ -1377,6 +1424,7 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GenerateMipmap, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2112,6 +2160,7 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Hint, target, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
         if (isCallValid)
@@ -2338,6 +2387,7 @@ void GL_APIENTRY LineWidth(GLfloat width)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LineWidth, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
         if (isCallValid)
@@ -2359,6 +2409,7 @@ void GL_APIENTRY LinkProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LinkProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2383,6 +2434,7 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PixelStorei, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
@@ -2406,6 +2458,7 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PolygonOffset, factor, units);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
@@ -2460,6 +2513,7 @@ void GL_APIENTRY ReleaseShaderCompiler()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ReleaseShaderCompiler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
         if (isCallValid)
@@ -2487,6 +2541,7 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorage, target, internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -2512,6 +2567,7 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleCoverage, value, invert);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
@@ -2535,6 +2591,7 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Scissor, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
@@ -2620,6 +2677,7 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilFunc, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
@@ -2644,6 +2702,7 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilFuncSeparate, face, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
@@ -2666,6 +2725,7 @@ void GL_APIENTRY StencilMask(GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilMask, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
         if (isCallValid)
@@ -2688,6 +2748,7 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilMaskSeparate, face, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
@@ -2713,6 +2774,7 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilOp, fail, zfail, zpass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
@@ -2740,6 +2802,7 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, StencilOpSeparate, face, sfail, dpfail, dppass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
@@ -2803,6 +2866,7 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexParameterf, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2854,6 +2918,7 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexParameteri, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2942,6 +3007,7 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1f, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2967,6 +3033,8 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1fv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2990,6 +3058,7 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1i, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3015,6 +3084,8 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1iv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3039,6 +3110,7 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2f, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3064,6 +3136,8 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3088,6 +3162,7 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2i, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3113,6 +3188,8 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3137,6 +3214,7 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3f, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3162,6 +3240,8 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3186,6 +3266,7 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3i, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3211,6 +3292,8 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3235,6 +3318,7 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4f, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3260,6 +3344,8 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4fv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3284,6 +3370,7 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4i, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3309,6 +3396,8 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4iv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3337,6 +3426,8 @@ void GL_APIENTRY UniformMatrix2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3367,6 +3458,8 @@ void GL_APIENTRY UniformMatrix3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3397,6 +3490,8 @@ void GL_APIENTRY UniformMatrix4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3422,6 +3517,7 @@ void GL_APIENTRY UseProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UseProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3445,6 +3541,7 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ValidateProgram, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3468,6 +3565,7 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib1f, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
         if (isCallValid)
@@ -3513,6 +3611,7 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib2f, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
@@ -3559,6 +3658,7 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib3f, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
@@ -3605,6 +3705,7 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttrib4f, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
@@ -3659,6 +3760,8 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribPointer, index, size, type,
+                                      normalized, stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -3685,6 +3788,7 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Viewport, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
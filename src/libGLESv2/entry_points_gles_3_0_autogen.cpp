@@ -29,6 +29,7 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginQuery, target, id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -54,6 +55,7 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginTransformFeedback, primitiveMode);
         PrimitiveMode primitiveModePacked = PackParam<PrimitiveMode>(primitiveMode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -78,6 +80,7 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindBufferBase, target, index, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -106,6 +109,7 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindBufferRange, target, index, buffer, offset, size);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -133,6 +137,7 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindSampler, unit, sampler);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -157,6 +162,7 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindTransformFeedback, target, id);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -180,6 +186,7 @@ void GL_APIENTRY BindVertexArray(GLuint array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexArray, array);
         VertexArrayID arrayPacked                             = PackParam<VertexArrayID>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -217,6 +224,8 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlitFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
+                         dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
@@ -244,6 +253,7 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ClearBufferfi, buffer, drawbuffer, depth, stencil);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil));
@@ -462,6 +472,8 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyBufferSubData, readTarget, writeTarget, readOffset,
+                         writeOffset, size);
         BufferBinding readTargetPacked  = PackParam<BufferBinding>(readTarget);
         BufferBinding writeTargetPacked = PackParam<BufferBinding>(writeTarget);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -501,6 +513,8 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage3D, target, level, xoffset, yoffset, zoffset, x, y,
+                         width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -647,6 +661,8 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstanced, mode, first,
+                            count, instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -702,6 +718,9 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstanced, mode, count,
+                            type, context->copyDeferredIndices(indices, count, type),
+                            instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -737,6 +756,8 @@ void GL_APIENTRY DrawRangeElements(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElements, mode, start, end,
+                            count, type, context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -764,6 +785,7 @@ void GL_APIENTRY EndQuery(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndQuery, target);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndQuery(context, targetPacked));
@@ -786,6 +808,7 @@ void GL_APIENTRY EndTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndTransformFeedback(context));
         if (isCallValid)
@@ -841,6 +864,7 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FlushMappedBufferRange, target, offset, length);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -868,6 +892,8 @@ FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTextureLayer, target, attachment, texture, level,
+                         layer);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1890,6 +1916,7 @@ void GL_APIENTRY PauseTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PauseTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePauseTransformFeedback(context));
         if (isCallValid)
@@ -1943,6 +1970,7 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramParameteri, program, pname, value);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1967,6 +1995,7 @@ void GL_APIENTRY ReadBuffer(GLenum src)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ReadBuffer, src);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReadBuffer(context, src));
         if (isCallValid)
@@ -1995,6 +2024,8 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisample, target, samples, internalformat,
+                         width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisample(context, target, samples,
@@ -2019,6 +2050,7 @@ void GL_APIENTRY ResumeTransformFeedback()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ResumeTransformFeedback);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateResumeTransformFeedback(context));
         if (isCallValid)
@@ -2041,6 +2073,7 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SamplerParameterf, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2090,6 +2123,7 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SamplerParameteri, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2182,6 +2216,7 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2D, target, levels, internalformat, width, height);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2216,6 +2251,8 @@ void GL_APIENTRY TexStorage3D(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3D, target, levels, internalformat, width, height,
+                         depth);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2315,6 +2352,7 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1ui, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2340,6 +2378,8 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform1uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2364,6 +2404,7 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2ui, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2389,6 +2430,8 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform2uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2413,6 +2456,7 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3ui, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2438,6 +2482,8 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform3uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2462,6 +2508,7 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4ui, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2487,6 +2534,8 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Uniform4uiv, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2514,6 +2563,8 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformBlockBinding, program, uniformBlockIndex,
+                         uniformBlockBinding);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -2544,6 +2595,8 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2574,6 +2627,8 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix2x4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2604,6 +2659,8 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2634,6 +2691,8 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix3x4fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2664,6 +2723,8 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x2fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2694,6 +2755,8 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UniformMatrix4x3fv, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2751,6 +2814,7 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribDivisor, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor));
@@ -2774,6 +2838,7 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI4i, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w));
@@ -2820,6 +2885,7 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribI4ui, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w));
@@ -2870,6 +2936,8 @@ VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, cons
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribIPointer, index, size, type,
+                                      stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
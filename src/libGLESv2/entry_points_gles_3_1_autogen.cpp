@@ -29,6 +29,7 @@ void GL_APIENTRY ActiveShaderProgram(GLuint pipeline, GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ActiveShaderProgram, pipeline, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -64,6 +65,8 @@ void GL_APIENTRY BindImageTexture(GLuint unit,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindImageTexture, unit, texture, level, layered, layer, access,
+                         format);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -89,6 +92,7 @@ void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindProgramPipeline, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -117,6 +121,8 @@ void GL_APIENTRY BindVertexBuffer(GLuint bindingindex,
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexBuffer, bindingindex, buffer, offset,
+                                      stride);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -202,6 +208,7 @@ void GL_APIENTRY DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DispatchCompute, num_groups_x, num_groups_y, num_groups_z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -227,6 +234,7 @@ void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DispatchComputeIndirect, indirect);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect));
@@ -303,6 +311,7 @@ void GL_APIENTRY FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferParameteri, target, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferParameteri(context, target, pname, param));
@@ -750,6 +759,7 @@ void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MemoryBarrier, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMemoryBarrier(context, barriers));
         if (isCallValid)
@@ -772,6 +782,7 @@ void GL_APIENTRY MemoryBarrierByRegion(GLbitfield barriers)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MemoryBarrierByRegion, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers));
@@ -795,6 +806,7 @@ void GL_APIENTRY ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1f, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -824,6 +836,8 @@ void GL_APIENTRY ProgramUniform1fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -851,6 +865,7 @@ void GL_APIENTRY ProgramUniform1i(GLuint program, GLint location, GLint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1i, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -880,6 +895,8 @@ void GL_APIENTRY ProgramUniform1iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -907,6 +924,7 @@ void GL_APIENTRY ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1ui, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -936,6 +954,8 @@ void GL_APIENTRY ProgramUniform1uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -964,6 +984,7 @@ void GL_APIENTRY ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2f, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -995,6 +1016,8 @@ void GL_APIENTRY ProgramUniform2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1023,6 +1046,7 @@ void GL_APIENTRY ProgramUniform2i(GLuint program, GLint location, GLint v0, GLin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2i, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1054,6 +1078,8 @@ void GL_APIENTRY ProgramUniform2iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1082,6 +1108,7 @@ void GL_APIENTRY ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2ui, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1113,6 +1140,8 @@ void GL_APIENTRY ProgramUniform2uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1142,6 +1171,7 @@ ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3f, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1173,6 +1203,8 @@ void GL_APIENTRY ProgramUniform3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1201,6 +1233,7 @@ void GL_APIENTRY ProgramUniform3i(GLuint program, GLint location, GLint v0, GLin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3i, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1232,6 +1265,8 @@ void GL_APIENTRY ProgramUniform3iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1260,6 +1295,7 @@ void GL_APIENTRY ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3ui, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1291,6 +1327,8 @@ void GL_APIENTRY ProgramUniform3uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1320,6 +1358,7 @@ ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4f, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1351,6 +1390,8 @@ void GL_APIENTRY ProgramUniform4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4fv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1380,6 +1421,7 @@ ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4i, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1411,6 +1453,8 @@ void GL_APIENTRY ProgramUniform4iv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4iv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1440,6 +1484,7 @@ ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4ui, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1471,6 +1516,8 @@ void GL_APIENTRY ProgramUniform4uiv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4uiv, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1504,6 +1551,8 @@ void GL_APIENTRY ProgramUniformMatrix2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1538,6 +1587,8 @@ void GL_APIENTRY ProgramUniformMatrix2x3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1572,6 +1623,8 @@ void GL_APIENTRY ProgramUniformMatrix2x4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1606,6 +1659,8 @@ void GL_APIENTRY ProgramUniformMatrix3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1640,6 +1695,8 @@ void GL_APIENTRY ProgramUniformMatrix3x2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1674,6 +1731,8 @@ void GL_APIENTRY ProgramUniformMatrix3x4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1708,6 +1767,8 @@ void GL_APIENTRY ProgramUniformMatrix4fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1742,6 +1803,8 @@ void GL_APIENTRY ProgramUniformMatrix4x2fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1776,6 +1839,8 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3fv, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1804,6 +1869,7 @@ void GL_APIENTRY SampleMaski(GLuint maskNumber, GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleMaski, maskNumber, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask));
@@ -1836,6 +1902,8 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2DMultisample, target, samples, internalformat, width,
+                         height, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1865,6 +1933,7 @@ void GL_APIENTRY UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint pro
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UseProgramStages, pipeline, stages, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1892,6 +1961,7 @@ void GL_APIENTRY ValidateProgramPipeline(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ValidateProgramPipeline, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -1916,6 +1986,8 @@ void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribBinding, attribindex,
+                                      bindingindex);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribBinding(context, attribindex, bindingindex));
@@ -1946,6 +2018,8 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribFormat, attribindex, size, type, normalized,
+                         relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -1976,6 +2050,7 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribIFormat, attribindex, size, type, relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -2002,6 +2077,7 @@ void GL_APIENTRY VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexBindingDivisor, bindingindex, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexBindingDivisor(context, bindingindex, divisor));
@@ -28,6 +28,7 @@ void GL_APIENTRY BlendBarrier()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendBarrier);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendBarrier(context));
         if (isCallValid)
@@ -51,6 +52,7 @@ void GL_APIENTRY BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeA
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparatei, buf, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparatei(context, buf, modeRGB, modeAlpha));
@@ -74,6 +76,7 @@ void GL_APIENTRY BlendEquationi(GLuint buf, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationi, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationi(context, buf, mode));
@@ -102,6 +105,7 @@ BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GL
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparatei, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -128,6 +132,7 @@ void GL_APIENTRY BlendFunci(GLuint buf, GLenum src, GLenum dst)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunci, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunci(context, buf, src, dst));
@@ -152,6 +157,7 @@ void GL_APIENTRY ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMaski, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaski(context, index, r, g, b, a));
@@ -195,6 +201,9 @@ void GL_APIENTRY CopyImageSubData(GLuint srcName,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyImageSubData, srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
+                         dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight,
+                         srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyImageSubData(context, srcName, srcTarget, srcLevel, srcX,
@@ -317,6 +326,7 @@ void GL_APIENTRY Disablei(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Disablei, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisablei(context, target, index));
         if (isCallValid)
@@ -346,6 +356,8 @@ void GL_APIENTRY DrawElementsBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertex, mode, count,
+                            type, context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -382,6 +394,9 @@ void GL_APIENTRY DrawElementsInstancedBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedBaseVertex, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            instancecount, basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -419,6 +434,9 @@ void GL_APIENTRY DrawRangeElementsBaseVertex(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElementsBaseVertex, mode,
+                            start, end, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -447,6 +465,7 @@ void GL_APIENTRY Enablei(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, Enablei, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnablei(context, target, index));
         if (isCallValid)
@@ -471,6 +490,7 @@ void GL_APIENTRY FramebufferTexture(GLenum target, GLenum attachment, GLuint tex
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture, target, attachment, texture, level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -862,6 +882,7 @@ void GL_APIENTRY MinSampleShading(GLfloat value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MinSampleShading, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMinSampleShading(context, value));
         if (isCallValid)
@@ -933,6 +954,7 @@ void GL_APIENTRY PatchParameteri(GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PatchParameteri, pname, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteri(context, pname, value));
@@ -955,6 +977,7 @@ void GL_APIENTRY PopDebugGroup()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopDebugGroup);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroup(context));
         if (isCallValid)
@@ -986,6 +1009,8 @@ void GL_APIENTRY PrimitiveBoundingBox(GLfloat minX,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PrimitiveBoundingBox, minX, minY, minZ, minW, maxX, maxY, maxZ,
+                         maxW);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -1122,6 +1147,7 @@ void GL_APIENTRY TexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBuffer, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1154,6 +1180,7 @@ void GL_APIENTRY TexBufferRange(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferRange, target, internalformat, buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -1243,6 +1270,8 @@ void GL_APIENTRY TexStorage3DMultisample(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3DMultisample, target, samples, internalformat, width,
+                         height, depth, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -48,6 +48,8 @@ void GL_APIENTRY DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedBaseInstanceANGLE,
+                            mode, first, count, instanceCount, baseInstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -85,6 +87,10 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexBaseInstanceANGLE, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instanceCounts,
+                            baseVertex, baseInstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -211,6 +217,9 @@ void GL_APIENTRY CopyTexture3DANGLE(GLuint sourceId,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexture3DANGLE, sourceId, sourceLevel, destTarget, destId,
+                         destLevel, internalFormat, destType, unpackFlipY, unpackPremultiplyAlpha,
+                         unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -267,6 +276,9 @@ void GL_APIENTRY CopySubTexture3DANGLE(GLuint sourceId,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopySubTexture3DANGLE, sourceId, sourceLevel, destTarget, destId,
+                         destLevel, xoffset, yoffset, zoffset, x, y, z, width, height, depth,
+                         unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -317,6 +329,8 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlitFramebufferANGLE, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                         dstX1, dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0,
@@ -350,6 +364,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisampleANGLE, target, samples,
+                         internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleANGLE(
@@ -503,6 +519,8 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedANGLE, mode, first,
+                            count, primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -536,6 +554,9 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedANGLE, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -563,6 +584,7 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribDivisorANGLE, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribDivisorANGLE(context, index, divisor));
@@ -601,6 +623,8 @@ void GL_APIENTRY TexStorageMemFlags2DANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags2DANGLE, target, levels, internalFormat, width,
+                         height, memory, offset, createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -646,6 +670,9 @@ void GL_APIENTRY TexStorageMemFlags2DMultisampleANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags2DMultisampleANGLE, target, samples,
+                         internalFormat, width, height, fixedSampleLocations, memory, offset,
+                         createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -693,6 +720,8 @@ void GL_APIENTRY TexStorageMemFlags3DANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags3DANGLE, target, levels, internalFormat, width,
+                         height, depth, memory, offset, createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -740,6 +769,9 @@ void GL_APIENTRY TexStorageMemFlags3DMultisampleANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags3DMultisampleANGLE, target, samples,
+                         internalFormat, width, height, depth, fixedSampleLocations, memory, offset,
+                         createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -778,6 +810,7 @@ void GL_APIENTRY ImportMemoryZirconHandleANGLE(GLuint memory,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ImportMemoryZirconHandleANGLE, memory, size, handleType, handle);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -947,6 +980,7 @@ void GL_APIENTRY ProvokingVertexANGLE(GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProvokingVertexANGLE, mode);
         ProvokingVertexConvention modePacked = PackParam<ProvokingVertexConvention>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3193,6 +3227,7 @@ void GL_APIENTRY ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ImportSemaphoreZirconHandleANGLE, semaphore, handleType, handle);
         SemaphoreID semaphorePacked                           = PackParam<SemaphoreID>(semaphore);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3232,6 +3267,8 @@ void GL_APIENTRY TexImage2DExternalANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexImage2DExternalANGLE, target, level, internalformat, width,
+                         height, border, format, type);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3260,6 +3297,7 @@ void GL_APIENTRY InvalidateTextureANGLE(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, InvalidateTextureANGLE, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3294,6 +3332,8 @@ void GL_APIENTRY TexStorage2DMultisampleANGLE(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2DMultisampleANGLE, target, samples, internalformat,
+                         width, height, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -3346,6 +3386,7 @@ void GL_APIENTRY SampleMaskiANGLE(GLuint maskNumber, GLbitfield mask)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SampleMaskiANGLE, maskNumber, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaskiANGLE(context, maskNumber, mask));
@@ -3435,6 +3476,7 @@ void GL_APIENTRY CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CompressedCopyTextureCHROMIUM, sourceId, destId);
         TextureID sourceIdPacked                              = PackParam<TextureID>(sourceId);
         TextureID destIdPacked                                = PackParam<TextureID>(destId);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3478,6 +3520,9 @@ void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTextureCHROMIUM, sourceId, sourceLevel, destTarget, destId,
+                         destLevel, internalFormat, destType, unpackFlipY, unpackPremultiplyAlpha,
+                         unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -3530,6 +3575,9 @@ void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopySubTextureCHROMIUM, sourceId, sourceLevel, destTarget, destId,
+                         destLevel, xoffset, yoffset, x, y, width, height, unpackFlipY,
+                         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -3564,6 +3612,7 @@ void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CoverageModulationCHROMIUM, components);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components));
@@ -3589,6 +3638,7 @@ void GL_APIENTRY LoseContextCHROMIUM(GLenum current, GLenum other)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LoseContextCHROMIUM, current, other);
         GraphicsResetStatus currentPacked = PackParam<GraphicsResetStatus>(current);
         GraphicsResetStatus otherPacked   = PackParam<GraphicsResetStatus>(other);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3798,6 +3848,9 @@ void GL_APIENTRY CopyImageSubDataEXT(GLuint srcName,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyImageSubDataEXT, srcName, srcTarget, srcLevel, srcX, srcY,
+                         srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight,
+                         srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -3855,6 +3908,7 @@ void GL_APIENTRY PopGroupMarkerEXT()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopGroupMarkerEXT);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopGroupMarkerEXT(context));
         if (isCallValid)
@@ -3933,6 +3987,7 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BeginQueryEXT, target, id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -3982,6 +4037,7 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EndQueryEXT, target);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4204,6 +4260,7 @@ void GL_APIENTRY QueryCounterEXT(GLuint id, GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, QueryCounterEXT, id, target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -4255,6 +4312,7 @@ void GL_APIENTRY BlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum mo
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateiEXT, buf, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiEXT(context, buf, modeRGB, modeAlpha));
@@ -4278,6 +4336,7 @@ void GL_APIENTRY BlendEquationiEXT(GLuint buf, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationiEXT, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiEXT(context, buf, mode));
@@ -4306,6 +4365,7 @@ BlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateiEXT, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -4332,6 +4392,7 @@ void GL_APIENTRY BlendFunciEXT(GLuint buf, GLenum src, GLenum dst)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunciEXT, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciEXT(context, buf, src, dst));
@@ -4356,6 +4417,7 @@ void GL_APIENTRY ColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLboolean
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMaskiEXT, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiEXT(context, index, r, g, b, a));
@@ -4379,6 +4441,7 @@ void GL_APIENTRY DisableiEXT(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DisableiEXT, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiEXT(context, target, index));
@@ -4402,6 +4465,7 @@ void GL_APIENTRY EnableiEXT(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EnableiEXT, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiEXT(context, target, index));
@@ -4463,6 +4527,9 @@ void GL_APIENTRY DrawElementsBaseVertexEXT(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertexEXT, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -4499,6 +4566,9 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexEXT(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedBaseVertexEXT,
+                            mode, count, type, context->copyDeferredIndices(indices, count, type),
+                            instancecount, basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -4536,6 +4606,9 @@ void GL_APIENTRY DrawRangeElementsBaseVertexEXT(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElementsBaseVertexEXT, mode,
+                            start, end, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -4676,6 +4749,7 @@ void GL_APIENTRY FramebufferTextureEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTextureEXT, target, attachment, texture, level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4704,6 +4778,8 @@ void GL_APIENTRY DrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedEXT, mode, start,
+                            count, primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4737,6 +4813,8 @@ void GL_APIENTRY DrawElementsInstancedEXT(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedEXT, mode, count,
+                            type, context->copyDeferredIndices(indices, count, type), primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -4764,6 +4842,7 @@ void GL_APIENTRY VertexAttribDivisorEXT(GLuint index, GLuint divisor)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, VertexAttribDivisorEXT, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisorEXT(context, index, divisor));
@@ -4790,6 +4869,7 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FlushMappedBufferRangeEXT, target, offset, length);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -4858,6 +4938,7 @@ void GL_APIENTRY BufferStorageMemEXT(GLenum target, GLsizeiptr size, GLuint memo
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BufferStorageMemEXT, target, size, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5081,6 +5162,8 @@ void GL_APIENTRY TexStorageMem2DEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMem2DEXT, target, levels, internalFormat, width, height,
+                         memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5121,6 +5204,8 @@ void GL_APIENTRY TexStorageMem2DMultisampleEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMem2DMultisampleEXT, target, samples, internalFormat,
+                         width, height, fixedSampleLocations, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5161,6 +5246,8 @@ void GL_APIENTRY TexStorageMem3DEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMem3DEXT, target, levels, internalFormat, width, height,
+                         depth, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5202,6 +5289,8 @@ void GL_APIENTRY TexStorageMem3DMultisampleEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorageMem3DMultisampleEXT, target, samples, internalFormat,
+                         width, height, depth, fixedSampleLocations, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5236,6 +5325,7 @@ void GL_APIENTRY ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleTy
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ImportMemoryFdEXT, memory, size, handleType, fd);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5273,6 +5363,8 @@ void GL_APIENTRY FramebufferTexture2DMultisampleEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture2DMultisampleEXT, target, attachment, textarget,
+                         texture, level, samples);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5308,6 +5400,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisampleEXT, target, samples,
+                         internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleEXT(
@@ -5690,6 +5784,7 @@ void GL_APIENTRY ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ImportSemaphoreFdEXT, semaphore, handleType, fd);
         SemaphoreID semaphorePacked                           = PackParam<SemaphoreID>(semaphore);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5718,6 +5813,7 @@ void GL_APIENTRY ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ActiveShaderProgramEXT, pipeline, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5742,6 +5838,7 @@ void GL_APIENTRY BindProgramPipelineEXT(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindProgramPipelineEXT, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -5937,6 +6034,7 @@ void GL_APIENTRY ProgramParameteriEXT(GLuint program, GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramParameteriEXT, program, pname, value);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -5961,6 +6059,7 @@ void GL_APIENTRY ProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1fEXT, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -5991,6 +6090,8 @@ void GL_APIENTRY ProgramUniform1fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1fvEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6018,6 +6119,7 @@ void GL_APIENTRY ProgramUniform1iEXT(GLuint program, GLint location, GLint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1iEXT, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6048,6 +6150,8 @@ void GL_APIENTRY ProgramUniform1ivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1ivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6075,6 +6179,7 @@ void GL_APIENTRY ProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1uiEXT, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6106,6 +6211,8 @@ void GL_APIENTRY ProgramUniform1uivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform1uivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6134,6 +6241,7 @@ void GL_APIENTRY ProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2fEXT, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6165,6 +6273,8 @@ void GL_APIENTRY ProgramUniform2fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2fvEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6193,6 +6303,7 @@ void GL_APIENTRY ProgramUniform2iEXT(GLuint program, GLint location, GLint v0, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2iEXT, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6224,6 +6335,8 @@ void GL_APIENTRY ProgramUniform2ivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2ivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6252,6 +6365,7 @@ void GL_APIENTRY ProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2uiEXT, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6283,6 +6397,8 @@ void GL_APIENTRY ProgramUniform2uivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform2uivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6312,6 +6428,7 @@ ProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3fEXT, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6343,6 +6460,8 @@ void GL_APIENTRY ProgramUniform3fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3fvEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6371,6 +6490,7 @@ void GL_APIENTRY ProgramUniform3iEXT(GLuint program, GLint location, GLint v0, G
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3iEXT, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6402,6 +6522,8 @@ void GL_APIENTRY ProgramUniform3ivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3ivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6431,6 +6553,7 @@ ProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3uiEXT, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6462,6 +6585,8 @@ void GL_APIENTRY ProgramUniform3uivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform3uivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6491,6 +6616,7 @@ ProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4fEXT, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6522,6 +6648,8 @@ void GL_APIENTRY ProgramUniform4fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4fvEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6551,6 +6679,7 @@ ProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4iEXT, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6582,6 +6711,8 @@ void GL_APIENTRY ProgramUniform4ivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4ivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6611,6 +6742,7 @@ ProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4uiEXT, program, location, v0, v1, v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6642,6 +6774,8 @@ void GL_APIENTRY ProgramUniform4uivEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniform4uivEXT, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6675,6 +6809,8 @@ void GL_APIENTRY ProgramUniformMatrix2fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6709,6 +6845,8 @@ void GL_APIENTRY ProgramUniformMatrix2x3fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6743,6 +6881,8 @@ void GL_APIENTRY ProgramUniformMatrix2x4fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6777,6 +6917,8 @@ void GL_APIENTRY ProgramUniformMatrix3fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6811,6 +6953,8 @@ void GL_APIENTRY ProgramUniformMatrix3x2fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6845,6 +6989,8 @@ void GL_APIENTRY ProgramUniformMatrix3x4fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6879,6 +7025,8 @@ void GL_APIENTRY ProgramUniformMatrix4fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6913,6 +7061,8 @@ void GL_APIENTRY ProgramUniformMatrix4x2fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6947,6 +7097,8 @@ void GL_APIENTRY ProgramUniformMatrix4x3fvEXT(GLuint program,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3fvEXT, program, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -6976,6 +7128,7 @@ void GL_APIENTRY UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLuint
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, UseProgramStagesEXT, pipeline, stages, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7003,6 +7156,7 @@ void GL_APIENTRY ValidateProgramPipelineEXT(GLuint pipeline)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ValidateProgramPipelineEXT, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -7028,6 +7182,7 @@ void GL_APIENTRY PatchParameteriEXT(GLenum pname, GLint value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PatchParameteriEXT, pname, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteriEXT(context, pname, value));
@@ -7053,6 +7208,7 @@ void GL_APIENTRY TexBufferEXT(GLenum target, GLenum internalformat, GLuint buffe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferEXT, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7087,6 +7243,7 @@ void GL_APIENTRY TexBufferRangeEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferRangeEXT, target, internalformat, buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -7138,6 +7295,7 @@ void GL_APIENTRY TexStorage1DEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage1DEXT, target, levels, internalformat, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -7165,6 +7323,7 @@ TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage2DEXT, target, levels, internalformat, width, height);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7199,6 +7358,8 @@ void GL_APIENTRY TexStorage3DEXT(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3DEXT, target, levels, internalformat, width, height,
+                         depth);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -7492,6 +7653,7 @@ void GL_APIENTRY PopDebugGroupKHR()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, PopDebugGroupKHR);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroupKHR(context));
         if (isCallValid)
@@ -7539,6 +7701,7 @@ void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MaxShaderCompilerThreadsKHR, count);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaxShaderCompilerThreadsKHR(context, count));
@@ -7586,6 +7749,7 @@ void GL_APIENTRY FinishFenceNV(GLuint fence)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FinishFenceNV, fence);
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7688,6 +7852,7 @@ void GL_APIENTRY SetFenceNV(GLuint fence, GLenum condition)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, SetFenceNV, fence, condition);
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -7814,6 +7979,9 @@ void GL_APIENTRY CopyImageSubDataOES(GLuint srcName,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyImageSubDataOES, srcName, srcTarget, srcLevel, srcX, srcY,
+                         srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight,
+                         srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -7849,6 +8017,7 @@ void GL_APIENTRY BlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum mo
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateiOES, buf, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiOES(context, buf, modeRGB, modeAlpha));
@@ -7872,6 +8041,7 @@ void GL_APIENTRY BlendEquationiOES(GLuint buf, GLenum mode)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendEquationiOES, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiOES(context, buf, mode));
@@ -7900,6 +8070,7 @@ BlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateiOES, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -7926,6 +8097,7 @@ void GL_APIENTRY BlendFunciOES(GLuint buf, GLenum src, GLenum dst)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BlendFunciOES, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciOES(context, buf, src, dst));
@@ -7950,6 +8122,7 @@ void GL_APIENTRY ColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLboolean
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, ColorMaskiOES, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiOES(context, index, r, g, b, a));
@@ -7973,6 +8146,7 @@ void GL_APIENTRY DisableiOES(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DisableiOES, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiOES(context, target, index));
@@ -7996,6 +8170,7 @@ void GL_APIENTRY EnableiOES(GLenum target, GLuint index)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, EnableiOES, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiOES(context, target, index));
@@ -8057,6 +8232,9 @@ void GL_APIENTRY DrawElementsBaseVertexOES(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertexOES, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8093,6 +8271,9 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexOES(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedBaseVertexOES,
+                            mode, count, type, context->copyDeferredIndices(indices, count, type),
+                            instancecount, basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8130,6 +8311,9 @@ void GL_APIENTRY DrawRangeElementsBaseVertexOES(GLenum mode,
 
     if (context)
     {
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElementsBaseVertexOES, mode,
+                            start, end, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8161,6 +8345,7 @@ void GL_APIENTRY DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLf
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DrawTexfOES, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height));
@@ -8206,6 +8391,7 @@ void GL_APIENTRY DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint heigh
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DrawTexiOES, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height));
@@ -8251,6 +8437,7 @@ void GL_APIENTRY DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width, GLs
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DrawTexsOES, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height));
@@ -8297,6 +8484,7 @@ void GL_APIENTRY DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLf
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, DrawTexxOES, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height));
@@ -8343,6 +8531,7 @@ void GL_APIENTRY BindFramebufferOES(GLenum target, GLuint framebuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindFramebufferOES, target, framebuffer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8367,6 +8556,7 @@ void GL_APIENTRY BindRenderbufferOES(GLenum target, GLuint renderbuffer)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, BindRenderbufferOES, target, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -8480,6 +8670,8 @@ void GL_APIENTRY FramebufferRenderbufferOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferRenderbufferOES, target, attachment,
+                         renderbuffertarget, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8515,6 +8707,8 @@ void GL_APIENTRY FramebufferTexture2DOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture2DOES, target, attachment, textarget, texture,
+                         level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -8591,6 +8785,7 @@ void GL_APIENTRY GenerateMipmapOES(GLenum target)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, GenerateMipmapOES, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -8739,6 +8934,7 @@ void GL_APIENTRY RenderbufferStorageOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, RenderbufferStorageOES, target, internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -8920,6 +9116,7 @@ void GL_APIENTRY CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CurrentPaletteMatrixOES, matrixpaletteindex);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCurrentPaletteMatrixOES(context, matrixpaletteindex));
@@ -8942,6 +9139,7 @@ void GL_APIENTRY LoadPaletteFromModelViewMatrixOES()
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, LoadPaletteFromModelViewMatrixOES);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context));
@@ -9073,6 +9271,7 @@ void GL_APIENTRY MinSampleShadingOES(GLfloat value)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, MinSampleShadingOES, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMinSampleShadingOES(context, value));
@@ -9190,6 +9389,8 @@ void GL_APIENTRY CopyTexSubImage3DOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, CopyTexSubImage3DOES, target, level, xoffset, yoffset, zoffset, x,
+                         y, width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -9226,6 +9427,8 @@ void GL_APIENTRY FramebufferTexture3DOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTexture3DOES, target, attachment, textarget, texture,
+                         level, zoffset);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -9550,6 +9753,7 @@ void GL_APIENTRY TexBufferOES(GLenum target, GLenum internalformat, GLuint buffe
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferOES, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -9584,6 +9788,7 @@ void GL_APIENTRY TexBufferRangeOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexBufferRangeOES, target, internalformat, buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -9688,6 +9893,7 @@ void GL_APIENTRY TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGenfOES, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param));
@@ -9737,6 +9943,7 @@ void GL_APIENTRY TexGeniOES(GLenum coord, GLenum pname, GLint param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGeniOES, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param));
@@ -9786,6 +9993,7 @@ void GL_APIENTRY TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexGenxOES, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param));
@@ -9851,6 +10059,8 @@ void GL_APIENTRY TexStorage3DMultisampleOES(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, TexStorage3DMultisampleOES, target, samples, internalformat,
+                         width, height, depth, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9879,6 +10089,7 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
 
     if (context)
     {
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexArrayOES, array);
         VertexArrayID arrayPacked                             = PackParam<VertexArrayID>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -9991,6 +10202,8 @@ void GL_APIENTRY FramebufferTextureMultiviewOVR(GLenum target,
 
     if (context)
     {
+        ANGLE_DEFER_CALL(context, FramebufferTextureMultiviewOVR, target, attachment, texture,
+                         level, baseViewIndex, numViews);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10023,6 +10236,7 @@ void GL_APIENTRY ActiveShaderProgramContextANGLE(GLeglContext ctx, GLuint pipeli
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ActiveShaderProgramContextANGLE, ctx, pipeline, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10051,6 +10265,7 @@ void GL_APIENTRY ActiveShaderProgramEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ActiveShaderProgramEXTContextANGLE, ctx, pipeline, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10077,6 +10292,7 @@ void GL_APIENTRY ActiveTextureContextANGLE(GLeglContext ctx, GLenum texture)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ActiveTextureContextANGLE, ctx, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
         if (isCallValid)
@@ -10100,6 +10316,7 @@ void GL_APIENTRY AlphaFuncContextANGLE(GLeglContext ctx, GLenum func, GLfloat re
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, AlphaFuncContextANGLE, ctx, func, ref);
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10125,6 +10342,7 @@ void GL_APIENTRY AlphaFuncxContextANGLE(GLeglContext ctx, GLenum func, GLfixed r
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, AlphaFuncxContextANGLE, ctx, func, ref);
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10150,6 +10368,7 @@ void GL_APIENTRY AttachShaderContextANGLE(GLeglContext ctx, GLuint program, GLui
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, AttachShaderContextANGLE, ctx, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10176,6 +10395,7 @@ void GL_APIENTRY BeginQueryContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BeginQueryContextANGLE, ctx, target, id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10202,6 +10422,7 @@ void GL_APIENTRY BeginQueryEXTContextANGLE(GLeglContext ctx, GLenum target, GLui
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BeginQueryEXTContextANGLE, ctx, target, id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10228,6 +10449,7 @@ void GL_APIENTRY BeginTransformFeedbackContextANGLE(GLeglContext ctx, GLenum pri
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BeginTransformFeedbackContextANGLE, ctx, primitiveMode);
         PrimitiveMode primitiveModePacked = PackParam<PrimitiveMode>(primitiveMode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10282,6 +10504,8 @@ void GL_APIENTRY BindBufferContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(target == GL_ELEMENT_ARRAY_BUFFER, context,
+                                      BindBufferContextANGLE, ctx, target, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10311,6 +10535,7 @@ void GL_APIENTRY BindBufferBaseContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindBufferBaseContextANGLE, ctx, target, index, buffer);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10344,6 +10569,8 @@ void GL_APIENTRY BindBufferRangeContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindBufferRangeContextANGLE, ctx, target, index, buffer, offset,
+                         size);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10433,6 +10660,7 @@ void GL_APIENTRY BindFramebufferContextANGLE(GLeglContext ctx, GLenum target, GL
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindFramebufferContextANGLE, ctx, target, framebuffer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10458,6 +10686,7 @@ void GL_APIENTRY BindFramebufferOESContextANGLE(GLeglContext ctx, GLenum target,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindFramebufferOESContextANGLE, ctx, target, framebuffer);
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10494,6 +10723,8 @@ void GL_APIENTRY BindImageTextureContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindImageTextureContextANGLE, ctx, unit, texture, level, layered,
+                         layer, access, format);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10520,6 +10751,7 @@ void GL_APIENTRY BindProgramPipelineContextANGLE(GLeglContext ctx, GLuint pipeli
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindProgramPipelineContextANGLE, ctx, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10544,6 +10776,7 @@ void GL_APIENTRY BindProgramPipelineEXTContextANGLE(GLeglContext ctx, GLuint pip
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindProgramPipelineEXTContextANGLE, ctx, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10569,6 +10802,7 @@ void GL_APIENTRY BindRenderbufferContextANGLE(GLeglContext ctx, GLenum target, G
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindRenderbufferContextANGLE, ctx, target, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10596,6 +10830,7 @@ void GL_APIENTRY BindRenderbufferOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindRenderbufferOESContextANGLE, ctx, target, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -10621,6 +10856,7 @@ void GL_APIENTRY BindSamplerContextANGLE(GLeglContext ctx, GLuint unit, GLuint s
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindSamplerContextANGLE, ctx, unit, sampler);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10646,6 +10882,7 @@ void GL_APIENTRY BindTextureContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindTextureContextANGLE, ctx, target, texture);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -10672,6 +10909,7 @@ void GL_APIENTRY BindTransformFeedbackContextANGLE(GLeglContext ctx, GLenum targ
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BindTransformFeedbackContextANGLE, ctx, target, id);
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10696,6 +10934,7 @@ void GL_APIENTRY BindVertexArrayContextANGLE(GLeglContext ctx, GLuint array)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexArrayContextANGLE, ctx, array);
         VertexArrayID arrayPacked                             = PackParam<VertexArrayID>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10720,6 +10959,7 @@ void GL_APIENTRY BindVertexArrayOESContextANGLE(GLeglContext ctx, GLuint array)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexArrayOESContextANGLE, ctx, array);
         VertexArrayID arrayPacked                             = PackParam<VertexArrayID>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10750,6 +10990,8 @@ void GL_APIENTRY BindVertexBufferContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, BindVertexBufferContextANGLE, ctx,
+                                      bindingindex, buffer, offset, stride);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -10776,6 +11018,7 @@ void GL_APIENTRY BlendBarrierContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendBarrierContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendBarrier(context));
         if (isCallValid)
@@ -10800,6 +11043,7 @@ BlendColorContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat blu
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendColorContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha));
@@ -10824,6 +11068,7 @@ void GL_APIENTRY BlendEquationContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationContextANGLE, ctx, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateBlendEquation(context, mode));
         if (isCallValid)
@@ -10850,6 +11095,7 @@ void GL_APIENTRY BlendEquationSeparateContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateContextANGLE, ctx, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparate(context, modeRGB, modeAlpha));
@@ -10878,6 +11124,7 @@ void GL_APIENTRY BlendEquationSeparateiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateiContextANGLE, ctx, buf, modeRGB, modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparatei(context, buf, modeRGB, modeAlpha));
@@ -10907,6 +11154,8 @@ void GL_APIENTRY BlendEquationSeparateiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateiEXTContextANGLE, ctx, buf, modeRGB,
+                         modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiEXT(context, buf, modeRGB, modeAlpha));
@@ -10936,6 +11185,8 @@ void GL_APIENTRY BlendEquationSeparateiOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationSeparateiOESContextANGLE, ctx, buf, modeRGB,
+                         modeAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlendEquationSeparateiOES(context, buf, modeRGB, modeAlpha));
@@ -10960,6 +11211,7 @@ void GL_APIENTRY BlendEquationiContextANGLE(GLeglContext ctx, GLuint buf, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationiContextANGLE, ctx, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationi(context, buf, mode));
@@ -10984,6 +11236,7 @@ void GL_APIENTRY BlendEquationiEXTContextANGLE(GLeglContext ctx, GLuint buf, GLe
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationiEXTContextANGLE, ctx, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiEXT(context, buf, mode));
@@ -11008,6 +11261,7 @@ void GL_APIENTRY BlendEquationiOESContextANGLE(GLeglContext ctx, GLuint buf, GLe
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendEquationiOESContextANGLE, ctx, buf, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendEquationiOES(context, buf, mode));
@@ -11033,6 +11287,7 @@ void GL_APIENTRY BlendFuncContextANGLE(GLeglContext ctx, GLenum sfactor, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFuncContextANGLE, ctx, sfactor, dfactor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
@@ -11065,6 +11320,8 @@ void GL_APIENTRY BlendFuncSeparateContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateContextANGLE, ctx, sfactorRGB, dfactorRGB,
+                         sfactorAlpha, dfactorAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB,
@@ -11100,6 +11357,8 @@ void GL_APIENTRY BlendFuncSeparateiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateiContextANGLE, ctx, buf, srcRGB, dstRGB,
+                         srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -11135,6 +11394,8 @@ void GL_APIENTRY BlendFuncSeparateiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateiEXTContextANGLE, ctx, buf, srcRGB, dstRGB,
+                         srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -11170,6 +11431,8 @@ void GL_APIENTRY BlendFuncSeparateiOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFuncSeparateiOESContextANGLE, ctx, buf, srcRGB, dstRGB,
+                         srcAlpha, dstAlpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -11197,6 +11460,7 @@ void GL_APIENTRY BlendFunciContextANGLE(GLeglContext ctx, GLuint buf, GLenum src
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFunciContextANGLE, ctx, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunci(context, buf, src, dst));
@@ -11222,6 +11486,7 @@ void GL_APIENTRY BlendFunciEXTContextANGLE(GLeglContext ctx, GLuint buf, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFunciEXTContextANGLE, ctx, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciEXT(context, buf, src, dst));
@@ -11247,6 +11512,7 @@ void GL_APIENTRY BlendFunciOESContextANGLE(GLeglContext ctx, GLuint buf, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlendFunciOESContextANGLE, ctx, buf, src, dst);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunciOES(context, buf, src, dst));
@@ -11285,6 +11551,8 @@ void GL_APIENTRY BlitFramebufferContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlitFramebufferContextANGLE, ctx, srcX0, srcY0, srcX1, srcY1,
+                         dstX0, dstY0, dstX1, dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0,
@@ -11326,6 +11594,8 @@ void GL_APIENTRY BlitFramebufferANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BlitFramebufferANGLEContextANGLE, ctx, srcX0, srcY0, srcX1, srcY1,
+                         dstX0, dstY0, dstX1, dstY1, mask, filter);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0,
@@ -11360,6 +11630,8 @@ void GL_APIENTRY BufferDataContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BufferDataContextANGLE, ctx, target, size,
+                         DeferredCallQueue::Copy(data, size, 1), usage);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferUsage usagePacked                               = PackParam<BufferUsage>(usage);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -11461,6 +11733,8 @@ void GL_APIENTRY BufferStorageMemEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BufferStorageMemEXTContextANGLE, ctx, target, size, memory,
+                         offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -11496,6 +11770,8 @@ void GL_APIENTRY BufferSubDataContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, BufferSubDataContextANGLE, ctx, target, offset, size,
+                         DeferredCallQueue::Copy(data, size, 1));
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -11586,6 +11862,7 @@ void GL_APIENTRY ClearContextANGLE(GLeglContext ctx, GLbitfield mask)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearContextANGLE, ctx, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
         if (isCallValid)
@@ -11614,6 +11891,8 @@ void GL_APIENTRY ClearBufferfiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearBufferfiContextANGLE, ctx, buffer, drawbuffer, depth,
+                         stencil);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil));
@@ -11723,6 +12002,7 @@ ClearColorContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat blu
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearColorContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
@@ -11749,6 +12029,7 @@ ClearColorxContextANGLE(GLeglContext ctx, GLfixed red, GLfixed green, GLfixed bl
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearColorxContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha));
@@ -11772,6 +12053,7 @@ void GL_APIENTRY ClearDepthfContextANGLE(GLeglContext ctx, GLfloat d)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearDepthfContextANGLE, ctx, d);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthf(context, d));
         if (isCallValid)
@@ -11794,6 +12076,7 @@ void GL_APIENTRY ClearDepthxContextANGLE(GLeglContext ctx, GLfixed depth)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearDepthxContextANGLE, ctx, depth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearDepthx(context, depth));
         if (isCallValid)
@@ -11816,6 +12099,7 @@ void GL_APIENTRY ClearStencilContextANGLE(GLeglContext ctx, GLint s)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClearStencilContextANGLE, ctx, s);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClearStencil(context, s));
         if (isCallValid)
@@ -11839,6 +12123,7 @@ void GL_APIENTRY ClientActiveTextureContextANGLE(GLeglContext ctx, GLenum textur
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ClientActiveTextureContextANGLE, ctx, texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClientActiveTexture(context, texture));
@@ -11947,6 +12232,7 @@ Color4fContextANGLE(GLeglContext ctx, GLfloat red, GLfloat green, GLfloat blue,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Color4fContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha));
@@ -11972,6 +12258,7 @@ Color4ubContextANGLE(GLeglContext ctx, GLubyte red, GLubyte green, GLubyte blue,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Color4ubContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha));
@@ -11997,6 +12284,7 @@ Color4xContextANGLE(GLeglContext ctx, GLfixed red, GLfixed green, GLfixed blue,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Color4xContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha));
@@ -12026,6 +12314,7 @@ void GL_APIENTRY ColorMaskContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ColorMaskContextANGLE, ctx, red, green, blue, alpha);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
@@ -12056,6 +12345,7 @@ void GL_APIENTRY ColorMaskiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ColorMaskiContextANGLE, ctx, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaski(context, index, r, g, b, a));
@@ -12086,6 +12376,7 @@ void GL_APIENTRY ColorMaskiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ColorMaskiEXTContextANGLE, ctx, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiEXT(context, index, r, g, b, a));
@@ -12116,6 +12407,7 @@ void GL_APIENTRY ColorMaskiOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ColorMaskiOESContextANGLE, ctx, index, r, g, b, a);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMaskiOES(context, index, r, g, b, a));
@@ -12170,6 +12462,7 @@ void GL_APIENTRY CompileShaderContextANGLE(GLeglContext ctx, GLuint shader)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CompileShaderContextANGLE, ctx, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -12460,6 +12753,8 @@ void GL_APIENTRY CopyBufferSubDataContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyBufferSubDataContextANGLE, ctx, readTarget, writeTarget,
+                         readOffset, writeOffset, size);
         BufferBinding readTargetPacked  = PackParam<BufferBinding>(readTarget);
         BufferBinding writeTargetPacked = PackParam<BufferBinding>(writeTarget);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -12510,6 +12805,9 @@ void GL_APIENTRY CopyImageSubDataContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyImageSubDataContextANGLE, ctx, srcName, srcTarget, srcLevel,
+                         srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
+                         srcHeight, srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyImageSubData(context, srcName, srcTarget, srcLevel, srcX,
@@ -12561,6 +12859,9 @@ void GL_APIENTRY CopyImageSubDataEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyImageSubDataEXTContextANGLE, ctx, srcName, srcTarget,
+                         srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ,
+                         srcWidth, srcHeight, srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -12613,6 +12914,9 @@ void GL_APIENTRY CopyImageSubDataOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyImageSubDataOESContextANGLE, ctx, srcName, srcTarget,
+                         srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ,
+                         srcWidth, srcHeight, srcDepth);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -12655,6 +12959,8 @@ void GL_APIENTRY CopyTexImage2DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTexImage2DContextANGLE, ctx, target, level, internalformat, x,
+                         y, width, height, border);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -12694,6 +13000,8 @@ void GL_APIENTRY CopyTexSubImage2DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTexSubImage2DContextANGLE, ctx, target, level, xoffset,
+                         yoffset, x, y, width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -12733,6 +13041,8 @@ void GL_APIENTRY CopyTexSubImage3DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTexSubImage3DContextANGLE, ctx, target, level, xoffset,
+                         yoffset, zoffset, x, y, width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -12773,6 +13083,8 @@ void GL_APIENTRY CopyTexSubImage3DOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTexSubImage3DOESContextANGLE, ctx, target, level, xoffset,
+                         yoffset, zoffset, x, y, width, height);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -12965,6 +13277,7 @@ void GL_APIENTRY CullFaceContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CullFaceContextANGLE, ctx, mode);
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateCullFace(context, modePacked));
@@ -12989,6 +13302,7 @@ void GL_APIENTRY CurrentPaletteMatrixOESContextANGLE(GLeglContext ctx, GLuint ma
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CurrentPaletteMatrixOESContextANGLE, ctx, matrixpaletteindex);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCurrentPaletteMatrixOES(context, matrixpaletteindex));
@@ -13346,6 +13660,7 @@ void GL_APIENTRY DeleteProgramContextANGLE(GLeglContext ctx, GLuint program)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DeleteProgramContextANGLE, ctx, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -13584,6 +13899,7 @@ void GL_APIENTRY DeleteShaderContextANGLE(GLeglContext ctx, GLuint shader)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DeleteShaderContextANGLE, ctx, shader);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -13736,6 +14052,7 @@ void GL_APIENTRY DepthFuncContextANGLE(GLeglContext ctx, GLenum func)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DepthFuncContextANGLE, ctx, func);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthFunc(context, func));
         if (isCallValid)
@@ -13758,6 +14075,7 @@ void GL_APIENTRY DepthMaskContextANGLE(GLeglContext ctx, GLboolean flag)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DepthMaskContextANGLE, ctx, flag);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
         if (isCallValid)
@@ -13780,6 +14098,7 @@ void GL_APIENTRY DepthRangefContextANGLE(GLeglContext ctx, GLfloat n, GLfloat f)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DepthRangefContextANGLE, ctx, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangef(context, n, f));
         if (isCallValid)
@@ -13802,6 +14121,7 @@ void GL_APIENTRY DepthRangexContextANGLE(GLeglContext ctx, GLfixed n, GLfixed f)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DepthRangexContextANGLE, ctx, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthRangex(context, n, f));
         if (isCallValid)
@@ -13825,6 +14145,7 @@ void GL_APIENTRY DetachShaderContextANGLE(GLeglContext ctx, GLuint program, GLui
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DetachShaderContextANGLE, ctx, program, shader);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         ShaderProgramID shaderPacked                          = PackParam<ShaderProgramID>(shader);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -13851,6 +14172,8 @@ void GL_APIENTRY DisableContextANGLE(GLeglContext ctx, GLenum cap)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, DisableContextANGLE, ctx,
+                            cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
         if (isCallValid)
@@ -13874,6 +14197,7 @@ void GL_APIENTRY DisableClientStateContextANGLE(GLeglContext ctx, GLenum array)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableClientStateContextANGLE, ctx, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -13898,6 +14222,8 @@ void GL_APIENTRY DisableVertexAttribArrayContextANGLE(GLeglContext ctx, GLuint i
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, DisableVertexAttribArrayContextANGLE, ctx,
+                                      index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableVertexAttribArray(context, index));
@@ -13922,6 +14248,7 @@ void GL_APIENTRY DisableiContextANGLE(GLeglContext ctx, GLenum target, GLuint in
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DisableiContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisablei(context, target, index));
         if (isCallValid)
@@ -13945,6 +14272,7 @@ void GL_APIENTRY DisableiEXTContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DisableiEXTContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiEXT(context, target, index));
@@ -13969,6 +14297,7 @@ void GL_APIENTRY DisableiOESContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DisableiOESContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDisableiOES(context, target, index));
@@ -14028,6 +14357,8 @@ void GL_APIENTRY DispatchComputeContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DispatchComputeContextANGLE, ctx, num_groups_x, num_groups_y,
+                         num_groups_z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -14054,6 +14385,7 @@ void GL_APIENTRY DispatchComputeIndirectContextANGLE(GLeglContext ctx, GLintptr
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DispatchComputeIndirectContextANGLE, ctx, indirect);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect));
@@ -14078,6 +14410,8 @@ void GL_APIENTRY DrawArraysContextANGLE(GLeglContext ctx, GLenum mode, GLint fir
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysContextANGLE, ctx, mode,
+                            first, count);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -14133,6 +14467,8 @@ void GL_APIENTRY DrawArraysInstancedContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedContextANGLE, ctx,
+                            mode, first, count, instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -14165,6 +14501,8 @@ void GL_APIENTRY DrawArraysInstancedANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedANGLEContextANGLE,
+                            ctx, mode, first, count, primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -14197,6 +14535,8 @@ void GL_APIENTRY DrawArraysInstancedEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawArraysInstancedEXTContextANGLE,
+                            ctx, mode, start, count, primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -14276,6 +14616,8 @@ void GL_APIENTRY DrawElementsContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsContextANGLE, ctx, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14310,6 +14652,9 @@ void GL_APIENTRY DrawElementsBaseVertexContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertexContextANGLE,
+                            ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14346,6 +14691,9 @@ void GL_APIENTRY DrawElementsBaseVertexEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertexEXTContextANGLE,
+                            ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14382,6 +14730,9 @@ void GL_APIENTRY DrawElementsBaseVertexOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsBaseVertexOESContextANGLE,
+                            ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14450,6 +14801,9 @@ void GL_APIENTRY DrawElementsInstancedContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedContextANGLE,
+                            ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instancecount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14486,6 +14840,9 @@ void GL_APIENTRY DrawElementsInstancedANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedANGLEContextANGLE, ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14524,6 +14881,10 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexContextANGLE, ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instancecount,
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14563,6 +14924,10 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexEXTContextANGLE(GLeglContext ctx
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexEXTContextANGLE, ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instancecount,
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14602,6 +14967,10 @@ void GL_APIENTRY DrawElementsInstancedBaseVertexOESContextANGLE(GLeglContext ctx
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexOESContextANGLE, ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), instancecount,
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14639,6 +15008,9 @@ void GL_APIENTRY DrawElementsInstancedEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawElementsInstancedEXTContextANGLE,
+                            ctx, mode, count, type,
+                            context->copyDeferredIndices(indices, count, type), primcount);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14676,6 +15048,9 @@ void GL_APIENTRY DrawRangeElementsContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context, DrawRangeElementsContextANGLE, ctx,
+                            mode, start, end, count, type,
+                            context->copyDeferredIndices(indices, count, type));
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14714,6 +15089,9 @@ void GL_APIENTRY DrawRangeElementsBaseVertexContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawRangeElementsBaseVertexContextANGLE, ctx, mode, start, end, count,
+                            type, context->copyDeferredIndices(indices, count, type), basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14753,6 +15131,10 @@ void GL_APIENTRY DrawRangeElementsBaseVertexEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawRangeElementsBaseVertexEXTContextANGLE, ctx, mode, start, end,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14792,6 +15174,10 @@ void GL_APIENTRY DrawRangeElementsBaseVertexOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawRangeElementsBaseVertexOESContextANGLE, ctx, mode, start, end,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            basevertex);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -14826,6 +15212,7 @@ void GL_APIENTRY DrawTexfOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DrawTexfOESContextANGLE, ctx, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height));
@@ -14874,6 +15261,7 @@ DrawTexiOESContextANGLE(GLeglContext ctx, GLint x, GLint y, GLint z, GLint width
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DrawTexiOESContextANGLE, ctx, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height));
@@ -14926,6 +15314,7 @@ void GL_APIENTRY DrawTexsOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DrawTexsOESContextANGLE, ctx, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height));
@@ -14979,6 +15368,7 @@ void GL_APIENTRY DrawTexxOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, DrawTexxOESContextANGLE, ctx, x, y, z, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height));
@@ -15081,6 +15471,8 @@ void GL_APIENTRY EnableContextANGLE(GLeglContext ctx, GLenum cap)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(cap != GL_DEBUG_OUTPUT_SYNCHRONOUS, context, EnableContextANGLE, ctx,
+                            cap);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
         if (isCallValid)
@@ -15104,6 +15496,7 @@ void GL_APIENTRY EnableClientStateContextANGLE(GLeglContext ctx, GLenum array)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableClientStateContextANGLE, ctx, array);
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15128,6 +15521,8 @@ void GL_APIENTRY EnableVertexAttribArrayContextANGLE(GLeglContext ctx, GLuint in
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, EnableVertexAttribArrayContextANGLE, ctx,
+                                      index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableVertexAttribArray(context, index));
@@ -15152,6 +15547,7 @@ void GL_APIENTRY EnableiContextANGLE(GLeglContext ctx, GLenum target, GLuint ind
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EnableiContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnablei(context, target, index));
         if (isCallValid)
@@ -15175,6 +15571,7 @@ void GL_APIENTRY EnableiEXTContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EnableiEXTContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiEXT(context, target, index));
@@ -15199,6 +15596,7 @@ void GL_APIENTRY EnableiOESContextANGLE(GLeglContext ctx, GLenum target, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EnableiOESContextANGLE, ctx, target, index);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnableiOES(context, target, index));
@@ -15223,6 +15621,7 @@ void GL_APIENTRY EndQueryContextANGLE(GLeglContext ctx, GLenum target)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EndQueryContextANGLE, ctx, target);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndQuery(context, targetPacked));
@@ -15247,6 +15646,7 @@ void GL_APIENTRY EndQueryEXTContextANGLE(GLeglContext ctx, GLenum target)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EndQueryEXTContextANGLE, ctx, target);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15271,6 +15671,7 @@ void GL_APIENTRY EndTransformFeedbackContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, EndTransformFeedbackContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEndTransformFeedback(context));
         if (isCallValid)
@@ -15347,6 +15748,7 @@ void GL_APIENTRY FinishFenceNVContextANGLE(GLeglContext ctx, GLuint fence)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FinishFenceNVContextANGLE, ctx, fence);
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15371,6 +15773,7 @@ void GL_APIENTRY FlushContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FlushContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFlush(context));
         if (isCallValid)
@@ -15399,6 +15802,7 @@ void GL_APIENTRY FlushMappedBufferRangeContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FlushMappedBufferRangeContextANGLE, ctx, target, offset, length);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -15429,6 +15833,8 @@ void GL_APIENTRY FlushMappedBufferRangeEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FlushMappedBufferRangeEXTContextANGLE, ctx, target, offset,
+                         length);
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15456,6 +15862,7 @@ void GL_APIENTRY FogfContextANGLE(GLeglContext ctx, GLenum pname, GLfloat param)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FogfContextANGLE, ctx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogf(context, pname, param));
         if (isCallValid)
@@ -15502,6 +15909,7 @@ void GL_APIENTRY FogxContextANGLE(GLeglContext ctx, GLenum pname, GLfixed param)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FogxContextANGLE, ctx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFogx(context, pname, param));
         if (isCallValid)
@@ -15552,6 +15960,7 @@ void GL_APIENTRY FramebufferParameteriContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferParameteriContextANGLE, ctx, target, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFramebufferParameteri(context, target, pname, param));
@@ -15583,6 +15992,8 @@ void GL_APIENTRY FramebufferRenderbufferContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferRenderbufferContextANGLE, ctx, target, attachment,
+                         renderbuffertarget, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15619,6 +16030,8 @@ void GL_APIENTRY FramebufferRenderbufferOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferRenderbufferOESContextANGLE, ctx, target, attachment,
+                         renderbuffertarget, renderbuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15654,6 +16067,8 @@ void GL_APIENTRY FramebufferTextureContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTextureContextANGLE, ctx, target, attachment, texture,
+                         level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15689,6 +16104,8 @@ void GL_APIENTRY FramebufferTexture2DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTexture2DContextANGLE, ctx, target, attachment,
+                         textarget, texture, level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -15728,6 +16145,8 @@ void GL_APIENTRY FramebufferTexture2DMultisampleEXTContextANGLE(GLeglContext ctx
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTexture2DMultisampleEXTContextANGLE, ctx, target,
+                         attachment, textarget, texture, level, samples);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -15766,6 +16185,8 @@ void GL_APIENTRY FramebufferTexture2DOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTexture2DOESContextANGLE, ctx, target, attachment,
+                         textarget, texture, level);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -15805,6 +16226,8 @@ void GL_APIENTRY FramebufferTexture3DOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTexture3DOESContextANGLE, ctx, target, attachment,
+                         textarget, texture, level, zoffset);
         TextureTarget textargetPacked                         = PackParam<TextureTarget>(textarget);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -15841,6 +16264,8 @@ void GL_APIENTRY FramebufferTextureEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTextureEXTContextANGLE, ctx, target, attachment,
+                         texture, level);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15875,6 +16300,8 @@ void GL_APIENTRY FramebufferTextureLayerContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTextureLayerContextANGLE, ctx, target, attachment,
+                         texture, level, layer);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -15912,6 +16339,8 @@ void GL_APIENTRY FramebufferTextureMultiviewOVRContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FramebufferTextureMultiviewOVRContextANGLE, ctx, target,
+                         attachment, texture, level, baseViewIndex, numViews);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -15941,6 +16370,7 @@ void GL_APIENTRY FrontFaceContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FrontFaceContextANGLE, ctx, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateFrontFace(context, mode));
         if (isCallValid)
@@ -15970,6 +16400,7 @@ void GL_APIENTRY FrustumfContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FrustumfContextANGLE, ctx, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f));
@@ -16001,6 +16432,7 @@ void GL_APIENTRY FrustumxContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, FrustumxContextANGLE, ctx, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f));
@@ -16424,6 +16856,7 @@ void GL_APIENTRY GenerateMipmapContextANGLE(GLeglContext ctx, GLenum target)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, GenerateMipmapContextANGLE, ctx, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -16449,6 +16882,7 @@ void GL_APIENTRY GenerateMipmapOESContextANGLE(GLeglContext ctx, GLenum target)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, GenerateMipmapOESContextANGLE, ctx, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -20138,6 +20572,7 @@ void GL_APIENTRY HintContextANGLE(GLeglContext ctx, GLenum target, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, HintContextANGLE, ctx, target, mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateHint(context, target, mode));
         if (isCallValid)
@@ -20167,6 +20602,7 @@ void GL_APIENTRY ImportMemoryFdEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ImportMemoryFdEXTContextANGLE, ctx, memory, size, handleType, fd);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -20198,6 +20634,7 @@ void GL_APIENTRY ImportSemaphoreFdEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ImportSemaphoreFdEXTContextANGLE, ctx, semaphore, handleType, fd);
         SemaphoreID semaphorePacked                           = PackParam<SemaphoreID>(semaphore);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -21063,6 +21500,7 @@ void GL_APIENTRY LightModelfContextANGLE(GLeglContext ctx, GLenum pname, GLfloat
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LightModelfContextANGLE, ctx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelf(context, pname, param));
@@ -21111,6 +21549,7 @@ void GL_APIENTRY LightModelxContextANGLE(GLeglContext ctx, GLenum pname, GLfixed
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LightModelxContextANGLE, ctx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLightModelx(context, pname, param));
@@ -21160,6 +21599,7 @@ void GL_APIENTRY LightfContextANGLE(GLeglContext ctx, GLenum light, GLenum pname
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LightfContextANGLE, ctx, light, pname, param);
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -21215,6 +21655,7 @@ void GL_APIENTRY LightxContextANGLE(GLeglContext ctx, GLenum light, GLenum pname
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LightxContextANGLE, ctx, light, pname, param);
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -21268,6 +21709,7 @@ void GL_APIENTRY LineWidthContextANGLE(GLeglContext ctx, GLfloat width)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LineWidthContextANGLE, ctx, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidth(context, width));
         if (isCallValid)
@@ -21290,6 +21732,7 @@ void GL_APIENTRY LineWidthxContextANGLE(GLeglContext ctx, GLfixed width)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LineWidthxContextANGLE, ctx, width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLineWidthx(context, width));
         if (isCallValid)
@@ -21312,6 +21755,7 @@ void GL_APIENTRY LinkProgramContextANGLE(GLeglContext ctx, GLuint program)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LinkProgramContextANGLE, ctx, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -21336,6 +21780,7 @@ void GL_APIENTRY LoadIdentityContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LoadIdentityContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLoadIdentity(context));
         if (isCallValid)
@@ -21404,6 +21849,7 @@ void GL_APIENTRY LoadPaletteFromModelViewMatrixOESContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LoadPaletteFromModelViewMatrixOESContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context));
@@ -21428,6 +21874,7 @@ void GL_APIENTRY LogicOpContextANGLE(GLeglContext ctx, GLenum opcode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LogicOpContextANGLE, ctx, opcode);
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateLogicOp(context, opcodePacked));
@@ -21567,6 +22014,7 @@ void GL_APIENTRY MaterialfContextANGLE(GLeglContext ctx, GLenum face, GLenum pna
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MaterialfContextANGLE, ctx, face, pname, param);
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -21622,6 +22070,7 @@ void GL_APIENTRY MaterialxContextANGLE(GLeglContext ctx, GLenum face, GLenum pna
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MaterialxContextANGLE, ctx, face, pname, param);
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -21706,6 +22155,7 @@ void GL_APIENTRY MatrixModeContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MatrixModeContextANGLE, ctx, mode);
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMatrixMode(context, modePacked));
@@ -21729,6 +22179,7 @@ void GL_APIENTRY MaxShaderCompilerThreadsKHRContextANGLE(GLeglContext ctx, GLuin
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MaxShaderCompilerThreadsKHRContextANGLE, ctx, count);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMaxShaderCompilerThreadsKHR(context, count));
@@ -21753,6 +22204,7 @@ void GL_APIENTRY MemoryBarrierContextANGLE(GLeglContext ctx, GLbitfield barriers
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MemoryBarrierContextANGLE, ctx, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMemoryBarrier(context, barriers));
         if (isCallValid)
@@ -21776,6 +22228,7 @@ void GL_APIENTRY MemoryBarrierByRegionContextANGLE(GLeglContext ctx, GLbitfield
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MemoryBarrierByRegionContextANGLE, ctx, barriers);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers));
@@ -21831,6 +22284,7 @@ void GL_APIENTRY MinSampleShadingContextANGLE(GLeglContext ctx, GLfloat value)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MinSampleShadingContextANGLE, ctx, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateMinSampleShading(context, value));
         if (isCallValid)
@@ -21853,6 +22307,7 @@ void GL_APIENTRY MinSampleShadingOESContextANGLE(GLeglContext ctx, GLfloat value
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MinSampleShadingOESContextANGLE, ctx, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMinSampleShadingOES(context, value));
@@ -21967,6 +22422,7 @@ void GL_APIENTRY MultiTexCoord4fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MultiTexCoord4fContextANGLE, ctx, target, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q));
@@ -21997,6 +22453,7 @@ void GL_APIENTRY MultiTexCoord4xContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, MultiTexCoord4xContextANGLE, ctx, texture, s, t, r, q);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q));
@@ -22055,6 +22512,7 @@ void GL_APIENTRY Normal3fContextANGLE(GLeglContext ctx, GLfloat nx, GLfloat ny,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Normal3fContextANGLE, ctx, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz));
         if (isCallValid)
@@ -22078,6 +22536,7 @@ void GL_APIENTRY Normal3xContextANGLE(GLeglContext ctx, GLfixed nx, GLfixed ny,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Normal3xContextANGLE, ctx, nx, ny, nz);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz));
         if (isCallValid)
@@ -22252,6 +22711,7 @@ void GL_APIENTRY OrthofContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, OrthofContextANGLE, ctx, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f));
         if (isCallValid)
@@ -22282,6 +22742,7 @@ void GL_APIENTRY OrthoxContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, OrthoxContextANGLE, ctx, l, r, b, t, n, f);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f));
         if (isCallValid)
@@ -22305,6 +22766,7 @@ void GL_APIENTRY PatchParameteriContextANGLE(GLeglContext ctx, GLenum pname, GLi
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PatchParameteriContextANGLE, ctx, pname, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteri(context, pname, value));
@@ -22329,6 +22791,7 @@ void GL_APIENTRY PatchParameteriEXTContextANGLE(GLeglContext ctx, GLenum pname,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PatchParameteriEXTContextANGLE, ctx, pname, value);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePatchParameteriEXT(context, pname, value));
@@ -22352,6 +22815,7 @@ void GL_APIENTRY PauseTransformFeedbackContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PauseTransformFeedbackContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePauseTransformFeedback(context));
         if (isCallValid)
@@ -22375,6 +22839,7 @@ void GL_APIENTRY PixelStoreiContextANGLE(GLeglContext ctx, GLenum pname, GLint p
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PixelStoreiContextANGLE, ctx, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePixelStorei(context, pname, param));
@@ -22399,6 +22864,7 @@ void GL_APIENTRY PointParameterfContextANGLE(GLeglContext ctx, GLenum pname, GLf
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PointParameterfContextANGLE, ctx, pname, param);
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -22449,6 +22915,7 @@ void GL_APIENTRY PointParameterxContextANGLE(GLeglContext ctx, GLenum pname, GLf
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PointParameterxContextANGLE, ctx, pname, param);
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -22498,6 +22965,7 @@ void GL_APIENTRY PointSizeContextANGLE(GLeglContext ctx, GLfloat size)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PointSizeContextANGLE, ctx, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSize(context, size));
         if (isCallValid)
@@ -22549,6 +23017,7 @@ void GL_APIENTRY PointSizexContextANGLE(GLeglContext ctx, GLfixed size)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PointSizexContextANGLE, ctx, size);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePointSizex(context, size));
         if (isCallValid)
@@ -22572,6 +23041,7 @@ void GL_APIENTRY PolygonOffsetContextANGLE(GLeglContext ctx, GLfloat factor, GLf
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PolygonOffsetContextANGLE, ctx, factor, units);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffset(context, factor, units));
@@ -22596,6 +23066,7 @@ void GL_APIENTRY PolygonOffsetxContextANGLE(GLeglContext ctx, GLfixed factor, GL
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PolygonOffsetxContextANGLE, ctx, factor, units);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units));
@@ -22619,6 +23090,7 @@ void GL_APIENTRY PopDebugGroupContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PopDebugGroupContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroup(context));
         if (isCallValid)
@@ -22641,6 +23113,7 @@ void GL_APIENTRY PopDebugGroupKHRContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PopDebugGroupKHRContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopDebugGroupKHR(context));
         if (isCallValid)
@@ -22665,6 +23138,7 @@ void GL_APIENTRY PopGroupMarkerEXTContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PopGroupMarkerEXTContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopGroupMarkerEXT(context));
         if (isCallValid)
@@ -22687,6 +23161,7 @@ void GL_APIENTRY PopMatrixContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PopMatrixContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePopMatrix(context));
         if (isCallValid)
@@ -22720,6 +23195,8 @@ void GL_APIENTRY PrimitiveBoundingBoxContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PrimitiveBoundingBoxContextANGLE, ctx, minX, minY, minZ, minW,
+                         maxX, maxY, maxZ, maxW);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -22815,6 +23292,7 @@ void GL_APIENTRY ProgramParameteriContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramParameteriContextANGLE, ctx, program, pname, value);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -22843,6 +23321,7 @@ void GL_APIENTRY ProgramParameteriEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramParameteriEXTContextANGLE, ctx, program, pname, value);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -22871,6 +23350,7 @@ void GL_APIENTRY ProgramUniform1fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1fContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -22900,6 +23380,7 @@ void GL_APIENTRY ProgramUniform1fEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1fEXTContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -22932,6 +23413,8 @@ void GL_APIENTRY ProgramUniform1fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1fvContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -22965,6 +23448,8 @@ void GL_APIENTRY ProgramUniform1fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1fvEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -22996,6 +23481,7 @@ void GL_APIENTRY ProgramUniform1iContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1iContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23025,6 +23511,7 @@ void GL_APIENTRY ProgramUniform1iEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1iEXTContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23057,6 +23544,8 @@ void GL_APIENTRY ProgramUniform1ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1ivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23090,6 +23579,8 @@ void GL_APIENTRY ProgramUniform1ivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1ivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23121,6 +23612,7 @@ void GL_APIENTRY ProgramUniform1uiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1uiContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23150,6 +23642,7 @@ void GL_APIENTRY ProgramUniform1uiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1uiEXTContextANGLE, ctx, program, location, v0);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23183,6 +23676,8 @@ void GL_APIENTRY ProgramUniform1uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1uivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23216,6 +23711,8 @@ void GL_APIENTRY ProgramUniform1uivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform1uivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23249,6 +23746,7 @@ void GL_APIENTRY ProgramUniform2fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2fContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23282,6 +23780,7 @@ void GL_APIENTRY ProgramUniform2fEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2fEXTContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23315,6 +23814,8 @@ void GL_APIENTRY ProgramUniform2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2fvContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23348,6 +23849,8 @@ void GL_APIENTRY ProgramUniform2fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2fvEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23378,6 +23881,7 @@ ProgramUniform2iContextANGLE(GLeglContext ctx, GLuint program, GLint location, G
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2iContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23411,6 +23915,7 @@ void GL_APIENTRY ProgramUniform2iEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2iEXTContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23444,6 +23949,8 @@ void GL_APIENTRY ProgramUniform2ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2ivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23477,6 +23984,8 @@ void GL_APIENTRY ProgramUniform2ivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2ivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23510,6 +24019,7 @@ void GL_APIENTRY ProgramUniform2uiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2uiContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23543,6 +24053,7 @@ void GL_APIENTRY ProgramUniform2uiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2uiEXTContextANGLE, ctx, program, location, v0, v1);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23576,6 +24087,8 @@ void GL_APIENTRY ProgramUniform2uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2uivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23609,6 +24122,8 @@ void GL_APIENTRY ProgramUniform2uivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform2uivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23643,6 +24158,7 @@ void GL_APIENTRY ProgramUniform3fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3fContextANGLE, ctx, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23677,6 +24193,8 @@ void GL_APIENTRY ProgramUniform3fEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3fEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23710,6 +24228,8 @@ void GL_APIENTRY ProgramUniform3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3fvContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23743,6 +24263,8 @@ void GL_APIENTRY ProgramUniform3fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3fvEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23777,6 +24299,7 @@ void GL_APIENTRY ProgramUniform3iContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3iContextANGLE, ctx, program, location, v0, v1, v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23811,6 +24334,8 @@ void GL_APIENTRY ProgramUniform3iEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3iEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23844,6 +24369,8 @@ void GL_APIENTRY ProgramUniform3ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3ivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23877,6 +24404,8 @@ void GL_APIENTRY ProgramUniform3ivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3ivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23911,6 +24440,8 @@ void GL_APIENTRY ProgramUniform3uiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3uiContextANGLE, ctx, program, location, v0, v1,
+                         v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23945,6 +24476,8 @@ void GL_APIENTRY ProgramUniform3uiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3uiEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -23978,6 +24511,8 @@ void GL_APIENTRY ProgramUniform3uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3uivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24011,6 +24546,8 @@ void GL_APIENTRY ProgramUniform3uivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform3uivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24046,6 +24583,8 @@ void GL_APIENTRY ProgramUniform4fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4fContextANGLE, ctx, program, location, v0, v1, v2,
+                         v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24081,6 +24620,8 @@ void GL_APIENTRY ProgramUniform4fEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4fEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24114,6 +24655,8 @@ void GL_APIENTRY ProgramUniform4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4fvContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24147,6 +24690,8 @@ void GL_APIENTRY ProgramUniform4fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4fvEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24182,6 +24727,8 @@ void GL_APIENTRY ProgramUniform4iContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4iContextANGLE, ctx, program, location, v0, v1, v2,
+                         v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24217,6 +24764,8 @@ void GL_APIENTRY ProgramUniform4iEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4iEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24250,6 +24799,8 @@ void GL_APIENTRY ProgramUniform4ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4ivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24283,6 +24834,8 @@ void GL_APIENTRY ProgramUniform4ivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4ivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24318,6 +24871,8 @@ void GL_APIENTRY ProgramUniform4uiContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4uiContextANGLE, ctx, program, location, v0, v1, v2,
+                         v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24353,6 +24908,8 @@ void GL_APIENTRY ProgramUniform4uiEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4uiEXTContextANGLE, ctx, program, location, v0, v1,
+                         v2, v3);
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24386,6 +24943,8 @@ void GL_APIENTRY ProgramUniform4uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4uivContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24419,6 +24978,8 @@ void GL_APIENTRY ProgramUniform4uivEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniform4uivEXTContextANGLE, ctx, program, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24454,6 +25015,9 @@ void GL_APIENTRY ProgramUniformMatrix2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24490,6 +25054,9 @@ void GL_APIENTRY ProgramUniformMatrix2fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24526,6 +25093,9 @@ void GL_APIENTRY ProgramUniformMatrix2x3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24562,6 +25132,9 @@ void GL_APIENTRY ProgramUniformMatrix2x3fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x3fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24598,6 +25171,9 @@ void GL_APIENTRY ProgramUniformMatrix2x4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24634,6 +25210,9 @@ void GL_APIENTRY ProgramUniformMatrix2x4fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix2x4fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24670,6 +25249,9 @@ void GL_APIENTRY ProgramUniformMatrix3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24706,6 +25288,9 @@ void GL_APIENTRY ProgramUniformMatrix3fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24742,6 +25327,9 @@ void GL_APIENTRY ProgramUniformMatrix3x2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24778,6 +25366,9 @@ void GL_APIENTRY ProgramUniformMatrix3x2fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x2fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24814,6 +25405,9 @@ void GL_APIENTRY ProgramUniformMatrix3x4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24850,6 +25444,9 @@ void GL_APIENTRY ProgramUniformMatrix3x4fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix3x4fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24886,6 +25483,9 @@ void GL_APIENTRY ProgramUniformMatrix4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24922,6 +25522,9 @@ void GL_APIENTRY ProgramUniformMatrix4fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24958,6 +25561,9 @@ void GL_APIENTRY ProgramUniformMatrix4x2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -24994,6 +25600,9 @@ void GL_APIENTRY ProgramUniformMatrix4x2fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x2fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -25030,6 +25639,9 @@ void GL_APIENTRY ProgramUniformMatrix4x3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3fvContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -25066,6 +25678,9 @@ void GL_APIENTRY ProgramUniformMatrix4x3fvEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProgramUniformMatrix4x3fvEXTContextANGLE, ctx, program, location,
+                         count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -25182,6 +25797,7 @@ void GL_APIENTRY PushMatrixContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, PushMatrixContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidatePushMatrix(context));
         if (isCallValid)
@@ -25205,6 +25821,7 @@ void GL_APIENTRY QueryCounterEXTContextANGLE(GLeglContext ctx, GLuint id, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, QueryCounterEXTContextANGLE, ctx, id, target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
         QueryType targetPacked                                = PackParam<QueryType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -25265,6 +25882,7 @@ void GL_APIENTRY ReadBufferContextANGLE(GLeglContext ctx, GLenum src)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ReadBufferContextANGLE, ctx, src);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReadBuffer(context, src));
         if (isCallValid)
@@ -25395,6 +26013,7 @@ void GL_APIENTRY ReleaseShaderCompilerContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ReleaseShaderCompilerContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateReleaseShaderCompiler(context));
         if (isCallValid)
@@ -25424,6 +26043,8 @@ void GL_APIENTRY RenderbufferStorageContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RenderbufferStorageContextANGLE, ctx, target, internalformat,
+                         width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -25457,6 +26078,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisampleContextANGLE, ctx, target, samples,
+                         internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisample(context, target, samples,
@@ -25490,6 +26113,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLEContextANGLE(GLeglContext ct
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisampleANGLEContextANGLE, ctx, target,
+                         samples, internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleANGLE(
@@ -25523,6 +26148,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RenderbufferStorageMultisampleEXTContextANGLE, ctx, target,
+                         samples, internalformat, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderbufferStorageMultisampleEXT(
@@ -25556,6 +26183,8 @@ void GL_APIENTRY RenderbufferStorageOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RenderbufferStorageOESContextANGLE, ctx, target, internalformat,
+                         width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -25581,6 +26210,7 @@ void GL_APIENTRY ResumeTransformFeedbackContextANGLE(GLeglContext ctx)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ResumeTransformFeedbackContextANGLE, ctx);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateResumeTransformFeedback(context));
         if (isCallValid)
@@ -25605,6 +26235,7 @@ RotatefContextANGLE(GLeglContext ctx, GLfloat angle, GLfloat x, GLfloat y, GLflo
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RotatefContextANGLE, ctx, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatef(context, angle, x, y, z));
         if (isCallValid)
@@ -25629,6 +26260,7 @@ RotatexContextANGLE(GLeglContext ctx, GLfixed angle, GLfixed x, GLfixed y, GLfix
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, RotatexContextANGLE, ctx, angle, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateRotatex(context, angle, x, y, z));
         if (isCallValid)
@@ -25652,6 +26284,7 @@ void GL_APIENTRY SampleCoverageContextANGLE(GLeglContext ctx, GLfloat value, GLb
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SampleCoverageContextANGLE, ctx, value, invert);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoverage(context, value, invert));
@@ -25676,6 +26309,7 @@ void GL_APIENTRY SampleCoveragexContextANGLE(GLeglContext ctx, GLclampx value, G
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SampleCoveragexContextANGLE, ctx, value, invert);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleCoveragex(context, value, invert));
@@ -25700,6 +26334,7 @@ void GL_APIENTRY SampleMaskiContextANGLE(GLeglContext ctx, GLuint maskNumber, GL
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SampleMaskiContextANGLE, ctx, maskNumber, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask));
@@ -25843,6 +26478,7 @@ void GL_APIENTRY SamplerParameterfContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SamplerParameterfContextANGLE, ctx, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -25900,6 +26536,7 @@ void GL_APIENTRY SamplerParameteriContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SamplerParameteriContextANGLE, ctx, sampler, pname, param);
         SamplerID samplerPacked                               = PackParam<SamplerID>(sampler);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -25953,6 +26590,7 @@ void GL_APIENTRY ScalefContextANGLE(GLeglContext ctx, GLfloat x, GLfloat y, GLfl
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ScalefContextANGLE, ctx, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalef(context, x, y, z));
         if (isCallValid)
@@ -25975,6 +26613,7 @@ void GL_APIENTRY ScalexContextANGLE(GLeglContext ctx, GLfixed x, GLfixed y, GLfi
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ScalexContextANGLE, ctx, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateScalex(context, x, y, z));
         if (isCallValid)
@@ -25999,6 +26638,7 @@ ScissorContextANGLE(GLeglContext ctx, GLint x, GLint y, GLsizei width, GLsizei h
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ScissorContextANGLE, ctx, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
@@ -26054,6 +26694,7 @@ void GL_APIENTRY SetFenceNVContextANGLE(GLeglContext ctx, GLuint fence, GLenum c
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SetFenceNVContextANGLE, ctx, fence, condition);
         FenceNVID fencePacked                                 = PackParam<FenceNVID>(fence);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -26079,6 +26720,7 @@ void GL_APIENTRY ShadeModelContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ShadeModelContextANGLE, ctx, mode);
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateShadeModel(context, modePacked));
@@ -26209,6 +26851,7 @@ void GL_APIENTRY StencilFuncContextANGLE(GLeglContext ctx, GLenum func, GLint re
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilFuncContextANGLE, ctx, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask));
@@ -26235,6 +26878,7 @@ StencilFuncSeparateContextANGLE(GLeglContext ctx, GLenum face, GLenum func, GLin
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilFuncSeparateContextANGLE, ctx, face, func, ref, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilFuncSeparate(context, face, func, ref, mask));
@@ -26258,6 +26902,7 @@ void GL_APIENTRY StencilMaskContextANGLE(GLeglContext ctx, GLuint mask)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilMaskContextANGLE, ctx, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateStencilMask(context, mask));
         if (isCallValid)
@@ -26281,6 +26926,7 @@ void GL_APIENTRY StencilMaskSeparateContextANGLE(GLeglContext ctx, GLenum face,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilMaskSeparateContextANGLE, ctx, face, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask));
@@ -26307,6 +26953,7 @@ void GL_APIENTRY StencilOpContextANGLE(GLeglContext ctx, GLenum fail, GLenum zfa
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilOpContextANGLE, ctx, fail, zfail, zpass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass));
@@ -26339,6 +26986,7 @@ void GL_APIENTRY StencilOpSeparateContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, StencilOpSeparateContextANGLE, ctx, face, sfail, dpfail, dppass);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass));
@@ -26397,6 +27045,7 @@ void GL_APIENTRY TexBufferContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferContextANGLE, ctx, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26427,6 +27076,7 @@ void GL_APIENTRY TexBufferEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferEXTContextANGLE, ctx, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26459,6 +27109,7 @@ void GL_APIENTRY TexBufferOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferOESContextANGLE, ctx, target, internalformat, buffer);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26495,6 +27146,8 @@ void GL_APIENTRY TexBufferRangeContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferRangeContextANGLE, ctx, target, internalformat, buffer,
+                         offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26531,6 +27184,8 @@ void GL_APIENTRY TexBufferRangeEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferRangeEXTContextANGLE, ctx, target, internalformat,
+                         buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26567,6 +27222,8 @@ void GL_APIENTRY TexBufferRangeOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexBufferRangeOESContextANGLE, ctx, target, internalformat,
+                         buffer, offset, size);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26627,6 +27284,7 @@ void GL_APIENTRY TexEnvfContextANGLE(GLeglContext ctx, GLenum target, GLenum pna
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexEnvfContextANGLE, ctx, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26684,6 +27342,7 @@ void GL_APIENTRY TexEnviContextANGLE(GLeglContext ctx, GLenum target, GLenum pna
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexEnviContextANGLE, ctx, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26741,6 +27400,7 @@ void GL_APIENTRY TexEnvxContextANGLE(GLeglContext ctx, GLenum target, GLenum pna
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexEnvxContextANGLE, ctx, target, pname, param);
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -26798,6 +27458,7 @@ void GL_APIENTRY TexGenfOESContextANGLE(GLeglContext ctx, GLenum coord, GLenum p
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexGenfOESContextANGLE, ctx, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param));
@@ -26852,6 +27513,7 @@ void GL_APIENTRY TexGeniOESContextANGLE(GLeglContext ctx, GLenum coord, GLenum p
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexGeniOESContextANGLE, ctx, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param));
@@ -26906,6 +27568,7 @@ void GL_APIENTRY TexGenxOESContextANGLE(GLeglContext ctx, GLenum coord, GLenum p
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexGenxOESContextANGLE, ctx, coord, pname, param);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param));
@@ -27210,6 +27873,7 @@ void GL_APIENTRY TexParameterfContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexParameterfContextANGLE, ctx, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -27269,6 +27933,7 @@ void GL_APIENTRY TexParameteriContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexParameteriContextANGLE, ctx, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -27328,6 +27993,7 @@ void GL_APIENTRY TexParameterxContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexParameterxContextANGLE, ctx, target, pname, param);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -27389,6 +28055,8 @@ void GL_APIENTRY TexStorage1DEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage1DEXTContextANGLE, ctx, target, levels, internalformat,
+                         width);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -27421,6 +28089,8 @@ void GL_APIENTRY TexStorage2DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage2DContextANGLE, ctx, target, levels, internalformat,
+                         width, height);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -27455,6 +28125,8 @@ void GL_APIENTRY TexStorage2DEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage2DEXTContextANGLE, ctx, target, levels, internalformat,
+                         width, height);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -27492,6 +28164,8 @@ void GL_APIENTRY TexStorage2DMultisampleContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage2DMultisampleContextANGLE, ctx, target, samples,
+                         internalformat, width, height, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -27530,6 +28204,8 @@ void GL_APIENTRY TexStorage3DContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage3DContextANGLE, ctx, target, levels, internalformat,
+                         width, height, depth);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -27566,6 +28242,8 @@ void GL_APIENTRY TexStorage3DEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage3DEXTContextANGLE, ctx, target, levels, internalformat,
+                         width, height, depth);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -27604,6 +28282,8 @@ void GL_APIENTRY TexStorage3DMultisampleContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage3DMultisampleContextANGLE, ctx, target, samples,
+                         internalformat, width, height, depth, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -27644,6 +28324,8 @@ void GL_APIENTRY TexStorage3DMultisampleOESContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage3DMultisampleOESContextANGLE, ctx, target, samples,
+                         internalformat, width, height, depth, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -27684,6 +28366,8 @@ void GL_APIENTRY TexStorageMem2DEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMem2DEXTContextANGLE, ctx, target, levels,
+                         internalFormat, width, height, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -27726,6 +28410,8 @@ void GL_APIENTRY TexStorageMem2DMultisampleEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMem2DMultisampleEXTContextANGLE, ctx, target, samples,
+                         internalFormat, width, height, fixedSampleLocations, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -27768,6 +28454,8 @@ void GL_APIENTRY TexStorageMem3DEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMem3DEXTContextANGLE, ctx, target, levels,
+                         internalFormat, width, height, depth, memory, offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -27811,6 +28499,9 @@ void GL_APIENTRY TexStorageMem3DMultisampleEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMem3DMultisampleEXTContextANGLE, ctx, target, samples,
+                         internalFormat, width, height, depth, fixedSampleLocations, memory,
+                         offset);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -28004,6 +28695,7 @@ void GL_APIENTRY TranslatefContextANGLE(GLeglContext ctx, GLfloat x, GLfloat y,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TranslatefContextANGLE, ctx, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatef(context, x, y, z));
         if (isCallValid)
@@ -28027,6 +28719,7 @@ void GL_APIENTRY TranslatexContextANGLE(GLeglContext ctx, GLfixed x, GLfixed y,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TranslatexContextANGLE, ctx, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateTranslatex(context, x, y, z));
         if (isCallValid)
@@ -28049,6 +28742,7 @@ void GL_APIENTRY Uniform1fContextANGLE(GLeglContext ctx, GLint location, GLfloat
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1fContextANGLE, ctx, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28078,6 +28772,8 @@ void GL_APIENTRY Uniform1fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1fvContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28102,6 +28798,7 @@ void GL_APIENTRY Uniform1iContextANGLE(GLeglContext ctx, GLint location, GLint v
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1iContextANGLE, ctx, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28131,6 +28828,8 @@ void GL_APIENTRY Uniform1ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1ivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28156,6 +28855,7 @@ void GL_APIENTRY Uniform1uiContextANGLE(GLeglContext ctx, GLint location, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1uiContextANGLE, ctx, location, v0);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28185,6 +28885,8 @@ void GL_APIENTRY Uniform1uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform1uivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28210,6 +28912,7 @@ void GL_APIENTRY Uniform2fContextANGLE(GLeglContext ctx, GLint location, GLfloat
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2fContextANGLE, ctx, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28239,6 +28942,8 @@ void GL_APIENTRY Uniform2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2fvContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28264,6 +28969,7 @@ void GL_APIENTRY Uniform2iContextANGLE(GLeglContext ctx, GLint location, GLint v
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2iContextANGLE, ctx, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28293,6 +28999,8 @@ void GL_APIENTRY Uniform2ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2ivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28318,6 +29026,7 @@ void GL_APIENTRY Uniform2uiContextANGLE(GLeglContext ctx, GLint location, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2uiContextANGLE, ctx, location, v0, v1);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28347,6 +29056,8 @@ void GL_APIENTRY Uniform2uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform2uivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 2 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28373,6 +29084,7 @@ Uniform3fContextANGLE(GLeglContext ctx, GLint location, GLfloat v0, GLfloat v1,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3fContextANGLE, ctx, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28402,6 +29114,8 @@ void GL_APIENTRY Uniform3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3fvContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28428,6 +29142,7 @@ Uniform3iContextANGLE(GLeglContext ctx, GLint location, GLint v0, GLint v1, GLin
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3iContextANGLE, ctx, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28457,6 +29172,8 @@ void GL_APIENTRY Uniform3ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3ivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28483,6 +29200,7 @@ Uniform3uiContextANGLE(GLeglContext ctx, GLint location, GLuint v0, GLuint v1, G
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3uiContextANGLE, ctx, location, v0, v1, v2);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28512,6 +29230,8 @@ void GL_APIENTRY Uniform3uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform3uivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 3 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28542,6 +29262,7 @@ void GL_APIENTRY Uniform4fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4fContextANGLE, ctx, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28571,6 +29292,8 @@ void GL_APIENTRY Uniform4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4fvContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28597,6 +29320,7 @@ Uniform4iContextANGLE(GLeglContext ctx, GLint location, GLint v0, GLint v1, GLin
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4iContextANGLE, ctx, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28626,6 +29350,8 @@ void GL_APIENTRY Uniform4ivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4ivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28652,6 +29378,7 @@ Uniform4uiContextANGLE(GLeglContext ctx, GLint location, GLuint v0, GLuint v1, G
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4uiContextANGLE, ctx, location, v0, v1, v2, v3);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28681,6 +29408,8 @@ void GL_APIENTRY Uniform4uivContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, Uniform4uivContextANGLE, ctx, location, count,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLuint)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28710,6 +29439,8 @@ void GL_APIENTRY UniformBlockBindingContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformBlockBindingContextANGLE, ctx, program, uniformBlockIndex,
+                         uniformBlockBinding);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -28742,6 +29473,8 @@ void GL_APIENTRY UniformMatrix2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix2fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 4 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28774,6 +29507,8 @@ void GL_APIENTRY UniformMatrix2x3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix2x3fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28806,6 +29541,8 @@ void GL_APIENTRY UniformMatrix2x4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix2x4fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28838,6 +29575,8 @@ void GL_APIENTRY UniformMatrix3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix3fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 9 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28870,6 +29609,8 @@ void GL_APIENTRY UniformMatrix3x2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix3x2fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 6 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28902,6 +29643,8 @@ void GL_APIENTRY UniformMatrix3x4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix3x4fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28934,6 +29677,8 @@ void GL_APIENTRY UniformMatrix4fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix4fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 16 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28966,6 +29711,8 @@ void GL_APIENTRY UniformMatrix4x2fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix4x2fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 8 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -28998,6 +29745,8 @@ void GL_APIENTRY UniformMatrix4x3fvContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UniformMatrix4x3fvContextANGLE, ctx, location, count, transpose,
+                         DeferredCallQueue::Copy(value, count, 12 * sizeof(GLfloat)));
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29088,6 +29837,7 @@ void GL_APIENTRY UseProgramContextANGLE(GLeglContext ctx, GLuint program)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UseProgramContextANGLE, ctx, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29117,6 +29867,7 @@ void GL_APIENTRY UseProgramStagesContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UseProgramStagesContextANGLE, ctx, pipeline, stages, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -29149,6 +29900,7 @@ void GL_APIENTRY UseProgramStagesEXTContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, UseProgramStagesEXTContextANGLE, ctx, pipeline, stages, program);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -29176,6 +29928,7 @@ void GL_APIENTRY ValidateProgramContextANGLE(GLeglContext ctx, GLuint program)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ValidateProgramContextANGLE, ctx, program);
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29201,6 +29954,7 @@ void GL_APIENTRY ValidateProgramPipelineContextANGLE(GLeglContext ctx, GLuint pi
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ValidateProgramPipelineContextANGLE, ctx, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29226,6 +29980,7 @@ void GL_APIENTRY ValidateProgramPipelineEXTContextANGLE(GLeglContext ctx, GLuint
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ValidateProgramPipelineEXTContextANGLE, ctx, pipeline);
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -29250,6 +30005,7 @@ void GL_APIENTRY VertexAttrib1fContextANGLE(GLeglContext ctx, GLuint index, GLfl
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttrib1fContextANGLE, ctx, index, x);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateVertexAttrib1f(context, index, x));
         if (isCallValid)
@@ -29297,6 +30053,7 @@ void GL_APIENTRY VertexAttrib2fContextANGLE(GLeglContext ctx, GLuint index, GLfl
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttrib2fContextANGLE, ctx, index, x, y);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y));
@@ -29346,6 +30103,7 @@ VertexAttrib3fContextANGLE(GLeglContext ctx, GLuint index, GLfloat x, GLfloat y,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttrib3fContextANGLE, ctx, index, x, y, z);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z));
@@ -29399,6 +30157,7 @@ void GL_APIENTRY VertexAttrib4fContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttrib4fContextANGLE, ctx, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w));
@@ -29449,6 +30208,8 @@ void GL_APIENTRY VertexAttribBindingContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribBindingContextANGLE, ctx,
+                                      attribindex, bindingindex);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribBinding(context, attribindex, bindingindex));
@@ -29473,6 +30234,7 @@ void GL_APIENTRY VertexAttribDivisorContextANGLE(GLeglContext ctx, GLuint index,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribDivisorContextANGLE, ctx, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor));
@@ -29499,6 +30261,7 @@ void GL_APIENTRY VertexAttribDivisorANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribDivisorANGLEContextANGLE, ctx, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribDivisorANGLE(context, index, divisor));
@@ -29523,6 +30286,7 @@ void GL_APIENTRY VertexAttribDivisorEXTContextANGLE(GLeglContext ctx, GLuint ind
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribDivisorEXTContextANGLE, ctx, index, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribDivisorEXT(context, index, divisor));
@@ -29555,6 +30319,8 @@ void GL_APIENTRY VertexAttribFormatContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribFormatContextANGLE, ctx, attribindex, size, type,
+                         normalized, relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -29583,6 +30349,7 @@ VertexAttribI4iContextANGLE(GLeglContext ctx, GLuint index, GLint x, GLint y, GL
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribI4iContextANGLE, ctx, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w));
@@ -29632,6 +30399,7 @@ VertexAttribI4uiContextANGLE(GLeglContext ctx, GLuint index, GLuint x, GLuint y,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribI4uiContextANGLE, ctx, index, x, y, z, w);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w));
@@ -29685,6 +30453,8 @@ void GL_APIENTRY VertexAttribIFormatContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexAttribIFormatContextANGLE, ctx, attribindex, size, type,
+                         relativeoffset);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29720,6 +30490,8 @@ void GL_APIENTRY VertexAttribIPointerContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribIPointerContextANGLE, ctx, index,
+                                      size, type, stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -29756,6 +30528,8 @@ void GL_APIENTRY VertexAttribPointerContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_VERTEX_STATE_CALL(true, context, VertexAttribPointerContextANGLE, ctx, index,
+                                      size, type, normalized, stride, pointer);
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -29785,6 +30559,7 @@ void GL_APIENTRY VertexBindingDivisorContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, VertexBindingDivisorContextANGLE, ctx, bindingindex, divisor);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexBindingDivisor(context, bindingindex, divisor));
@@ -29841,6 +30616,7 @@ ViewportContextANGLE(GLeglContext ctx, GLint x, GLint y, GLsizei width, GLsizei
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ViewportContextANGLE, ctx, x, y, width, height);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
@@ -29996,6 +30772,7 @@ void GL_APIENTRY CoverageModulationCHROMIUMContextANGLE(GLeglContext ctx, GLenum
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CoverageModulationCHROMIUMContextANGLE, ctx, components);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components));
@@ -30036,6 +30813,9 @@ void GL_APIENTRY CopyTextureCHROMIUMContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTextureCHROMIUMContextANGLE, ctx, sourceId, sourceLevel,
+                         destTarget, destId, destLevel, internalFormat, destType, unpackFlipY,
+                         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -30090,6 +30870,9 @@ void GL_APIENTRY CopySubTextureCHROMIUMContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopySubTextureCHROMIUMContextANGLE, ctx, sourceId, sourceLevel,
+                         destTarget, destId, destLevel, xoffset, yoffset, x, y, width, height,
+                         unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -30126,6 +30909,7 @@ void GL_APIENTRY CompressedCopyTextureCHROMIUMContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CompressedCopyTextureCHROMIUMContextANGLE, ctx, sourceId, destId);
         TextureID sourceIdPacked                              = PackParam<TextureID>(sourceId);
         TextureID destIdPacked                                = PackParam<TextureID>(destId);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -32528,6 +33312,9 @@ void GL_APIENTRY CopyTexture3DANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopyTexture3DANGLEContextANGLE, ctx, sourceId, sourceLevel,
+                         destTarget, destId, destLevel, internalFormat, destType, unpackFlipY,
+                         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -32586,6 +33373,9 @@ void GL_APIENTRY CopySubTexture3DANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, CopySubTexture3DANGLEContextANGLE, ctx, sourceId, sourceLevel,
+                         destTarget, destId, destLevel, xoffset, yoffset, zoffset, x, y, z, width,
+                         height, depth, unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
         TextureID sourceIdPacked       = PackParam<TextureID>(sourceId);
         TextureTarget destTargetPacked = PackParam<TextureTarget>(destTarget);
         TextureID destIdPacked         = PackParam<TextureID>(destId);
@@ -32633,6 +33423,8 @@ void GL_APIENTRY TexStorage2DMultisampleANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorage2DMultisampleANGLEContextANGLE, ctx, target, samples,
+                         internalformat, width, height, fixedsamplelocations);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -32881,6 +33673,9 @@ void GL_APIENTRY DrawArraysInstancedBaseInstanceANGLEContextANGLE(GLeglContext c
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawArraysInstancedBaseInstanceANGLEContextANGLE, ctx, mode, first,
+                            count, instanceCount, baseInstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
@@ -32921,6 +33716,10 @@ DrawElementsInstancedBaseVertexBaseInstanceANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL_IF(context->canDeferDraw(), context,
+                            DrawElementsInstancedBaseVertexBaseInstanceANGLEContextANGLE, ctx, mode,
+                            count, type, context->copyDeferredIndices(indices, count, type),
+                            instanceCounts, baseVertex, baseInstance);
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33065,6 +33864,7 @@ void GL_APIENTRY SampleMaskiANGLEContextANGLE(GLeglContext ctx, GLuint maskNumbe
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, SampleMaskiANGLEContextANGLE, ctx, maskNumber, mask);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateSampleMaskiANGLE(context, maskNumber, mask));
@@ -33089,6 +33889,7 @@ void GL_APIENTRY ProvokingVertexANGLEContextANGLE(GLeglContext ctx, GLenum mode)
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ProvokingVertexANGLEContextANGLE, ctx, mode);
         ProvokingVertexConvention modePacked = PackParam<ProvokingVertexConvention>(mode);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -33115,6 +33916,7 @@ void GL_APIENTRY LoseContextCHROMIUMContextANGLE(GLeglContext ctx, GLenum curren
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, LoseContextCHROMIUMContextANGLE, ctx, current, other);
         GraphicsResetStatus currentPacked = PackParam<GraphicsResetStatus>(current);
         GraphicsResetStatus otherPacked   = PackParam<GraphicsResetStatus>(other);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33153,6 +33955,8 @@ void GL_APIENTRY TexImage2DExternalANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexImage2DExternalANGLEContextANGLE, ctx, target, level,
+                         internalformat, width, height, border, format, type);
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -33182,6 +33986,7 @@ void GL_APIENTRY InvalidateTextureANGLEContextANGLE(GLeglContext ctx, GLenum tar
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, InvalidateTextureANGLEContextANGLE, ctx, target);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
@@ -33291,6 +34096,8 @@ void GL_APIENTRY TexStorageMemFlags2DANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags2DANGLEContextANGLE, ctx, target, levels,
+                         internalFormat, width, height, memory, offset, createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33338,6 +34145,9 @@ void GL_APIENTRY TexStorageMemFlags2DMultisampleANGLEContextANGLE(GLeglContext c
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags2DMultisampleANGLEContextANGLE, ctx, target,
+                         samples, internalFormat, width, height, fixedSampleLocations, memory,
+                         offset, createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33387,6 +34197,9 @@ void GL_APIENTRY TexStorageMemFlags3DANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags3DANGLEContextANGLE, ctx, target, levels,
+                         internalFormat, width, height, depth, memory, offset, createFlags,
+                         usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33436,6 +34249,9 @@ void GL_APIENTRY TexStorageMemFlags3DMultisampleANGLEContextANGLE(GLeglContext c
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, TexStorageMemFlags3DMultisampleANGLEContextANGLE, ctx, target,
+                         samples, internalFormat, width, height, depth, fixedSampleLocations,
+                         memory, offset, createFlags, usageFlags);
         TextureType targetPacked                              = PackParam<TextureType>(target);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33475,6 +34291,8 @@ void GL_APIENTRY ImportMemoryZirconHandleANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ImportMemoryZirconHandleANGLEContextANGLE, ctx, memory, size,
+                         handleType, handle);
         MemoryObjectID memoryPacked                           = PackParam<MemoryObjectID>(memory);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -33507,6 +34325,8 @@ void GL_APIENTRY ImportSemaphoreZirconHandleANGLEContextANGLE(GLeglContext ctx,
     if (context && !context->isContextLost())
     {
         ASSERT(context == GetValidGlobalContext());
+        ANGLE_DEFER_CALL(context, ImportSemaphoreZirconHandleANGLEContextANGLE, ctx, semaphore,
+                         handleType, handle);
         SemaphoreID semaphorePacked                           = PackParam<SemaphoreID>(semaphore);
         HandleType handleTypePacked                           = PackParam<HandleType>(handleType);
         std::unique_lock<angle::GlobalMutex> shareContextLock = GetShareGroupLock(context);
@@ -59,6 +59,17 @@ void AllocateMutex()
     }
 }
 
+// The worker thread of the current context locks its share group for each call, so the deferred
+// calls are finished before the lock is taken.
+const gl::Context *GetCurrentContextWithoutDeferredCalls()
+{
+    const gl::Context *context = gCurrentThread ? gCurrentThread->getContext() : nullptr;
+    if (context != nullptr)
+    {
+        context->finishDeferredCalls();
+    }
+    return context;
+}
 }  // anonymous namespace
 
 thread_local Thread *gCurrentThread = nullptr;
@@ -82,6 +93,33 @@ void SetContextCurrent(Thread *thread, gl::Context *context)
     SetContextToAndroidOpenGLTLSSlot(context);
     gl::gCurrentValidContext = context;
 }
+
+ScopedShareGroupLock::ScopedShareGroupLock(const gl::Context *context)
+{
+    if (context != nullptr && context->isShared())
+    {
+        mShareGroupMutex = context->getShareGroup()->getSharedMutex();
+        mLock            = gl::LockShareGroup(context);
+    }
+}
+
+ScopedShareGroupLock::ScopedShareGroupLock(std::shared_ptr<std::recursive_mutex> shareGroupMutex)
+    : mShareGroupMutex(std::move(shareGroupMutex))
+{
+    if (mShareGroupMutex)
+    {
+        mLock = std::unique_lock<angle::GlobalMutex>(*mShareGroupMutex);
+    }
+}
+
+ScopedShareGroupLock::~ScopedShareGroupLock() = default;
+
+ScopedGlobalLock::ScopedGlobalLock()
+    : mGlobalLock(GetGlobalMutex()),
+      mCurrentShareGroupLock(GetCurrentContextWithoutDeferredCalls())
+{}
+
+ScopedGlobalLock::~ScopedGlobalLock() = default;
 }  // namespace egl
 
 namespace gl
@@ -11,6 +11,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 
@@ -95,10 +96,82 @@ angle::GlobalMutex &GetGlobalMutex();
 Thread *GetCurrentThread();
 Debug *GetDebug();
 void SetContextCurrent(Thread *thread, gl::Context *context);
+
+// Locks the share group of a context in an EGL call, after the global mutex.  The mutex is kept
+// alive until it is unlocked, since the call may destroy the context and its share group.
+class ScopedShareGroupLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedShareGroupLock(const gl::Context *context);
+    // For objects that record the share group mutex of a context they outlive.  Does nothing if
+    // |shareGroupMutex| is null.
+    explicit ScopedShareGroupLock(std::shared_ptr<std::recursive_mutex> shareGroupMutex);
+    ~ScopedShareGroupLock();
+
+  private:
+    std::shared_ptr<std::recursive_mutex> mShareGroupMutex;
+    std::unique_lock<angle::GlobalMutex> mLock;
+};
+
+// Held by the EGL entry points.  EGL calls can use the thread's current context, so they are also
+// serialized with the GL calls of the other contexts in its share group, and wait for the calls
+// the current context deferred.
+class ScopedGlobalLock final : angle::NonCopyable
+{
+  public:
+    ScopedGlobalLock();
+    ~ScopedGlobalLock();
+
+  private:
+    std::lock_guard<angle::GlobalMutex> mGlobalLock;
+    ScopedShareGroupLock mCurrentShareGroupLock;
+};
 }  // namespace egl
 
-#define ANGLE_SCOPED_GLOBAL_LOCK() \
-    std::lock_guard<angle::GlobalMutex> globalMutexLock(egl::GetGlobalMutex())
+#define ANGLE_SCOPED_GLOBAL_LOCK() egl::ScopedGlobalLock globalMutexLock
+
+// Adds the call to the queue of the context and returns from the entry point when the context
+// defers its calls.  The worker thread calls the entry point again with the same parameters,
+// except for the ones passed through DeferredCallQueue::Copy, which point to copies of the memory
+// they referred to.  The call is executed directly if the copies don't fit in the queue.
+#define ANGLE_DEFER_CALL(context, entryPoint, ...)                              \
+    do                                                                          \
+    {                                                                           \
+        if (ANGLE_UNLIKELY((context)->isDeferringCalls()) &&                    \
+            (context)->getDeferredCalls()->enqueue(&entryPoint, ##__VA_ARGS__)) \
+        {                                                                       \
+            return;                                                             \
+        }                                                                       \
+    } while (0)
+
+// Only defers the call if |condition| holds.  It is evaluated if the context defers its calls.
+#define ANGLE_DEFER_CALL_IF(condition, context, entryPoint, ...)                \
+    do                                                                          \
+    {                                                                           \
+        if (ANGLE_UNLIKELY((context)->isDeferringCalls()) && (condition) &&     \
+            (context)->getDeferredCalls()->enqueue(&entryPoint, ##__VA_ARGS__)) \
+        {                                                                       \
+            return;                                                             \
+        }                                                                       \
+    } while (0)
+
+// Defers a call that can change whether the draw calls read client memory, when
+// |changesVertexState| holds.
+#define ANGLE_DEFER_VERTEX_STATE_CALL(changesVertexState, context, entryPoint, ...) \
+    do                                                                              \
+    {                                                                               \
+        if (ANGLE_UNLIKELY((context)->isDeferringCalls()))                          \
+        {                                                                           \
+            if (changesVertexState)                                                 \
+            {                                                                       \
+                (context)->onDeferredVertexStateChange();                           \
+            }                                                                       \
+            if ((context)->getDeferredCalls()->enqueue(&entryPoint, ##__VA_ARGS__)) \
+            {                                                                       \
+                return;                                                             \
+            }                                                                       \
+        }                                                                           \
+    } while (0)
 
 namespace gl
 {
@@ -138,10 +211,31 @@ ANGLE_INLINE Context *GetValidGlobalContext()
 void GenerateContextLostErrorOnContext(Context *context);
 void GenerateContextLostErrorOnCurrentGlobalContext();
 
+// Locks the share group of a context without executing its deferred calls first.
+ANGLE_INLINE std::unique_lock<angle::GlobalMutex> LockShareGroup(const Context *context)
+{
+    if (!context->isShared())
+    {
+        return std::unique_lock<angle::GlobalMutex>();
+    }
+
+    // Textures and semaphores shared through the display can be used by any share group.  All the
+    // contexts of a share group agree on whether they use them.
+    if (context->usingDisplayTextureShareGroup() || context->usingDisplaySemaphoreShareGroup())
+    {
+        return std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex());
+    }
+
+    return std::unique_lock<angle::GlobalMutex>(context->getShareGroup()->getMutex());
+}
+
+// Used by the entry points, with the current context.  A call that can't be deferred waits until
+// the worker thread of the context has executed the calls before it.  The worker locks the share
+// group for each call, so the queue must be finished before the lock is taken.
 ANGLE_INLINE std::unique_lock<angle::GlobalMutex> GetShareGroupLock(const Context *context)
 {
-    return context->isShared() ? std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex())
-                               : std::unique_lock<angle::GlobalMutex>();
+    context->finishDeferredCalls();
+    return LockShareGroup(context);
 }
 
 }  // namespace gl
@@ -0,0 +1,282 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that traversers fused in a single traversal of the tree visit the same nodes in the same
+//   context as when each of them traverses the tree on its own.
+//
+
+#include <sstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/OutputTree.h"
+#include "compiler/translator/TranslatorESSL.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Records every visit with the context the traverser keeps, and can skip parts of the tree.
+class RecordingTraverser : public TIntermTraverser
+{
+  public:
+    RecordingTraverser(bool preVisit, bool inVisit, bool postVisit)
+        : TIntermTraverser(preVisit, inVisit, postVisit),
+          mSkipDeclarations(false),
+          mSkipAfterInVisit(false)
+    {}
+
+    void setSkipDeclarations() { mSkipDeclarations = true; }
+    void setSkipAfterInVisit() { mSkipAfterInVisit = true; }
+    void setMaxDepth(int depth) { setMaxAllowedDepth(depth); }
+
+    std::string getLog() const { return mLog.str(); }
+
+    void visitSymbol(TIntermSymbol *node) override { record(PreVisit, node, "symbol"); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        record(PreVisit, node, "constant");
+    }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return record(visit, node, "swizzle");
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        return record(visit, node, "binary");
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        return record(visit, node, "unary");
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return record(visit, node, "ternary");
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return record(visit, node, "ifelse");
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        return record(visit, node, "switch");
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override { return record(visit, node, "case"); }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override
+    {
+        record(PreVisit, node, "prototype");
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return record(visit, node, "function");
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return record(visit, node, "aggregate");
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        return record(visit, node, "block");
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return record(visit, node, "declaration") && !mSkipDeclarations;
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return record(visit, node, "loop"); }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        return record(visit, node, "branch");
+    }
+
+  private:
+    bool record(Visit visit, TIntermNode *node, const char *kind)
+    {
+        mLog << kind << " " << visit << " " << node << " depth " << getCurrentTraversalDepth()
+             << " parent " << getParentNode() << " block " << getParentBlock() << " global "
+             << mInGlobalScope << "\n";
+        return !(mSkipAfterInVisit && visit == InVisit);
+    }
+
+    bool mSkipDeclarations;
+    bool mSkipAfterInVisit;
+    std::ostringstream mLog;
+};
+
+// Inserts a statement before each declaration in a block.
+class InsertingTraverser : public TIntermTraverser
+{
+  public:
+    InsertingTraverser() : TIntermTraverser(true, false, false), mInsertionCount(0) {}
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        if (getParentNode()->getAsBlock() != nullptr)
+        {
+            insertStatementInParentBlock(CreateIndexNode(mInsertionCount++));
+        }
+        return true;
+    }
+
+  private:
+    int mInsertionCount;
+};
+
+class FusedTraverserTest : public testing::Test
+{
+  public:
+    FusedTraverserTest() {}
+
+  protected:
+    void SetUp() override
+    {
+        mAllocator.push();
+        SetGlobalPoolAllocator(&mAllocator);
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        mTranslator = new TranslatorESSL(GL_FRAGMENT_SHADER, SH_GLES3_SPEC);
+        ASSERT_TRUE(mTranslator->Init(resources));
+    }
+
+    void TearDown() override
+    {
+        SafeDelete(mTranslator);
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.pop();
+    }
+
+    TIntermBlock *compile(const std::string &shaderString)
+    {
+        const char *shaderStrings[] = {shaderString.c_str()};
+        TIntermBlock *root =
+            mTranslator->compileTreeForTesting(shaderStrings, 1, SH_OBJECT_CODE | SH_VALIDATE_AST);
+        EXPECT_NE(nullptr, root) << mTranslator->getInfoSink().info.c_str();
+        return root;
+    }
+
+    std::string outputTree(TIntermNode *root)
+    {
+        TInfoSinkBase out;
+        OutputTree(root, out);
+        return out.c_str();
+    }
+
+    TranslatorESSL *mTranslator;
+
+  private:
+    angle::PoolAllocator mAllocator;
+};
+
+constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 u;
+uniform int i;
+out vec4 color;
+
+float helper(float x)
+{
+    float y = x * 2.0;
+    for (int j = 0; j < 3; ++j)
+    {
+        y += float(j);
+        if (y > 4.0)
+        {
+            break;
+        }
+    }
+    return y > 1.0 ? y : -y;
+}
+
+void main()
+{
+    vec4 a = u;
+    switch (i)
+    {
+        case 0:
+            a.x = helper(a.y + a.z * (a.w - 1.0));
+            break;
+        default:
+            a = a.wzyx;
+    }
+    color = a;
+})";
+
+// Tests that each fused traverser visits the same nodes with the same context as when it traverses
+// the tree alone, including when the traversers skip different parts of the tree.
+TEST_F(FusedTraverserTest, VisitsMatchSeparateTraversals)
+{
+    TIntermBlock *root = compile(kShader);
+    ASSERT_NE(nullptr, root);
+
+    auto createTraversers = []() {
+        std::vector<std::unique_ptr<RecordingTraverser>> traversers;
+        traversers.emplace_back(new RecordingTraverser(true, true, true));
+        traversers.emplace_back(new RecordingTraverser(true, false, false));
+        traversers.back()->setSkipDeclarations();
+        traversers.emplace_back(new RecordingTraverser(true, true, true));
+        traversers.back()->setSkipAfterInVisit();
+        traversers.emplace_back(new RecordingTraverser(false, false, true));
+        traversers.back()->setMaxDepth(5);
+        return traversers;
+    };
+
+    std::vector<std::unique_ptr<RecordingTraverser>> separate = createTraversers();
+    for (std::unique_ptr<RecordingTraverser> &traverser : separate)
+    {
+        root->traverse(traverser.get());
+    }
+
+    std::vector<std::unique_ptr<RecordingTraverser>> fused = createTraversers();
+    TIntermFusedTraverser fusedTraverser;
+    for (std::unique_ptr<RecordingTraverser> &traverser : fused)
+    {
+        fusedTraverser.addTraverser(traverser.get());
+    }
+    root->traverse(&fusedTraverser);
+
+    for (size_t index = 0; index < separate.size(); ++index)
+    {
+        EXPECT_FALSE(separate[index]->getLog().empty());
+        EXPECT_EQ(separate[index]->getLog(), fused[index]->getLog()) << "traverser " << index;
+        EXPECT_EQ(separate[index]->getMaxDepth(), fused[index]->getMaxDepth());
+    }
+}
+
+// Tests that the statements a fused traverser inserts end up where they would without fusing, and
+// that the other traversers don't see them.
+TEST_F(FusedTraverserTest, QueuedChangesAreApplied)
+{
+    TIntermBlock *separateRoot = compile(kShader);
+    ASSERT_NE(nullptr, separateRoot);
+    TIntermBlock *fusedRoot = compile(kShader);
+    ASSERT_NE(nullptr, fusedRoot);
+    const std::string originalTree = outputTree(fusedRoot);
+    ASSERT_EQ(originalTree, outputTree(separateRoot));
+
+    InsertingTraverser separateInserter;
+    separateRoot->traverse(&separateInserter);
+    ASSERT_TRUE(separateInserter.updateTree(mTranslator, separateRoot));
+
+    RecordingTraverser recorder(true, true, true);
+    fusedRoot->traverse(&recorder);
+
+    InsertingTraverser fusedInserter;
+    RecordingTraverser fusedRecorder(true, true, true);
+    TIntermFusedTraverser fusedTraverser;
+    fusedTraverser.addTraverser(&fusedInserter);
+    fusedTraverser.addTraverser(&fusedRecorder);
+    fusedRoot->traverse(&fusedTraverser);
+    EXPECT_EQ(recorder.getLog(), fusedRecorder.getLog());
+
+    ASSERT_TRUE(fusedTraverser.updateTrees(mTranslator, fusedRoot));
+    EXPECT_NE(originalTree, outputTree(fusedRoot));
+    EXPECT_EQ(outputTree(separateRoot), outputTree(fusedRoot));
+}
+
+}  // anonymous namespace
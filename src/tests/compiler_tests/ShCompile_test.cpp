@@ -137,6 +137,58 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
     testCompile(shaderStrings, 3, true);
 }
 
+// Test that the time spent in each phase of the compilation is only recorded when requested.
+TEST_F(ShCompileTest, CompileTimings)
+{
+    const char kSource[] = R"(precision mediump float;
+    uniform vec4 u;
+    void main()
+    {
+        gl_FragColor = u * 2.0;
+    })";
+    const char *shaderStrings[] = {kSource};
+
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE));
+    EXPECT_TRUE(sh::GetCompileTimings(mCompiler)->empty());
+
+    ShCompileOptions options = SH_OBJECT_CODE | SH_RECORD_COMPILE_TIMINGS;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+    const std::vector<sh::CompileTiming> &timings = *sh::GetCompileTimings(mCompiler);
+    ASSERT_GT(timings.size(), 3u);
+    EXPECT_EQ("Preprocess", timings[0].phase);
+    EXPECT_EQ("Parse", timings[1].phase);
+    EXPECT_EQ("Translate", timings.back().phase);
+    for (const sh::CompileTiming &timing : timings)
+    {
+        EXPECT_GE(timing.seconds, 0.0) << timing.phase;
+    }
+
+    // The timings of the previous compilation are cleared.
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE));
+    EXPECT_TRUE(sh::GetCompileTimings(mCompiler)->empty());
+}
+
+// Test that the passes of the output backend are recorded on their own, before the translation.
+TEST_F(ShCompileTest, CompileTimingsOfBackendPasses)
+{
+    const char kSource[] = R"(precision mediump float;
+    uniform float u;
+    void main()
+    {
+        gl_FragColor = vec4(-u);
+    })";
+    const char *shaderStrings[] = {kSource};
+
+    ShCompileOptions options =
+        SH_OBJECT_CODE | SH_RECORD_COMPILE_TIMINGS | SH_REWRITE_FLOAT_UNARY_MINUS_OPERATOR;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+    const std::vector<sh::CompileTiming> &timings = *sh::GetCompileTimings(mCompiler);
+    ASSERT_GT(timings.size(), 2u);
+    EXPECT_EQ("RewriteUnaryMinusOperatorFloat", timings[timings.size() - 2].phase);
+    EXPECT_EQ("Translate", timings.back().phase);
+    EXPECT_GE(timings.back().seconds, 0.0);
+}
+
 // Parsing floats in shaders can run afoul of locale settings.
 // Eg. in de_DE, `strtof("1.9")` will yield `1.0f`. (It's expecting "1,9")
 TEST_F(ShCompileTest, DecimalSepLocale)
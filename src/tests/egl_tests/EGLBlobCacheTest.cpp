@@ -281,4 +281,116 @@ void main() {
     }
 }
 
+// Tests that shader translations are stored in the cache, and that programs linked with cached
+// translations behave like programs linked with freshly translated shaders.
+TEST_P(EGLBlobCacheTest, ShaderTranslation)
+{
+    // Only the back-ends that use the common translation path cache shader translations.
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    constexpr char kFragmentShaderSrc[] = R"(precision mediump float;
+struct Colors
+{
+    vec4 unused;
+    vec4 color;
+};
+uniform Colors colors;
+void main()
+{
+    gl_FragColor = colors.color;
+})";
+
+    // The first compile misses the cache and stores the translation.
+    GLuint shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    ASSERT_NE(0u, shader);
+    glDeleteShader(shader);
+    EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+    const size_t cacheEntryCount = gApplicationCache.size();
+    gLastCacheOpResult           = CacheOpResult::ValueNotSet;
+
+    // Compiling the same source again finds the translation in the cache.
+    shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    ASSERT_NE(0u, shader);
+    glDeleteShader(shader);
+    EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult);
+    EXPECT_EQ(cacheEntryCount, gApplicationCache.size());
+
+    // Each program binds the position attribute to a different location, so the programs aren't
+    // found in the cache and are linked with the cached translations.
+    for (GLuint positionLocation : {0u, 1u})
+    {
+        GLuint program = CompileProgram(
+            essl1_shaders::vs::Simple(), kFragmentShaderSrc, [positionLocation](GLuint p) {
+                glBindAttribLocation(p, positionLocation, essl1_shaders::PositionAttrib());
+            });
+        ASSERT_NE(0u, program);
+
+        glUseProgram(program);
+        GLint colorLocation = glGetUniformLocation(program, "colors.color");
+        ASSERT_NE(-1, colorLocation);
+        glUniform4f(colorLocation, 0.0f, 1.0f, 1.0f, 1.0f);
+
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::cyan);
+
+        glDeleteProgram(program);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a shader translated in a context of one version isn't found in the cache by a context
+// of a version that doesn't support it.
+TEST_P(EGLBlobCacheTest, ShaderTranslationDependsOnContextVersion)
+{
+    // Only the back-ends that use the common translation path cache shader translations.
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+
+    const EGLint es31ContextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 1,
+                                         EGL_NONE};
+    EGLContext es31Context =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, es31ContextAttribs);
+    ANGLE_SKIP_TEST_IF(es31Context == EGL_NO_CONTEXT);
+
+    const EGLint es30ContextAttribs[] = {EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 0,
+                                         EGL_NONE};
+    EGLContext es30Context =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, es30ContextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, es30Context);
+
+    constexpr char kFragmentShaderSrc[] = R"(#version 310 es
+precision mediump float;
+layout(location = 0) out vec4 color;
+void main()
+{
+    color = vec4(0.0, 1.0, 0.0, 1.0);
+})";
+
+    // The shader compiles in the ES 3.1 context, which stores its translation.
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, es31Context));
+    GLuint shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    EXPECT_NE(0u, shader);
+    glDeleteShader(shader);
+
+    // ESSL 3.10 is rejected in the ES 3.0 context instead of using the cached translation.
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, es30Context));
+    shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderSrc);
+    EXPECT_EQ(0u, shader);
+
+    ASSERT_EGL_TRUE(window->makeCurrent());
+    EXPECT_EGL_TRUE(eglDestroyContext(display, es31Context));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, es30Context));
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(EGLBlobCacheTest);
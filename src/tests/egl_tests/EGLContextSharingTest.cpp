@@ -13,6 +13,7 @@
 #include "test_utils/gl_raii.h"
 #include "util/EGLWindow.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -564,6 +565,218 @@ TEST_P(EGLContextSharingTest, DeleteReaderOfSharedTexture)
         eglDestroyContext(dpy, ctx[t]);
     }
 }
+
+// Test that threads using independent share groups at the same time see their own objects, and
+// that share groups can be created and destroyed while the others are in use.
+TEST_P(EGLContextSharingTest, IndependentShareGroupsOnThreads)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    constexpr size_t kThreadCount    = 4;
+    constexpr size_t kIterationCount = 32;
+
+    auto useShareGroup = [&](size_t threadIndex) {
+        EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE, EGL_NONE};
+        EGLSurface surface         = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+        EXPECT_EGL_SUCCESS();
+
+        EGLContext writer = window->createContext(EGL_NO_CONTEXT);
+        EGLContext reader = window->createContext(writer);
+        EXPECT_NE(EGL_NO_CONTEXT, writer);
+        EXPECT_NE(EGL_NO_CONTEXT, reader);
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, writer));
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, reader));
+        GLuint framebuffer = 0;
+        glGenFramebuffers(1, &framebuffer);
+
+        for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+        {
+            // Write the texture in one context of the share group and read it in the other.
+            const GLColor color(static_cast<GLubyte>(threadIndex * 64),
+                                static_cast<GLubyte>(iteration * 8), 0, 255);
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, writer));
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &color);
+            glFinish();
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, reader));
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture,
+                                   0);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+        }
+
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteTextures(1, &texture);
+        EXPECT_GL_NO_ERROR();
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, reader));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, writer));
+        EXPECT_EGL_TRUE(eglDestroySurface(dpy, surface));
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back(useShareGroup, threadIndex);
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Test that share groups on different threads can use the same EGL image at the same time, while
+// its source is updated in yet another share group and the image is destroyed under them.
+TEST_P(EGLContextSharingTest, ImageSiblingsInIndependentShareGroupsOnThreads)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_image_base") ||
+                       !IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_gl_texture_2D_image") ||
+                       !IsGLExtensionEnabled("GL_OES_EGL_image"));
+
+    constexpr size_t kThreadCount    = 4;
+    constexpr size_t kIterationCount = 32;
+    const GLColor kColor             = GLColor::green;
+
+    EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE, EGL_NONE};
+
+    // The source texture belongs to a share group of its own, which is shared so that it is
+    // locked separately from the others.
+    EGLSurface sourceSurface = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+    EGLContext sourceContext = window->createContext(EGL_NO_CONTEXT);
+    EGLContext sourceSharer  = window->createContext(sourceContext);
+    ASSERT_NE(EGL_NO_CONTEXT, sourceContext);
+    ASSERT_NE(EGL_NO_CONTEXT, sourceSharer);
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(dpy, sourceSurface, sourceSurface, sourceContext));
+    GLuint sourceTexture = 0;
+    glGenTextures(1, &sourceTexture);
+    glBindTexture(GL_TEXTURE_2D, sourceTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &kColor);
+    ASSERT_GL_NO_ERROR();
+
+    EGLImageKHR image =
+        eglCreateImageKHR(dpy, sourceContext, EGL_GL_TEXTURE_2D_KHR,
+                          reinterpret_cast<EGLClientBuffer>(sourceTexture), nullptr);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t readyThreadCount = 0;
+    bool imageDestroyed     = false;
+    std::atomic<bool> done(false);
+
+    // Keeps updating the source with the same contents, which notifies the targets.
+    std::thread sourceThread([&]() {
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, sourceSurface, sourceSurface, sourceContext));
+        glBindTexture(GL_TEXTURE_2D, sourceTexture);
+        while (!done)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &kColor);
+            glFinish();
+        }
+        EXPECT_GL_NO_ERROR();
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    });
+
+    auto useImage = [&]() {
+        EGLSurface surface = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+        EGLContext context = window->createContext(EGL_NO_CONTEXT);
+        EGLContext sharer  = window->createContext(context);
+        EXPECT_NE(EGL_NO_CONTEXT, context);
+        EXPECT_NE(EGL_NO_CONTEXT, sharer);
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, context));
+
+        // Keep one target until the end, so that the image outlives eglDestroyImageKHR.
+        GLuint keptTexture = 0;
+        glGenTextures(1, &keptTexture);
+        glBindTexture(GL_TEXTURE_2D, keptTexture);
+        glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+        EXPECT_GL_NO_ERROR();
+
+        GLuint framebuffer = 0;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+        for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+        {
+            // Make and orphan targets while the other share groups do the same.
+            GLuint texture = 0;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture,
+                                   0);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, kColor);
+            glDeleteTextures(1, &texture);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++readyThreadCount;
+            condition.notify_all();
+            condition.wait(lock, [&]() { return imageDestroyed; });
+        }
+
+        // The last of these releases the image, in whichever share group that happens to be.
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, keptTexture,
+                               0);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, kColor);
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteTextures(1, &keptTexture);
+        EXPECT_GL_NO_ERROR();
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, sharer));
+        EXPECT_EGL_TRUE(eglDestroyContext(dpy, context));
+        EXPECT_EGL_TRUE(eglDestroySurface(dpy, surface));
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back(useImage);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return readyThreadCount == kThreadCount; });
+        EXPECT_EGL_TRUE(eglDestroyImageKHR(dpy, image));
+        imageDestroyed = true;
+        condition.notify_all();
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    done = true;
+    sourceThread.join();
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(dpy, sourceSurface, sourceSurface, sourceContext));
+    glDeleteTextures(1, &sourceTexture);
+    EXPECT_TRUE(window->makeCurrent());
+    EXPECT_EGL_TRUE(eglDestroyContext(dpy, sourceSharer));
+    EXPECT_EGL_TRUE(eglDestroyContext(dpy, sourceContext));
+    EXPECT_EGL_TRUE(eglDestroySurface(dpy, sourceSurface));
+}
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(EGLContextSharingTest,
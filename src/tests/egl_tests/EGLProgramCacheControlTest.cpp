@@ -13,8 +13,9 @@
 
 using namespace angle;
 
-constexpr EGLint kEnabledCacheSize = 0x10000;
-constexpr char kEGLExtName[]       = "EGL_ANGLE_program_cache_control";
+constexpr EGLint kEnabledCacheSize  = 0x10000;
+constexpr char kEGLExtName[]        = "EGL_ANGLE_program_cache_control";
+constexpr char kStatisticsExtName[] = "EGL_ANGLE_program_cache_statistics";
 
 void TestCacheProgram(PlatformMethods *platform,
                       const ProgramKeyType &key,
@@ -261,6 +262,41 @@ TEST_P(EGLProgramCacheControlTest, LinkProgramWithBadShaders)
     glDeleteProgram(program);
 }
 
+// Tests that linking the same program twice is counted as a cache miss followed by a hit.
+TEST_P(EGLProgramCacheControlTest, Statistics)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    ANGLE_SKIP_TEST_IF(!extensionAvailable() || !programBinaryAvailable() ||
+                       !IsEGLDisplayExtensionEnabled(display, kStatisticsExtName));
+
+    constexpr char kVS[] = "attribute vec4 position; void main() { gl_Position = position; }";
+    constexpr char kFS[] = "void main() { gl_FragColor = vec4(0, 0, 1, 1); }";
+
+    EGLint hits   = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE);
+    EGLint misses = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE);
+    ASSERT_EGL_SUCCESS();
+
+    {
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+    }
+    EXPECT_LT(misses, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE));
+
+    {
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    }
+    EXPECT_LT(hits, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE));
+
+    // Trimming the cache evicts the program.
+    EGLint evictions =
+        eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE);
+    eglProgramCacheResizeANGLE(display, 0, EGL_PROGRAM_CACHE_TRIM_ANGLE);
+    EXPECT_LT(evictions,
+              eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE));
+    ASSERT_EGL_SUCCESS();
+}
+
 ANGLE_INSTANTIATE_TEST(EGLProgramCacheControlTest,
                        ES2_D3D9(),
                        ES2_D3D11(),
@@ -779,6 +779,47 @@ TEST_P(BufferDataTestES3, NoBufferInitDataCopyBug)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that many small buffers hold their own data, including when they are copied to and from.
+// The Vulkan back-end sub-allocates such buffers from shared VkBuffers.
+TEST_P(BufferDataTestES3, ManySmallBuffersCopy)
+{
+    constexpr size_t kBufferCount = 64;
+    constexpr GLsizei kSize       = 20;
+
+    std::vector<GLBuffer> buffers(kBufferCount);
+    for (size_t index = 0; index < kBufferCount; ++index)
+    {
+        std::vector<uint8_t> data(kSize, static_cast<uint8_t>(index));
+        glBindBuffer(GL_COPY_READ_BUFFER, buffers[index]);
+        glBufferData(GL_COPY_READ_BUFFER, kSize, data.data(), GL_DYNAMIC_DRAW);
+    }
+
+    // Copy the second half of every buffer to the first half of the next one.
+    for (size_t index = 0; index + 1 < kBufferCount; ++index)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, buffers[index]);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[index + 1]);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, kSize / 2, 0, kSize / 2);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (size_t index = 0; index < kBufferCount; ++index)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, buffers[index]);
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(
+            glMapBufferRange(GL_COPY_READ_BUFFER, 0, kSize, GL_MAP_READ_BIT));
+        ASSERT_NE(nullptr, data);
+
+        const uint8_t firstHalf = static_cast<uint8_t>(index == 0 ? 0 : index - 1);
+        for (GLsizei offset = 0; offset < kSize; ++offset)
+        {
+            EXPECT_EQ(offset < kSize / 2 ? firstHalf : index, data[offset]);
+        }
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Ensures that calling glBufferData on a mapped buffer results in an unmapped buffer
 TEST_P(BufferDataTestES3, BufferDataUnmap)
 {
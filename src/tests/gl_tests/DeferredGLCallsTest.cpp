@@ -0,0 +1,246 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredGLCallsTest:
+//   Tests for the mode where a worker thread of the context executes the GL calls that don't
+//   return anything.
+//
+
+#include <thread>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class DeferredGLCallsTest : public ANGLETest
+{
+  protected:
+    DeferredGLCallsTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+};
+
+constexpr char kUniformColorFS[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+void GL_APIENTRY RecordMessageThread(GLenum source,
+                                     GLenum type,
+                                     GLuint id,
+                                     GLenum severity,
+                                     GLsizei length,
+                                     const GLchar *message,
+                                     const void *userParam)
+{
+    std::vector<std::thread::id> *messageThreads =
+        static_cast<std::vector<std::thread::id> *>(const_cast<void *>(userParam));
+    messageThreads->push_back(std::this_thread::get_id());
+}
+
+// Tests that clears are executed before the pixels are read back.
+TEST_P(DeferredGLCallsTest, ClearThenReadPixels)
+{
+    const GLColor kColors[] = {GLColor::red, GLColor::green, GLColor::blue, GLColor::yellow};
+
+    for (const GLColor &color : kColors)
+    {
+        glClearColor(color.R / 255.0f, color.G / 255.0f, color.B / 255.0f, color.A / 255.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, color);
+    }
+}
+
+// Tests more draws than the queue can hold, each with its own uniform value and scissor.
+TEST_P(DeferredGLCallsTest, ManyDraws)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kUniformColorFS);
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    const std::array<Vector3, 6> quadVertices = GetQuadVertices();
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+
+    // Only value calls are made in the loop, so the queue fills up.  Every column is drawn several
+    // times, the last time in red.
+    constexpr int kDrawCount = 10000;
+    const int width          = getWindowWidth();
+    for (int drawIndex = 0; drawIndex < kDrawCount; ++drawIndex)
+    {
+        const int column      = drawIndex % width;
+        const bool isLastPass = drawIndex >= kDrawCount - width;
+        glScissor(column, 0, 1, getWindowHeight());
+        glUniform4f(colorLocation, isLastPass ? 1.0f : 0.0f, static_cast<float>(column) / 255.0f,
+                    0.0f, 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    glDisable(GL_SCISSOR_TEST);
+    for (int column = 0; column < width; ++column)
+    {
+        EXPECT_PIXEL_COLOR_EQ(column, 0, GLColor(255, static_cast<GLubyte>(column), 0, 255));
+    }
+}
+
+// Tests that the errors generated by deferred calls are reported by glGetError.
+TEST_P(DeferredGLCallsTest, ErrorInDeferredCall)
+{
+    glEnable(GL_INVALID_ENUM);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    glViewport(0, 0, -1, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glClearColor(0, 1, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Tests that deferred calls and calls that take pointers are executed in order.
+TEST_P(DeferredGLCallsTest, InterleavedWithPointerCalls)
+{
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::yellow);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+}
+
+// Tests that the calls taking pointers use the memory as it was when they were made.
+TEST_P(DeferredGLCallsTest, CopiedPointerParams)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kUniformColorFS);
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    std::array<Vector3, 6> quadVertices = GetQuadVertices();
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), nullptr, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(quadVertices), quadVertices.data());
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // No element array buffer is bound, so the indices are client memory.
+    std::array<GLushort, 6> indices = {{0, 1, 2, 3, 4, 5}};
+    std::array<GLfloat, 4> color    = {{0.0f, 1.0f, 0.0f, 1.0f}};
+    glUniform4fv(colorLocation, 1, color.data());
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices.data());
+
+    quadVertices.fill(Vector3(0.0f));
+    indices.fill(0);
+    color = {{1.0f, 0.0f, 0.0f, 1.0f}};
+
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+}
+
+// Tests that the draw calls reading client vertex arrays read them before they return.
+TEST_P(DeferredGLCallsTest, ClientVertexArrays)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kUniformColorFS);
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    std::array<Vector3, 6> quadVertices = GetQuadVertices();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, quadVertices.data());
+    glEnableVertexAttribArray(positionLocation);
+    glUniform4f(colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    quadVertices.fill(Vector3(0.0f));
+
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::blue);
+}
+
+// Tests that the calls aren't deferred while GL_DEBUG_OUTPUT_SYNCHRONOUS is enabled, so the debug
+// callback is called by the call generating the message.
+TEST_P(DeferredGLCallsTest, DebugOutputSynchronous)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_KHR_debug"));
+
+    std::vector<std::thread::id> messageThreads;
+    glDebugMessageCallbackKHR(RecordMessageThread, &messageThreads);
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+    for (size_t callIndex = 0; callIndex < 10; ++callIndex)
+    {
+        glEnable(GL_INVALID_ENUM);
+        ASSERT_EQ(callIndex + 1, messageThreads.size());
+        EXPECT_EQ(std::this_thread::get_id(), messageThreads.back());
+    }
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // The calls are deferred again once it is disabled.
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDisable(GL_DEBUG_OUTPUT);
+    glClearColor(0, 1, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_EQ(10u, messageThreads.size());
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(DeferredGLCallsTest,
+                       WithDeferGLCallsFeature(ES2_VULKAN()),
+                       WithDeferGLCallsFeature(ES3_VULKAN()));
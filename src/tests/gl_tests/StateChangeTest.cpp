@@ -2553,6 +2553,56 @@ TEST_P(SimpleStateChangeTestES3, ReadFramebufferDrawFramebufferDifferentAttachme
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
 }
 
+// Tests many draws with interleaved scissor and uniform changes in a single render pass.  Large
+// render passes may be split and recorded in pieces, each of which must start with the right state.
+TEST_P(SimpleStateChangeTestES3, ManyDrawsInOneRenderPass)
+{
+    constexpr int kGridSize = 16;
+    constexpr int kLayers   = 16;
+    const int cellWidth     = getWindowWidth() / kGridSize;
+    const int cellHeight    = getWindowHeight() / kGridSize;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+
+    auto cellColor = [](int layer, int x, int y) {
+        return GLColor(static_cast<GLubyte>(x * 16), static_cast<GLubyte>(y * 16),
+                       static_cast<GLubyte>(layer * 16), 255);
+    };
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+
+    // Every layer overwrites the previous one, so any draw that picks up stale state from a
+    // different cell or layer shows up in the final result.
+    for (int layer = 0; layer < kLayers; ++layer)
+    {
+        for (int y = 0; y < kGridSize; ++y)
+        {
+            for (int x = 0; x < kGridSize; ++x)
+            {
+                glScissor(x * cellWidth, y * cellHeight, cellWidth, cellHeight);
+                angle::Vector4 color = cellColor(layer, x, y).toNormalizedVector();
+                glUniform4fv(colorUniformLocation, 1, color.data());
+                drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f, 1.0f, true);
+            }
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (int y = 0; y < kGridSize; ++y)
+    {
+        for (int x = 0; x < kGridSize; ++x)
+        {
+            EXPECT_PIXEL_COLOR_EQ(x * cellWidth + cellWidth / 2, y * cellHeight + cellHeight / 2,
+                                  cellColor(kLayers - 1, x, y));
+        }
+    }
+}
+
 // Tests that invalidate then copy then blend works.
 TEST_P(SimpleStateChangeTestES3, InvalidateThenCopyThenBlend)
 {
@@ -5837,7 +5887,9 @@ ANGLE_INSTANTIATE_TEST_ES2(StateChangeRenderTest);
 ANGLE_INSTANTIATE_TEST_ES3(StateChangeTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(StateChangeRenderTestES3);
 ANGLE_INSTANTIATE_TEST_ES2(SimpleStateChangeTest);
-ANGLE_INSTANTIATE_TEST_ES3(SimpleStateChangeTestES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(SimpleStateChangeTestES3,
+                               WithAsyncPipelineCompilationFeatureVulkan(ES3_VULKAN()),
+                               WithParallelRenderPassCommandRecordingFeatureVulkan(ES3_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES3(ImageRespecificationTest);
 ANGLE_INSTANTIATE_TEST_ES31(SimpleStateChangeTestES31);
 ANGLE_INSTANTIATE_TEST_ES31(SimpleStateChangeTestComputeES31);
@@ -2073,6 +2073,95 @@ TEST_P(TextureCubeTest, CubeMapFBOScissoredClear)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that many small glTexSubImage2D calls, some of which overlap the previous ones, are all
+// applied in order.
+TEST_P(Texture2DTest, ManySmallSubImageUploads)
+{
+    constexpr GLsizei kTileSize  = 4;
+    constexpr GLsizei kTileCount = 4;
+    constexpr GLsizei kSize      = kTileSize * kTileCount;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    // Fill the texture with tiles of different colors.
+    for (GLsizei tileY = 0; tileY < kTileCount; ++tileY)
+    {
+        for (GLsizei tileX = 0; tileX < kTileCount; ++tileX)
+        {
+            const GLColor color(static_cast<GLubyte>(tileX * 64), static_cast<GLubyte>(tileY * 64),
+                                0, 255);
+            std::vector<GLColor> tile(kTileSize * kTileSize, color);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, tileX * kTileSize, tileY * kTileSize, kTileSize,
+                            kTileSize, GL_RGBA, GL_UNSIGNED_BYTE, tile.data());
+        }
+    }
+
+    // Overwrite the center of the texture, across four tiles.
+    std::vector<GLColor> center(kTileSize * kTileSize, GLColor::blue);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, kSize / 2 - kTileSize / 2, kSize / 2 - kTileSize / 2,
+                    kTileSize, kTileSize, GL_RGBA, GL_UNSIGNED_BYTE, center.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor(0, 0, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, 0, GLColor(192, 0, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(0, kSize - 1, GLColor(0, 192, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor(192, 192, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - kTileSize / 2 - 1, kSize / 2, GLColor(64, 128, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - kTileSize / 2, kSize / 2 - kTileSize / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 + kTileSize / 2, kSize / 2, GLColor(128, 128, 0, 255));
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that a texture upload large enough to have its format conversion split between threads is
+// converted correctly across the whole image.
+TEST_P(Texture2DTest, LargeRGBUploadWithConversion)
+{
+    constexpr GLsizei kSize = 1024;
+
+    // Every row has its own color, so a band of rows written to the wrong place is caught.
+    std::vector<GLubyte> pixels(kSize * kSize * 3);
+    for (GLsizei y = 0; y < kSize; ++y)
+    {
+        for (GLsizei x = 0; x < kSize; ++x)
+        {
+            GLubyte *pixel = &pixels[(y * kSize + x) * 3];
+            pixel[0]       = static_cast<GLubyte>(y);
+            pixel[1]       = static_cast<GLubyte>(y >> 8);
+            pixel[2]       = static_cast<GLubyte>(x);
+        }
+    }
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, kSize, kSize, 0, GL_RGB, GL_UNSIGNED_BYTE,
+                 pixels.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    for (GLsizei y : {0, 1, kSize / 8 - 1, kSize / 8, kSize / 2 - 1, kSize / 2, kSize - 1})
+    {
+        for (GLsizei x : {0, kSize / 2, kSize - 1})
+        {
+            EXPECT_PIXEL_COLOR_EQ(x, y,
+                                  GLColor(static_cast<GLubyte>(y), static_cast<GLubyte>(y >> 8),
+                                          static_cast<GLubyte>(x), 255));
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test that glTexSubImage2D works properly when glTexStorage2DEXT has initialized the image with a
 // default color.
 TEST_P(Texture2DTest, TexStorage)
@@ -8700,13 +8789,20 @@ void main()
 #define ES3_EMULATE_COPY_TEX_IMAGE()                          \
     WithEmulateCopyTexImage2DFromRenderbuffers(ES3_OPENGL()), \
         WithEmulateCopyTexImage2DFromRenderbuffers(ES3_OPENGLES())
-ANGLE_INSTANTIATE_TEST(Texture2DTest, ANGLE_ALL_TEST_PLATFORMS_ES2, ES2_EMULATE_COPY_TEX_IMAGE());
+ANGLE_INSTANTIATE_TEST(Texture2DTest,
+                       ANGLE_ALL_TEST_PLATFORMS_ES2,
+                       ES2_EMULATE_COPY_TEX_IMAGE(),
+                       WithParallelTextureLoadFeatureVulkan(ES2_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES2(TextureCubeTest);
 ANGLE_INSTANTIATE_TEST_ES2(Texture2DTestWithDrawScale);
 ANGLE_INSTANTIATE_TEST_ES2(Sampler2DAsFunctionParameterTest);
-ANGLE_INSTANTIATE_TEST_ES2(SamplerArrayTest);
+ANGLE_INSTANTIATE_TEST(SamplerArrayTest,
+                       ANGLE_ALL_TEST_PLATFORMS_ES2,
+                       WithDescriptorUpdateTemplatesFeatureVulkan(ES2_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES2(SamplerArrayAsFunctionParameterTest);
-ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3, WithAllocateNonZeroMemory(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3,
+                               WithAllocateNonZeroMemory(ES3_VULKAN()),
+                               WithDescriptorUpdateTemplatesFeatureVulkan(ES3_VULKAN()));
 ANGLE_INSTANTIATE_TEST_ES31(Texture2DTestES31PPO);
 ANGLE_INSTANTIATE_TEST_ES3(Texture2DBaseMaxTestES3);
 ANGLE_INSTANTIATE_TEST_ES2(Texture3DTestES2);
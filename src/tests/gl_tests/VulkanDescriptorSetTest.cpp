@@ -31,6 +31,8 @@ class VulkanDescriptorSetTest : public ANGLETest
         mMaxSetsPerPool = rx::vk::DynamicDescriptorPool::GetMaxSetsPerPoolForTesting();
         mMaxSetsPerPoolMultiplier =
             rx::vk::DynamicDescriptorPool::GetMaxSetsPerPoolMultiplierForTesting();
+        mMaxCachedDescriptorSets =
+            rx::vk::DescriptorSetCache::GetMaxCachedDescriptorSetsForTesting();
     }
 
     void testTearDown() override
@@ -38,6 +40,7 @@ class VulkanDescriptorSetTest : public ANGLETest
         rx::vk::DynamicDescriptorPool::SetMaxSetsPerPoolForTesting(mMaxSetsPerPool);
         rx::vk::DynamicDescriptorPool::SetMaxSetsPerPoolMultiplierForTesting(
             mMaxSetsPerPoolMultiplier);
+        rx::vk::DescriptorSetCache::SetMaxCachedDescriptorSetsForTesting(mMaxCachedDescriptorSets);
     }
 
     static constexpr uint32_t kMaxSetsForTesting           = 1;
@@ -53,6 +56,7 @@ class VulkanDescriptorSetTest : public ANGLETest
   private:
     uint32_t mMaxSetsPerPool;
     uint32_t mMaxSetsPerPoolMultiplier;
+    size_t mMaxCachedDescriptorSets;
 };
 
 // Test atomic counter read.
@@ -101,6 +105,86 @@ TEST_P(VulkanDescriptorSetTest, AtomicCounterReadLimitedDescriptorPool)
     }
 }
 
+// Test that textures are sampled correctly when their descriptor sets keep getting evicted from
+// the cache and their pools recycled.
+TEST_P(VulkanDescriptorSetTest, TextureDescriptorSetEviction)
+{
+    limitMaxSets();
+    rx::vk::DescriptorSetCache::SetMaxCachedDescriptorSetsForTesting(1);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    const GLColor kColors[] = {GLColor::red, GLColor::green, GLColor::blue, GLColor::yellow};
+    GLTexture textures[ArraySize(kColors)];
+    for (size_t index = 0; index < ArraySize(kColors); ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     &kColors[index]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        for (size_t index = 0; index < ArraySize(kColors); ++index)
+        {
+            glBindTexture(GL_TEXTURE_2D, textures[index]);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+            ASSERT_GL_NO_ERROR();
+            EXPECT_PIXEL_COLOR_EQ(0, 0, kColors[index]);
+        }
+    }
+}
+
+// Test that changing a sampler uniform after the program is used samples from the new texture
+// unit, even though the textures bound to the units are unchanged.
+TEST_P(VulkanDescriptorSetTest, SamplerUniformChangeAfterDraw)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D u_first;
+uniform sampler2D u_second;
+varying vec2 v_texCoord;
+
+void main()
+{
+    gl_FragColor = texture2D(u_first, v_texCoord) + texture2D(u_second, v_texCoord) * 0.0;
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), kFS);
+    glUseProgram(program);
+    GLint firstLocation  = glGetUniformLocation(program, "u_first");
+    GLint secondLocation = glGetUniformLocation(program, "u_second");
+    ASSERT_NE(-1, firstLocation);
+    ASSERT_NE(-1, secondLocation);
+
+    const GLColor kColors[] = {GLColor::red, GLColor::green};
+    GLTexture textures[ArraySize(kColors)];
+    for (size_t index = 0; index < ArraySize(kColors); ++index)
+    {
+        glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + index));
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     &kColors[index]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    glUniform1i(firstLocation, 0);
+    glUniform1i(secondLocation, 1);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Swap the units.  The same textures stay bound, so only the program's binding signature
+    // tells the cached descriptor sets apart.
+    glUniform1i(firstLocation, 1);
+    glUniform1i(secondLocation, 0);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanDescriptorSetTest, ES31_VULKAN(), ES31_VULKAN_SWIFTSHADER());
 
 }  // namespace
\ No newline at end of file
@@ -46,6 +46,12 @@ class VulkanPerformanceCounterTest : public ANGLETest
         return rx::GetImplAs<const rx::ContextVk>(context)->getPerfCounters();
     }
 
+    rx::RendererVk *hackRenderer() const
+    {
+        const gl::Context *context = static_cast<const gl::Context *>(getEGLWindow()->getContext());
+        return rx::GetImplAs<const rx::ContextVk>(context)->getRenderer();
+    }
+
     static constexpr GLsizei kInvalidateTestSize = 16;
 
     void setupClearAndDrawForInvalidateTest(GLProgram *program,
@@ -172,6 +178,12 @@ class VulkanPerformanceCounterTest : public ANGLETest
 class VulkanPerformanceCounterTest_ES31 : public VulkanPerformanceCounterTest
 {};
 
+class VulkanPerformanceCounterTest_AsyncPipelines : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_WarmUpPipelines : public VulkanPerformanceCounterTest
+{};
+
 // Tests that texture updates to unused textures don't break the RP.
 TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
 {
@@ -355,6 +367,198 @@ TEST_P(VulkanPerformanceCounterTest, ChangingMaxLevelHitsDescriptorCache)
     EXPECT_EQ(expectedWriteDescriptorSetCount, actualWriteDescriptorSetCount);
 }
 
+// Tests that switching back to a previously used program and state hits the pipeline cache.
+TEST_P(VulkanPerformanceCounterTest, SwitchingProgramsHitsGraphicsPipelineCache)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    // Step 1: Create a pipeline for each program.
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t expectedMissCount = counters.graphicsPipelineCacheMisses;
+    uint32_t expectedHitCount  = counters.graphicsPipelineCacheHits + 2;
+
+    // Step 2: Switch back and forth between the programs and verify no pipeline is created.
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedMissCount, counters.graphicsPipelineCacheMisses);
+    EXPECT_EQ(expectedHitCount, counters.graphicsPipelineCacheHits);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Tests that graphics pipelines are evicted once the renderer is over its pipeline budget, and that
+// pipelines in use by a pending submission are not evicted.
+TEST_P(VulkanPerformanceCounterTest, GraphicsPipelinesEvictedOverBudget)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+    rx::RendererVk *renderer             = hackRenderer();
+
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    // Pipelines created by ANGLE internally count against the budget too.
+    const size_t originalBudget = renderer->getGraphicsPipelineBudget();
+    const size_t budget         = renderer->getGraphicsPipelineCount() + 8;
+    renderer->setGraphicsPipelineBudgetForTesting(budget);
+
+    // Each color mask results in a different pipeline.
+    auto drawWithColorMasks = [&](GLProgram &program) {
+        for (GLuint mask = 0; mask < 16; ++mask)
+        {
+            glColorMask(mask & 1, mask & 2, mask & 4, mask & 8);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    };
+
+    // Step 1: Create more pipelines than the budget allows in a single submission.  None of them
+    // can be evicted as they are all in use by the GPU.
+    uint32_t expectedEvictionCount = counters.graphicsPipelineCacheEvictions;
+    drawWithColorMasks(redProgram);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedEvictionCount, counters.graphicsPipelineCacheEvictions);
+    EXPECT_GT(renderer->getGraphicsPipelineCount(), budget);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Step 2: Once the GPU is done, creating new pipelines evicts the least recently used ones,
+    // across programs.
+    const uint32_t missCountBefore = counters.graphicsPipelineCacheMisses;
+    drawWithColorMasks(greenProgram);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_GT(counters.graphicsPipelineCacheEvictions, expectedEvictionCount);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Step 3: The evicted pipelines are recreated when used again.
+    expectedEvictionCount = counters.graphicsPipelineCacheEvictions;
+    drawWithColorMasks(redProgram);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_GT(counters.graphicsPipelineCacheMisses, missCountBefore + 16);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    renderer->setGraphicsPipelineBudgetForTesting(originalBudget);
+}
+
+// Tests that draw calls don't wait for pipelines that are being created on a worker thread.
+TEST_P(VulkanPerformanceCounterTest_AsyncPipelines, DrawDoesNotWaitForPipelineCreation)
+{
+    // Binding a pipeline before it's created requires ANGLE's own command buffers, which are
+    // executed after being recorded.
+    ANGLE_SKIP_TEST_IF(!rx::vk::CommandBuffer::ExecutesInline());
+
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+
+    // Every draw uses a new pipeline, as the color mask changes.  Adding red to the blue clear
+    // color results in magenta regardless of which channels are written.
+    const uint32_t expectedMissCount = counters.graphicsPipelineCacheMisses + 16;
+    const uint32_t expectedWaitCount = counters.graphicsPipelineCreationWaits;
+    for (GLuint mask = 0; mask < 16; ++mask)
+    {
+        glColorMask(mask & 1, mask & 2, mask & 4, mask & 8);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    }
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedWaitCount, counters.graphicsPipelineCreationWaits);
+
+    // The pipelines are created by the time the render pass is flushed.
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::magenta);
+    EXPECT_LE(expectedMissCount, counters.graphicsPipelineCacheMisses);
+}
+
+// Tests that the pipelines recorded for a program are created when the same program is linked
+// again, so that drawing with them hits the pipeline cache.
+TEST_P(VulkanPerformanceCounterTest_WarmUpPipelines, RelinkedProgramWarmsUpRecordedPipelines)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    // Each color mask results in a different pipeline.
+    auto drawWithColorMasks = [&](GLProgram &program) {
+        for (GLuint mask = 0; mask < 4; ++mask)
+        {
+            glColorMask(GL_TRUE, (mask & 1) != 0, (mask & 2) != 0, GL_TRUE);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    };
+
+    // Step 1: Record the pipelines of a program.  Deleting the program writes its pipeline
+    // manifest to the blob cache.
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+        drawWithColorMasks(program);
+        glUseProgram(0);
+    }
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    // Step 2: Link the same program again.  The recorded pipelines are created on worker threads,
+    // and the draw calls find them in the cache.
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    const uint32_t expectedMissCount = counters.graphicsPipelineCacheMisses;
+    const uint32_t expectedHitCount  = counters.graphicsPipelineCacheHits + 4;
+    drawWithColorMasks(program);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedMissCount, counters.graphicsPipelineCacheMisses);
+    EXPECT_EQ(expectedHitCount, counters.graphicsPipelineCacheHits);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
+// Tests that programs that sample the same texture with the same bindings share the texture
+// descriptor set.
+TEST_P(VulkanPerformanceCounterTest, ProgramsWithSameSamplersShareTextureDescriptorSet)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    constexpr char kSwizzleFS[] = R"(precision mediump float;
+uniform sampler2D u_tex2D;
+varying vec2 v_texCoord;
+
+void main()
+{
+    gl_FragColor = texture2D(u_tex2D, v_texCoord).gbra;
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    ANGLE_GL_PROGRAM(swizzleProgram, essl1_shaders::vs::Texture2D(), kSwizzleFS);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // Step 1: Draw with the first program, which creates the texture descriptor set.
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    uint32_t expectedHitCount = counters.descriptorSetCacheHits + 1;
+
+    // Step 2: Draw with the second program, which should find the first program's set.
+    drawQuad(swizzleProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedHitCount, counters.descriptorSetCacheHits);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+}
+
 // Tests that two glCopyBufferSubData commands can share a barrier.
 TEST_P(VulkanPerformanceCounterTest, IndependentBufferCopiesShareSingleBarrier)
 {
@@ -2919,7 +3123,108 @@ TEST_P(VulkanPerformanceCounterTest, ScissorDoesNotBreakRenderPass)
                          GLColor::transparentBlack);
 }
 
+// Tests that client vertex data and default uniforms are streamed through the same ring buffer,
+// which is reused across frames without growing.
+TEST_P(VulkanPerformanceCounterTest, StreamedDataReusesRingBuffer)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+
+    // Warm up, so the ring buffer is created.
+    glUniform4f(colorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    swapBuffers();
+    ASSERT_GL_NO_ERROR();
+
+    constexpr uint32_t kFrameCount = 8;
+    constexpr uint32_t kDrawCount  = 16;
+    for (uint32_t frame = 0; frame < kFrameCount; ++frame)
+    {
+        for (uint32_t draw = 0; draw < kDrawCount; ++draw)
+        {
+            // Client vertex data and a new uniform value for every draw.
+            glUniform4f(colorUniformLocation, 0.0f, static_cast<float>(draw) / kDrawCount, 0.0f,
+                        1.0f);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+
+        EXPECT_GT(counters.streamingBufferBytesAllocated, 0u);
+        EXPECT_EQ(counters.streamingBufferResizes, 0u);
+        EXPECT_EQ(counters.streamingBufferStalls, 0u);
+        swapBuffers();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a small glBufferSubData to a vertex buffer used by the current render pass orphans the
+// buffer instead of breaking the render pass.
+TEST_P(VulkanPerformanceCounterTest, BufferSubDataToBusyBufferDoesNotBreakRenderPass)
+{
+    const rx::vk::PerfCounters &counters = hackANGLE();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    // A quad covering the left half of the framebuffer, followed by one covering nothing.
+    const std::array<Vector3, 6> leftQuad = {{{-1.0f, 1.0f, 0.5f},
+                                              {-1.0f, -1.0f, 0.5f},
+                                              {0.0f, -1.0f, 0.5f},
+                                              {-1.0f, 1.0f, 0.5f},
+                                              {0.0f, -1.0f, 0.5f},
+                                              {0.0f, 1.0f, 0.5f}}};
+    std::array<Vector3, 6> rightQuad      = {};
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(leftQuad) + sizeof(rightQuad), nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(leftQuad), leftQuad.data());
+    glBufferSubData(GL_ARRAY_BUFFER, sizeof(leftQuad), sizeof(rightQuad), rightQuad.data());
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t expectedRenderPassCount = counters.renderPasses + 1;
+
+    glUniform4f(colorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    // Move the second quad to the right half while the buffer is used by the render pass.
+    for (size_t index = 0; index < leftQuad.size(); ++index)
+    {
+        rightQuad[index] = leftQuad[index] + Vector3(1.0f, 0.0f, 0.0f);
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, sizeof(leftQuad), sizeof(rightQuad), rightQuad.data());
+
+    glUniform4f(colorUniformLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 6, 6);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t actualRenderPassCount = counters.renderPasses;
+    EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
+
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 4, getWindowHeight() / 2, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() * 3 / 4, getWindowHeight() / 2, GLColor::green);
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest, ES3_VULKAN());
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ES31, ES31_VULKAN());
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_AsyncPipelines,
+                       WithAsyncPipelineCompilationFeatureVulkan(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_WarmUpPipelines,
+                       WithWarmUpPipelinesFeatureVulkan(ES3_VULKAN()));
 
 }  // anonymous namespace
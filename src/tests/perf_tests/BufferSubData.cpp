@@ -17,6 +17,8 @@ using namespace angle;
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 4;
+constexpr GLsizeiptr kDefaultUpdateSize    = 32000;
+constexpr GLsizeiptr kDefaultBufferSize    = 40000;
 
 struct BufferSubDataParams final : public RenderTestParams
 {
@@ -27,8 +29,8 @@ struct BufferSubDataParams final : public RenderTestParams
         minorVersion      = 0;
         windowWidth       = 512;
         windowHeight      = 512;
-        updateSize        = 32000;
-        bufferSize        = 40000;
+        updateSize        = kDefaultUpdateSize;
+        bufferSize        = kDefaultBufferSize;
         iterationsPerStep = kIterationsPerStep;
         updateRate        = 1;
     }
@@ -245,6 +247,11 @@ std::string BufferSubDataParams::story() const
     strstr << vertexComponentCount;
     strstr << "_every" << updateRate;
 
+    if (updateSize != kDefaultUpdateSize || bufferSize != kDefaultBufferSize)
+    {
+        strstr << "_update" << updateSize << "_of" << bufferSize;
+    }
+
     return strstr.str();
 }
 
@@ -370,6 +377,16 @@ BufferSubDataParams BufferUpdateVulkanParams()
     return params;
 }
 
+// Updates a small part of a buffer that the previous draw calls are still using.
+BufferSubDataParams BufferUpdateInFlightVulkanParams()
+{
+    BufferSubDataParams params = BufferUpdateVulkanParams();
+    params.updateSize          = 4800;
+    params.bufferSize          = 16000;
+    params.iterationsPerStep   = 16;
+    return params;
+}
+
 TEST_P(BufferSubDataBenchmark, Run)
 {
     run();
@@ -378,6 +395,7 @@ TEST_P(BufferSubDataBenchmark, Run)
 ANGLE_INSTANTIATE_TEST(BufferSubDataBenchmark,
                        BufferUpdateD3D11Params(),
                        BufferUpdateOpenGLOrGLESParams(),
-                       BufferUpdateVulkanParams());
+                       BufferUpdateVulkanParams(),
+                       BufferUpdateInFlightVulkanParams());
 
 }  // namespace
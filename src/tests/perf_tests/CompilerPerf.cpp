@@ -6,16 +6,28 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders.  After the timed runs, the test also reports the average time spent in each
+//   phase of the compilation, so that a regression can be attributed to the preprocessor, the
+//   parser, a pass over the AST or the output backend.
+//
+//   The _SPIRV variations measure the whole ESSL to SPIR-V path of the Vulkan back-end, compiling
+//   the translated shader with glslang as the back-end does when the program is linked.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <cstring>
+#include <map>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
 
+#if defined(ANGLE_ENABLE_VULKAN)
+#    include "libANGLE/renderer/glslang_wrapper_utils.h"
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+
 namespace
 {
 
@@ -162,13 +174,792 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// The following shaders are large shaders in the style of those real-world applications use, for
+// each type of shader.
+const char *kLargeESSL300VertSource = R"(#version 300 es
+// Skinned and morphed mesh with normal mapping, cascaded shadows and fog, in the style of a game
+// engine's forward pass.
+precision highp float;
+precision highp int;
+
+#define MAX_BONES 64
+#define NUM_MORPH_TARGETS 4
+#define NUM_SHADOW_CASCADES 4
+#define SATURATE(x) clamp(x, 0.0, 1.0)
+
+in vec3 aPosition;
+in vec3 aNormal;
+in vec4 aTangent;
+in vec2 aTexCoord0;
+in vec2 aTexCoord1;
+in vec4 aColor;
+in uvec4 aBoneIndices;
+in vec4 aBoneWeights;
+in vec3 aMorphPosition0;
+in vec3 aMorphPosition1;
+in vec3 aMorphPosition2;
+in vec3 aMorphPosition3;
+in vec3 aMorphNormal0;
+in vec3 aMorphNormal1;
+
+struct Camera
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec3 position;
+    float nearPlane;
+    float farPlane;
+};
+
+struct Fog
+{
+    vec3 color;
+    float density;
+    float heightFalloff;
+    float startDistance;
+};
+
+layout(std140) uniform FrameBlock
+{
+    Camera uCamera;
+    Fog uFog;
+    mat4 uShadowMatrices[NUM_SHADOW_CASCADES];
+    vec4 uCascadeSplits;
+    float uTime;
+    vec3 uWindDirection;
+    float uWindStrength;
+};
+
+layout(std140) uniform SkinBlock
+{
+    mat4 uBones[MAX_BONES];
+};
+
+uniform mat4 uModel;
+uniform mat3 uNormalMatrix;
+uniform float uMorphWeights[NUM_MORPH_TARGETS];
+uniform vec4 uTexCoordTransform;
+uniform bool uEnableSkinning;
+uniform bool uEnableWind;
+uniform int uBillboardMode;
+
+out vec3 vWorldPosition;
+out vec3 vViewPosition;
+out vec3 vNormal;
+out vec3 vTangent;
+out vec3 vBitangent;
+out vec2 vTexCoord0;
+out vec2 vTexCoord1;
+out vec4 vColor;
+out vec4 vShadowCoords[NUM_SHADOW_CASCADES];
+out float vFogFactor;
+flat out int vCascade;
+
+mat4 skinMatrix()
+{
+    mat4 skin = mat4(0.0);
+    for (int i = 0; i < 4; ++i)
+    {
+        float weight = aBoneWeights[i];
+        if (weight > 0.0)
+        {
+            skin += uBones[int(aBoneIndices[i]) % MAX_BONES] * weight;
+        }
+    }
+    float total = dot(aBoneWeights, vec4(1.0));
+    return total > 0.0 ? skin / total : mat4(1.0);
+}
+
+vec3 morphPosition(vec3 position)
+{
+    vec3 targets[NUM_MORPH_TARGETS] =
+        vec3[NUM_MORPH_TARGETS](aMorphPosition0, aMorphPosition1, aMorphPosition2, aMorphPosition3);
+    for (int i = 0; i < NUM_MORPH_TARGETS; ++i)
+    {
+        position += targets[i] * uMorphWeights[i];
+    }
+    return position;
+}
+
+vec3 morphNormal(vec3 normal)
+{
+    normal += aMorphNormal0 * uMorphWeights[0] + aMorphNormal1 * uMorphWeights[1];
+    return normalize(normal);
+}
+
+vec3 windOffset(vec3 worldPosition, float flexibility)
+{
+    float phase   = dot(worldPosition.xz, vec2(0.13, 0.17)) + uTime * 1.7;
+    float gust    = sin(phase) * 0.5 + sin(phase * 2.3 + 1.1) * 0.3 + sin(phase * 5.1) * 0.2;
+    float sway    = flexibility * flexibility * uWindStrength;
+    vec3 offset   = uWindDirection * gust * sway;
+    offset.y     -= length(offset.xz) * 0.3;
+    return offset;
+}
+
+float computeFog(vec3 worldPosition, float viewDistance)
+{
+    float distance   = max(viewDistance - uFog.startDistance, 0.0);
+    float height     = worldPosition.y - uCamera.position.y;
+    float falloff    = max(uFog.heightFalloff, 1e-4);
+    float heightTerm = abs(height) > 0.01 ? (1.0 - exp(-falloff * height)) / (falloff * height)
+                                          : 1.0;
+    return SATURATE(exp(-uFog.density * distance * heightTerm));
+}
+
+int selectCascade(float viewDepth)
+{
+    int cascade = NUM_SHADOW_CASCADES - 1;
+    for (int i = NUM_SHADOW_CASCADES - 1; i >= 0; --i)
+    {
+        if (viewDepth < uCascadeSplits[i])
+        {
+            cascade = i;
+        }
+    }
+    return cascade;
+}
+
+mat4 billboard(mat4 modelView)
+{
+    if (uBillboardMode == 1)
+    {
+        // Spherical billboard.
+        modelView[0].xyz = vec3(length(uModel[0].xyz), 0.0, 0.0);
+        modelView[1].xyz = vec3(0.0, length(uModel[1].xyz), 0.0);
+        modelView[2].xyz = vec3(0.0, 0.0, length(uModel[2].xyz));
+    }
+    else if (uBillboardMode == 2)
+    {
+        // Cylindrical billboard.
+        modelView[0].xyz = vec3(length(uModel[0].xyz), 0.0, 0.0);
+        modelView[2].xyz = vec3(0.0, 0.0, length(uModel[2].xyz));
+    }
+    return modelView;
+}
+
+void main()
+{
+    vec3 position = morphPosition(aPosition);
+    vec3 normal   = morphNormal(aNormal);
+    vec3 tangent  = aTangent.xyz;
+
+    mat4 model = uModel;
+    if (uEnableSkinning)
+    {
+        model = model * skinMatrix();
+    }
+    mat3 normalMatrix = uEnableSkinning ? mat3(model) : uNormalMatrix;
+
+    vec4 worldPosition = model * vec4(position, 1.0);
+    if (uEnableWind)
+    {
+        worldPosition.xyz += windOffset(worldPosition.xyz, aColor.a);
+    }
+
+    mat4 modelView = billboard(uCamera.view * model);
+    vec4 viewPosition =
+        uBillboardMode != 0 ? modelView * vec4(position, 1.0) : uCamera.view * worldPosition;
+
+    vWorldPosition = worldPosition.xyz;
+    vViewPosition  = viewPosition.xyz;
+    vNormal        = normalize(normalMatrix * normal);
+    vTangent       = normalize(normalMatrix * tangent);
+    vBitangent     = cross(vNormal, vTangent) * aTangent.w;
+    vTexCoord0     = aTexCoord0 * uTexCoordTransform.xy + uTexCoordTransform.zw;
+    vTexCoord1     = aTexCoord1;
+    vColor         = aColor;
+
+    for (int i = 0; i < NUM_SHADOW_CASCADES; ++i)
+    {
+        vec3 offsetPosition = worldPosition.xyz + vNormal * (0.02 * float(i + 1));
+        vShadowCoords[i]    = uShadowMatrices[i] * vec4(offsetPosition, 1.0);
+    }
+    vCascade   = selectCascade(-viewPosition.z);
+    vFogFactor = computeFog(worldPosition.xyz, length(viewPosition.xyz));
+
+    gl_Position = uCamera.projection * viewPosition;
+})";
+
+const char *kLargeESSL300VertId = "LargeESSL300Vert";
+
+const char *kLargeESSL300FragSource = R"(#version 300 es
+// Physically based forward shading with clustered lights, cascaded shadow maps, image based
+// lighting, parallax mapping and post-processing, in the style of a game engine's uber-shader.
+precision highp float;
+precision highp int;
+precision highp sampler2DArrayShadow;
+
+#define MAX_LIGHTS 16
+#define NUM_SHADOW_CASCADES 4
+#define PCF_RADIUS 2
+#define PI 3.14159265359
+#define SATURATE(x) clamp(x, 0.0, 1.0)
+#define LIGHT_DIRECTIONAL 0
+#define LIGHT_POINT 1
+#define LIGHT_SPOT 2
+#define USE_PARALLAX 1
+
+struct Light
+{
+    vec4 positionAndRange;
+    vec4 directionAndType;
+    vec4 colorAndIntensity;
+    vec4 spotAngles;
+};
+
+struct Material
+{
+    vec4 baseColorFactor;
+    vec3 emissiveFactor;
+    float metallicFactor;
+    float roughnessFactor;
+    float occlusionStrength;
+    float normalScale;
+    float parallaxScale;
+    float alphaCutoff;
+    float clearcoat;
+    float clearcoatRoughness;
+    float sheen;
+};
+
+struct SurfaceData
+{
+    vec3 albedo;
+    vec3 normal;
+    vec3 f0;
+    float metallic;
+    float roughness;
+    float occlusion;
+    float alpha;
+};
+
+layout(std140) uniform LightBlock
+{
+    Light uLights[MAX_LIGHTS];
+    int uLightCount;
+    vec3 uAmbientColor;
+};
+
+layout(std140) uniform MaterialBlock
+{
+    Material uMaterial;
+};
+
+uniform vec3 uCameraPosition;
+uniform vec4 uCascadeSplits;
+uniform float uExposure;
+uniform float uTime;
+uniform vec2 uScreenSize;
+
+uniform sampler2D uBaseColorMap;
+uniform sampler2D uNormalMap;
+uniform sampler2D uMetallicRoughnessMap;
+uniform sampler2D uOcclusionMap;
+uniform sampler2D uEmissiveMap;
+uniform sampler2D uHeightMap;
+uniform sampler2D uBrdfLut;
+uniform samplerCube uIrradianceMap;
+uniform samplerCube uPrefilteredMap;
+uniform sampler2DArrayShadow uShadowMap;
+
+in vec3 vWorldPosition;
+in vec3 vViewPosition;
+in vec3 vNormal;
+in vec3 vTangent;
+in vec3 vBitangent;
+in vec2 vTexCoord0;
+in vec2 vTexCoord1;
+in vec4 vColor;
+in vec4 vShadowCoords[NUM_SHADOW_CASCADES];
+in float vFogFactor;
+flat in int vCascade;
+
+layout(location = 0) out vec4 outColor;
+layout(location = 1) out vec4 outNormalRoughness;
+layout(location = 2) out vec4 outEmissive;
+
+float distributionGGX(float NdotH, float roughness)
+{
+    float a      = roughness * roughness;
+    float a2     = a * a;
+    float denom  = NdotH * NdotH * (a2 - 1.0) + 1.0;
+    return a2 / max(PI * denom * denom, 1e-6);
+}
+
+float geometrySchlickGGX(float NdotV, float roughness)
+{
+    float r = roughness + 1.0;
+    float k = (r * r) / 8.0;
+    return NdotV / (NdotV * (1.0 - k) + k);
+}
+
+float geometrySmith(float NdotV, float NdotL, float roughness)
+{
+    return geometrySchlickGGX(NdotV, roughness) * geometrySchlickGGX(NdotL, roughness);
+}
+
+vec3 fresnelSchlick(float cosTheta, vec3 f0)
+{
+    return f0 + (1.0 - f0) * pow(1.0 - cosTheta, 5.0);
+}
+
+vec3 fresnelSchlickRoughness(float cosTheta, vec3 f0, float roughness)
+{
+    return f0 + (max(vec3(1.0 - roughness), f0) - f0) * pow(1.0 - cosTheta, 5.0);
+}
+
+float sheenDistribution(float NdotH, float roughness)
+{
+    float invAlpha = 1.0 / max(roughness * roughness, 1e-3);
+    float sin2h    = max(1.0 - NdotH * NdotH, 0.0078125);
+    return (2.0 + invAlpha) * pow(sin2h, invAlpha * 0.5) / (2.0 * PI);
+}
+
+vec2 parallaxMapping(vec2 texCoord, vec3 viewDirTangent)
+{
+#if USE_PARALLAX
+    const int kMinLayers = 8;
+    const int kMaxLayers = 32;
+    float layers         = mix(float(kMaxLayers), float(kMinLayers),
+                               abs(dot(vec3(0.0, 0.0, 1.0), viewDirTangent)));
+    float layerDepth     = 1.0 / layers;
+    vec2 deltaTexCoord   = viewDirTangent.xy / max(viewDirTangent.z, 0.05) *
+                           uMaterial.parallaxScale / layers;
+    float currentDepth   = 0.0;
+    float mapDepth       = texture(uHeightMap, texCoord).r;
+    for (int i = 0; i < kMaxLayers; ++i)
+    {
+        if (currentDepth >= mapDepth)
+        {
+            break;
+        }
+        texCoord -= deltaTexCoord;
+        mapDepth      = textureLod(uHeightMap, texCoord, 0.0).r;
+        currentDepth += layerDepth;
+    }
+    vec2 previous      = texCoord + deltaTexCoord;
+    float afterDepth   = mapDepth - currentDepth;
+    float beforeDepth  = textureLod(uHeightMap, previous, 0.0).r - currentDepth + layerDepth;
+    float weight       = afterDepth / (afterDepth - beforeDepth);
+    return mix(texCoord, previous, weight);
+#else
+    return texCoord;
+#endif
+}
+
+float sampleShadow(int cascade, vec3 normal, vec3 lightDir)
+{
+    vec4 shadowCoord = vShadowCoords[0];
+    switch (cascade)
+    {
+        case 0:
+            shadowCoord = vShadowCoords[0];
+            break;
+        case 1:
+            shadowCoord = vShadowCoords[1];
+            break;
+        case 2:
+            shadowCoord = vShadowCoords[2];
+            break;
+        default:
+            shadowCoord = vShadowCoords[3];
+            break;
+    }
+    vec3 projected = shadowCoord.xyz / shadowCoord.w * 0.5 + 0.5;
+    if (any(lessThan(projected, vec3(0.0))) || any(greaterThan(projected, vec3(1.0))))
+    {
+        return 1.0;
+    }
+
+    float bias     = max(0.005 * (1.0 - dot(normal, lightDir)), 0.0005);
+    vec2 texelSize = 1.0 / vec2(textureSize(uShadowMap, 0).xy);
+    float shadow   = 0.0;
+    float samples  = 0.0;
+    for (int y = -PCF_RADIUS; y <= PCF_RADIUS; ++y)
+    {
+        for (int x = -PCF_RADIUS; x <= PCF_RADIUS; ++x)
+        {
+            vec2 offset = vec2(float(x), float(y)) * texelSize;
+            shadow += texture(uShadowMap, vec4(projected.xy + offset, float(cascade),
+                                               projected.z - bias));
+            samples += 1.0;
+        }
+    }
+    return shadow / samples;
+}
+
+float lightAttenuation(Light light, vec3 toLight, out vec3 lightDir)
+{
+    int type = int(light.directionAndType.w);
+    if (type == LIGHT_DIRECTIONAL)
+    {
+        lightDir = -normalize(light.directionAndType.xyz);
+        return 1.0;
+    }
+
+    float distance = length(toLight);
+    lightDir       = toLight / max(distance, 1e-4);
+    float range    = light.positionAndRange.w;
+    float falloff  = SATURATE(1.0 - pow(distance / range, 4.0));
+    float atten    = falloff * falloff / (distance * distance + 1.0);
+
+    if (type == LIGHT_SPOT)
+    {
+        float cosAngle = dot(-lightDir, normalize(light.directionAndType.xyz));
+        float spot     = SATURATE((cosAngle - light.spotAngles.y) /
+                                  max(light.spotAngles.x - light.spotAngles.y, 1e-4));
+        atten *= spot * spot;
+    }
+    return atten;
+}
+
+vec3 shadeLight(Light light, SurfaceData surface, vec3 viewDir, float shadow)
+{
+    vec3 lightDir;
+    float attenuation = lightAttenuation(light, light.positionAndRange.xyz - vWorldPosition,
+                                         lightDir);
+    if (attenuation <= 0.0)
+    {
+        return vec3(0.0);
+    }
+
+    vec3 halfway = normalize(viewDir + lightDir);
+    float NdotL  = max(dot(surface.normal, lightDir), 0.0);
+    float NdotV  = max(dot(surface.normal, viewDir), 1e-4);
+    float NdotH  = max(dot(surface.normal, halfway), 0.0);
+    float HdotV  = max(dot(halfway, viewDir), 0.0);
+
+    float D = distributionGGX(NdotH, surface.roughness);
+    float G = geometrySmith(NdotV, NdotL, surface.roughness);
+    vec3 F  = fresnelSchlick(HdotV, surface.f0);
+
+    vec3 specular = D * G * F / max(4.0 * NdotV * NdotL, 1e-4);
+    vec3 kd       = (1.0 - F) * (1.0 - surface.metallic);
+    vec3 diffuse  = kd * surface.albedo / PI;
+
+    float clearcoatD = distributionGGX(NdotH, uMaterial.clearcoatRoughness);
+    float clearcoatF = fresnelSchlick(HdotV, vec3(0.04)).x * uMaterial.clearcoat;
+    vec3 sheenTerm   = vec3(uMaterial.sheen * sheenDistribution(NdotH, surface.roughness));
+
+    vec3 radiance = light.colorAndIntensity.rgb * light.colorAndIntensity.a * attenuation;
+    vec3 lobes    = (diffuse + specular + sheenTerm) * (1.0 - clearcoatF) +
+                 vec3(clearcoatD * clearcoatF * 0.25);
+    return lobes * radiance * NdotL * shadow;
+}
+
+vec3 imageBasedLighting(SurfaceData surface, vec3 viewDir)
+{
+    float NdotV   = max(dot(surface.normal, viewDir), 1e-4);
+    vec3 F        = fresnelSchlickRoughness(NdotV, surface.f0, surface.roughness);
+    vec3 kd       = (1.0 - F) * (1.0 - surface.metallic);
+    vec3 diffuse  = texture(uIrradianceMap, surface.normal).rgb * surface.albedo * kd;
+    vec3 reflectV = reflect(-viewDir, surface.normal);
+    float lod     = surface.roughness * 6.0;
+    vec3 prefilt  = textureLod(uPrefilteredMap, reflectV, lod).rgb;
+    vec2 brdf     = texture(uBrdfLut, vec2(NdotV, surface.roughness)).rg;
+    vec3 specular = prefilt * (F * brdf.x + brdf.y);
+    return (diffuse + specular) * surface.occlusion;
+}
+
+vec3 acesFilm(vec3 x)
+{
+    const float a = 2.51;
+    const float b = 0.03;
+    const float c = 2.43;
+    const float d = 0.59;
+    const float e = 0.14;
+    return SATURATE((x * (a * x + b)) / (x * (c * x + d) + e));
+}
+
+float interleavedGradientNoise(vec2 position)
+{
+    return fract(52.9829189 * fract(dot(position, vec2(0.06711056, 0.00583715)) + uTime));
+}
+
+SurfaceData getSurfaceData(vec2 texCoord, mat3 tbn)
+{
+    SurfaceData surface;
+    vec4 baseColor  = texture(uBaseColorMap, texCoord) * uMaterial.baseColorFactor * vColor;
+    surface.albedo  = pow(baseColor.rgb, vec3(2.2));
+    surface.alpha   = baseColor.a;
+
+    vec3 tangentNormal = texture(uNormalMap, texCoord).xyz * 2.0 - 1.0;
+    tangentNormal.xy *= uMaterial.normalScale;
+    surface.normal = normalize(tbn * tangentNormal);
+
+    vec4 metallicRoughness = texture(uMetallicRoughnessMap, texCoord);
+    surface.metallic       = SATURATE(metallicRoughness.b * uMaterial.metallicFactor);
+    surface.roughness      = clamp(metallicRoughness.g * uMaterial.roughnessFactor, 0.04, 1.0);
+    surface.occlusion =
+        mix(1.0, texture(uOcclusionMap, vTexCoord1).r, uMaterial.occlusionStrength);
+    surface.f0 = mix(vec3(0.04), surface.albedo, surface.metallic);
+    return surface;
+}
+
+void main()
+{
+    mat3 tbn     = mat3(normalize(vTangent), normalize(vBitangent), normalize(vNormal));
+    vec3 viewDir = normalize(uCameraPosition - vWorldPosition);
+
+    vec2 texCoord = parallaxMapping(vTexCoord0, normalize(transpose(tbn) * viewDir));
+    SurfaceData surface = getSurfaceData(texCoord, tbn);
+    if (surface.alpha < uMaterial.alphaCutoff)
+    {
+        discard;
+    }
+
+    vec3 color = uAmbientColor * surface.albedo * surface.occlusion;
+    for (int i = 0; i < MAX_LIGHTS; ++i)
+    {
+        if (i >= uLightCount)
+        {
+            break;
+        }
+        Light light  = uLights[i];
+        float shadow = 1.0;
+        if (i == 0 && int(light.directionAndType.w) == LIGHT_DIRECTIONAL)
+        {
+            shadow = sampleShadow(vCascade, surface.normal, -light.directionAndType.xyz);
+        }
+        color += shadeLight(light, surface, viewDir, shadow);
+    }
+    color += imageBasedLighting(surface, viewDir);
+
+    vec3 emissive = texture(uEmissiveMap, texCoord).rgb * uMaterial.emissiveFactor;
+    color += emissive;
+
+    color = mix(vec3(0.5, 0.6, 0.7), color, vFogFactor);
+    color = acesFilm(color * uExposure);
+    color = pow(color, vec3(1.0 / 2.2));
+    color += (interleavedGradientNoise(gl_FragCoord.xy) - 0.5) / 255.0;
+
+    outColor           = vec4(color, surface.alpha);
+    outNormalRoughness = vec4(surface.normal * 0.5 + 0.5, surface.roughness);
+    outEmissive        = vec4(emissive, 1.0);
+})";
+
+const char *kLargeESSL300FragId = "LargeESSL300Frag";
+
+const char *kLargeESSL310CompSource = R"(#version 310 es
+// Tiled light culling followed by a separable bloom blur of the tile, in the style of a game
+// engine's compute-based lighting pass.
+precision highp float;
+precision highp int;
+precision highp image2D;
+
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 64
+#define BLUR_RADIUS 4
+#define NUM_THREADS (TILE_SIZE * TILE_SIZE)
+
+layout(local_size_x = TILE_SIZE, local_size_y = TILE_SIZE, local_size_z = 1) in;
+
+struct PointLight
+{
+    vec4 positionAndRadius;
+    vec4 colorAndIntensity;
+};
+
+layout(std140, binding = 0) uniform CullingParams
+{
+    mat4 uProjection;
+    mat4 uInverseProjection;
+    mat4 uView;
+    vec2 uScreenSize;
+    uint uLightCount;
+    float uBloomThreshold;
+    float uBlurWeights[BLUR_RADIUS + 1];
+};
+
+layout(std430, binding = 0) readonly buffer LightBuffer
+{
+    PointLight lights[];
+};
+
+layout(std430, binding = 1) writeonly buffer TileLightBuffer
+{
+    uint tileLightIndices[];
+};
+
+layout(std430, binding = 2) buffer StatsBuffer
+{
+    uint totalLightsVisible;
+    uint maxLightsPerTile;
+    uint tilesWithLights;
+};
+
+layout(binding = 0) uniform highp sampler2D uDepth;
+layout(binding = 1) uniform highp sampler2D uColor;
+layout(rgba16f, binding = 0) writeonly uniform highp image2D uBloomImage;
+
+shared uint sMinDepth;
+shared uint sMaxDepth;
+shared uint sTileLightCount;
+shared uint sTileLights[MAX_LIGHTS_PER_TILE];
+shared vec3 sBrightColors[TILE_SIZE][TILE_SIZE + 2 * BLUR_RADIUS];
+
+vec3 viewPositionFromDepth(vec2 uv, float depth)
+{
+    vec4 clip = vec4(uv * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+    vec4 view = uInverseProjection * clip;
+    return view.xyz / view.w;
+}
+
+vec4 createPlane(vec3 p0, vec3 p1, vec3 p2)
+{
+    vec3 normal = normalize(cross(p1 - p0, p2 - p0));
+    return vec4(normal, dot(normal, p0));
+}
+
+bool sphereInsidePlane(vec3 center, float radius, vec4 plane)
+{
+    return dot(plane.xyz, center) - plane.w < radius;
+}
+
+bool sphereInsideFrustum(vec3 center, float radius, vec4 planes[4], float nearZ, float farZ)
+{
+    if (center.z - radius > nearZ || center.z + radius < farZ)
+    {
+        return false;
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        if (!sphereInsidePlane(center, radius, planes[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+vec3 brightPass(vec3 color)
+{
+    float luminance = dot(color, vec3(0.2126, 0.7152, 0.0722));
+    float knee      = uBloomThreshold * 0.5;
+    float soft      = clamp(luminance - uBloomThreshold + knee, 0.0, 2.0 * knee);
+    soft            = soft * soft / (4.0 * knee + 1e-5);
+    float weight    = max(soft, luminance - uBloomThreshold) / max(luminance, 1e-5);
+    return color * weight;
+}
+
+void cullLights(uvec2 tile, uint localIndex, float minDepth, float maxDepth)
+{
+    vec2 tileScale = uScreenSize / float(TILE_SIZE);
+    vec2 tileMin   = vec2(tile) / tileScale;
+    vec2 tileMax   = vec2(tile + 1u) / tileScale;
+
+    vec3 corners[4];
+    corners[0] = viewPositionFromDepth(vec2(tileMin.x, tileMin.y), 1.0);
+    corners[1] = viewPositionFromDepth(vec2(tileMax.x, tileMin.y), 1.0);
+    corners[2] = viewPositionFromDepth(vec2(tileMax.x, tileMax.y), 1.0);
+    corners[3] = viewPositionFromDepth(vec2(tileMin.x, tileMax.y), 1.0);
+
+    vec4 planes[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        planes[i] = createPlane(vec3(0.0), corners[i], corners[(i + 1) % 4]);
+    }
+
+    float nearZ = viewPositionFromDepth(vec2(0.5), minDepth).z;
+    float farZ  = viewPositionFromDepth(vec2(0.5), maxDepth).z;
+
+    for (uint lightIndex = localIndex; lightIndex < uLightCount; lightIndex += uint(NUM_THREADS))
+    {
+        PointLight light = lights[lightIndex];
+        vec3 center      = (uView * vec4(light.positionAndRadius.xyz, 1.0)).xyz;
+        if (sphereInsideFrustum(center, light.positionAndRadius.w, planes, nearZ, farZ))
+        {
+            uint slot = atomicAdd(sTileLightCount, 1u);
+            if (slot < uint(MAX_LIGHTS_PER_TILE))
+            {
+                sTileLights[slot] = lightIndex;
+            }
+        }
+    }
+}
+
+void main()
+{
+    uvec2 tile       = gl_WorkGroupID.xy;
+    uvec2 local      = gl_LocalInvocationID.xy;
+    uint localIndex  = gl_LocalInvocationIndex;
+    ivec2 pixel      = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 screenSize = ivec2(uScreenSize);
+
+    if (localIndex == 0u)
+    {
+        sMinDepth       = 0xFFFFFFFFu;
+        sMaxDepth       = 0u;
+        sTileLightCount = 0u;
+    }
+    barrier();
+
+    ivec2 clampedPixel = clamp(pixel, ivec2(0), screenSize - 1);
+    float depth        = texelFetch(uDepth, clampedPixel, 0).r;
+    uint depthBits     = floatBitsToUint(depth);
+    atomicMin(sMinDepth, depthBits);
+    atomicMax(sMaxDepth, depthBits);
+    barrier();
+
+    cullLights(tile, localIndex, uintBitsToFloat(sMinDepth), uintBitsToFloat(sMaxDepth));
+    barrier();
+
+    uint lightCount = min(sTileLightCount, uint(MAX_LIGHTS_PER_TILE));
+    uint tileIndex  = tile.y * gl_NumWorkGroups.x + tile.x;
+    uint tileOffset = tileIndex * uint(MAX_LIGHTS_PER_TILE + 1);
+    for (uint i = localIndex; i < lightCount; i += uint(NUM_THREADS))
+    {
+        tileLightIndices[tileOffset + 1u + i] = sTileLights[i];
+    }
+    if (localIndex == 0u)
+    {
+        tileLightIndices[tileOffset] = lightCount;
+        atomicAdd(totalLightsVisible, lightCount);
+        atomicMax(maxLightsPerTile, lightCount);
+        if (lightCount > 0u)
+        {
+            atomicAdd(tilesWithLights, 1u);
+        }
+    }
+
+    // Load the bright parts of the tile with a horizontal apron for the blur.
+    for (int x = int(local.x); x < TILE_SIZE + 2 * BLUR_RADIUS; x += TILE_SIZE)
+    {
+        ivec2 source = clamp(ivec2(tile) * TILE_SIZE + ivec2(x - BLUR_RADIUS, int(local.y)),
+                             ivec2(0), screenSize - 1);
+        sBrightColors[local.y][x] = brightPass(texelFetch(uColor, source, 0).rgb);
+    }
+    memoryBarrierShared();
+    barrier();
+
+    vec3 blurred = sBrightColors[local.y][int(local.x) + BLUR_RADIUS] * uBlurWeights[0];
+    for (int i = 1; i <= BLUR_RADIUS; ++i)
+    {
+        blurred += sBrightColors[local.y][int(local.x) + BLUR_RADIUS - i] * uBlurWeights[i];
+        blurred += sBrightColors[local.y][int(local.x) + BLUR_RADIUS + i] * uBlurWeights[i];
+    }
+
+    if (all(lessThan(pixel, screenSize)))
+    {
+        float lightDensity = float(lightCount) / float(MAX_LIGHTS_PER_TILE);
+        imageStore(uBloomImage, pixel, vec4(blurred, lightDensity));
+    }
+})";
+
+const char *kLargeESSL310CompId = "LargeESSL310Comp";
+
 constexpr int kNumIterationsPerStep = 4;
 
+// Number of compilations after the timed runs that record the time spent in each phase.
+constexpr int kNumPhaseTimingCompilations = 16;
+
 struct CompilerParameters
 {
-    CompilerParameters() { output = SH_HLSL_4_1_OUTPUT; }
+    CompilerParameters() : output(SH_HLSL_4_1_OUTPUT), generateSpirv(false) {}
 
-    CompilerParameters(ShShaderOutput output) : output(output) {}
+    CompilerParameters(ShShaderOutput output) : output(output), generateSpirv(false) {}
 
     const char *str() const
     {
@@ -180,6 +971,8 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_GLSL_VULKAN_OUTPUT:
+                return "Vulkan";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -187,15 +980,25 @@ struct CompilerParameters
     }
 
     ShShaderOutput output;
+    // Whether the translated shader is also compiled to SPIR-V with glslang.
+    bool generateSpirv;
 };
 
 bool IsPlatformAvailable(const CompilerParameters &param)
 {
+#if !defined(ANGLE_ENABLE_VULKAN)
+    if (param.generateSpirv)
+    {
+        return false;
+    }
+#endif  // !defined(ANGLE_ENABLE_VULKAN)
+
     switch (param.output)
     {
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_4_0_FL9_3_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_GLSL_VULKAN_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -224,17 +1027,51 @@ struct CompilerPerfParameters final : public CompilerParameters
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
                            const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+        : CompilerPerfParameters(output,
+                                 GL_FRAGMENT_SHADER,
+                                 SH_WEBGL2_SPEC,
+                                 shaderSource,
+                                 shaderSourceId)
+    {}
+
+    CompilerPerfParameters(ShShaderOutput output,
+                           GLenum shaderType,
+                           ShShaderSpec shaderSpec,
+                           const char *shaderSource,
+                           const char *shaderSourceId)
+        : CompilerParameters(output),
+          shaderType(shaderType),
+          shaderSpec(shaderSpec),
+          shaderSource(shaderSource)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
     }
 
+    GLenum shaderType;
+    ShShaderSpec shaderSpec;
     const char *shaderSource;
     std::string testId;
 };
 
+CompilerPerfParameters LargeShader(ShShaderOutput output,
+                                   GLenum shaderType,
+                                   const char *shaderSource,
+                                   const char *shaderSourceId)
+{
+    return CompilerPerfParameters(output, shaderType, SH_GLES3_1_SPEC, shaderSource,
+                                  shaderSourceId);
+}
+
+CompilerPerfParameters WithSpirv(CompilerPerfParameters params)
+{
+    ASSERT(params.output == SH_GLSL_VULKAN_OUTPUT);
+    params.generateSpirv = true;
+    params.testId += "_SPIRV";
+    return params;
+}
+
 std::ostream &operator<<(std::ostream &stream, const CompilerPerfParameters &p)
 {
     stream << p.testId;
@@ -256,6 +1093,9 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    bool compileToSpirv();
+    void reportPhaseTimings();
+
     const char *mTestShader;
 
     ShBuiltInResources mResources;
@@ -277,7 +1117,7 @@ void CompilerPerfTest::SetUp()
 
     const auto &params = GetParam();
 
-    mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
+    mTranslator = sh::ConstructCompiler(params.shaderType, params.shaderSpec, params.output);
     sh::InitBuiltInResources(&mResources);
     mResources.FragmentPrecisionHigh = true;
     if (!mTranslator->Init(mResources))
@@ -286,10 +1126,29 @@ void CompilerPerfTest::SetUp()
     }
 
     setTestShader(params.shaderSource);
+
+#if defined(ANGLE_ENABLE_VULKAN)
+    if (params.generateSpirv)
+    {
+        rx::GlslangInitialize();
+    }
+#endif  // defined(ANGLE_ENABLE_VULKAN)
 }
 
 void CompilerPerfTest::TearDown()
 {
+    if (!mSkipTest && mTranslator != nullptr)
+    {
+        reportPhaseTimings();
+    }
+
+#if defined(ANGLE_ENABLE_VULKAN)
+    if (GetParam().generateSpirv)
+    {
+        rx::GlslangRelease();
+    }
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -300,25 +1159,99 @@ void CompilerPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
+constexpr ShCompileOptions kCompileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                             SH_INITIALIZE_UNINITIALIZED_LOCALS |
+                                             SH_INIT_OUTPUT_VARIABLES;
+
 void CompilerPerfTest::step()
 {
     const char *shaderStrings[] = {mTestShader};
 
-    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
-
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
-    if (!mTranslator->compile(shaderStrings, 1, compileOptions))
+    if (!mTranslator->compile(shaderStrings, 1, kCompileOptions))
     {
         std::cout << "Compiling perf test shader failed with log:\n"
                   << mTranslator->getInfoSink().info.c_str();
     }
+    else if (!compileToSpirv())
+    {
+        std::cout << "Compiling perf test shader to SPIR-V failed.\n";
+    }
 #endif
 
     for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
     {
-        mTranslator->compile(shaderStrings, 1, compileOptions);
+        if (mTranslator->compile(shaderStrings, 1, kCompileOptions))
+        {
+            compileToSpirv();
+        }
+    }
+}
+
+bool CompilerPerfTest::compileToSpirv()
+{
+    const CompilerPerfParameters &params = GetParam();
+    if (!params.generateSpirv)
+    {
+        return true;
+    }
+
+#if defined(ANGLE_ENABLE_VULKAN)
+    // The transform feedback markers of vertex shaders are removed, as the back-end does when the
+    // program doesn't capture varyings.
+    std::string source = mTranslator->getInfoSink().obj.str();
+    for (const char *marker : {"@@ XFB-DECL @@", "@@ XFB-OUT @@;"})
+    {
+        size_t markerStart = source.find(marker);
+        if (markerStart != std::string::npos)
+        {
+            source.erase(markerStart, strlen(marker));
+        }
+    }
+
+    rx::SpirvBlob spirvBlob;
+    angle::Result result =
+        rx::GlslangCompileShaderOneOff([](rx::GlslangError) { return angle::Result::Stop; },
+                                       gl::FromGLenum<gl::ShaderType>(params.shaderType), source,
+                                       &spirvBlob);
+    return result == angle::Result::Continue;
+#else
+    UNREACHABLE();
+    return false;
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+}
+
+// Compiles the shader again, outside of the timed runs as recording the timings has some overhead,
+// and reports the average time spent in each phase of a compilation.  The phases that run more than
+// once in a compilation are added up.
+void CompilerPerfTest::reportPhaseTimings()
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    std::vector<std::string> phases;
+    std::map<std::string, double> phaseSeconds;
+    for (int compilation = 0; compilation < kNumPhaseTimingCompilations; ++compilation)
+    {
+        if (!mTranslator->compile(shaderStrings, 1, kCompileOptions | SH_RECORD_COMPILE_TIMINGS))
+        {
+            return;
+        }
+        for (const sh::CompileTiming &timing : mTranslator->getCompileTimings())
+        {
+            if (phaseSeconds.count(timing.phase) == 0)
+            {
+                phases.push_back(timing.phase);
+            }
+            phaseSeconds[timing.phase] += timing.seconds;
+        }
+    }
+
+    for (const std::string &phase : phases)
+    {
+        std::string metric = "." + phase;
+        mReporter->RegisterFyiMetric(metric, "ns");
+        mReporter->AddResult(metric, phaseSeconds[phase] * 1e9 / kNumPhaseTimingCompilations);
     }
 }
 
@@ -342,6 +1275,63 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    LargeShader(SH_HLSL_4_1_OUTPUT, GL_VERTEX_SHADER, kLargeESSL300VertSource, kLargeESSL300VertId),
+    LargeShader(SH_HLSL_4_1_OUTPUT,
+                GL_FRAGMENT_SHADER,
+                kLargeESSL300FragSource,
+                kLargeESSL300FragId),
+    LargeShader(SH_HLSL_4_1_OUTPUT,
+                GL_COMPUTE_SHADER,
+                kLargeESSL310CompSource,
+                kLargeESSL310CompId),
+    LargeShader(SH_GLSL_450_CORE_OUTPUT,
+                GL_VERTEX_SHADER,
+                kLargeESSL300VertSource,
+                kLargeESSL300VertId),
+    LargeShader(SH_GLSL_450_CORE_OUTPUT,
+                GL_FRAGMENT_SHADER,
+                kLargeESSL300FragSource,
+                kLargeESSL300FragId),
+    LargeShader(SH_GLSL_450_CORE_OUTPUT,
+                GL_COMPUTE_SHADER,
+                kLargeESSL310CompSource,
+                kLargeESSL310CompId),
+    LargeShader(SH_ESSL_OUTPUT, GL_VERTEX_SHADER, kLargeESSL300VertSource, kLargeESSL300VertId),
+    LargeShader(SH_ESSL_OUTPUT, GL_FRAGMENT_SHADER, kLargeESSL300FragSource, kLargeESSL300FragId),
+    LargeShader(SH_ESSL_OUTPUT, GL_COMPUTE_SHADER, kLargeESSL310CompSource, kLargeESSL310CompId),
+    LargeShader(SH_GLSL_VULKAN_OUTPUT,
+                GL_VERTEX_SHADER,
+                kLargeESSL300VertSource,
+                kLargeESSL300VertId),
+    LargeShader(SH_GLSL_VULKAN_OUTPUT,
+                GL_FRAGMENT_SHADER,
+                kLargeESSL300FragSource,
+                kLargeESSL300FragId),
+    LargeShader(SH_GLSL_VULKAN_OUTPUT,
+                GL_COMPUTE_SHADER,
+                kLargeESSL310CompSource,
+                kLargeESSL310CompId),
+    WithSpirv(
+        CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id)),
+    WithSpirv(
+        CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id)),
+    WithSpirv(CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT,
+                                     kRealWorldESSL100FragSource,
+                                     kRealWorldESSL100Id)),
+    WithSpirv(
+        CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id)),
+    WithSpirv(LargeShader(SH_GLSL_VULKAN_OUTPUT,
+                          GL_VERTEX_SHADER,
+                          kLargeESSL300VertSource,
+                          kLargeESSL300VertId)),
+    WithSpirv(LargeShader(SH_GLSL_VULKAN_OUTPUT,
+                          GL_FRAGMENT_SHADER,
+                          kLargeESSL300FragSource,
+                          kLargeESSL300FragId)));
 
 }  // anonymous namespace
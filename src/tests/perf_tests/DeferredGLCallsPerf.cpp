@@ -0,0 +1,184 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredGLCallsPerf:
+//   Performance test for the calls of a frame, executed directly or deferred to the worker thread
+//   of the context.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <sstream>
+
+#include "test_utils/angle_test_instantiate.h"
+#include "util/shader_utils.h"
+
+namespace angle
+{
+constexpr unsigned int kIterationsPerStep = 4;
+
+struct DeferredGLCallsParams final : public RenderTestParams
+{
+    DeferredGLCallsParams()
+    {
+        majorVersion      = 2;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+        iterationsPerStep = kIterationsPerStep;
+
+        drawsPerIteration = 200;
+    }
+
+    std::string story() const override;
+
+    unsigned int drawsPerIteration;
+};
+
+std::ostream &operator<<(std::ostream &os, const DeferredGLCallsParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string DeferredGLCallsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (eglParameters.deferGLCallsFeature == EGL_TRUE ? "_deferred" : "_direct");
+
+    return strstr.str();
+}
+
+class DeferredGLCallsBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<DeferredGLCallsParams>
+{
+  public:
+    DeferredGLCallsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram;
+    GLint mColorLocation;
+    GLint mOffsetLocation;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+};
+
+DeferredGLCallsBenchmark::DeferredGLCallsBenchmark()
+    : ANGLERenderTest("DeferredGLCalls", GetParam()),
+      mProgram(0),
+      mColorLocation(-1),
+      mOffsetLocation(-1),
+      mVertexBuffer(0),
+      mIndexBuffer(0)
+{}
+
+void DeferredGLCallsBenchmark::initializeBenchmark()
+{
+    constexpr char kVS[] = R"(attribute vec2 position;
+uniform vec2 offset;
+void main()
+{
+    gl_Position = vec4(position * 0.05 + offset, 0.0, 1.0);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mColorLocation  = glGetUniformLocation(mProgram, "color");
+    mOffsetLocation = glGetUniformLocation(mProgram, "offset");
+    ASSERT_NE(-1, mColorLocation);
+    ASSERT_NE(-1, mOffsetLocation);
+
+    const std::array<GLfloat, 8> vertices = {{-1, -1, 1, -1, 1, 1, -1, 1}};
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices.data(), GL_DYNAMIC_DRAW);
+
+    const std::array<GLushort, 6> indices = {{0, 1, 2, 0, 2, 3}};
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices.data(), GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    ASSERT_GL_NO_ERROR();
+}
+
+void DeferredGLCallsBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void DeferredGLCallsBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    // The calls an application typically makes for each draw: uniform and buffer updates from
+    // client memory, and indexed draws.
+    std::array<GLfloat, 4> color  = {{0.0f, 0.0f, 0.0f, 1.0f}};
+    std::array<GLfloat, 2> offset = {{0.0f, 0.0f}};
+    std::array<GLfloat, 2> corner = {{1.0f, 1.0f}};
+    const float drawCount         = static_cast<float>(params.drawsPerIteration);
+    for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (unsigned int drawIndex = 0; drawIndex < params.drawsPerIteration; ++drawIndex)
+        {
+            const float fraction = static_cast<float>(drawIndex) / drawCount;
+            color[0]             = fraction;
+            offset[0]            = fraction * 2.0f - 1.0f;
+            offset[1]            = 1.0f - fraction * 2.0f;
+            corner[0]            = 1.0f + fraction;
+
+            glUniform4fv(mColorLocation, 1, color.data());
+            glUniform2fv(mOffsetLocation, 1, offset.data());
+            glBufferSubData(GL_ARRAY_BUFFER, 4 * sizeof(GLfloat), sizeof(corner), corner.data());
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+DeferredGLCallsParams VulkanParams(bool deferCalls)
+{
+    DeferredGLCallsParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    if (deferCalls)
+    {
+        params.eglParameters.deferGLCallsFeature = EGL_TRUE;
+    }
+    return params;
+}
+
+TEST_P(DeferredGLCallsBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(DeferredGLCallsBenchmark, VulkanParams(false), VulkanParams(true));
+
+}  // namespace angle
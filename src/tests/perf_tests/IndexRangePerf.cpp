@@ -0,0 +1,128 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing the range of large index buffers.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
+
+using namespace angle;
+
+namespace
+{
+// 4MB of 32-bit indices, which doesn't fit in most caches.
+constexpr size_t kIndexCount = 1024 * 1024;
+
+struct IndexRangePerfParams final
+{
+    std::string story() const
+    {
+        std::stringstream strstr;
+
+        switch (indexType)
+        {
+            case gl::DrawElementsType::UnsignedByte:
+                strstr << "_ubyte";
+                break;
+            case gl::DrawElementsType::UnsignedShort:
+                strstr << "_ushort";
+                break;
+            case gl::DrawElementsType::UnsignedInt:
+                strstr << "_uint";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        if (primitiveRestartEnabled)
+        {
+            strstr << "_primitive_restart";
+        }
+
+        return strstr.str();
+    }
+
+    gl::DrawElementsType indexType;
+    bool primitiveRestartEnabled;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexRangePerfParams &param)
+{
+    stream << param.story().substr(1);
+    return stream;
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangePerfParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mIndexData;
+    size_t mRangeEnd;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", GetParam().story(), 1), mRangeEnd(0)
+{
+    const IndexRangePerfParams &params = GetParam();
+    const size_t indexSize             = gl::GetDrawElementsTypeSize(params.indexType);
+    const GLuint restartIndex          = gl::GetPrimitiveRestartIndex(params.indexType);
+
+    // Strips of consecutive indices that wrap around before reaching the restart index, with a
+    // restart index ending every strip.
+    mIndexData.resize(kIndexCount * indexSize);
+    for (size_t index = 0; index < kIndexCount; ++index)
+    {
+        GLuint value = static_cast<GLuint>(index % restartIndex);
+        if (index % 64 == 63)
+        {
+            value = restartIndex;
+        }
+        memcpy(mIndexData.data() + index * indexSize, &value, indexSize);
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangePerfParams &params = GetParam();
+    gl::IndexRange range = gl::ComputeIndexRange(params.indexType, mIndexData.data(), kIndexCount,
+                                                 params.primitiveRestartEnabled);
+    mRangeEnd += range.end;
+}
+
+IndexRangePerfParams IndexRangeParams(gl::DrawElementsType indexType, bool primitiveRestartEnabled)
+{
+    IndexRangePerfParams params;
+    params.indexType               = indexType;
+    params.primitiveRestartEnabled = primitiveRestartEnabled;
+    return params;
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangePerfTest,
+                         ::testing::Values(
+                             IndexRangeParams(gl::DrawElementsType::UnsignedByte, false),
+                             IndexRangeParams(gl::DrawElementsType::UnsignedByte, true),
+                             IndexRangeParams(gl::DrawElementsType::UnsignedShort, false),
+                             IndexRangeParams(gl::DrawElementsType::UnsignedShort, true),
+                             IndexRangeParams(gl::DrawElementsType::UnsignedInt, false),
+                             IndexRangeParams(gl::DrawElementsType::UnsignedInt, true)));
+}  // anonymous namespace
@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // LinkProgramPerfTest:
-//   Performance tests compiling a lot of shaders.
+//   Performance tests compiling a lot of shaders, and loading programs from the program cache.
 //
 
 #include "ANGLEPerfTest.h"
@@ -18,11 +18,19 @@ using namespace angle;
 
 namespace
 {
+constexpr EGLint kProgramCacheSize     = 1024 * 1024;
+constexpr size_t kLinkManyProgramCount = 16;
 
 enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // Compile and link with the program cache enabled, so linking loads the program binary from
+    // the cache after the first iteration.
+    LoadFromCache,
+    // Link a batch of programs before using any of them, as applications loading many programs at
+    // once do.  The links can run in parallel.
+    LinkMany,
 
     Unspecified
 };
@@ -62,6 +70,14 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::LoadFromCache)
+        {
+            strstr << "_load_from_cache";
+        }
+        else if (taskOption == TaskOption::LinkMany)
+        {
+            strstr << "_link_many";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -101,6 +117,8 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   protected:
+    void linkManyPrograms();
+
     GLuint mVertexBuffer = 0;
 };
 
@@ -113,6 +131,13 @@ void LinkProgramBenchmark::initializeBenchmark()
         glMaxShaderCompilerThreadsKHR(0);
     }
 
+    // The program cache is disabled by default.
+    if (GetParam().taskOption == TaskOption::LoadFromCache)
+    {
+        eglProgramCacheResizeANGLE(eglGetCurrentDisplay(), kProgramCacheSize,
+                                   EGL_PROGRAM_CACHE_RESIZE_ANGLE);
+    }
+
     std::array<Vector3, 6> vertices = {{Vector3(-1.0f, 1.0f, 0.5f), Vector3(-1.0f, -1.0f, 0.5f),
                                         Vector3(1.0f, -1.0f, 0.5f), Vector3(-1.0f, 1.0f, 0.5f),
                                         Vector3(1.0f, -1.0f, 0.5f), Vector3(1.0f, 1.0f, 0.5f)}};
@@ -130,6 +155,12 @@ void LinkProgramBenchmark::destroyBenchmark()
 
 void LinkProgramBenchmark::drawBenchmark()
 {
+    if (GetParam().taskOption == TaskOption::LinkMany)
+    {
+        linkManyPrograms();
+        return;
+    }
+
     static const char *vertexShader =
         "attribute vec2 position;\n"
         "void main() {\n"
@@ -172,6 +203,56 @@ void LinkProgramBenchmark::drawBenchmark()
     glDeleteProgram(program);
 }
 
+void LinkProgramBenchmark::linkManyPrograms()
+{
+    constexpr char kVS[] = R"(attribute vec2 position;
+uniform vec2 offset;
+varying vec2 texCoord;
+void main()
+{
+    texCoord = position * 0.5 + 0.5;
+    gl_Position = vec4(position + offset, 0, 1);
+})";
+
+    std::array<GLuint, kLinkManyProgramCount> programs;
+    for (size_t programIndex = 0; programIndex < kLinkManyProgramCount; ++programIndex)
+    {
+        // Every program is different, so that the links can't share any work.
+        std::stringstream fragmentShader;
+        fragmentShader << "precision mediump float;\n"
+                          "varying vec2 texCoord;\n"
+                          "void main() {\n"
+                          "    gl_FragColor = vec4(texCoord, "
+                       << programIndex << ".0 / " << kLinkManyProgramCount << ".0, 1);\n"
+                       << "}";
+
+        GLuint vs = CompileShader(GL_VERTEX_SHADER, kVS);
+        GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader.str().c_str());
+        ASSERT_NE(0u, vs);
+        ASSERT_NE(0u, fs);
+
+        programs[programIndex] = glCreateProgram();
+        glAttachShader(programs[programIndex], vs);
+        glDeleteShader(vs);
+        glAttachShader(programs[programIndex], fs);
+        glDeleteShader(fs);
+        glLinkProgram(programs[programIndex]);
+    }
+
+    // Using a program waits for its link to finish.
+    for (GLuint program : programs)
+    {
+        glUseProgram(program);
+
+        GLint positionLoc = glGetAttribLocation(program, "position");
+        glVertexAttribPointer(positionLoc, 2, GL_FLOAT, GL_FALSE, 8, nullptr);
+        glEnableVertexAttribArray(positionLoc);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+
+        glDeleteProgram(program);
+    }
+}
+
 using namespace egl_platform;
 
 LinkProgramParams LinkProgramD3D11Params(TaskOption taskOption, ThreadOption threadOption)
@@ -213,6 +294,13 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramVulkanParams(TaskOption::CompileOnly, ThreadOption::SingleThread),
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramD3D11Params(TaskOption::LoadFromCache, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::LoadFromCache, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::LoadFromCache, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::LinkMany, ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::LinkMany, ThreadOption::MultiThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::LinkMany, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::LinkMany, ThreadOption::SingleThread));
 
 }  // anonymous namespace
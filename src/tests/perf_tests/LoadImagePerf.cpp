@@ -0,0 +1,149 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for converting texture data with the load functions.  The image is split
+//   between worker threads the same way the Vulkan back-end splits large texture uploads.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "image_util/loadimage.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+using namespace angle;
+
+namespace
+{
+struct LoadFormat
+{
+    const char *name;
+    rx::LoadImageFunction loadFunction;
+    // The input is made of square blocks, which are single pixels for formats that are not
+    // compressed.
+    size_t inputBlockSize;
+    size_t inputBlockBytes;
+    size_t outputPixelBytes;
+};
+
+const LoadFormat kRGB8ToBGRX8     = {"rgb8_to_bgrx8", LoadRGB8ToBGRX8, 1, 3, 4};
+const LoadFormat kRGB8ToRGBA8     = {"rgb8_to_rgba8", LoadToNative3To4<uint8_t, 0xFF>, 1, 3, 4};
+const LoadFormat kRGB32FToRGBA16F = {"rgb32f_to_rgba16f", LoadRGB32FToRGBA16F, 1, 12, 8};
+const LoadFormat kETC2RGB8ToRGBA8 = {"etc2_rgb8_to_rgba8", LoadETC2RGB8ToRGBA8, 4, 8, 4};
+
+struct LoadImagePerfParams final
+{
+    std::string story() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << format.name << "_" << width << "x" << height << "x" << depth << "_tasks_"
+               << taskCount;
+        return strstr.str();
+    }
+
+    LoadFormat format;
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t taskCount;
+};
+
+std::ostream &operator<<(std::ostream &stream, const LoadImagePerfParams &param)
+{
+    stream << param.story().substr(1);
+    return stream;
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImagePerfParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void step() override;
+
+  private:
+    std::shared_ptr<WorkerThreadPool> mWorkerPool;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest("LoadImagePerf", "", GetParam().story(), 1),
+      mWorkerPool(WorkerThreadPool::Create(GetParam().taskCount > 1))
+{
+    const LoadImagePerfParams &params = GetParam();
+    const LoadFormat &format          = params.format;
+
+    const size_t blockRows = (params.height + format.inputBlockSize - 1) / format.inputBlockSize;
+    const size_t blockColumns = (params.width + format.inputBlockSize - 1) / format.inputBlockSize;
+    mInputRowPitch            = blockColumns * format.inputBlockBytes;
+    mInputDepthPitch          = blockRows * mInputRowPitch;
+    mOutputRowPitch           = params.width * format.outputPixelBytes;
+    mOutputDepthPitch         = params.height * mOutputRowPitch;
+
+    // Any bit pattern is a valid input, including for the compressed formats.
+    mInput.resize(mInputDepthPitch * params.depth);
+    uint32_t seed = 1;
+    for (uint8_t &byte : mInput)
+    {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    mOutput.resize(mOutputDepthPitch * params.depth);
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImagePerfParams &params = GetParam();
+    const LoadFormat &format          = params.format;
+
+    rx::LoadImageParallel(mWorkerPool, params.taskCount, format.loadFunction,
+                          format.inputBlockSize, 1, params.width, params.height, params.depth,
+                          mInput.data(), mInputRowPitch, mInputDepthPitch, mOutput.data(),
+                          mOutputRowPitch, mOutputDepthPitch);
+}
+
+LoadImagePerfParams LoadImageParams(const LoadFormat &format,
+                                    size_t width,
+                                    size_t height,
+                                    size_t depth,
+                                    size_t taskCount)
+{
+    LoadImagePerfParams params;
+    params.format    = format;
+    params.width     = width;
+    params.height    = height;
+    params.depth     = depth;
+    params.taskCount = taskCount;
+    return params;
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+// A single large layer is split in bands of rows, and a texture array in groups of layers.
+INSTANTIATE_TEST_SUITE_P(,
+                         LoadImagePerfTest,
+                         ::testing::Values(LoadImageParams(kRGB8ToBGRX8, 2048, 2048, 1, 1),
+                                           LoadImageParams(kRGB8ToBGRX8, 2048, 2048, 1, 8),
+                                           LoadImageParams(kRGB8ToRGBA8, 2048, 2048, 1, 1),
+                                           LoadImageParams(kRGB8ToRGBA8, 2048, 2048, 1, 8),
+                                           LoadImageParams(kRGB32FToRGBA16F, 2048, 2048, 1, 1),
+                                           LoadImageParams(kRGB32FToRGBA16F, 2048, 2048, 1, 8),
+                                           LoadImageParams(kETC2RGB8ToRGBA8, 2048, 2048, 1, 1),
+                                           LoadImageParams(kETC2RGB8ToRGBA8, 2048, 2048, 1, 8),
+                                           LoadImageParams(kRGB8ToRGBA8, 512, 512, 16, 1),
+                                           LoadImageParams(kRGB8ToRGBA8, 512, 512, 16, 8)));
+}  // anonymous namespace
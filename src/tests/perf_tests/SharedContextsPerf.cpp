@@ -0,0 +1,232 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedContextsPerf:
+//   Performance test for GL calls made on several threads at once, each thread with its own pair
+//   of shared contexts.  The share groups are independent, so as long as there are enough cores
+//   the time per draw call should not grow with the number of threads.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "test_utils/angle_test_platform.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kDrawsPerThread = 1024;
+
+struct SharedContextsParams final : public RenderTestParams
+{
+    SharedContextsParams()
+    {
+        iterationsPerStep = kDrawsPerThread;
+        threadCount       = 1;
+    }
+
+    std::string story() const override;
+
+    size_t threadCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const SharedContextsParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string SharedContextsParams::story() const
+{
+    std::stringstream strstr;
+    strstr << RenderTestParams::story() << "_threads_" << threadCount;
+    return strstr.str();
+}
+
+// The context a thread draws with.  It is shared with a second context, so its GL calls lock the
+// share group.
+struct ShareGroupState
+{
+    EGLContext context       = EGL_NO_CONTEXT;
+    EGLContext sharedContext = EGL_NO_CONTEXT;
+    GLuint program           = 0;
+    GLint offsetLocation     = -1;
+    GLuint texture           = 0;
+    GLuint framebuffer       = 0;
+};
+
+void DrawOnThread(EGLDisplay display, const ShareGroupState &state, unsigned int drawCount)
+{
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, state.context);
+
+    for (unsigned int drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        glUniform1f(state.offsetLocation, static_cast<float>(drawIndex % 2));
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glFinish();
+
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+class SharedContextsBenchmark : public ANGLERenderTest,
+                                public ::testing::WithParamInterface<SharedContextsParams>
+{
+  public:
+    SharedContextsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    EGLWindow *getEGLWindow() { return static_cast<EGLWindow *>(getGLWindow()); }
+    void makeMainContextCurrent();
+
+    std::vector<ShareGroupState> mShareGroups;
+};
+
+SharedContextsBenchmark::SharedContextsBenchmark()
+    : ANGLERenderTest("SharedContexts", GetParam())
+{}
+
+void SharedContextsBenchmark::initializeBenchmark()
+{
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+
+    if (!IsEGLDisplayExtensionEnabled(display, "EGL_KHR_surfaceless_context"))
+    {
+        std::cout << "Test skipped because EGL_KHR_surfaceless_context is not available."
+                  << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    // Degenerate triangles, so the test measures the CPU cost of the calls.
+    constexpr char kVS[] = R"(uniform float offset;
+void main()
+{
+    gl_Position = vec4(offset, 0.0, 0.0, 1.0);
+})";
+
+    mShareGroups.resize(GetParam().threadCount);
+    for (ShareGroupState &state : mShareGroups)
+    {
+        state.context       = window->createContext(EGL_NO_CONTEXT);
+        state.sharedContext = window->createContext(state.context);
+        ASSERT_NE(EGL_NO_CONTEXT, state.context);
+        ASSERT_NE(EGL_NO_CONTEXT, state.sharedContext);
+
+        ASSERT_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, state.context));
+
+        state.program = CompileProgram(kVS, essl1_shaders::fs::Red());
+        ASSERT_NE(0u, state.program);
+        state.offsetLocation = glGetUniformLocation(state.program, "offset");
+        glUseProgram(state.program);
+
+        glGenTextures(1, &state.texture);
+        glBindTexture(GL_TEXTURE_2D, state.texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+        glGenFramebuffers(1, &state.framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, state.framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, state.texture,
+                               0);
+        glViewport(0, 0, 1, 1);
+        ASSERT_GL_NO_ERROR();
+
+        // Let the draw threads make the context current.
+        ASSERT_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    }
+
+    makeMainContextCurrent();
+}
+
+void SharedContextsBenchmark::destroyBenchmark()
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    for (ShareGroupState &state : mShareGroups)
+    {
+        if (state.context == EGL_NO_CONTEXT)
+        {
+            continue;
+        }
+
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, state.context);
+        glDeleteFramebuffers(1, &state.framebuffer);
+        glDeleteTextures(1, &state.texture);
+        glDeleteProgram(state.program);
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        eglDestroyContext(display, state.sharedContext);
+        eglDestroyContext(display, state.context);
+    }
+    mShareGroups.clear();
+
+    makeMainContextCurrent();
+}
+
+void SharedContextsBenchmark::drawBenchmark()
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    std::vector<std::thread> threads;
+    for (const ShareGroupState &state : mShareGroups)
+    {
+        threads.emplace_back(DrawOnThread, display, std::cref(state),
+                             GetParam().iterationsPerStep);
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void SharedContextsBenchmark::makeMainContextCurrent()
+{
+    EGLWindow *window = getEGLWindow();
+    eglMakeCurrent(window->getDisplay(), window->getSurface(), window->getSurface(),
+                   window->getContext());
+}
+
+SharedContextsParams OpenGLOrGLESParams(size_t threadCount)
+{
+    SharedContextsParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+SharedContextsParams VulkanParams(size_t threadCount)
+{
+    SharedContextsParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.threadCount   = threadCount;
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(SharedContextsBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(SharedContextsBenchmark,
+                       OpenGLOrGLESParams(1),
+                       OpenGLOrGLESParams(4),
+                       VulkanParams(1),
+                       VulkanParams(2),
+                       VulkanParams(4),
+                       VulkanParams(8));
@@ -101,6 +101,27 @@ class TextureUploadSubImageBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Fills a texture atlas with many small sub images before drawing, like text rendering does.  The
+// tiles don't overlap, and subImageSize is the size of a tile.
+class TextureUploadAtlasBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadAtlasBenchmark() : TextureUploadBenchmarkBase("TexSubImageAtlas")
+    {
+        addExtensionPrerequisite("GL_EXT_texture_storage");
+    }
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, params.baseSize, params.baseSize);
+    }
+
+    void drawBenchmark() override;
+};
+
 class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -267,6 +288,32 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadAtlasBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        for (GLsizei y = 0; y + params.subImageSize <= params.baseSize; y += params.subImageSize)
+        {
+            for (GLsizei x = 0; x + params.subImageSize <= params.baseSize;
+                 x += params.subImageSize)
+            {
+                glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, params.subImageSize, params.subImageSize,
+                                GL_RGBA, GL_UNSIGNED_BYTE, mTextureData.data());
+            }
+        }
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void TextureUploadFullMipBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -355,6 +402,17 @@ TextureUploadParams VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams AtlasParams(const EGLPlatformParameters &eglParameters,
+                                GLsizei baseSize,
+                                GLsizei subImageSize)
+{
+    TextureUploadParams params;
+    params.eglParameters = eglParameters;
+    params.baseSize      = baseSize;
+    params.subImageSize  = subImageSize;
+    return params;
+}
+
 TextureUploadParams VulkanPBOParams(GLsizei baseSize, GLsizei subImageSize)
 {
     TextureUploadParams params;
@@ -386,6 +444,11 @@ TEST_P(TextureUploadSubImageBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadAtlasBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(TextureUploadFullMipBenchmark, Run)
 {
     run();
@@ -412,6 +475,12 @@ ANGLE_INSTANTIATE_TEST(TextureUploadSubImageBenchmark,
                        NullDevice(VulkanParams(false)),
                        VulkanParams(true));
 
+// 1024 16x16 tiles per atlas.
+ANGLE_INSTANTIATE_TEST(TextureUploadAtlasBenchmark,
+                       AtlasParams(egl_platform::OPENGL_OR_GLES(), 512, 16),
+                       AtlasParams(egl_platform::VULKAN(), 512, 16),
+                       NullDevice(AtlasParams(egl_platform::VULKAN(), 512, 16)));
+
 ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        D3D11Params(false),
                        D3D11Params(true),
@@ -18,6 +18,9 @@
 namespace angle
 {
 constexpr unsigned int kIterationsPerStep = 256;
+// Textures the churning draws pick from.  Enough that combinations almost never repeat, so nearly
+// every draw writes a new texture descriptor set.
+constexpr size_t kChurnTexturePoolSize = 64;
 
 struct TexturesParams final : public RenderTestParams
 {
@@ -36,7 +39,8 @@ struct TexturesParams final : public RenderTestParams
         textureStateUpdateFrequency = 3;
         textureMipCount             = 8;
 
-        webgl = false;
+        webgl        = false;
+        textureChurn = false;
     }
 
     std::string story() const override;
@@ -46,6 +50,9 @@ struct TexturesParams final : public RenderTestParams
     size_t textureMipCount;
 
     bool webgl;
+
+    // Bind a random set of textures to every unit before each draw instead of swapping two.
+    bool textureChurn;
 };
 
 std::ostream &operator<<(std::ostream &os, const TexturesParams &params)
@@ -69,6 +76,16 @@ std::string TexturesParams::story() const
         strstr << "_webgl";
     }
 
+    if (textureChurn)
+    {
+        strstr << "_churn";
+    }
+
+    if (eglParameters.descriptorUpdateTemplatesFeatureVulkan == EGL_TRUE)
+    {
+        strstr << "_descriptor_update_templates";
+    }
+
     return strstr.str();
 }
 
@@ -86,10 +103,14 @@ class TexturesBenchmark : public ANGLERenderTest,
     void initShaders();
     void initTextures();
 
+    void bindChurnTextures();
+
     std::vector<GLuint> mTextures;
 
     GLuint mProgram;
     std::vector<GLuint> mUniformLocations;
+
+    std::minstd_rand mChurnRandom;
 };
 
 TexturesBenchmark::TexturesBenchmark() : ANGLERenderTest("Textures", GetParam()), mProgram(0u)
@@ -179,12 +200,13 @@ void TexturesBenchmark::initTextures()
         byte = rand() % 255u;
     }
 
-    for (size_t texIndex = 0; texIndex < params.numTextures; texIndex++)
+    const size_t textureCount = params.textureChurn ? kChurnTexturePoolSize : params.numTextures;
+    for (size_t texIndex = 0; texIndex < textureCount; texIndex++)
     {
         GLuint tex = 0;
         glGenTextures(1, &tex);
 
-        glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + texIndex));
+        glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + texIndex % params.numTextures));
         glBindTexture(GL_TEXTURE_2D, tex);
         for (size_t mip = 0; mip < params.textureMipCount; mip++)
         {
@@ -193,7 +215,10 @@ void TexturesBenchmark::initTextures()
                          GL_RGBA, GL_UNSIGNED_BYTE, textureData.data());
         }
         mTextures.push_back(tex);
+    }
 
+    for (size_t texIndex = 0; texIndex < params.numTextures; texIndex++)
+    {
         glUniform1i(mUniformLocations[texIndex], static_cast<GLint>(texIndex));
     }
 }
@@ -203,13 +228,29 @@ void TexturesBenchmark::destroyBenchmark()
     glDeleteProgram(mProgram);
 }
 
+void TexturesBenchmark::bindChurnTextures()
+{
+    const auto &params = GetParam();
+
+    std::uniform_int_distribution<size_t> textureDistribution(0, mTextures.size() - 1);
+    for (size_t unit = 0; unit < params.numTextures; ++unit)
+    {
+        glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + unit));
+        glBindTexture(GL_TEXTURE_2D, mTextures[textureDistribution(mChurnRandom)]);
+    }
+}
+
 void TexturesBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
 
     for (size_t it = 0; it < params.iterationsPerStep; ++it)
     {
-        if (it % params.textureRebindFrequency == 0)
+        if (params.textureChurn)
+        {
+            bindChurnTextures();
+        }
+        else if (it % params.textureRebindFrequency == 0)
         {
             // Swap two textures
             size_t swapTexture = (it / params.textureRebindFrequency) % (params.numTextures - 1);
@@ -312,6 +353,20 @@ TexturesParams VulkanParams(bool webglCompat, bool frequentUpdate)
     return params;
 }
 
+// Each iteration is a single draw and the null device does no GPU work, so the reported time is
+// the CPU time per draw.
+TexturesParams VulkanChurnParams(bool descriptorUpdateTemplates)
+{
+    TexturesParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.textureChurn  = true;
+    if (descriptorUpdateTemplates)
+    {
+        params.eglParameters.descriptorUpdateTemplatesFeatureVulkan = EGL_TRUE;
+    }
+    return params;
+}
+
 TEST_P(TexturesBenchmark, Run)
 {
     run();
@@ -329,5 +384,7 @@ ANGLE_INSTANTIATE_TEST(TexturesBenchmark,
                        VulkanParams(false, false),
                        VulkanParams(true, false),
                        VulkanParams(false, true),
-                       VulkanParams(true, true));
+                       VulkanParams(true, true),
+                       VulkanChurnParams(false),
+                       VulkanChurnParams(true));
 }  // namespace angle
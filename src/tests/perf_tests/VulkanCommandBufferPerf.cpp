@@ -6,12 +6,21 @@
 //   Performance benchmark for Vulkan Primary/Secondary Command Buffer implementations.
 //  Can run just these tests by adding "--gtest_filter=VulkanCommandBufferPerfTest*"
 //   option to angle_white_box_perftests.
+//  VulkanCommandQueuePerfTest compares the task queue schemes used to feed the asynchronous
+//   command processor thread, with several producer threads.
 //  When running on Android with run_angle_white_box_perftests, use "-v" option.
 
 #include "ANGLEPerfTest.h"
+#include "common/BoundedMPSCQueue.h"
 #include "common/platform.h"
 #include "test_utils/third_party/vulkan_command_buffer_utils.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+
 #if defined(ANDROID)
 #    define NUM_CMD_BUFFERS 1000
 // Android devices tend to be slower so only do 10 frames to avoid timeout
@@ -648,3 +657,194 @@ INSTANTIATE_TEST_SUITE_P(,
                                            CommandBufferExplicitHardResetParams(),
                                            CommandBufferExplicitSoftResetParams(),
                                            CommandBufferImplicitResetParams()));
+
+// Compares the mutex and condition variable protected std::queue that CommandProcessor used to
+// hand tasks to its worker thread against the lock-free BoundedMPSCQueue it uses now.  Each step,
+// every producer thread queues kTasksPerProducer tasks which the test thread consumes.  The queues
+// are measured on their own: CommandProcessor serializes its producers with
+// RendererVk::mCommandQueueMutex, so only the single producer results apply to it.
+constexpr uint32_t kTasksPerProducer = 10000;
+// Matches the queue size of CommandProcessor.
+constexpr size_t kTaskQueueSize = 256;
+// Number of times the consumer polls an empty queue before parking.
+constexpr uint32_t kConsumerSpinCount = 100;
+
+// Roughly the size of the smaller CommandProcessorTasks.
+struct QueueTestTask
+{
+    uint64_t payload[8];
+};
+
+struct CommandQueueTestParams
+{
+    bool lockFree;
+    uint32_t producerCount;
+    std::string story;
+};
+
+class VulkanCommandQueuePerfTest : public ANGLEPerfTest,
+                                   public ::testing::WithParamInterface<CommandQueueTestParams>
+{
+  public:
+    VulkanCommandQueuePerfTest();
+
+    void step() override;
+
+  private:
+    void produceMutex(uint32_t producerIndex);
+    uint64_t consumeMutex(uint32_t taskCount);
+
+    void produceLockFree(uint32_t producerIndex);
+    uint64_t consumeLockFree(uint32_t taskCount);
+
+    // Mutex path.
+    std::queue<QueueTestTask> mMutexTasks;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+
+    // Lock-free path.
+    angle::BoundedMPSCQueue<QueueTestTask, kTaskQueueSize> mLockFreeTasks;
+    std::atomic<bool> mConsumerParked;
+};
+
+VulkanCommandQueuePerfTest::VulkanCommandQueuePerfTest()
+    : ANGLEPerfTest("VulkanCommandQueuePerfTest", "", GetParam().story, 1), mConsumerParked(false)
+{}
+
+void VulkanCommandQueuePerfTest::produceMutex(uint32_t producerIndex)
+{
+    for (uint32_t taskIndex = 0; taskIndex < kTasksPerProducer; ++taskIndex)
+    {
+        QueueTestTask task = {};
+        task.payload[0]    = producerIndex;
+        task.payload[1]    = taskIndex;
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mMutexTasks.emplace(std::move(task));
+        mWorkAvailableCondition.notify_one();
+    }
+}
+
+uint64_t VulkanCommandQueuePerfTest::consumeMutex(uint32_t taskCount)
+{
+    uint64_t checksum = 0;
+    for (uint32_t consumed = 0; consumed < taskCount; ++consumed)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkAvailableCondition.wait(lock, [this] { return !mMutexTasks.empty(); });
+        QueueTestTask task(std::move(mMutexTasks.front()));
+        mMutexTasks.pop();
+        lock.unlock();
+
+        checksum += task.payload[1];
+    }
+    return checksum;
+}
+
+void VulkanCommandQueuePerfTest::produceLockFree(uint32_t producerIndex)
+{
+    for (uint32_t taskIndex = 0; taskIndex < kTasksPerProducer; ++taskIndex)
+    {
+        QueueTestTask task = {};
+        task.payload[0]    = producerIndex;
+        task.payload[1]    = taskIndex;
+
+        while (!mLockFreeTasks.tryPush(std::move(task)))
+        {
+            std::this_thread::yield();
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mConsumerParked.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mWorkAvailableCondition.notify_one();
+        }
+    }
+}
+
+uint64_t VulkanCommandQueuePerfTest::consumeLockFree(uint32_t taskCount)
+{
+    uint64_t checksum = 0;
+    for (uint32_t consumed = 0; consumed < taskCount; ++consumed)
+    {
+        QueueTestTask task;
+        uint32_t spinCount = 0;
+        while (!mLockFreeTasks.tryPop(&task))
+        {
+            if (spinCount++ < kConsumerSpinCount || !mLockFreeTasks.empty())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mMutex);
+            mConsumerParked.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            mWorkAvailableCondition.wait(lock, [this] { return !mLockFreeTasks.empty(); });
+            mConsumerParked.store(false);
+        }
+
+        checksum += task.payload[1];
+    }
+    return checksum;
+}
+
+void VulkanCommandQueuePerfTest::step()
+{
+    const CommandQueueTestParams &params = GetParam();
+    const uint32_t taskCount             = params.producerCount * kTasksPerProducer;
+
+    std::vector<std::thread> producers;
+    for (uint32_t producerIndex = 0; producerIndex < params.producerCount; ++producerIndex)
+    {
+        if (params.lockFree)
+        {
+            producers.emplace_back(&VulkanCommandQueuePerfTest::produceLockFree, this,
+                                   producerIndex);
+        }
+        else
+        {
+            producers.emplace_back(&VulkanCommandQueuePerfTest::produceMutex, this, producerIndex);
+        }
+    }
+
+    const uint64_t checksum =
+        params.lockFree ? consumeLockFree(taskCount) : consumeMutex(taskCount);
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    const uint64_t tasksPerProducer = kTasksPerProducer;
+    const uint64_t expectedChecksum =
+        params.producerCount * tasksPerProducer * (tasksPerProducer - 1) / 2;
+    ASSERT_EQ(expectedChecksum, checksum);
+}
+
+CommandQueueTestParams CommandQueueParams(bool lockFree, uint32_t producerCount)
+{
+    CommandQueueTestParams params;
+    params.lockFree      = lockFree;
+    params.producerCount = producerCount;
+    params.story         = lockFree ? "_LockFree" : "_Mutex";
+    params.story += "_" + std::to_string(producerCount) + "_Producers";
+    return params;
+}
+
+TEST_P(VulkanCommandQueuePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanCommandQueuePerfTest,
+                         ::testing::Values(CommandQueueParams(false, 1),
+                                           CommandQueueParams(true, 1),
+                                           CommandQueueParams(false, 2),
+                                           CommandQueueParams(true, 2),
+                                           CommandQueueParams(false, 4),
+                                           CommandQueueParams(true, 4),
+                                           CommandQueueParams(false, 8),
+                                           CommandQueueParams(true, 8)));
@@ -43,7 +43,7 @@ VulkanPipelineCachePerfTest::VulkanPipelineCachePerfTest()
 
 VulkanPipelineCachePerfTest::~VulkanPipelineCachePerfTest()
 {
-    mCache.destroy(VK_NULL_HANDLE);
+    mCache.destroy(nullptr);
 }
 
 void VulkanPipelineCachePerfTest::SetUp()
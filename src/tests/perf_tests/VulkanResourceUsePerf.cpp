@@ -0,0 +1,108 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanResourceUsePerf:
+//   Performance benchmark for the Vulkan back-end's resource lifetime tracking.  Each step creates
+//   a frame's worth of short-lived resources, uses them in a submission and turns them into
+//   garbage, then retires the garbage of the frame that just completed on the simulated GPU.
+
+#include "ANGLEPerfTest.h"
+
+#include <deque>
+#include <sstream>
+
+#include "libANGLE/renderer/vulkan/ResourceVk.h"
+
+using namespace rx;
+
+namespace
+{
+constexpr size_t kResourcesPerFrame = 10000;
+
+struct ResourceUsePerfParams
+{
+    std::string story() const
+    {
+        std::stringstream strstr;
+        strstr << "_frames_in_flight_" << framesInFlight;
+        return strstr.str();
+    }
+
+    // Frames of garbage that are waiting for the GPU at any time.
+    size_t framesInFlight;
+};
+
+std::ostream &operator<<(std::ostream &stream, const ResourceUsePerfParams &param)
+{
+    stream << param.story().substr(1);
+    return stream;
+}
+
+class VulkanResourceUsePerfTest : public ANGLEPerfTest,
+                                  public ::testing::WithParamInterface<ResourceUsePerfParams>
+{
+  public:
+    VulkanResourceUsePerfTest();
+
+    void TearDown() override;
+    void step() override;
+
+  private:
+    SerialFactory mSerialFactory;
+    std::deque<Serial> mSubmittedSerials;
+    vk::ResourceUseList mResourceUseList;
+    vk::SharedGarbageList mGarbageList;
+};
+
+VulkanResourceUsePerfTest::VulkanResourceUsePerfTest()
+    : ANGLEPerfTest("VulkanResourceUsePerf", "", GetParam().story(), 1)
+{}
+
+void VulkanResourceUsePerfTest::TearDown()
+{
+    // The garbage holds no Vulkan objects, so no renderer is needed to destroy it.
+    mGarbageList.cleanup(nullptr, Serial::Infinite());
+    ANGLEPerfTest::TearDown();
+}
+
+void VulkanResourceUsePerfTest::step()
+{
+    for (size_t index = 0; index < kResourcesPerFrame; ++index)
+    {
+        vk::SharedResourceUse use;
+        use.init();
+        mResourceUseList.add(use);
+
+        // Deleted while still referenced by the unsubmitted commands.
+        mGarbageList.add(vk::SharedGarbage(std::move(use), {}));
+    }
+
+    const Serial serial = mSerialFactory.generate();
+    mResourceUseList.releaseResourceUsesAndUpdateSerials(serial);
+    mSubmittedSerials.push_back(serial);
+
+    if (mSubmittedSerials.size() > GetParam().framesInFlight)
+    {
+        mGarbageList.cleanup(nullptr, mSubmittedSerials.front());
+        mSubmittedSerials.pop_front();
+    }
+}
+
+ResourceUsePerfParams FramesInFlightParams(size_t framesInFlight)
+{
+    ResourceUsePerfParams params;
+    params.framesInFlight = framesInFlight;
+    return params;
+}
+
+TEST_P(VulkanResourceUsePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanResourceUsePerfTest,
+                         ::testing::Values(FramesInFlightParams(2), FramesInFlightParams(32)));
+}  // anonymous namespace
@@ -0,0 +1,185 @@
+//
+// Copyright 2020 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanSecondaryCommandBufferPerf:
+//   Performance benchmark for recording into ANGLE's CPU-side SecondaryCommandBuffer.  Each step
+//   records a render pass worth of commands with a typical draw call command mix and resets the
+//   command buffer, the same way CommandBufferHelper reuses it frame after frame.
+
+#include "ANGLEPerfTest.h"
+
+#include "common/PoolAlloc.h"
+#include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+using namespace rx;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+// Matches the page size CommandBufferHelper uses for its pool allocator.
+constexpr size_t kPoolAllocatorPageSize = 16 * 1024;
+
+enum class CommandMix
+{
+    // A pipeline bound once followed by non-indexed draws.
+    DrawsOnly,
+    // Per draw descriptor set, vertex buffer and push constant updates and an indexed draw.
+    StateChanges,
+    // StateChanges, plus a pipeline and index buffer change with every draw.
+    PipelineChanges,
+};
+
+struct SecondaryCommandBufferParams
+{
+    CommandMix mix;
+    uint32_t drawCount;
+    std::string story;
+};
+
+class VulkanSecondaryCommandBufferPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<SecondaryCommandBufferParams>
+{
+  public:
+    VulkanSecondaryCommandBufferPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    void recordRenderPass();
+
+    angle::PoolAllocator mAllocator;
+    vk::priv::SecondaryCommandBuffer mCommandBuffer;
+
+    vk::Pipeline mPipeline;
+    vk::PipelineLayout mPipelineLayout;
+    vk::Buffer mIndexBuffer;
+
+    // Statistics of the last recorded render pass.
+    size_t mBytesRecorded;
+    size_t mBlocksUsed;
+    size_t mNewBlocks;
+};
+
+VulkanSecondaryCommandBufferPerfTest::VulkanSecondaryCommandBufferPerfTest()
+    : ANGLEPerfTest("VulkanSecondaryCommandBufferPerf", "", GetParam().story, kIterationsPerStep),
+      mBytesRecorded(0),
+      mBlocksUsed(0),
+      mNewBlocks(0)
+{}
+
+void VulkanSecondaryCommandBufferPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    mAllocator.initialize(kPoolAllocatorPageSize, 1);
+    mAllocator.push();
+    mCommandBuffer.initialize(&mAllocator);
+
+    mReporter->RegisterFyiMetric(".bytes_recorded", "sizeInBytes");
+    mReporter->RegisterFyiMetric(".blocks_used", "count");
+    mReporter->RegisterFyiMetric(".new_blocks", "count");
+}
+
+void VulkanSecondaryCommandBufferPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+    mReporter->AddResult(".bytes_recorded", mBytesRecorded);
+    mReporter->AddResult(".blocks_used", mBlocksUsed);
+    mReporter->AddResult(".new_blocks", mNewBlocks);
+}
+
+void VulkanSecondaryCommandBufferPerfTest::recordRenderPass()
+{
+    const SecondaryCommandBufferParams &params = GetParam();
+
+    // The handles are never used with a device, only recorded.
+    const VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    const VkBuffer vertexBuffers[2]     = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    const float pushConstants[4]        = {};
+    const VkRect2D scissor              = {{0, 0}, {256, 256}};
+
+    mCommandBuffer.bindGraphicsPipeline(mPipeline);
+    mCommandBuffer.setScissor(0, 1, &scissor);
+    if (params.mix != CommandMix::DrawsOnly)
+    {
+        mCommandBuffer.bindIndexBuffer(mIndexBuffer, 0, VK_INDEX_TYPE_UINT16);
+    }
+
+    for (uint32_t drawIndex = 0; drawIndex < params.drawCount; ++drawIndex)
+    {
+        if (params.mix == CommandMix::DrawsOnly)
+        {
+            mCommandBuffer.draw(6, drawIndex * 6);
+            continue;
+        }
+
+        if (params.mix == CommandMix::PipelineChanges)
+        {
+            mCommandBuffer.bindGraphicsPipeline(mPipeline);
+            mCommandBuffer.bindIndexBuffer(mIndexBuffer, drawIndex * 12, VK_INDEX_TYPE_UINT16);
+        }
+
+        const VkDeviceSize vertexOffsets[2] = {drawIndex * 64u, drawIndex * 32u};
+        const uint32_t dynamicOffset        = drawIndex * 256;
+        mCommandBuffer.bindDescriptorSets(mPipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                          DescriptorSetIndex::UniformsAndXfb, 1, &descriptorSet,
+                                          1, &dynamicOffset);
+        mCommandBuffer.bindVertexBuffers(0, 2, vertexBuffers, vertexOffsets);
+        mCommandBuffer.pushConstants(mPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                     sizeof(pushConstants), pushConstants);
+        mCommandBuffer.drawIndexed(6);
+    }
+}
+
+void VulkanSecondaryCommandBufferPerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        recordRenderPass();
+        mCommandBuffer.getRecordingStats(&mBytesRecorded, &mBlocksUsed, &mNewBlocks);
+        mCommandBuffer.reset();
+    }
+}
+
+SecondaryCommandBufferParams CommandMixParams(CommandMix mix, uint32_t drawCount)
+{
+    SecondaryCommandBufferParams params;
+    params.mix       = mix;
+    params.drawCount = drawCount;
+
+    switch (mix)
+    {
+        case CommandMix::DrawsOnly:
+            params.story = "_DrawsOnly";
+            break;
+        case CommandMix::StateChanges:
+            params.story = "_StateChanges";
+            break;
+        case CommandMix::PipelineChanges:
+            params.story = "_PipelineChanges";
+            break;
+    }
+    params.story += "_" + std::to_string(drawCount) + "_Draws";
+    return params;
+}
+}  // anonymous namespace
+
+TEST_P(VulkanSecondaryCommandBufferPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanSecondaryCommandBufferPerfTest,
+                         ::testing::Values(CommandMixParams(CommandMix::DrawsOnly, 10),
+                                           CommandMixParams(CommandMix::DrawsOnly, 1000),
+                                           CommandMixParams(CommandMix::StateChanges, 10),
+                                           CommandMixParams(CommandMix::StateChanges, 1000),
+                                           CommandMixParams(CommandMix::PipelineChanges, 10),
+                                           CommandMixParams(CommandMix::PipelineChanges, 1000)));
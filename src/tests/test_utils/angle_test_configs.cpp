@@ -239,6 +239,31 @@ std::ostream &operator<<(std::ostream &stream, const PlatformParameters &pp)
         stream << "_AsyncQueue";
     }
 
+    if (pp.eglParameters.asyncPipelineCompilationFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_AsyncPipelineCompilation";
+    }
+
+    if (pp.eglParameters.parallelRenderPassCommandRecordingFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_ParallelRenderPassCommandRecording";
+    }
+
+    if (pp.eglParameters.descriptorUpdateTemplatesFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_DescriptorUpdateTemplates";
+    }
+
+    if (pp.eglParameters.warmUpPipelinesFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_WarmUpPipelines";
+    }
+
+    if (pp.eglParameters.parallelTextureLoadFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_ParallelTextureLoad";
+    }
+
     if (pp.eglParameters.hasExplicitMemBarrierFeatureMtl == EGL_FALSE)
     {
         stream << "_NoMetalExplicitMemoryBarrier";
@@ -254,6 +279,11 @@ std::ostream &operator<<(std::ostream &stream, const PlatformParameters &pp)
         stream << "_ForceMetalBufferGPUStorage";
     }
 
+    if (pp.eglParameters.deferGLCallsFeature == EGL_TRUE)
+    {
+        stream << "_DeferGLCalls";
+    }
+
     return stream;
 }
 
@@ -281,6 +281,50 @@ inline PlatformParameters WithAsyncCommandQueueFeatureVulkan(const PlatformParam
     withAsyncCommandQueue.eglParameters.asyncCommandQueueFeatureVulkan = EGL_TRUE;
     return withAsyncCommandQueue;
 }
+
+inline PlatformParameters WithAsyncPipelineCompilationFeatureVulkan(const PlatformParameters &params)
+{
+    PlatformParameters withAsyncCompilation                                  = params;
+    withAsyncCompilation.eglParameters.asyncPipelineCompilationFeatureVulkan = EGL_TRUE;
+    return withAsyncCompilation;
+}
+
+inline PlatformParameters WithParallelRenderPassCommandRecordingFeatureVulkan(
+    const PlatformParameters &params)
+{
+    PlatformParameters withParallelRecording = params;
+    withParallelRecording.eglParameters.parallelRenderPassCommandRecordingFeatureVulkan = EGL_TRUE;
+    return withParallelRecording;
+}
+
+inline PlatformParameters WithDescriptorUpdateTemplatesFeatureVulkan(
+    const PlatformParameters &params)
+{
+    PlatformParameters withTemplates                                   = params;
+    withTemplates.eglParameters.descriptorUpdateTemplatesFeatureVulkan = EGL_TRUE;
+    return withTemplates;
+}
+
+inline PlatformParameters WithWarmUpPipelinesFeatureVulkan(const PlatformParameters &params)
+{
+    PlatformParameters withWarmUp                         = params;
+    withWarmUp.eglParameters.warmUpPipelinesFeatureVulkan = EGL_TRUE;
+    return withWarmUp;
+}
+
+inline PlatformParameters WithParallelTextureLoadFeatureVulkan(const PlatformParameters &params)
+{
+    PlatformParameters withParallelLoad                             = params;
+    withParallelLoad.eglParameters.parallelTextureLoadFeatureVulkan = EGL_TRUE;
+    return withParallelLoad;
+}
+
+inline PlatformParameters WithDeferGLCallsFeature(const PlatformParameters &params)
+{
+    PlatformParameters withDeferredCalls                = params;
+    withDeferredCalls.eglParameters.deferGLCallsFeature = EGL_TRUE;
+    return withDeferredCalls;
+}
 }  // namespace angle
 
 #endif  // ANGLE_TEST_CONFIGS_H_
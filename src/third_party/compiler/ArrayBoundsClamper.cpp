@@ -25,6 +25,7 @@
 
 #include "third_party/compiler/ArrayBoundsClamper.h"
 
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
 // The built-in 'clamp' instruction only accepts floats and returns a float.  I
@@ -96,6 +97,20 @@ void ArrayBoundsClamper::MarkIndirectArrayBoundsForClamping(TIntermNode *root)
     }
 }
 
+void ArrayBoundsClamper::MarkIndirectArrayBoundsForClamping(PassManager *passManager)
+{
+    auto marker                       = std::make_unique<ArrayBoundsClamperMarker>();
+    ArrayBoundsClamperMarker *clamper = marker.get();
+    passManager->queueTraversal("MarkIndirectArrayBoundsForClamping", std::move(marker),
+                                PassManager::kAllAnalyses, [this, clamper]() {
+                                    if (clamper->GetNeedsClamp())
+                                    {
+                                        SetArrayBoundsClampDefinitionNeeded();
+                                    }
+                                    return true;
+                                });
+}
+
 void ArrayBoundsClamper::OutputClampingFunctionDefinition(TInfoSinkBase &out) const
 {
     if (!mArrayBoundsClampDefinitionNeeded)
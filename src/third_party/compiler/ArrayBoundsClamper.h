@@ -32,6 +32,8 @@
 namespace sh
 {
 
+class PassManager;
+
 class ArrayBoundsClamper
 {
   public:
@@ -44,6 +46,8 @@ class ArrayBoundsClamper
     // Marks nodes in the tree that index arrays indirectly as
     // requiring clamping.
     void MarkIndirectArrayBoundsForClamping(TIntermNode *root);
+    // Same, but queues the traversal in the pass manager.
+    void MarkIndirectArrayBoundsForClamping(PassManager *passManager);
 
     // If necessary, output array clamp function source into the shader source.
     void OutputClampingFunctionDefinition(TInfoSinkBase &out) const;
@@ -228,6 +228,31 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         enabledFeatureOverrides.push_back("asynchronousCommandProcessing");
     }
 
+    if (params.asyncPipelineCompilationFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("asyncGraphicsPipelineCompilation");
+    }
+
+    if (params.parallelRenderPassCommandRecordingFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("parallelRenderPassCommandRecording");
+    }
+
+    if (params.descriptorUpdateTemplatesFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("useDescriptorUpdateTemplates");
+    }
+
+    if (params.warmUpPipelinesFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("warmUpGraphicsPipelines");
+    }
+
+    if (params.parallelTextureLoadFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("parallelTextureLoad");
+    }
+
     if (params.hasExplicitMemBarrierFeatureMtl == EGL_FALSE)
     {
         disabledFeatureOverrides.push_back("has_explicit_mem_barrier_mtl");
@@ -243,6 +268,11 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         enabledFeatureOverrides.push_back("force_buffer_gpu_storage_mtl");
     }
 
+    if (params.deferGLCallsFeature == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("defer_gl_calls");
+    }
+
     const bool hasFeatureControlANGLE =
         strstr(extensionString, "EGL_ANGLE_feature_control") != nullptr;
 